@@ -0,0 +1,427 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/runtime/CMakeLists.txt"
+  "/root/repo/cmake/code_coverage.cmake"
+  "/root/repo/cmake/compiler_options.cmake"
+  "/root/repo/cmake/compiler_warnings.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/experimental/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/algorithm/CMakeLists.txt"
+  "/root/repo/tests/array/CMakeLists.txt"
+  "/root/repo/tests/bit/CMakeLists.txt"
+  "/root/repo/tests/bitset/CMakeLists.txt"
+  "/root/repo/tests/cctype/CMakeLists.txt"
+  "/root/repo/tests/cfloat/CMakeLists.txt"
+  "/root/repo/tests/charconv/CMakeLists.txt"
+  "/root/repo/tests/chrono/CMakeLists.txt"
+  "/root/repo/tests/cmath/CMakeLists.txt"
+  "/root/repo/tests/complex/CMakeLists.txt"
+  "/root/repo/tests/concepts/CMakeLists.txt"
+  "/root/repo/tests/coroutine/CMakeLists.txt"
+  "/root/repo/tests/cstdarg/CMakeLists.txt"
+  "/root/repo/tests/cstddef/CMakeLists.txt"
+  "/root/repo/tests/cstdint/CMakeLists.txt"
+  "/root/repo/tests/cstdlib/CMakeLists.txt"
+  "/root/repo/tests/cstring/CMakeLists.txt"
+  "/root/repo/tests/exception/CMakeLists.txt"
+  "/root/repo/tests/expected/CMakeLists.txt"
+  "/root/repo/tests/experimental/freertos/CMakeLists.txt"
+  "/root/repo/tests/experimental/meta/CMakeLists.txt"
+  "/root/repo/tests/experimental/net/CMakeLists.txt"
+  "/root/repo/tests/experimental/stm32/CMakeLists.txt"
+  "/root/repo/tests/experimental/strong_type/CMakeLists.txt"
+  "/root/repo/tests/experimental/testing/CMakeLists.txt"
+  "/root/repo/tests/experimental/trace/CMakeLists.txt"
+  "/root/repo/tests/fixed_point/CMakeLists.txt"
+  "/root/repo/tests/flat_set/CMakeLists.txt"
+  "/root/repo/tests/format/CMakeLists.txt"
+  "/root/repo/tests/functional/CMakeLists.txt"
+  "/root/repo/tests/ios/CMakeLists.txt"
+  "/root/repo/tests/iterator/CMakeLists.txt"
+  "/root/repo/tests/limits/CMakeLists.txt"
+  "/root/repo/tests/linalg/CMakeLists.txt"
+  "/root/repo/tests/map/CMakeLists.txt"
+  "/root/repo/tests/mdspan/CMakeLists.txt"
+  "/root/repo/tests/memory/CMakeLists.txt"
+  "/root/repo/tests/mutex/CMakeLists.txt"
+  "/root/repo/tests/numbers/CMakeLists.txt"
+  "/root/repo/tests/numeric/CMakeLists.txt"
+  "/root/repo/tests/optional/CMakeLists.txt"
+  "/root/repo/tests/random/CMakeLists.txt"
+  "/root/repo/tests/ratio/CMakeLists.txt"
+  "/root/repo/tests/scope/CMakeLists.txt"
+  "/root/repo/tests/set/CMakeLists.txt"
+  "/root/repo/tests/simd/CMakeLists.txt"
+  "/root/repo/tests/span/CMakeLists.txt"
+  "/root/repo/tests/stack/CMakeLists.txt"
+  "/root/repo/tests/stdexcept/CMakeLists.txt"
+  "/root/repo/tests/string/CMakeLists.txt"
+  "/root/repo/tests/string_view/CMakeLists.txt"
+  "/root/repo/tests/tuple/CMakeLists.txt"
+  "/root/repo/tests/type_traits/CMakeLists.txt"
+  "/root/repo/tests/utility/CMakeLists.txt"
+  "/root/repo/tests/variant/CMakeLists.txt"
+  "/root/repo/tests/vector/CMakeLists.txt"
+  "/root/repo/tests/version/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/algorithm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/array/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/bit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/bitset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cctype/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cfloat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/charconv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/chrono/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cmath/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/complex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/concepts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/coroutine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cstdarg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cstddef/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cstdint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cstdlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/cstring/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/exception/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/expected/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/fixed_point/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/flat_set/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/format/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/functional/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ios/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/iterator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/limits/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/linalg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/map/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/mdspan/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/mutex/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/numbers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/numeric/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/optional/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/random/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ratio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/scope/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/set/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/simd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/span/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/stack/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/stdexcept/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/string/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/string_view/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/tuple/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/type_traits/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/variant/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/vector/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/freertos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/meta/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/stm32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/strong_type/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/testing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/experimental/trace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/experimental/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/runtime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_all_of.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_binary_search.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_copy.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_count.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_equal.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_equal_range.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_fill.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_find.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_for_each.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_generate.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_includes.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_lower_bound.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_merge.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_minmax.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_misc.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_mismatch.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_move.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_partition.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_remove.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_replace.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_reverse.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_rotate.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_search.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_set_difference.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_shift.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_sort.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_swap_ranges.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_transform.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_unique.dir/DependInfo.cmake"
+  "tests/algorithm/CMakeFiles/test_algorithm_upper_bound.dir/DependInfo.cmake"
+  "tests/array/CMakeFiles/test_array_array.dir/DependInfo.cmake"
+  "tests/bit/CMakeFiles/test_bit_bit_cast.dir/DependInfo.cmake"
+  "tests/bit/CMakeFiles/test_bit_bit_functions.dir/DependInfo.cmake"
+  "tests/bit/CMakeFiles/test_bit_byteswap.dir/DependInfo.cmake"
+  "tests/bitset/CMakeFiles/test_bitset_bitset.dir/DependInfo.cmake"
+  "tests/cctype/CMakeFiles/test_cctype_cctype.dir/DependInfo.cmake"
+  "tests/cfloat/CMakeFiles/test_cfloat_half.dir/DependInfo.cmake"
+  "tests/charconv/CMakeFiles/test_charconv_charconv.dir/DependInfo.cmake"
+  "tests/chrono/CMakeFiles/test_chrono_calender.dir/DependInfo.cmake"
+  "tests/chrono/CMakeFiles/test_chrono_duration.dir/DependInfo.cmake"
+  "tests/chrono/CMakeFiles/test_chrono_time_point.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_abs.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_acos.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_acosh.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_asin.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_asinh.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_atan.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_atanh.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_beta.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_ceil.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_copysign.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_cos.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_cosh.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_erf.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_exp.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_floor.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_fma.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_isfinite.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_isinf.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_isnan.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_kernel.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_lerp.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_nextafter.dir/DependInfo.cmake"
+  "tests/cmath/CMakeFiles/test_cmath_sin.dir/DependInfo.cmake"
+  "tests/complex/CMakeFiles/test_complex_complex.dir/DependInfo.cmake"
+  "tests/concepts/CMakeFiles/test_concepts_concepts.dir/DependInfo.cmake"
+  "tests/coroutine/CMakeFiles/test_coroutine_frame_arena.dir/DependInfo.cmake"
+  "tests/coroutine/CMakeFiles/test_coroutine_generator.dir/DependInfo.cmake"
+  "tests/coroutine/CMakeFiles/test_coroutine_task.dir/DependInfo.cmake"
+  "tests/coroutine/CMakeFiles/test_coroutine_run_loop.dir/DependInfo.cmake"
+  "tests/cstdarg/CMakeFiles/test_cstdarg_va_list.dir/DependInfo.cmake"
+  "tests/cstddef/CMakeFiles/test_cstddef_byte.dir/DependInfo.cmake"
+  "tests/cstdint/CMakeFiles/test_cstdint_cstdint.dir/DependInfo.cmake"
+  "tests/cstdlib/CMakeFiles/test_cstdlib_atoi.dir/DependInfo.cmake"
+  "tests/cstdlib/CMakeFiles/test_cstdlib_div.dir/DependInfo.cmake"
+  "tests/cstdlib/CMakeFiles/test_cstdlib_strtod.dir/DependInfo.cmake"
+  "tests/cstring/CMakeFiles/test_cstring_cstring.dir/DependInfo.cmake"
+  "tests/exception/CMakeFiles/test_exception_exception.dir/DependInfo.cmake"
+  "tests/exception/CMakeFiles/test_exception_raise.dir/DependInfo.cmake"
+  "tests/expected/CMakeFiles/test_expected_unexpected.dir/DependInfo.cmake"
+  "tests/fixed_point/CMakeFiles/test_fixed_point_charconv.dir/DependInfo.cmake"
+  "tests/fixed_point/CMakeFiles/test_fixed_point_fixed_point.dir/DependInfo.cmake"
+  "tests/fixed_point/CMakeFiles/test_fixed_point_math.dir/DependInfo.cmake"
+  "tests/flat_set/CMakeFiles/test_flat_set_flat_set.dir/DependInfo.cmake"
+  "tests/format/CMakeFiles/test_format_format.dir/DependInfo.cmake"
+  "tests/format/CMakeFiles/test_format_formatter.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_function_ref.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_hash.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_inplace_function.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_invoke.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_move_only_inplace_function.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_operations.dir/DependInfo.cmake"
+  "tests/functional/CMakeFiles/test_functional_reference_wrapper.dir/DependInfo.cmake"
+  "tests/ios/CMakeFiles/test_ios_ios.dir/DependInfo.cmake"
+  "tests/iterator/CMakeFiles/test_iterator_functions.dir/DependInfo.cmake"
+  "tests/iterator/CMakeFiles/test_iterator_insert_iterator.dir/DependInfo.cmake"
+  "tests/iterator/CMakeFiles/test_iterator_reverse_iterator.dir/DependInfo.cmake"
+  "tests/limits/CMakeFiles/test_limits_numeric_limits.dir/DependInfo.cmake"
+  "tests/linalg/CMakeFiles/test_linalg_blas1.dir/DependInfo.cmake"
+  "tests/linalg/CMakeFiles/test_linalg_blas2.dir/DependInfo.cmake"
+  "tests/linalg/CMakeFiles/test_linalg_blas3.dir/DependInfo.cmake"
+  "tests/map/CMakeFiles/test_map_static_perfect_map.dir/DependInfo.cmake"
+  "tests/mdspan/CMakeFiles/test_mdspan_extents.dir/DependInfo.cmake"
+  "tests/mdspan/CMakeFiles/test_mdspan_layout.dir/DependInfo.cmake"
+  "tests/mdspan/CMakeFiles/test_mdspan_mdspan.dir/DependInfo.cmake"
+  "tests/mdspan/CMakeFiles/test_mdspan_submdspan.dir/DependInfo.cmake"
+  "tests/memory/CMakeFiles/test_memory_memory.dir/DependInfo.cmake"
+  "tests/memory/CMakeFiles/test_memory_pointer_int_pair.dir/DependInfo.cmake"
+  "tests/memory/CMakeFiles/test_memory_relocate.dir/DependInfo.cmake"
+  "tests/memory/CMakeFiles/test_memory_small_ptr.dir/DependInfo.cmake"
+  "tests/mutex/CMakeFiles/test_mutex_unique_lock.dir/DependInfo.cmake"
+  "tests/mutex/CMakeFiles/test_mutex_lock_guard.dir/DependInfo.cmake"
+  "tests/numbers/CMakeFiles/test_numbers_constants.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_abs.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_accumulate.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_adjacent_difference.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_gcd.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_inner_product.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_iota.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_lcm.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_midpoint.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_partial_sum.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_reduce.dir/DependInfo.cmake"
+  "tests/numeric/CMakeFiles/test_numeric_transform_reduce.dir/DependInfo.cmake"
+  "tests/optional/CMakeFiles/test_optional_optional.dir/DependInfo.cmake"
+  "tests/optional/CMakeFiles/test_optional_optional2.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_discrete_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_exponential_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_normal_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_pcg.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_poisson_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_splitmix64.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_uniform_int_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_uniform_real_distribution.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_xorshift.dir/DependInfo.cmake"
+  "tests/random/CMakeFiles/test_random_xoshiro256.dir/DependInfo.cmake"
+  "tests/ratio/CMakeFiles/test_ratio_ratio.dir/DependInfo.cmake"
+  "tests/scope/CMakeFiles/test_scope_scope_exit.dir/DependInfo.cmake"
+  "tests/set/CMakeFiles/test_set_static_set.dir/DependInfo.cmake"
+  "tests/simd/CMakeFiles/test_simd_simd.dir/DependInfo.cmake"
+  "tests/simd/CMakeFiles/test_simd_vmath.dir/DependInfo.cmake"
+  "tests/span/CMakeFiles/test_span_span.dir/DependInfo.cmake"
+  "tests/stack/CMakeFiles/test_stack_stack.dir/DependInfo.cmake"
+  "tests/stdexcept/CMakeFiles/test_stdexcept_types.dir/DependInfo.cmake"
+  "tests/string/CMakeFiles/test_string_conversion.dir/DependInfo.cmake"
+  "tests/string/CMakeFiles/test_string_static_string.dir/DependInfo.cmake"
+  "tests/string/CMakeFiles/test_string_static_wstring.dir/DependInfo.cmake"
+  "tests/string/CMakeFiles/test_string_stoi.dir/DependInfo.cmake"
+  "tests/string/CMakeFiles/test_string_to_string.dir/DependInfo.cmake"
+  "tests/string_view/CMakeFiles/test_string_view_string_view.dir/DependInfo.cmake"
+  "tests/tuple/CMakeFiles/test_tuple_tuple.dir/DependInfo.cmake"
+  "tests/type_traits/CMakeFiles/test_type_traits_type_traits.dir/DependInfo.cmake"
+  "tests/type_traits/CMakeFiles/test_type_traits_type_traits2.dir/DependInfo.cmake"
+  "tests/type_traits/CMakeFiles/test_type_traits_type_traits3.dir/DependInfo.cmake"
+  "tests/type_traits/CMakeFiles/test_type_traits_type_traits4.dir/DependInfo.cmake"
+  "tests/type_traits/CMakeFiles/test_type_traits_underlying_type.dir/DependInfo.cmake"
+  "tests/utility/CMakeFiles/test_utility_cmp.dir/DependInfo.cmake"
+  "tests/utility/CMakeFiles/test_utility_pair.dir/DependInfo.cmake"
+  "tests/utility/CMakeFiles/test_utility_utility.dir/DependInfo.cmake"
+  "tests/variant/CMakeFiles/test_variant_variant.dir/DependInfo.cmake"
+  "tests/vector/CMakeFiles/test_vector_static_vector.dir/DependInfo.cmake"
+  "tests/version/CMakeFiles/test_version_version.dir/DependInfo.cmake"
+  "tests/experimental/freertos/CMakeFiles/test_experimental_freertos_queue.dir/DependInfo.cmake"
+  "tests/experimental/freertos/CMakeFiles/test_experimental_freertos_stream_buffer.dir/DependInfo.cmake"
+  "tests/experimental/freertos/CMakeFiles/test_experimental_freertos_task.dir/DependInfo.cmake"
+  "tests/experimental/freertos/CMakeFiles/test_experimental_freertos_zero_copy_stream_buffer.dir/DependInfo.cmake"
+  "tests/experimental/meta/CMakeFiles/test_experimental_mpl_mpl_algorithm.dir/DependInfo.cmake"
+  "tests/experimental/meta/CMakeFiles/test_experimental_mpl_mpl_traits.dir/DependInfo.cmake"
+  "tests/experimental/meta/CMakeFiles/test_experimental_mpl_mpl_types.dir/DependInfo.cmake"
+  "tests/experimental/net/CMakeFiles/test_experimental_net_buffer.dir/DependInfo.cmake"
+  "tests/experimental/net/CMakeFiles/test_experimental_net_buffer_sequence.dir/DependInfo.cmake"
+  "tests/experimental/net/CMakeFiles/test_experimental_net_byte_order.dir/DependInfo.cmake"
+  "tests/experimental/net/CMakeFiles/test_experimental_net_checksum.dir/DependInfo.cmake"
+  "tests/experimental/net/CMakeFiles/test_experimental_net_codec.dir/DependInfo.cmake"
+  "tests/experimental/stm32/CMakeFiles/test_experimental_stm32_gpio.dir/DependInfo.cmake"
+  "tests/experimental/stm32/CMakeFiles/test_experimental_stm32_interrupt.dir/DependInfo.cmake"
+  "tests/experimental/strong_type/CMakeFiles/test_experimental_strong_type_strong_type.dir/DependInfo.cmake"
+  "tests/experimental/testing/CMakeFiles/experimental_testing.dir/DependInfo.cmake"
+  "tests/experimental/trace/CMakeFiles/test_experimental_trace_ring_buffer.dir/DependInfo.cmake"
+  "tests/experimental/trace/CMakeFiles/test_experimental_trace_threads.dir/DependInfo.cmake"
+  "tests/experimental/trace/CMakeFiles/test_experimental_trace_trace.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_algorithm.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_all_headers.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_array.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_bitset.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_cassert.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_chrono.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_cmath.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_memory.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_numeric.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_optional.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_set.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_source_location.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_string.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_tuple.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_type_traits.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_utility.dir/DependInfo.cmake"
+  "examples/CMakeFiles/example_vector.dir/DependInfo.cmake"
+  "examples/experimental/CMakeFiles/example_stm32_freertos.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_numeric.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_mdspan.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_linalg.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_random.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_cmath.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_vmath.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_algorithm.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_set.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_bitset.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_cstring.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_charconv.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_format.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_run_loop.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_byte_order.dir/DependInfo.cmake"
+  "benchmarks/runtime/CMakeFiles/bench_checksum.dir/DependInfo.cmake"
+  )
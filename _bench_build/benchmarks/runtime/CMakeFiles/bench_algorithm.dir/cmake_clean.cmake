@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_algorithm"
+  "../../bin/bench_algorithm.pdb"
+  "CMakeFiles/bench_algorithm.dir/algorithm.bench.cpp.o"
+  "CMakeFiles/bench_algorithm.dir/algorithm.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
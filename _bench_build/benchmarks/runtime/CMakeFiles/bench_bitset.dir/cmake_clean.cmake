@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_bitset"
+  "../../bin/bench_bitset.pdb"
+  "CMakeFiles/bench_bitset.dir/bitset.bench.cpp.o"
+  "CMakeFiles/bench_bitset.dir/bitset.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_bitset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_byte_order"
+  "../../bin/bench_byte_order.pdb"
+  "CMakeFiles/bench_byte_order.dir/byte_order.bench.cpp.o"
+  "CMakeFiles/bench_byte_order.dir/byte_order.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_byte_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_charconv"
+  "../../bin/bench_charconv.pdb"
+  "CMakeFiles/bench_charconv.dir/charconv.bench.cpp.o"
+  "CMakeFiles/bench_charconv.dir/charconv.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_charconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_checksum"
+  "../../bin/bench_checksum.pdb"
+  "CMakeFiles/bench_checksum.dir/checksum.bench.cpp.o"
+  "CMakeFiles/bench_checksum.dir/checksum.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_cmath"
+  "../../bin/bench_cmath.pdb"
+  "CMakeFiles/bench_cmath.dir/cmath.bench.cpp.o"
+  "CMakeFiles/bench_cmath.dir/cmath.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_cmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
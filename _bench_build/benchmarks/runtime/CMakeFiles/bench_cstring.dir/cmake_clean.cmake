@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_cstring"
+  "../../bin/bench_cstring.pdb"
+  "CMakeFiles/bench_cstring.dir/cstring.bench.cpp.o"
+  "CMakeFiles/bench_cstring.dir/cstring.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_cstring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_format"
+  "../../bin/bench_format.pdb"
+  "CMakeFiles/bench_format.dir/format.bench.cpp.o"
+  "CMakeFiles/bench_format.dir/format.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_linalg"
+  "../../bin/bench_linalg.pdb"
+  "CMakeFiles/bench_linalg.dir/linalg.bench.cpp.o"
+  "CMakeFiles/bench_linalg.dir/linalg.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_linalg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
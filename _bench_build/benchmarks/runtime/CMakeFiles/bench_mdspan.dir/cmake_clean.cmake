@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_mdspan"
+  "../../bin/bench_mdspan.pdb"
+  "CMakeFiles/bench_mdspan.dir/mdspan.bench.cpp.o"
+  "CMakeFiles/bench_mdspan.dir/mdspan.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_mdspan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_numeric"
+  "../../bin/bench_numeric.pdb"
+  "CMakeFiles/bench_numeric.dir/numeric.bench.cpp.o"
+  "CMakeFiles/bench_numeric.dir/numeric.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_numeric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_random"
+  "../../bin/bench_random.pdb"
+  "CMakeFiles/bench_random.dir/random.bench.cpp.o"
+  "CMakeFiles/bench_random.dir/random.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_random.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_run_loop"
+  "../../bin/bench_run_loop.pdb"
+  "CMakeFiles/bench_run_loop.dir/run_loop.bench.cpp.o"
+  "CMakeFiles/bench_run_loop.dir/run_loop.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_run_loop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
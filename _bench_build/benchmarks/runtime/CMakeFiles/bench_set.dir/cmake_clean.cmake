@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_set"
+  "../../bin/bench_set.pdb"
+  "CMakeFiles/bench_set.dir/set.bench.cpp.o"
+  "CMakeFiles/bench_set.dir/set.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
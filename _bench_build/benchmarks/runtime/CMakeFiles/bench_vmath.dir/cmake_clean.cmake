@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/bench_vmath"
+  "../../bin/bench_vmath.pdb"
+  "CMakeFiles/bench_vmath.dir/vmath.bench.cpp.o"
+  "CMakeFiles/bench_vmath.dir/vmath.bench.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_vmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
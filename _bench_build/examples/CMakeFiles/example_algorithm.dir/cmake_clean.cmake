@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_algorithm"
+  "../bin/example_algorithm.pdb"
+  "CMakeFiles/example_algorithm.dir/algorithm.cpp.o"
+  "CMakeFiles/example_algorithm.dir/algorithm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
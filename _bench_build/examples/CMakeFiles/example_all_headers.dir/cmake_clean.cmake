@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_all_headers"
+  "../bin/example_all_headers.pdb"
+  "CMakeFiles/example_all_headers.dir/all_headers.cpp.o"
+  "CMakeFiles/example_all_headers.dir/all_headers.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_all_headers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_array"
+  "../bin/example_array.pdb"
+  "CMakeFiles/example_array.dir/array.cpp.o"
+  "CMakeFiles/example_array.dir/array.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
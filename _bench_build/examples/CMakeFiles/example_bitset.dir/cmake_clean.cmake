@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_bitset"
+  "../bin/example_bitset.pdb"
+  "CMakeFiles/example_bitset.dir/bitset.cpp.o"
+  "CMakeFiles/example_bitset.dir/bitset.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_bitset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_cassert"
+  "../bin/example_cassert.pdb"
+  "CMakeFiles/example_cassert.dir/cassert.cpp.o"
+  "CMakeFiles/example_cassert.dir/cassert.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_cassert.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
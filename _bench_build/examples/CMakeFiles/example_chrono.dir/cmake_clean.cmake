@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_chrono"
+  "../bin/example_chrono.pdb"
+  "CMakeFiles/example_chrono.dir/chrono.cpp.o"
+  "CMakeFiles/example_chrono.dir/chrono.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_chrono.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_cmath"
+  "../bin/example_cmath.pdb"
+  "CMakeFiles/example_cmath.dir/cmath.cpp.o"
+  "CMakeFiles/example_cmath.dir/cmath.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_cmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
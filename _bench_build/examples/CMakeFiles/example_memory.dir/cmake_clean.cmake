@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_memory"
+  "../bin/example_memory.pdb"
+  "CMakeFiles/example_memory.dir/memory.cpp.o"
+  "CMakeFiles/example_memory.dir/memory.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
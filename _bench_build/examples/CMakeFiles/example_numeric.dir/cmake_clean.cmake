@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_numeric"
+  "../bin/example_numeric.pdb"
+  "CMakeFiles/example_numeric.dir/numeric.cpp.o"
+  "CMakeFiles/example_numeric.dir/numeric.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_numeric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_optional"
+  "../bin/example_optional.pdb"
+  "CMakeFiles/example_optional.dir/optional.cpp.o"
+  "CMakeFiles/example_optional.dir/optional.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_optional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
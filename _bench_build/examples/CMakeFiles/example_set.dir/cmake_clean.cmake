@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_set"
+  "../bin/example_set.pdb"
+  "CMakeFiles/example_set.dir/set.cpp.o"
+  "CMakeFiles/example_set.dir/set.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
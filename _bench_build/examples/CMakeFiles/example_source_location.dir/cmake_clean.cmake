@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_source_location"
+  "../bin/example_source_location.pdb"
+  "CMakeFiles/example_source_location.dir/source_location.cpp.o"
+  "CMakeFiles/example_source_location.dir/source_location.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_source_location.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_string"
+  "../bin/example_string.pdb"
+  "CMakeFiles/example_string.dir/string.cpp.o"
+  "CMakeFiles/example_string.dir/string.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_tuple"
+  "../bin/example_tuple.pdb"
+  "CMakeFiles/example_tuple.dir/tuple.cpp.o"
+  "CMakeFiles/example_tuple.dir/tuple.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_tuple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
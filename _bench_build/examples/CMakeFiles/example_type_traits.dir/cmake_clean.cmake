@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_type_traits"
+  "../bin/example_type_traits.pdb"
+  "CMakeFiles/example_type_traits.dir/type_traits.cpp.o"
+  "CMakeFiles/example_type_traits.dir/type_traits.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_type_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
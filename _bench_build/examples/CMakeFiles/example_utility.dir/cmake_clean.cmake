@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_utility"
+  "../bin/example_utility.pdb"
+  "CMakeFiles/example_utility.dir/utility.cpp.o"
+  "CMakeFiles/example_utility.dir/utility.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
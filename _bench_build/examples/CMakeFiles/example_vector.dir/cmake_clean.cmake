@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/example_vector"
+  "../bin/example_vector.pdb"
+  "CMakeFiles/example_vector.dir/vector.cpp.o"
+  "CMakeFiles/example_vector.dir/vector.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
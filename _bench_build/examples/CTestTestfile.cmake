@@ -0,0 +1,41 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_bench_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[example: algorithm]=] "/root/repo/_bench_build/bin/example_algorithm")
+set_tests_properties([=[example: algorithm]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;15;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: all_headers]=] "/root/repo/_bench_build/bin/example_all_headers")
+set_tests_properties([=[example: all_headers]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;16;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: array]=] "/root/repo/_bench_build/bin/example_array")
+set_tests_properties([=[example: array]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;17;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: bitset]=] "/root/repo/_bench_build/bin/example_bitset")
+set_tests_properties([=[example: bitset]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;18;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: cassert]=] "/root/repo/_bench_build/bin/example_cassert")
+set_tests_properties([=[example: cassert]=] PROPERTIES  WILL_FAIL "TRUE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;19;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: chrono]=] "/root/repo/_bench_build/bin/example_chrono")
+set_tests_properties([=[example: chrono]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;20;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: cmath]=] "/root/repo/_bench_build/bin/example_cmath")
+set_tests_properties([=[example: cmath]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;21;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: memory]=] "/root/repo/_bench_build/bin/example_memory")
+set_tests_properties([=[example: memory]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;22;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: numeric]=] "/root/repo/_bench_build/bin/example_numeric")
+set_tests_properties([=[example: numeric]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;23;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: optional]=] "/root/repo/_bench_build/bin/example_optional")
+set_tests_properties([=[example: optional]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;24;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: set]=] "/root/repo/_bench_build/bin/example_set")
+set_tests_properties([=[example: set]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;25;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: source_location]=] "/root/repo/_bench_build/bin/example_source_location")
+set_tests_properties([=[example: source_location]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;26;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: string]=] "/root/repo/_bench_build/bin/example_string")
+set_tests_properties([=[example: string]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;27;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: tuple]=] "/root/repo/_bench_build/bin/example_tuple")
+set_tests_properties([=[example: tuple]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;28;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: type_traits]=] "/root/repo/_bench_build/bin/example_type_traits")
+set_tests_properties([=[example: type_traits]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;29;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: utility]=] "/root/repo/_bench_build/bin/example_utility")
+set_tests_properties([=[example: utility]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;30;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+add_test([=[example: vector]=] "/root/repo/_bench_build/bin/example_vector")
+set_tests_properties([=[example: vector]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/CMakeLists.txt;31;tetl_add_example;/root/repo/examples/CMakeLists.txt;0;")
+subdirs("experimental")
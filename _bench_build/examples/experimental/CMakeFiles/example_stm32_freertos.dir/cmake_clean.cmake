@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/example_stm32_freertos"
+  "../../bin/example_stm32_freertos.pdb"
+  "CMakeFiles/example_stm32_freertos.dir/stm32_freertos.cpp.o"
+  "CMakeFiles/example_stm32_freertos.dir/stm32_freertos.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/example_stm32_freertos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/experimental
+# Build directory: /root/repo/_bench_build/examples/experimental
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[example: stm32_freertos]=] "/root/repo/_bench_build/bin/example_stm32_freertos")
+set_tests_properties([=[example: stm32_freertos]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/examples/CMakeLists.txt;11;add_test;/root/repo/examples/experimental/CMakeLists.txt;3;tetl_add_example;/root/repo/examples/experimental/CMakeLists.txt;0;")
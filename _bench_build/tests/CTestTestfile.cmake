@@ -0,0 +1,63 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_bench_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("algorithm")
+subdirs("array")
+subdirs("bit")
+subdirs("bitset")
+subdirs("cctype")
+subdirs("cfloat")
+subdirs("charconv")
+subdirs("chrono")
+subdirs("cmath")
+subdirs("complex")
+subdirs("concepts")
+subdirs("coroutine")
+subdirs("cstdarg")
+subdirs("cstddef")
+subdirs("cstdint")
+subdirs("cstdlib")
+subdirs("cstring")
+subdirs("exception")
+subdirs("expected")
+subdirs("fixed_point")
+subdirs("flat_set")
+subdirs("format")
+subdirs("functional")
+subdirs("ios")
+subdirs("iterator")
+subdirs("limits")
+subdirs("linalg")
+subdirs("map")
+subdirs("mdspan")
+subdirs("memory")
+subdirs("mutex")
+subdirs("numbers")
+subdirs("numeric")
+subdirs("optional")
+subdirs("random")
+subdirs("ratio")
+subdirs("scope")
+subdirs("set")
+subdirs("simd")
+subdirs("span")
+subdirs("stack")
+subdirs("stdexcept")
+subdirs("string")
+subdirs("string_view")
+subdirs("tuple")
+subdirs("type_traits")
+subdirs("utility")
+subdirs("variant")
+subdirs("vector")
+subdirs("version")
+subdirs("experimental/freertos")
+subdirs("experimental/meta")
+subdirs("experimental/net")
+subdirs("experimental/stm32")
+subdirs("experimental/strong_type")
+subdirs("experimental/testing")
+subdirs("experimental/trace")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_all_of"
+  "../../bin/test_algorithm_all_of.pdb"
+  "CMakeFiles/test_algorithm_all_of.dir/all_of.t.cpp.o"
+  "CMakeFiles/test_algorithm_all_of.dir/all_of.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_all_of.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_copy"
+  "../../bin/test_algorithm_copy.pdb"
+  "CMakeFiles/test_algorithm_copy.dir/copy.t.cpp.o"
+  "CMakeFiles/test_algorithm_copy.dir/copy.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_count"
+  "../../bin/test_algorithm_count.pdb"
+  "CMakeFiles/test_algorithm_count.dir/count.t.cpp.o"
+  "CMakeFiles/test_algorithm_count.dir/count.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
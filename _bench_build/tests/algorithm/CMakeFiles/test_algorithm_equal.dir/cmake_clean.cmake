@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_equal"
+  "../../bin/test_algorithm_equal.pdb"
+  "CMakeFiles/test_algorithm_equal.dir/equal.t.cpp.o"
+  "CMakeFiles/test_algorithm_equal.dir/equal.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_equal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_equal_range"
+  "../../bin/test_algorithm_equal_range.pdb"
+  "CMakeFiles/test_algorithm_equal_range.dir/equal_range.t.cpp.o"
+  "CMakeFiles/test_algorithm_equal_range.dir/equal_range.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_equal_range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_fill"
+  "../../bin/test_algorithm_fill.pdb"
+  "CMakeFiles/test_algorithm_fill.dir/fill.t.cpp.o"
+  "CMakeFiles/test_algorithm_fill.dir/fill.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_fill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_find"
+  "../../bin/test_algorithm_find.pdb"
+  "CMakeFiles/test_algorithm_find.dir/find.t.cpp.o"
+  "CMakeFiles/test_algorithm_find.dir/find.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_find.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
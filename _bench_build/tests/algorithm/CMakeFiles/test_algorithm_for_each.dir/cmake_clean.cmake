@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_for_each"
+  "../../bin/test_algorithm_for_each.pdb"
+  "CMakeFiles/test_algorithm_for_each.dir/for_each.t.cpp.o"
+  "CMakeFiles/test_algorithm_for_each.dir/for_each.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_for_each.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_generate"
+  "../../bin/test_algorithm_generate.pdb"
+  "CMakeFiles/test_algorithm_generate.dir/generate.t.cpp.o"
+  "CMakeFiles/test_algorithm_generate.dir/generate.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_includes"
+  "../../bin/test_algorithm_includes.pdb"
+  "CMakeFiles/test_algorithm_includes.dir/includes.t.cpp.o"
+  "CMakeFiles/test_algorithm_includes.dir/includes.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_includes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_merge"
+  "../../bin/test_algorithm_merge.pdb"
+  "CMakeFiles/test_algorithm_merge.dir/merge.t.cpp.o"
+  "CMakeFiles/test_algorithm_merge.dir/merge.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_merge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_minmax"
+  "../../bin/test_algorithm_minmax.pdb"
+  "CMakeFiles/test_algorithm_minmax.dir/minmax.t.cpp.o"
+  "CMakeFiles/test_algorithm_minmax.dir/minmax.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_minmax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
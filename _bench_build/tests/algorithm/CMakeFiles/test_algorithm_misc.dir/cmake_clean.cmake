@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_misc"
+  "../../bin/test_algorithm_misc.pdb"
+  "CMakeFiles/test_algorithm_misc.dir/misc.t.cpp.o"
+  "CMakeFiles/test_algorithm_misc.dir/misc.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_mismatch"
+  "../../bin/test_algorithm_mismatch.pdb"
+  "CMakeFiles/test_algorithm_mismatch.dir/mismatch.t.cpp.o"
+  "CMakeFiles/test_algorithm_mismatch.dir/mismatch.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_mismatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
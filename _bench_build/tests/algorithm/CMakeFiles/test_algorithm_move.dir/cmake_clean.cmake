@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_move"
+  "../../bin/test_algorithm_move.pdb"
+  "CMakeFiles/test_algorithm_move.dir/move.t.cpp.o"
+  "CMakeFiles/test_algorithm_move.dir/move.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_move.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_partition"
+  "../../bin/test_algorithm_partition.pdb"
+  "CMakeFiles/test_algorithm_partition.dir/partition.t.cpp.o"
+  "CMakeFiles/test_algorithm_partition.dir/partition.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_partition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_remove"
+  "../../bin/test_algorithm_remove.pdb"
+  "CMakeFiles/test_algorithm_remove.dir/remove.t.cpp.o"
+  "CMakeFiles/test_algorithm_remove.dir/remove.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_remove.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_replace"
+  "../../bin/test_algorithm_replace.pdb"
+  "CMakeFiles/test_algorithm_replace.dir/replace.t.cpp.o"
+  "CMakeFiles/test_algorithm_replace.dir/replace.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_replace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_reverse"
+  "../../bin/test_algorithm_reverse.pdb"
+  "CMakeFiles/test_algorithm_reverse.dir/reverse.t.cpp.o"
+  "CMakeFiles/test_algorithm_reverse.dir/reverse.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_reverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_rotate"
+  "../../bin/test_algorithm_rotate.pdb"
+  "CMakeFiles/test_algorithm_rotate.dir/rotate.t.cpp.o"
+  "CMakeFiles/test_algorithm_rotate.dir/rotate.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_rotate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
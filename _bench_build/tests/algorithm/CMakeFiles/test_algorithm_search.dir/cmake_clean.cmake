@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_search"
+  "../../bin/test_algorithm_search.pdb"
+  "CMakeFiles/test_algorithm_search.dir/search.t.cpp.o"
+  "CMakeFiles/test_algorithm_search.dir/search.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_search.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_set_difference"
+  "../../bin/test_algorithm_set_difference.pdb"
+  "CMakeFiles/test_algorithm_set_difference.dir/set_difference.t.cpp.o"
+  "CMakeFiles/test_algorithm_set_difference.dir/set_difference.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_set_difference.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_shift"
+  "../../bin/test_algorithm_shift.pdb"
+  "CMakeFiles/test_algorithm_shift.dir/shift.t.cpp.o"
+  "CMakeFiles/test_algorithm_shift.dir/shift.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_shift.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_sort"
+  "../../bin/test_algorithm_sort.pdb"
+  "CMakeFiles/test_algorithm_sort.dir/sort.t.cpp.o"
+  "CMakeFiles/test_algorithm_sort.dir/sort.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_swap_ranges"
+  "../../bin/test_algorithm_swap_ranges.pdb"
+  "CMakeFiles/test_algorithm_swap_ranges.dir/swap_ranges.t.cpp.o"
+  "CMakeFiles/test_algorithm_swap_ranges.dir/swap_ranges.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_swap_ranges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
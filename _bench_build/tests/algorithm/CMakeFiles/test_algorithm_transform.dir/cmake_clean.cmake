@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_transform"
+  "../../bin/test_algorithm_transform.pdb"
+  "CMakeFiles/test_algorithm_transform.dir/transform.t.cpp.o"
+  "CMakeFiles/test_algorithm_transform.dir/transform.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_unique"
+  "../../bin/test_algorithm_unique.pdb"
+  "CMakeFiles/test_algorithm_unique.dir/unique.t.cpp.o"
+  "CMakeFiles/test_algorithm_unique.dir/unique.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_unique.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
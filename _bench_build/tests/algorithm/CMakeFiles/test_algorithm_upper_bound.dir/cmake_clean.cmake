@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_algorithm_upper_bound"
+  "../../bin/test_algorithm_upper_bound.pdb"
+  "CMakeFiles/test_algorithm_upper_bound.dir/upper_bound.t.cpp.o"
+  "CMakeFiles/test_algorithm_upper_bound.dir/upper_bound.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_algorithm_upper_bound.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
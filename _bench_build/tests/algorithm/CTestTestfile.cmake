@@ -0,0 +1,66 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/algorithm
+# Build directory: /root/repo/_bench_build/tests/algorithm
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[algorithm.hpp: all_of]=] "/root/repo/_bench_build/bin/test_algorithm_all_of")
+set_tests_properties([=[algorithm.hpp: all_of]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: binary_search]=] "/root/repo/_bench_build/bin/test_algorithm_binary_search")
+set_tests_properties([=[algorithm.hpp: binary_search]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: copy]=] "/root/repo/_bench_build/bin/test_algorithm_copy")
+set_tests_properties([=[algorithm.hpp: copy]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: count]=] "/root/repo/_bench_build/bin/test_algorithm_count")
+set_tests_properties([=[algorithm.hpp: count]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: equal]=] "/root/repo/_bench_build/bin/test_algorithm_equal")
+set_tests_properties([=[algorithm.hpp: equal]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: equal_range]=] "/root/repo/_bench_build/bin/test_algorithm_equal_range")
+set_tests_properties([=[algorithm.hpp: equal_range]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;8;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: fill]=] "/root/repo/_bench_build/bin/test_algorithm_fill")
+set_tests_properties([=[algorithm.hpp: fill]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;9;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: find]=] "/root/repo/_bench_build/bin/test_algorithm_find")
+set_tests_properties([=[algorithm.hpp: find]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;10;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: for_each]=] "/root/repo/_bench_build/bin/test_algorithm_for_each")
+set_tests_properties([=[algorithm.hpp: for_each]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;11;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: generate]=] "/root/repo/_bench_build/bin/test_algorithm_generate")
+set_tests_properties([=[algorithm.hpp: generate]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;12;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: includes]=] "/root/repo/_bench_build/bin/test_algorithm_includes")
+set_tests_properties([=[algorithm.hpp: includes]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;13;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: lower_bound]=] "/root/repo/_bench_build/bin/test_algorithm_lower_bound")
+set_tests_properties([=[algorithm.hpp: lower_bound]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;14;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: merge]=] "/root/repo/_bench_build/bin/test_algorithm_merge")
+set_tests_properties([=[algorithm.hpp: merge]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;15;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: minmax]=] "/root/repo/_bench_build/bin/test_algorithm_minmax")
+set_tests_properties([=[algorithm.hpp: minmax]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;16;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: misc]=] "/root/repo/_bench_build/bin/test_algorithm_misc")
+set_tests_properties([=[algorithm.hpp: misc]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;17;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: mismatch]=] "/root/repo/_bench_build/bin/test_algorithm_mismatch")
+set_tests_properties([=[algorithm.hpp: mismatch]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;18;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: move]=] "/root/repo/_bench_build/bin/test_algorithm_move")
+set_tests_properties([=[algorithm.hpp: move]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;19;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: partition]=] "/root/repo/_bench_build/bin/test_algorithm_partition")
+set_tests_properties([=[algorithm.hpp: partition]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;20;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: remove]=] "/root/repo/_bench_build/bin/test_algorithm_remove")
+set_tests_properties([=[algorithm.hpp: remove]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;21;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: replace]=] "/root/repo/_bench_build/bin/test_algorithm_replace")
+set_tests_properties([=[algorithm.hpp: replace]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;22;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: reverse]=] "/root/repo/_bench_build/bin/test_algorithm_reverse")
+set_tests_properties([=[algorithm.hpp: reverse]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;23;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: rotate]=] "/root/repo/_bench_build/bin/test_algorithm_rotate")
+set_tests_properties([=[algorithm.hpp: rotate]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;24;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: search]=] "/root/repo/_bench_build/bin/test_algorithm_search")
+set_tests_properties([=[algorithm.hpp: search]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;25;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: set_difference]=] "/root/repo/_bench_build/bin/test_algorithm_set_difference")
+set_tests_properties([=[algorithm.hpp: set_difference]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;26;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: shift]=] "/root/repo/_bench_build/bin/test_algorithm_shift")
+set_tests_properties([=[algorithm.hpp: shift]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;27;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: sort]=] "/root/repo/_bench_build/bin/test_algorithm_sort")
+set_tests_properties([=[algorithm.hpp: sort]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;28;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: swap_ranges]=] "/root/repo/_bench_build/bin/test_algorithm_swap_ranges")
+set_tests_properties([=[algorithm.hpp: swap_ranges]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;29;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: transform]=] "/root/repo/_bench_build/bin/test_algorithm_transform")
+set_tests_properties([=[algorithm.hpp: transform]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;30;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: unique]=] "/root/repo/_bench_build/bin/test_algorithm_unique")
+set_tests_properties([=[algorithm.hpp: unique]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;31;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
+add_test([=[algorithm.hpp: upper_bound]=] "/root/repo/_bench_build/bin/test_algorithm_upper_bound")
+set_tests_properties([=[algorithm.hpp: upper_bound]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/algorithm/CMakeLists.txt;32;tetl_add_test;/root/repo/tests/algorithm/CMakeLists.txt;0;")
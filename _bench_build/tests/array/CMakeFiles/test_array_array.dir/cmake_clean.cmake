@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_array_array"
+  "../../bin/test_array_array.pdb"
+  "CMakeFiles/test_array_array.dir/array.t.cpp.o"
+  "CMakeFiles/test_array_array.dir/array.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_array_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
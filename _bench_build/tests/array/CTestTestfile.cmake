@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/array
+# Build directory: /root/repo/_bench_build/tests/array
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[array.hpp: array]=] "/root/repo/_bench_build/bin/test_array_array")
+set_tests_properties([=[array.hpp: array]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/array/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/array/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_bit_bit_cast"
+  "../../bin/test_bit_bit_cast.pdb"
+  "CMakeFiles/test_bit_bit_cast.dir/bit_cast.t.cpp.o"
+  "CMakeFiles/test_bit_bit_cast.dir/bit_cast.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bit_bit_cast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
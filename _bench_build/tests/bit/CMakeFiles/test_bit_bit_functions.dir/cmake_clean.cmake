@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_bit_bit_functions"
+  "../../bin/test_bit_bit_functions.pdb"
+  "CMakeFiles/test_bit_bit_functions.dir/bit_functions.t.cpp.o"
+  "CMakeFiles/test_bit_bit_functions.dir/bit_functions.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bit_bit_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
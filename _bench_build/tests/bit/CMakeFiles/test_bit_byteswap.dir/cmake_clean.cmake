@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_bit_byteswap"
+  "../../bin/test_bit_byteswap.pdb"
+  "CMakeFiles/test_bit_byteswap.dir/byteswap.t.cpp.o"
+  "CMakeFiles/test_bit_byteswap.dir/byteswap.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bit_byteswap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
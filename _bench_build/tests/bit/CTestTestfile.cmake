@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/bit
+# Build directory: /root/repo/_bench_build/tests/bit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[bit.hpp: bit_cast]=] "/root/repo/_bench_build/bin/test_bit_bit_cast")
+set_tests_properties([=[bit.hpp: bit_cast]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/bit/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/bit/CMakeLists.txt;0;")
+add_test([=[bit.hpp: bit_functions]=] "/root/repo/_bench_build/bin/test_bit_bit_functions")
+set_tests_properties([=[bit.hpp: bit_functions]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/bit/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/bit/CMakeLists.txt;0;")
+add_test([=[bit.hpp: byteswap]=] "/root/repo/_bench_build/bin/test_bit_byteswap")
+set_tests_properties([=[bit.hpp: byteswap]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/bit/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/bit/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_bitset_bitset"
+  "../../bin/test_bitset_bitset.pdb"
+  "CMakeFiles/test_bitset_bitset.dir/bitset.t.cpp.o"
+  "CMakeFiles/test_bitset_bitset.dir/bitset.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bitset_bitset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/bitset
+# Build directory: /root/repo/_bench_build/tests/bitset
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[bitset.hpp: bitset]=] "/root/repo/_bench_build/bin/test_bitset_bitset")
+set_tests_properties([=[bitset.hpp: bitset]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/bitset/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/bitset/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cctype_cctype"
+  "../../bin/test_cctype_cctype.pdb"
+  "CMakeFiles/test_cctype_cctype.dir/cctype.t.cpp.o"
+  "CMakeFiles/test_cctype_cctype.dir/cctype.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cctype_cctype.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
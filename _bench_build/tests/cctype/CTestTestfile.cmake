@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cctype
+# Build directory: /root/repo/_bench_build/tests/cctype
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cctype.hpp: cctype]=] "/root/repo/_bench_build/bin/test_cctype_cctype")
+set_tests_properties([=[cctype.hpp: cctype]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cctype/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cctype/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cfloat_half"
+  "../../bin/test_cfloat_half.pdb"
+  "CMakeFiles/test_cfloat_half.dir/half.t.cpp.o"
+  "CMakeFiles/test_cfloat_half.dir/half.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cfloat_half.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
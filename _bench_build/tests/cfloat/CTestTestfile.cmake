@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cfloat
+# Build directory: /root/repo/_bench_build/tests/cfloat
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cfloat.hpp: half]=] "/root/repo/_bench_build/bin/test_cfloat_half")
+set_tests_properties([=[cfloat.hpp: half]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cfloat/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cfloat/CMakeLists.txt;0;")
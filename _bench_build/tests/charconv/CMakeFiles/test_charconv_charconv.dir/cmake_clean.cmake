@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_charconv_charconv"
+  "../../bin/test_charconv_charconv.pdb"
+  "CMakeFiles/test_charconv_charconv.dir/charconv.t.cpp.o"
+  "CMakeFiles/test_charconv_charconv.dir/charconv.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_charconv_charconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
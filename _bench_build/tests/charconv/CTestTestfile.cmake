@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/charconv
+# Build directory: /root/repo/_bench_build/tests/charconv
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[charconv.hpp: charconv]=] "/root/repo/_bench_build/bin/test_charconv_charconv")
+set_tests_properties([=[charconv.hpp: charconv]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/charconv/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/charconv/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_chrono_calender"
+  "../../bin/test_chrono_calender.pdb"
+  "CMakeFiles/test_chrono_calender.dir/calender.t.cpp.o"
+  "CMakeFiles/test_chrono_calender.dir/calender.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_chrono_calender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_chrono_duration"
+  "../../bin/test_chrono_duration.pdb"
+  "CMakeFiles/test_chrono_duration.dir/duration.t.cpp.o"
+  "CMakeFiles/test_chrono_duration.dir/duration.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_chrono_duration.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
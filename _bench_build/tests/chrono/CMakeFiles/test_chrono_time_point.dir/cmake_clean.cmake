@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_chrono_time_point"
+  "../../bin/test_chrono_time_point.pdb"
+  "CMakeFiles/test_chrono_time_point.dir/time_point.t.cpp.o"
+  "CMakeFiles/test_chrono_time_point.dir/time_point.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_chrono_time_point.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
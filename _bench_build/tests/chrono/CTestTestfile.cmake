@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/chrono
+# Build directory: /root/repo/_bench_build/tests/chrono
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[chrono.hpp: calender]=] "/root/repo/_bench_build/bin/test_chrono_calender")
+set_tests_properties([=[chrono.hpp: calender]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/chrono/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/chrono/CMakeLists.txt;0;")
+add_test([=[chrono.hpp: duration]=] "/root/repo/_bench_build/bin/test_chrono_duration")
+set_tests_properties([=[chrono.hpp: duration]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/chrono/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/chrono/CMakeLists.txt;0;")
+add_test([=[chrono.hpp: time_point]=] "/root/repo/_bench_build/bin/test_chrono_time_point")
+set_tests_properties([=[chrono.hpp: time_point]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/chrono/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/chrono/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_abs"
+  "../../bin/test_cmath_abs.pdb"
+  "CMakeFiles/test_cmath_abs.dir/abs.t.cpp.o"
+  "CMakeFiles/test_cmath_abs.dir/abs.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_abs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
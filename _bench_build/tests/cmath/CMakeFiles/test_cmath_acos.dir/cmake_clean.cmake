@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_acos"
+  "../../bin/test_cmath_acos.pdb"
+  "CMakeFiles/test_cmath_acos.dir/acos.t.cpp.o"
+  "CMakeFiles/test_cmath_acos.dir/acos.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_acos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
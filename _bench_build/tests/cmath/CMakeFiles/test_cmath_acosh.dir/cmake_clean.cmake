@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_acosh"
+  "../../bin/test_cmath_acosh.pdb"
+  "CMakeFiles/test_cmath_acosh.dir/acosh.t.cpp.o"
+  "CMakeFiles/test_cmath_acosh.dir/acosh.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_acosh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
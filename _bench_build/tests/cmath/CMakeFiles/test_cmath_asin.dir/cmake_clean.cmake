@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_asin"
+  "../../bin/test_cmath_asin.pdb"
+  "CMakeFiles/test_cmath_asin.dir/asin.t.cpp.o"
+  "CMakeFiles/test_cmath_asin.dir/asin.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_asin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_asinh"
+  "../../bin/test_cmath_asinh.pdb"
+  "CMakeFiles/test_cmath_asinh.dir/asinh.t.cpp.o"
+  "CMakeFiles/test_cmath_asinh.dir/asinh.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_asinh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
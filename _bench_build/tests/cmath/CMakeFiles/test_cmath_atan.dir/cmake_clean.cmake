@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_atan"
+  "../../bin/test_cmath_atan.pdb"
+  "CMakeFiles/test_cmath_atan.dir/atan.t.cpp.o"
+  "CMakeFiles/test_cmath_atan.dir/atan.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_atan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
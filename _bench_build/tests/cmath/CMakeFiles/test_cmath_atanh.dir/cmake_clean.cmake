@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_atanh"
+  "../../bin/test_cmath_atanh.pdb"
+  "CMakeFiles/test_cmath_atanh.dir/atanh.t.cpp.o"
+  "CMakeFiles/test_cmath_atanh.dir/atanh.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_atanh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_beta"
+  "../../bin/test_cmath_beta.pdb"
+  "CMakeFiles/test_cmath_beta.dir/beta.t.cpp.o"
+  "CMakeFiles/test_cmath_beta.dir/beta.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_beta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_ceil"
+  "../../bin/test_cmath_ceil.pdb"
+  "CMakeFiles/test_cmath_ceil.dir/ceil.t.cpp.o"
+  "CMakeFiles/test_cmath_ceil.dir/ceil.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_ceil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
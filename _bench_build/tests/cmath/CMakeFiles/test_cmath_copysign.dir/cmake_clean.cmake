@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_copysign"
+  "../../bin/test_cmath_copysign.pdb"
+  "CMakeFiles/test_cmath_copysign.dir/copysign.t.cpp.o"
+  "CMakeFiles/test_cmath_copysign.dir/copysign.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_copysign.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_cos"
+  "../../bin/test_cmath_cos.pdb"
+  "CMakeFiles/test_cmath_cos.dir/cos.t.cpp.o"
+  "CMakeFiles/test_cmath_cos.dir/cos.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_cos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_cosh"
+  "../../bin/test_cmath_cosh.pdb"
+  "CMakeFiles/test_cmath_cosh.dir/cosh.t.cpp.o"
+  "CMakeFiles/test_cmath_cosh.dir/cosh.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_cosh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_erf"
+  "../../bin/test_cmath_erf.pdb"
+  "CMakeFiles/test_cmath_erf.dir/erf.t.cpp.o"
+  "CMakeFiles/test_cmath_erf.dir/erf.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_erf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
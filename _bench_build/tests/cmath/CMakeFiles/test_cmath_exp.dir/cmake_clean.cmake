@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_exp"
+  "../../bin/test_cmath_exp.pdb"
+  "CMakeFiles/test_cmath_exp.dir/exp.t.cpp.o"
+  "CMakeFiles/test_cmath_exp.dir/exp.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_exp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_floor"
+  "../../bin/test_cmath_floor.pdb"
+  "CMakeFiles/test_cmath_floor.dir/floor.t.cpp.o"
+  "CMakeFiles/test_cmath_floor.dir/floor.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_floor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
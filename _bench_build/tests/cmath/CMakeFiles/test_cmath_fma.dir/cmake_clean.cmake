@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_fma"
+  "../../bin/test_cmath_fma.pdb"
+  "CMakeFiles/test_cmath_fma.dir/fma.t.cpp.o"
+  "CMakeFiles/test_cmath_fma.dir/fma.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_fma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
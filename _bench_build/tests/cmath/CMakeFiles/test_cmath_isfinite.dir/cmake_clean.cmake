@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_isfinite"
+  "../../bin/test_cmath_isfinite.pdb"
+  "CMakeFiles/test_cmath_isfinite.dir/isfinite.t.cpp.o"
+  "CMakeFiles/test_cmath_isfinite.dir/isfinite.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_isfinite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_isinf"
+  "../../bin/test_cmath_isinf.pdb"
+  "CMakeFiles/test_cmath_isinf.dir/isinf.t.cpp.o"
+  "CMakeFiles/test_cmath_isinf.dir/isinf.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_isinf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_isnan"
+  "../../bin/test_cmath_isnan.pdb"
+  "CMakeFiles/test_cmath_isnan.dir/isnan.t.cpp.o"
+  "CMakeFiles/test_cmath_isnan.dir/isnan.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_isnan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
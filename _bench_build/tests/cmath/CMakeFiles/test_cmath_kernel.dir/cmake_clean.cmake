@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_kernel"
+  "../../bin/test_cmath_kernel.pdb"
+  "CMakeFiles/test_cmath_kernel.dir/kernel.t.cpp.o"
+  "CMakeFiles/test_cmath_kernel.dir/kernel.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
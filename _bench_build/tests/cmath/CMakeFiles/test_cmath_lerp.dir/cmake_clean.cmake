@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_lerp"
+  "../../bin/test_cmath_lerp.pdb"
+  "CMakeFiles/test_cmath_lerp.dir/lerp.t.cpp.o"
+  "CMakeFiles/test_cmath_lerp.dir/lerp.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_lerp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
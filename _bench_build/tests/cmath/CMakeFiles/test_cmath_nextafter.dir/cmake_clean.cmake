@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_nextafter"
+  "../../bin/test_cmath_nextafter.pdb"
+  "CMakeFiles/test_cmath_nextafter.dir/nextafter.t.cpp.o"
+  "CMakeFiles/test_cmath_nextafter.dir/nextafter.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_nextafter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cmath_sin"
+  "../../bin/test_cmath_sin.pdb"
+  "CMakeFiles/test_cmath_sin.dir/sin.t.cpp.o"
+  "CMakeFiles/test_cmath_sin.dir/sin.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmath_sin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
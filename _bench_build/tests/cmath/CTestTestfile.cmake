@@ -0,0 +1,52 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cmath
+# Build directory: /root/repo/_bench_build/tests/cmath
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cmath.hpp: abs]=] "/root/repo/_bench_build/bin/test_cmath_abs")
+set_tests_properties([=[cmath.hpp: abs]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: acos]=] "/root/repo/_bench_build/bin/test_cmath_acos")
+set_tests_properties([=[cmath.hpp: acos]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: acosh]=] "/root/repo/_bench_build/bin/test_cmath_acosh")
+set_tests_properties([=[cmath.hpp: acosh]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: asin]=] "/root/repo/_bench_build/bin/test_cmath_asin")
+set_tests_properties([=[cmath.hpp: asin]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: asinh]=] "/root/repo/_bench_build/bin/test_cmath_asinh")
+set_tests_properties([=[cmath.hpp: asinh]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: atan]=] "/root/repo/_bench_build/bin/test_cmath_atan")
+set_tests_properties([=[cmath.hpp: atan]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;8;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: atanh]=] "/root/repo/_bench_build/bin/test_cmath_atanh")
+set_tests_properties([=[cmath.hpp: atanh]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;9;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: beta]=] "/root/repo/_bench_build/bin/test_cmath_beta")
+set_tests_properties([=[cmath.hpp: beta]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;10;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: ceil]=] "/root/repo/_bench_build/bin/test_cmath_ceil")
+set_tests_properties([=[cmath.hpp: ceil]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;11;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: copysign]=] "/root/repo/_bench_build/bin/test_cmath_copysign")
+set_tests_properties([=[cmath.hpp: copysign]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;12;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: cos]=] "/root/repo/_bench_build/bin/test_cmath_cos")
+set_tests_properties([=[cmath.hpp: cos]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;13;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: cosh]=] "/root/repo/_bench_build/bin/test_cmath_cosh")
+set_tests_properties([=[cmath.hpp: cosh]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;14;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: erf]=] "/root/repo/_bench_build/bin/test_cmath_erf")
+set_tests_properties([=[cmath.hpp: erf]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;15;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: exp]=] "/root/repo/_bench_build/bin/test_cmath_exp")
+set_tests_properties([=[cmath.hpp: exp]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;16;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: floor]=] "/root/repo/_bench_build/bin/test_cmath_floor")
+set_tests_properties([=[cmath.hpp: floor]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;17;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: fma]=] "/root/repo/_bench_build/bin/test_cmath_fma")
+set_tests_properties([=[cmath.hpp: fma]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;18;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: isfinite]=] "/root/repo/_bench_build/bin/test_cmath_isfinite")
+set_tests_properties([=[cmath.hpp: isfinite]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;19;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: isinf]=] "/root/repo/_bench_build/bin/test_cmath_isinf")
+set_tests_properties([=[cmath.hpp: isinf]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;20;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: isnan]=] "/root/repo/_bench_build/bin/test_cmath_isnan")
+set_tests_properties([=[cmath.hpp: isnan]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;21;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: kernel]=] "/root/repo/_bench_build/bin/test_cmath_kernel")
+set_tests_properties([=[cmath.hpp: kernel]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;22;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: lerp]=] "/root/repo/_bench_build/bin/test_cmath_lerp")
+set_tests_properties([=[cmath.hpp: lerp]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;23;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: nextafter]=] "/root/repo/_bench_build/bin/test_cmath_nextafter")
+set_tests_properties([=[cmath.hpp: nextafter]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;24;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
+add_test([=[cmath.hpp: sin]=] "/root/repo/_bench_build/bin/test_cmath_sin")
+set_tests_properties([=[cmath.hpp: sin]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cmath/CMakeLists.txt;25;tetl_add_test;/root/repo/tests/cmath/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_complex_complex"
+  "../../bin/test_complex_complex.pdb"
+  "CMakeFiles/test_complex_complex.dir/complex.t.cpp.o"
+  "CMakeFiles/test_complex_complex.dir/complex.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_complex_complex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
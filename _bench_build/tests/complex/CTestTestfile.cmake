@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/complex
+# Build directory: /root/repo/_bench_build/tests/complex
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[complex.hpp: complex]=] "/root/repo/_bench_build/bin/test_complex_complex")
+set_tests_properties([=[complex.hpp: complex]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/complex/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/complex/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_concepts_concepts"
+  "../../bin/test_concepts_concepts.pdb"
+  "CMakeFiles/test_concepts_concepts.dir/concepts.t.cpp.o"
+  "CMakeFiles/test_concepts_concepts.dir/concepts.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_concepts_concepts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/concepts
+# Build directory: /root/repo/_bench_build/tests/concepts
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[concepts.hpp: concepts]=] "/root/repo/_bench_build/bin/test_concepts_concepts")
+set_tests_properties([=[concepts.hpp: concepts]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/concepts/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/concepts/CMakeLists.txt;0;")
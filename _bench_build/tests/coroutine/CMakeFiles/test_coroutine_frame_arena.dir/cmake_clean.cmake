@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_coroutine_frame_arena"
+  "../../bin/test_coroutine_frame_arena.pdb"
+  "CMakeFiles/test_coroutine_frame_arena.dir/frame_arena.t.cpp.o"
+  "CMakeFiles/test_coroutine_frame_arena.dir/frame_arena.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coroutine_frame_arena.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
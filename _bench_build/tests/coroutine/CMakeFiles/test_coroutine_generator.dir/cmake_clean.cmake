@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_coroutine_generator"
+  "../../bin/test_coroutine_generator.pdb"
+  "CMakeFiles/test_coroutine_generator.dir/generator.t.cpp.o"
+  "CMakeFiles/test_coroutine_generator.dir/generator.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coroutine_generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_coroutine_run_loop"
+  "../../bin/test_coroutine_run_loop.pdb"
+  "CMakeFiles/test_coroutine_run_loop.dir/run_loop.t.cpp.o"
+  "CMakeFiles/test_coroutine_run_loop.dir/run_loop.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coroutine_run_loop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
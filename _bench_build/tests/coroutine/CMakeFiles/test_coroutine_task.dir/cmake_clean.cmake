@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_coroutine_task"
+  "../../bin/test_coroutine_task.pdb"
+  "CMakeFiles/test_coroutine_task.dir/task.t.cpp.o"
+  "CMakeFiles/test_coroutine_task.dir/task.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coroutine_task.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
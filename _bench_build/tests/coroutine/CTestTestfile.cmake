@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/coroutine
+# Build directory: /root/repo/_bench_build/tests/coroutine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[coroutine.hpp: frame_arena]=] "/root/repo/_bench_build/bin/test_coroutine_frame_arena")
+set_tests_properties([=[coroutine.hpp: frame_arena]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/coroutine/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/coroutine/CMakeLists.txt;0;")
+add_test([=[coroutine.hpp: generator]=] "/root/repo/_bench_build/bin/test_coroutine_generator")
+set_tests_properties([=[coroutine.hpp: generator]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/coroutine/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/coroutine/CMakeLists.txt;0;")
+add_test([=[coroutine.hpp: task]=] "/root/repo/_bench_build/bin/test_coroutine_task")
+set_tests_properties([=[coroutine.hpp: task]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/coroutine/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/coroutine/CMakeLists.txt;0;")
+add_test([=[coroutine.hpp: run_loop]=] "/root/repo/_bench_build/bin/test_coroutine_run_loop")
+set_tests_properties([=[coroutine.hpp: run_loop]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/coroutine/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/coroutine/CMakeLists.txt;0;")
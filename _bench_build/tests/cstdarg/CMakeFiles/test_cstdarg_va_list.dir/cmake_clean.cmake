@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstdarg_va_list"
+  "../../bin/test_cstdarg_va_list.pdb"
+  "CMakeFiles/test_cstdarg_va_list.dir/va_list.t.cpp.o"
+  "CMakeFiles/test_cstdarg_va_list.dir/va_list.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstdarg_va_list.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cstdarg
+# Build directory: /root/repo/_bench_build/tests/cstdarg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cstdarg.hpp: va_list]=] "/root/repo/_bench_build/bin/test_cstdarg_va_list")
+set_tests_properties([=[cstdarg.hpp: va_list]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstdarg/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cstdarg/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstddef_byte"
+  "../../bin/test_cstddef_byte.pdb"
+  "CMakeFiles/test_cstddef_byte.dir/byte.t.cpp.o"
+  "CMakeFiles/test_cstddef_byte.dir/byte.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstddef_byte.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
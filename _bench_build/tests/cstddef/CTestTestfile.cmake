@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cstddef
+# Build directory: /root/repo/_bench_build/tests/cstddef
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cstddef.hpp: byte]=] "/root/repo/_bench_build/bin/test_cstddef_byte")
+set_tests_properties([=[cstddef.hpp: byte]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstddef/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cstddef/CMakeLists.txt;0;")
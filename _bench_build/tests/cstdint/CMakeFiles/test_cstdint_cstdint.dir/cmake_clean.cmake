@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstdint_cstdint"
+  "../../bin/test_cstdint_cstdint.pdb"
+  "CMakeFiles/test_cstdint_cstdint.dir/cstdint.t.cpp.o"
+  "CMakeFiles/test_cstdint_cstdint.dir/cstdint.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstdint_cstdint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
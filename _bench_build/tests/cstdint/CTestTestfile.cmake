@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cstdint
+# Build directory: /root/repo/_bench_build/tests/cstdint
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cstdint.hpp: cstdint]=] "/root/repo/_bench_build/bin/test_cstdint_cstdint")
+set_tests_properties([=[cstdint.hpp: cstdint]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstdint/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cstdint/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstdlib_atoi"
+  "../../bin/test_cstdlib_atoi.pdb"
+  "CMakeFiles/test_cstdlib_atoi.dir/atoi.t.cpp.o"
+  "CMakeFiles/test_cstdlib_atoi.dir/atoi.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstdlib_atoi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstdlib_div"
+  "../../bin/test_cstdlib_div.pdb"
+  "CMakeFiles/test_cstdlib_div.dir/div.t.cpp.o"
+  "CMakeFiles/test_cstdlib_div.dir/div.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstdlib_div.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstdlib_strtod"
+  "../../bin/test_cstdlib_strtod.pdb"
+  "CMakeFiles/test_cstdlib_strtod.dir/strtod.t.cpp.o"
+  "CMakeFiles/test_cstdlib_strtod.dir/strtod.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstdlib_strtod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cstdlib
+# Build directory: /root/repo/_bench_build/tests/cstdlib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cstdlib.hpp: atoi]=] "/root/repo/_bench_build/bin/test_cstdlib_atoi")
+set_tests_properties([=[cstdlib.hpp: atoi]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstdlib/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cstdlib/CMakeLists.txt;0;")
+add_test([=[cstdlib.hpp: div]=] "/root/repo/_bench_build/bin/test_cstdlib_div")
+set_tests_properties([=[cstdlib.hpp: div]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstdlib/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/cstdlib/CMakeLists.txt;0;")
+add_test([=[cstdlib.hpp: strtod]=] "/root/repo/_bench_build/bin/test_cstdlib_strtod")
+set_tests_properties([=[cstdlib.hpp: strtod]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstdlib/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/cstdlib/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_cstring_cstring"
+  "../../bin/test_cstring_cstring.pdb"
+  "CMakeFiles/test_cstring_cstring.dir/cstring.t.cpp.o"
+  "CMakeFiles/test_cstring_cstring.dir/cstring.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cstring_cstring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
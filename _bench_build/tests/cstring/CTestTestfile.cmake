@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/cstring
+# Build directory: /root/repo/_bench_build/tests/cstring
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cstring.hpp: cstring]=] "/root/repo/_bench_build/bin/test_cstring_cstring")
+set_tests_properties([=[cstring.hpp: cstring]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/cstring/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/cstring/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_exception_exception"
+  "../../bin/test_exception_exception.pdb"
+  "CMakeFiles/test_exception_exception.dir/exception.t.cpp.o"
+  "CMakeFiles/test_exception_exception.dir/exception.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_exception_exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
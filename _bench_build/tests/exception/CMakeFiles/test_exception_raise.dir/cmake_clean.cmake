@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_exception_raise"
+  "../../bin/test_exception_raise.pdb"
+  "CMakeFiles/test_exception_raise.dir/raise.t.cpp.o"
+  "CMakeFiles/test_exception_raise.dir/raise.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_exception_raise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
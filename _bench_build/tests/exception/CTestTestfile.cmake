@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/exception
+# Build directory: /root/repo/_bench_build/tests/exception
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[exception.hpp: exception]=] "/root/repo/_bench_build/bin/test_exception_exception")
+set_tests_properties([=[exception.hpp: exception]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/exception/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/exception/CMakeLists.txt;0;")
+add_test([=[exception.hpp: raise]=] "/root/repo/_bench_build/bin/test_exception_raise")
+set_tests_properties([=[exception.hpp: raise]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/exception/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/exception/CMakeLists.txt;0;")
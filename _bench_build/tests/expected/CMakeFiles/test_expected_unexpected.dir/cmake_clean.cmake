@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_expected_unexpected"
+  "../../bin/test_expected_unexpected.pdb"
+  "CMakeFiles/test_expected_unexpected.dir/unexpected.t.cpp.o"
+  "CMakeFiles/test_expected_unexpected.dir/unexpected.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_expected_unexpected.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
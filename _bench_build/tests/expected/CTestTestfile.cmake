@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/expected
+# Build directory: /root/repo/_bench_build/tests/expected
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[expected.hpp: unexpected]=] "/root/repo/_bench_build/bin/test_expected_unexpected")
+set_tests_properties([=[expected.hpp: unexpected]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/expected/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/expected/CMakeLists.txt;0;")
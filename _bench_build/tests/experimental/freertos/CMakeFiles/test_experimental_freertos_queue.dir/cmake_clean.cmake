@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_freertos_queue"
+  "../../../bin/test_experimental_freertos_queue.pdb"
+  "CMakeFiles/test_experimental_freertos_queue.dir/queue.t.cpp.o"
+  "CMakeFiles/test_experimental_freertos_queue.dir/queue.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_freertos_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
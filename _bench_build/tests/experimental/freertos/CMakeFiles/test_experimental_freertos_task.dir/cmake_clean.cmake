@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_freertos_task"
+  "../../../bin/test_experimental_freertos_task.pdb"
+  "CMakeFiles/test_experimental_freertos_task.dir/task.t.cpp.o"
+  "CMakeFiles/test_experimental_freertos_task.dir/task.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_freertos_task.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
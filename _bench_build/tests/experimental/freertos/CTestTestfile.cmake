@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/freertos
+# Build directory: /root/repo/_bench_build/tests/experimental/freertos
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_freertos.hpp: queue]=] "/root/repo/_bench_build/bin/test_experimental_freertos_queue")
+set_tests_properties([=[experimental_freertos.hpp: queue]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;0;")
+add_test([=[experimental_freertos.hpp: stream_buffer]=] "/root/repo/_bench_build/bin/test_experimental_freertos_stream_buffer")
+set_tests_properties([=[experimental_freertos.hpp: stream_buffer]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;0;")
+add_test([=[experimental_freertos.hpp: task]=] "/root/repo/_bench_build/bin/test_experimental_freertos_task")
+set_tests_properties([=[experimental_freertos.hpp: task]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;0;")
+add_test([=[experimental_freertos.hpp: zero_copy_stream_buffer]=] "/root/repo/_bench_build/bin/test_experimental_freertos_zero_copy_stream_buffer")
+set_tests_properties([=[experimental_freertos.hpp: zero_copy_stream_buffer]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/experimental/freertos/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_mpl_mpl_algorithm"
+  "../../../bin/test_experimental_mpl_mpl_algorithm.pdb"
+  "CMakeFiles/test_experimental_mpl_mpl_algorithm.dir/mpl_algorithm.t.cpp.o"
+  "CMakeFiles/test_experimental_mpl_mpl_algorithm.dir/mpl_algorithm.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_mpl_mpl_algorithm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_mpl_mpl_traits"
+  "../../../bin/test_experimental_mpl_mpl_traits.pdb"
+  "CMakeFiles/test_experimental_mpl_mpl_traits.dir/mpl_traits.t.cpp.o"
+  "CMakeFiles/test_experimental_mpl_mpl_traits.dir/mpl_traits.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_mpl_mpl_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_mpl_mpl_types"
+  "../../../bin/test_experimental_mpl_mpl_types.pdb"
+  "CMakeFiles/test_experimental_mpl_mpl_types.dir/mpl_types.t.cpp.o"
+  "CMakeFiles/test_experimental_mpl_mpl_types.dir/mpl_types.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_mpl_mpl_types.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/meta
+# Build directory: /root/repo/_bench_build/tests/experimental/meta
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_mpl.hpp: mpl_algorithm]=] "/root/repo/_bench_build/bin/test_experimental_mpl_mpl_algorithm")
+set_tests_properties([=[experimental_mpl.hpp: mpl_algorithm]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;0;")
+add_test([=[experimental_mpl.hpp: mpl_traits]=] "/root/repo/_bench_build/bin/test_experimental_mpl_mpl_traits")
+set_tests_properties([=[experimental_mpl.hpp: mpl_traits]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;0;")
+add_test([=[experimental_mpl.hpp: mpl_types]=] "/root/repo/_bench_build/bin/test_experimental_mpl_mpl_types")
+set_tests_properties([=[experimental_mpl.hpp: mpl_types]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/experimental/meta/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_net_buffer"
+  "../../../bin/test_experimental_net_buffer.pdb"
+  "CMakeFiles/test_experimental_net_buffer.dir/buffer.t.cpp.o"
+  "CMakeFiles/test_experimental_net_buffer.dir/buffer.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_net_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
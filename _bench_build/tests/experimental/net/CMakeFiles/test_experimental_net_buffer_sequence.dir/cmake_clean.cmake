@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_net_buffer_sequence"
+  "../../../bin/test_experimental_net_buffer_sequence.pdb"
+  "CMakeFiles/test_experimental_net_buffer_sequence.dir/buffer_sequence.t.cpp.o"
+  "CMakeFiles/test_experimental_net_buffer_sequence.dir/buffer_sequence.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_net_buffer_sequence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_net_byte_order"
+  "../../../bin/test_experimental_net_byte_order.pdb"
+  "CMakeFiles/test_experimental_net_byte_order.dir/byte_order.t.cpp.o"
+  "CMakeFiles/test_experimental_net_byte_order.dir/byte_order.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_net_byte_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
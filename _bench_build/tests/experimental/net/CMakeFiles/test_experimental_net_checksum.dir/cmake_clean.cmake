@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_net_checksum"
+  "../../../bin/test_experimental_net_checksum.pdb"
+  "CMakeFiles/test_experimental_net_checksum.dir/checksum.t.cpp.o"
+  "CMakeFiles/test_experimental_net_checksum.dir/checksum.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_net_checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
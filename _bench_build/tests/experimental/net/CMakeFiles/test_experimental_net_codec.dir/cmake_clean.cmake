@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_net_codec"
+  "../../../bin/test_experimental_net_codec.pdb"
+  "CMakeFiles/test_experimental_net_codec.dir/codec.t.cpp.o"
+  "CMakeFiles/test_experimental_net_codec.dir/codec.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_net_codec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/net
+# Build directory: /root/repo/_bench_build/tests/experimental/net
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_net.hpp: buffer]=] "/root/repo/_bench_build/bin/test_experimental_net_buffer")
+set_tests_properties([=[experimental_net.hpp: buffer]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/net/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/experimental/net/CMakeLists.txt;0;")
+add_test([=[experimental_net.hpp: buffer_sequence]=] "/root/repo/_bench_build/bin/test_experimental_net_buffer_sequence")
+set_tests_properties([=[experimental_net.hpp: buffer_sequence]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/net/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/experimental/net/CMakeLists.txt;0;")
+add_test([=[experimental_net.hpp: byte_order]=] "/root/repo/_bench_build/bin/test_experimental_net_byte_order")
+set_tests_properties([=[experimental_net.hpp: byte_order]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/net/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/experimental/net/CMakeLists.txt;0;")
+add_test([=[experimental_net.hpp: checksum]=] "/root/repo/_bench_build/bin/test_experimental_net_checksum")
+set_tests_properties([=[experimental_net.hpp: checksum]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/net/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/experimental/net/CMakeLists.txt;0;")
+add_test([=[experimental_net.hpp: codec]=] "/root/repo/_bench_build/bin/test_experimental_net_codec")
+set_tests_properties([=[experimental_net.hpp: codec]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/net/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/experimental/net/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_stm32_gpio"
+  "../../../bin/test_experimental_stm32_gpio.pdb"
+  "CMakeFiles/test_experimental_stm32_gpio.dir/gpio.t.cpp.o"
+  "CMakeFiles/test_experimental_stm32_gpio.dir/gpio.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_stm32_gpio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_stm32_interrupt"
+  "../../../bin/test_experimental_stm32_interrupt.pdb"
+  "CMakeFiles/test_experimental_stm32_interrupt.dir/interrupt.t.cpp.o"
+  "CMakeFiles/test_experimental_stm32_interrupt.dir/interrupt.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_stm32_interrupt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
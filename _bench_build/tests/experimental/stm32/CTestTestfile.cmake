@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/stm32
+# Build directory: /root/repo/_bench_build/tests/experimental/stm32
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_stm32.hpp: gpio]=] "/root/repo/_bench_build/bin/test_experimental_stm32_gpio")
+set_tests_properties([=[experimental_stm32.hpp: gpio]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/stm32/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/experimental/stm32/CMakeLists.txt;0;")
+add_test([=[experimental_stm32.hpp: interrupt]=] "/root/repo/_bench_build/bin/test_experimental_stm32_interrupt")
+set_tests_properties([=[experimental_stm32.hpp: interrupt]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/stm32/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/experimental/stm32/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_strong_type_strong_type"
+  "../../../bin/test_experimental_strong_type_strong_type.pdb"
+  "CMakeFiles/test_experimental_strong_type_strong_type.dir/strong_type.t.cpp.o"
+  "CMakeFiles/test_experimental_strong_type_strong_type.dir/strong_type.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_strong_type_strong_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/strong_type
+# Build directory: /root/repo/_bench_build/tests/experimental/strong_type
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_strong_type.hpp: strong_type]=] "/root/repo/_bench_build/bin/test_experimental_strong_type_strong_type")
+set_tests_properties([=[experimental_strong_type.hpp: strong_type]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/strong_type/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/experimental/strong_type/CMakeLists.txt;0;")
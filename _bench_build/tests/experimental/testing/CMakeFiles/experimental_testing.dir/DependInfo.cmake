@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/experimental/testing/test_benchmark.cpp" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_benchmark.cpp.o" "gcc" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_benchmark.cpp.o.d"
+  "/root/repo/tests/experimental/testing/test_main.cpp" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_main.cpp.o" "gcc" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_main.cpp.o.d"
+  "/root/repo/tests/experimental/testing/test_test_case.cpp" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_test_case.cpp.o" "gcc" "tests/experimental/testing/CMakeFiles/experimental_testing.dir/test_test_case.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/experimental_testing"
+  "../../../bin/experimental_testing.pdb"
+  "CMakeFiles/experimental_testing.dir/test_benchmark.cpp.o"
+  "CMakeFiles/experimental_testing.dir/test_benchmark.cpp.o.d"
+  "CMakeFiles/experimental_testing.dir/test_main.cpp.o"
+  "CMakeFiles/experimental_testing.dir/test_main.cpp.o.d"
+  "CMakeFiles/experimental_testing.dir/test_test_case.cpp.o"
+  "CMakeFiles/experimental_testing.dir/test_test_case.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/experimental_testing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
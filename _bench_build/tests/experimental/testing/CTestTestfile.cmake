@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/testing
+# Build directory: /root/repo/_bench_build/tests/experimental/testing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_testing]=] "/root/repo/_bench_build/bin/experimental_testing")
+set_tests_properties([=[experimental_testing]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/experimental/testing/CMakeLists.txt;9;add_test;/root/repo/tests/experimental/testing/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_trace_threads"
+  "../../../bin/test_experimental_trace_threads.pdb"
+  "CMakeFiles/test_experimental_trace_threads.dir/threads.t.cpp.o"
+  "CMakeFiles/test_experimental_trace_threads.dir/threads.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_trace_threads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/test_experimental_trace_trace"
+  "../../../bin/test_experimental_trace_trace.pdb"
+  "CMakeFiles/test_experimental_trace_trace.dir/trace.t.cpp.o"
+  "CMakeFiles/test_experimental_trace_trace.dir/trace.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_experimental_trace_trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
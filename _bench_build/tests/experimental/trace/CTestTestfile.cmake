@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/experimental/trace
+# Build directory: /root/repo/_bench_build/tests/experimental/trace
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[experimental_trace.hpp: ring_buffer]=] "/root/repo/_bench_build/bin/test_experimental_trace_ring_buffer")
+set_tests_properties([=[experimental_trace.hpp: ring_buffer]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;0;")
+add_test([=[experimental_trace.hpp: threads]=] "/root/repo/_bench_build/bin/test_experimental_trace_threads")
+set_tests_properties([=[experimental_trace.hpp: threads]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;0;")
+add_test([=[experimental_trace.hpp: trace]=] "/root/repo/_bench_build/bin/test_experimental_trace_trace")
+set_tests_properties([=[experimental_trace.hpp: trace]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/experimental/trace/CMakeLists.txt;0;")
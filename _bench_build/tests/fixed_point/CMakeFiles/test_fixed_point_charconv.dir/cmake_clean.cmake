@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_fixed_point_charconv"
+  "../../bin/test_fixed_point_charconv.pdb"
+  "CMakeFiles/test_fixed_point_charconv.dir/charconv.t.cpp.o"
+  "CMakeFiles/test_fixed_point_charconv.dir/charconv.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fixed_point_charconv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_fixed_point_fixed_point"
+  "../../bin/test_fixed_point_fixed_point.pdb"
+  "CMakeFiles/test_fixed_point_fixed_point.dir/fixed_point.t.cpp.o"
+  "CMakeFiles/test_fixed_point_fixed_point.dir/fixed_point.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fixed_point_fixed_point.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_fixed_point_math"
+  "../../bin/test_fixed_point_math.pdb"
+  "CMakeFiles/test_fixed_point_math.dir/math.t.cpp.o"
+  "CMakeFiles/test_fixed_point_math.dir/math.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fixed_point_math.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/fixed_point
+# Build directory: /root/repo/_bench_build/tests/fixed_point
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[fixed_point.hpp: charconv]=] "/root/repo/_bench_build/bin/test_fixed_point_charconv")
+set_tests_properties([=[fixed_point.hpp: charconv]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/fixed_point/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/fixed_point/CMakeLists.txt;0;")
+add_test([=[fixed_point.hpp: fixed_point]=] "/root/repo/_bench_build/bin/test_fixed_point_fixed_point")
+set_tests_properties([=[fixed_point.hpp: fixed_point]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/fixed_point/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/fixed_point/CMakeLists.txt;0;")
+add_test([=[fixed_point.hpp: math]=] "/root/repo/_bench_build/bin/test_fixed_point_math")
+set_tests_properties([=[fixed_point.hpp: math]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/fixed_point/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/fixed_point/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_flat_set_flat_set"
+  "../../bin/test_flat_set_flat_set.pdb"
+  "CMakeFiles/test_flat_set_flat_set.dir/flat_set.t.cpp.o"
+  "CMakeFiles/test_flat_set_flat_set.dir/flat_set.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_flat_set_flat_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
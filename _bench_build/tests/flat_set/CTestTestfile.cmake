@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/flat_set
+# Build directory: /root/repo/_bench_build/tests/flat_set
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[flat_set.hpp: flat_set]=] "/root/repo/_bench_build/bin/test_flat_set_flat_set")
+set_tests_properties([=[flat_set.hpp: flat_set]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/flat_set/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/flat_set/CMakeLists.txt;0;")
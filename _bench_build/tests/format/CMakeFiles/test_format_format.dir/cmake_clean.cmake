@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_format_format"
+  "../../bin/test_format_format.pdb"
+  "CMakeFiles/test_format_format.dir/format.t.cpp.o"
+  "CMakeFiles/test_format_format.dir/format.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_format_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
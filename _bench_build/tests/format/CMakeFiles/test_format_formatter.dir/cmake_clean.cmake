@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_format_formatter"
+  "../../bin/test_format_formatter.pdb"
+  "CMakeFiles/test_format_formatter.dir/formatter.t.cpp.o"
+  "CMakeFiles/test_format_formatter.dir/formatter.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_format_formatter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
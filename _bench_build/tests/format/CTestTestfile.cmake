@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/format
+# Build directory: /root/repo/_bench_build/tests/format
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[format.hpp: format]=] "/root/repo/_bench_build/bin/test_format_format")
+set_tests_properties([=[format.hpp: format]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/format/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/format/CMakeLists.txt;0;")
+add_test([=[format.hpp: formatter]=] "/root/repo/_bench_build/bin/test_format_formatter")
+set_tests_properties([=[format.hpp: formatter]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/format/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/format/CMakeLists.txt;0;")
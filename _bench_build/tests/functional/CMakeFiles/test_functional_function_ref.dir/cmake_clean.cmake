@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_function_ref"
+  "../../bin/test_functional_function_ref.pdb"
+  "CMakeFiles/test_functional_function_ref.dir/function_ref.t.cpp.o"
+  "CMakeFiles/test_functional_function_ref.dir/function_ref.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_function_ref.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_hash"
+  "../../bin/test_functional_hash.pdb"
+  "CMakeFiles/test_functional_hash.dir/hash.t.cpp.o"
+  "CMakeFiles/test_functional_hash.dir/hash.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_invoke"
+  "../../bin/test_functional_invoke.pdb"
+  "CMakeFiles/test_functional_invoke.dir/invoke.t.cpp.o"
+  "CMakeFiles/test_functional_invoke.dir/invoke.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_invoke.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
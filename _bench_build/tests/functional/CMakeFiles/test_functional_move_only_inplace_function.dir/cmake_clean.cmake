@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_move_only_inplace_function"
+  "../../bin/test_functional_move_only_inplace_function.pdb"
+  "CMakeFiles/test_functional_move_only_inplace_function.dir/move_only_inplace_function.t.cpp.o"
+  "CMakeFiles/test_functional_move_only_inplace_function.dir/move_only_inplace_function.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_move_only_inplace_function.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
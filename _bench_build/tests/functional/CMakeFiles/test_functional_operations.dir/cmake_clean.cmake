@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_operations"
+  "../../bin/test_functional_operations.pdb"
+  "CMakeFiles/test_functional_operations.dir/operations.t.cpp.o"
+  "CMakeFiles/test_functional_operations.dir/operations.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_operations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_functional_reference_wrapper"
+  "../../bin/test_functional_reference_wrapper.pdb"
+  "CMakeFiles/test_functional_reference_wrapper.dir/reference_wrapper.t.cpp.o"
+  "CMakeFiles/test_functional_reference_wrapper.dir/reference_wrapper.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_functional_reference_wrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/functional
+# Build directory: /root/repo/_bench_build/tests/functional
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[functional.hpp: function_ref]=] "/root/repo/_bench_build/bin/test_functional_function_ref")
+set_tests_properties([=[functional.hpp: function_ref]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: hash]=] "/root/repo/_bench_build/bin/test_functional_hash")
+set_tests_properties([=[functional.hpp: hash]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: inplace_function]=] "/root/repo/_bench_build/bin/test_functional_inplace_function")
+set_tests_properties([=[functional.hpp: inplace_function]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: invoke]=] "/root/repo/_bench_build/bin/test_functional_invoke")
+set_tests_properties([=[functional.hpp: invoke]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: move_only_inplace_function]=] "/root/repo/_bench_build/bin/test_functional_move_only_inplace_function")
+set_tests_properties([=[functional.hpp: move_only_inplace_function]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: operations]=] "/root/repo/_bench_build/bin/test_functional_operations")
+set_tests_properties([=[functional.hpp: operations]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;8;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
+add_test([=[functional.hpp: reference_wrapper]=] "/root/repo/_bench_build/bin/test_functional_reference_wrapper")
+set_tests_properties([=[functional.hpp: reference_wrapper]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/functional/CMakeLists.txt;9;tetl_add_test;/root/repo/tests/functional/CMakeLists.txt;0;")
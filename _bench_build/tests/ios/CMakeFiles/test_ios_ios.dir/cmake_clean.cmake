@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_ios_ios"
+  "../../bin/test_ios_ios.pdb"
+  "CMakeFiles/test_ios_ios.dir/ios.t.cpp.o"
+  "CMakeFiles/test_ios_ios.dir/ios.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ios_ios.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/ios
+# Build directory: /root/repo/_bench_build/tests/ios
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[ios.hpp: ios]=] "/root/repo/_bench_build/bin/test_ios_ios")
+set_tests_properties([=[ios.hpp: ios]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/ios/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/ios/CMakeLists.txt;0;")
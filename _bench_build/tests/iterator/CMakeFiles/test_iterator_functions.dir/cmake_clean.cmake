@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_iterator_functions"
+  "../../bin/test_iterator_functions.pdb"
+  "CMakeFiles/test_iterator_functions.dir/functions.t.cpp.o"
+  "CMakeFiles/test_iterator_functions.dir/functions.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iterator_functions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_iterator_insert_iterator"
+  "../../bin/test_iterator_insert_iterator.pdb"
+  "CMakeFiles/test_iterator_insert_iterator.dir/insert_iterator.t.cpp.o"
+  "CMakeFiles/test_iterator_insert_iterator.dir/insert_iterator.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iterator_insert_iterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/iterator
+# Build directory: /root/repo/_bench_build/tests/iterator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[iterator.hpp: functions]=] "/root/repo/_bench_build/bin/test_iterator_functions")
+set_tests_properties([=[iterator.hpp: functions]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/iterator/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/iterator/CMakeLists.txt;0;")
+add_test([=[iterator.hpp: insert_iterator]=] "/root/repo/_bench_build/bin/test_iterator_insert_iterator")
+set_tests_properties([=[iterator.hpp: insert_iterator]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/iterator/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/iterator/CMakeLists.txt;0;")
+add_test([=[iterator.hpp: reverse_iterator]=] "/root/repo/_bench_build/bin/test_iterator_reverse_iterator")
+set_tests_properties([=[iterator.hpp: reverse_iterator]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/iterator/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/iterator/CMakeLists.txt;0;")
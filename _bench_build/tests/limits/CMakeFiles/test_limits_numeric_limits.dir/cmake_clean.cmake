@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_limits_numeric_limits"
+  "../../bin/test_limits_numeric_limits.pdb"
+  "CMakeFiles/test_limits_numeric_limits.dir/numeric_limits.t.cpp.o"
+  "CMakeFiles/test_limits_numeric_limits.dir/numeric_limits.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_limits_numeric_limits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/limits
+# Build directory: /root/repo/_bench_build/tests/limits
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[limits.hpp: numeric_limits]=] "/root/repo/_bench_build/bin/test_limits_numeric_limits")
+set_tests_properties([=[limits.hpp: numeric_limits]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/limits/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/limits/CMakeLists.txt;0;")
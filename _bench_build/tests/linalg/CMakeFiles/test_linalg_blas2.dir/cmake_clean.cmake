@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_linalg_blas2"
+  "../../bin/test_linalg_blas2.pdb"
+  "CMakeFiles/test_linalg_blas2.dir/blas2.t.cpp.o"
+  "CMakeFiles/test_linalg_blas2.dir/blas2.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_linalg_blas2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
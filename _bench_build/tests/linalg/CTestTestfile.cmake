@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/linalg
+# Build directory: /root/repo/_bench_build/tests/linalg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[linalg.hpp: blas1]=] "/root/repo/_bench_build/bin/test_linalg_blas1")
+set_tests_properties([=[linalg.hpp: blas1]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/linalg/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/linalg/CMakeLists.txt;0;")
+add_test([=[linalg.hpp: blas2]=] "/root/repo/_bench_build/bin/test_linalg_blas2")
+set_tests_properties([=[linalg.hpp: blas2]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/linalg/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/linalg/CMakeLists.txt;0;")
+add_test([=[linalg.hpp: blas3]=] "/root/repo/_bench_build/bin/test_linalg_blas3")
+set_tests_properties([=[linalg.hpp: blas3]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/linalg/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/linalg/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_map_static_perfect_map"
+  "../../bin/test_map_static_perfect_map.pdb"
+  "CMakeFiles/test_map_static_perfect_map.dir/static_perfect_map.t.cpp.o"
+  "CMakeFiles/test_map_static_perfect_map.dir/static_perfect_map.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_map_static_perfect_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/map
+# Build directory: /root/repo/_bench_build/tests/map
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[map.hpp: static_perfect_map]=] "/root/repo/_bench_build/bin/test_map_static_perfect_map")
+set_tests_properties([=[map.hpp: static_perfect_map]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/map/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/map/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mdspan_extents"
+  "../../bin/test_mdspan_extents.pdb"
+  "CMakeFiles/test_mdspan_extents.dir/extents.t.cpp.o"
+  "CMakeFiles/test_mdspan_extents.dir/extents.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mdspan_extents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mdspan_layout"
+  "../../bin/test_mdspan_layout.pdb"
+  "CMakeFiles/test_mdspan_layout.dir/layout.t.cpp.o"
+  "CMakeFiles/test_mdspan_layout.dir/layout.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mdspan_layout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
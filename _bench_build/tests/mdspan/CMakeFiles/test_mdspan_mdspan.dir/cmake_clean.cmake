@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mdspan_mdspan"
+  "../../bin/test_mdspan_mdspan.pdb"
+  "CMakeFiles/test_mdspan_mdspan.dir/mdspan.t.cpp.o"
+  "CMakeFiles/test_mdspan_mdspan.dir/mdspan.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mdspan_mdspan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
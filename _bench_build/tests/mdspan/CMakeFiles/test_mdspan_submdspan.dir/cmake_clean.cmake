@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mdspan_submdspan"
+  "../../bin/test_mdspan_submdspan.pdb"
+  "CMakeFiles/test_mdspan_submdspan.dir/submdspan.t.cpp.o"
+  "CMakeFiles/test_mdspan_submdspan.dir/submdspan.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mdspan_submdspan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/mdspan
+# Build directory: /root/repo/_bench_build/tests/mdspan
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[mdspan.hpp: extents]=] "/root/repo/_bench_build/bin/test_mdspan_extents")
+set_tests_properties([=[mdspan.hpp: extents]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mdspan/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/mdspan/CMakeLists.txt;0;")
+add_test([=[mdspan.hpp: layout]=] "/root/repo/_bench_build/bin/test_mdspan_layout")
+set_tests_properties([=[mdspan.hpp: layout]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mdspan/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/mdspan/CMakeLists.txt;0;")
+add_test([=[mdspan.hpp: mdspan]=] "/root/repo/_bench_build/bin/test_mdspan_mdspan")
+set_tests_properties([=[mdspan.hpp: mdspan]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mdspan/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/mdspan/CMakeLists.txt;0;")
+add_test([=[mdspan.hpp: submdspan]=] "/root/repo/_bench_build/bin/test_mdspan_submdspan")
+set_tests_properties([=[mdspan.hpp: submdspan]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mdspan/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/mdspan/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_memory_memory"
+  "../../bin/test_memory_memory.pdb"
+  "CMakeFiles/test_memory_memory.dir/memory.t.cpp.o"
+  "CMakeFiles/test_memory_memory.dir/memory.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_memory_pointer_int_pair"
+  "../../bin/test_memory_pointer_int_pair.pdb"
+  "CMakeFiles/test_memory_pointer_int_pair.dir/pointer_int_pair.t.cpp.o"
+  "CMakeFiles/test_memory_pointer_int_pair.dir/pointer_int_pair.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_pointer_int_pair.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_memory_relocate"
+  "../../bin/test_memory_relocate.pdb"
+  "CMakeFiles/test_memory_relocate.dir/relocate.t.cpp.o"
+  "CMakeFiles/test_memory_relocate.dir/relocate.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_relocate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_memory_small_ptr"
+  "../../bin/test_memory_small_ptr.pdb"
+  "CMakeFiles/test_memory_small_ptr.dir/small_ptr.t.cpp.o"
+  "CMakeFiles/test_memory_small_ptr.dir/small_ptr.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory_small_ptr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
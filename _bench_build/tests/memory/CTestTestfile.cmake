@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/memory
+# Build directory: /root/repo/_bench_build/tests/memory
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[memory.hpp: memory]=] "/root/repo/_bench_build/bin/test_memory_memory")
+set_tests_properties([=[memory.hpp: memory]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/memory/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/memory/CMakeLists.txt;0;")
+add_test([=[memory.hpp: pointer_int_pair]=] "/root/repo/_bench_build/bin/test_memory_pointer_int_pair")
+set_tests_properties([=[memory.hpp: pointer_int_pair]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/memory/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/memory/CMakeLists.txt;0;")
+add_test([=[memory.hpp: relocate]=] "/root/repo/_bench_build/bin/test_memory_relocate")
+set_tests_properties([=[memory.hpp: relocate]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/memory/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/memory/CMakeLists.txt;0;")
+add_test([=[memory.hpp: small_ptr]=] "/root/repo/_bench_build/bin/test_memory_small_ptr")
+set_tests_properties([=[memory.hpp: small_ptr]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/memory/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/memory/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mutex_lock_guard"
+  "../../bin/test_mutex_lock_guard.pdb"
+  "CMakeFiles/test_mutex_lock_guard.dir/lock_guard.t.cpp.o"
+  "CMakeFiles/test_mutex_lock_guard.dir/lock_guard.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mutex_lock_guard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_mutex_unique_lock"
+  "../../bin/test_mutex_unique_lock.pdb"
+  "CMakeFiles/test_mutex_unique_lock.dir/unique_lock.t.cpp.o"
+  "CMakeFiles/test_mutex_unique_lock.dir/unique_lock.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mutex_unique_lock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/mutex
+# Build directory: /root/repo/_bench_build/tests/mutex
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[mutex.hpp: unique_lock]=] "/root/repo/_bench_build/bin/test_mutex_unique_lock")
+set_tests_properties([=[mutex.hpp: unique_lock]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mutex/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/mutex/CMakeLists.txt;0;")
+add_test([=[mutex.hpp: lock_guard]=] "/root/repo/_bench_build/bin/test_mutex_lock_guard")
+set_tests_properties([=[mutex.hpp: lock_guard]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/mutex/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/mutex/CMakeLists.txt;0;")
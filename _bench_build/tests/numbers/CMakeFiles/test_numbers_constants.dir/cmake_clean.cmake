@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numbers_constants"
+  "../../bin/test_numbers_constants.pdb"
+  "CMakeFiles/test_numbers_constants.dir/constants.t.cpp.o"
+  "CMakeFiles/test_numbers_constants.dir/constants.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numbers_constants.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/numbers
+# Build directory: /root/repo/_bench_build/tests/numbers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[numbers.hpp: constants]=] "/root/repo/_bench_build/bin/test_numbers_constants")
+set_tests_properties([=[numbers.hpp: constants]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numbers/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/numbers/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_accumulate"
+  "../../bin/test_numeric_accumulate.pdb"
+  "CMakeFiles/test_numeric_accumulate.dir/accumulate.t.cpp.o"
+  "CMakeFiles/test_numeric_accumulate.dir/accumulate.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_accumulate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
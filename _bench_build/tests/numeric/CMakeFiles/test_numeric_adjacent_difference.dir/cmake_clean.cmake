@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_adjacent_difference"
+  "../../bin/test_numeric_adjacent_difference.pdb"
+  "CMakeFiles/test_numeric_adjacent_difference.dir/adjacent_difference.t.cpp.o"
+  "CMakeFiles/test_numeric_adjacent_difference.dir/adjacent_difference.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_adjacent_difference.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
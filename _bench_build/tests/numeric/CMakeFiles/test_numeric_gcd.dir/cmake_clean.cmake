@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_gcd"
+  "../../bin/test_numeric_gcd.pdb"
+  "CMakeFiles/test_numeric_gcd.dir/gcd.t.cpp.o"
+  "CMakeFiles/test_numeric_gcd.dir/gcd.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_gcd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
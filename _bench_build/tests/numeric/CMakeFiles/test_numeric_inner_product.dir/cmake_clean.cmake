@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_inner_product"
+  "../../bin/test_numeric_inner_product.pdb"
+  "CMakeFiles/test_numeric_inner_product.dir/inner_product.t.cpp.o"
+  "CMakeFiles/test_numeric_inner_product.dir/inner_product.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_inner_product.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_iota"
+  "../../bin/test_numeric_iota.pdb"
+  "CMakeFiles/test_numeric_iota.dir/iota.t.cpp.o"
+  "CMakeFiles/test_numeric_iota.dir/iota.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_iota.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_lcm"
+  "../../bin/test_numeric_lcm.pdb"
+  "CMakeFiles/test_numeric_lcm.dir/lcm.t.cpp.o"
+  "CMakeFiles/test_numeric_lcm.dir/lcm.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_lcm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
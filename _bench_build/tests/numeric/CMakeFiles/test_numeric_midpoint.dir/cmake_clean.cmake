@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_midpoint"
+  "../../bin/test_numeric_midpoint.pdb"
+  "CMakeFiles/test_numeric_midpoint.dir/midpoint.t.cpp.o"
+  "CMakeFiles/test_numeric_midpoint.dir/midpoint.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_midpoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
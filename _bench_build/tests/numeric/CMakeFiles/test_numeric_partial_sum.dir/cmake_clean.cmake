@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_partial_sum"
+  "../../bin/test_numeric_partial_sum.pdb"
+  "CMakeFiles/test_numeric_partial_sum.dir/partial_sum.t.cpp.o"
+  "CMakeFiles/test_numeric_partial_sum.dir/partial_sum.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_partial_sum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_reduce"
+  "../../bin/test_numeric_reduce.pdb"
+  "CMakeFiles/test_numeric_reduce.dir/reduce.t.cpp.o"
+  "CMakeFiles/test_numeric_reduce.dir/reduce.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_numeric_transform_reduce"
+  "../../bin/test_numeric_transform_reduce.pdb"
+  "CMakeFiles/test_numeric_transform_reduce.dir/transform_reduce.t.cpp.o"
+  "CMakeFiles/test_numeric_transform_reduce.dir/transform_reduce.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_numeric_transform_reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/numeric
+# Build directory: /root/repo/_bench_build/tests/numeric
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[numeric.hpp: abs]=] "/root/repo/_bench_build/bin/test_numeric_abs")
+set_tests_properties([=[numeric.hpp: abs]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: accumulate]=] "/root/repo/_bench_build/bin/test_numeric_accumulate")
+set_tests_properties([=[numeric.hpp: accumulate]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: adjacent_difference]=] "/root/repo/_bench_build/bin/test_numeric_adjacent_difference")
+set_tests_properties([=[numeric.hpp: adjacent_difference]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: gcd]=] "/root/repo/_bench_build/bin/test_numeric_gcd")
+set_tests_properties([=[numeric.hpp: gcd]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: inner_product]=] "/root/repo/_bench_build/bin/test_numeric_inner_product")
+set_tests_properties([=[numeric.hpp: inner_product]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: iota]=] "/root/repo/_bench_build/bin/test_numeric_iota")
+set_tests_properties([=[numeric.hpp: iota]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;8;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: lcm]=] "/root/repo/_bench_build/bin/test_numeric_lcm")
+set_tests_properties([=[numeric.hpp: lcm]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;9;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: midpoint]=] "/root/repo/_bench_build/bin/test_numeric_midpoint")
+set_tests_properties([=[numeric.hpp: midpoint]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;10;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: partial_sum]=] "/root/repo/_bench_build/bin/test_numeric_partial_sum")
+set_tests_properties([=[numeric.hpp: partial_sum]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;11;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: reduce]=] "/root/repo/_bench_build/bin/test_numeric_reduce")
+set_tests_properties([=[numeric.hpp: reduce]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;12;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
+add_test([=[numeric.hpp: transform_reduce]=] "/root/repo/_bench_build/bin/test_numeric_transform_reduce")
+set_tests_properties([=[numeric.hpp: transform_reduce]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/numeric/CMakeLists.txt;13;tetl_add_test;/root/repo/tests/numeric/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_optional_optional"
+  "../../bin/test_optional_optional.pdb"
+  "CMakeFiles/test_optional_optional.dir/optional.t.cpp.o"
+  "CMakeFiles/test_optional_optional.dir/optional.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_optional_optional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_optional_optional2"
+  "../../bin/test_optional_optional2.pdb"
+  "CMakeFiles/test_optional_optional2.dir/optional2.t.cpp.o"
+  "CMakeFiles/test_optional_optional2.dir/optional2.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_optional_optional2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/optional
+# Build directory: /root/repo/_bench_build/tests/optional
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[optional.hpp: optional]=] "/root/repo/_bench_build/bin/test_optional_optional")
+set_tests_properties([=[optional.hpp: optional]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/optional/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/optional/CMakeLists.txt;0;")
+add_test([=[optional.hpp: optional2]=] "/root/repo/_bench_build/bin/test_optional_optional2")
+set_tests_properties([=[optional.hpp: optional2]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/optional/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/optional/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_random_exponential_distribution"
+  "../../bin/test_random_exponential_distribution.pdb"
+  "CMakeFiles/test_random_exponential_distribution.dir/exponential_distribution.t.cpp.o"
+  "CMakeFiles/test_random_exponential_distribution.dir/exponential_distribution.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_random_exponential_distribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
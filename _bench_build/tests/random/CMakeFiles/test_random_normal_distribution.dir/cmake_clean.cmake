@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_random_normal_distribution"
+  "../../bin/test_random_normal_distribution.pdb"
+  "CMakeFiles/test_random_normal_distribution.dir/normal_distribution.t.cpp.o"
+  "CMakeFiles/test_random_normal_distribution.dir/normal_distribution.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_random_normal_distribution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_random_pcg"
+  "../../bin/test_random_pcg.pdb"
+  "CMakeFiles/test_random_pcg.dir/pcg.t.cpp.o"
+  "CMakeFiles/test_random_pcg.dir/pcg.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_random_pcg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_random_splitmix64"
+  "../../bin/test_random_splitmix64.pdb"
+  "CMakeFiles/test_random_splitmix64.dir/splitmix64.t.cpp.o"
+  "CMakeFiles/test_random_splitmix64.dir/splitmix64.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_random_splitmix64.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_random_xorshift"
+  "../../bin/test_random_xorshift.pdb"
+  "CMakeFiles/test_random_xorshift.dir/xorshift.t.cpp.o"
+  "CMakeFiles/test_random_xorshift.dir/xorshift.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_random_xorshift.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/random
+# Build directory: /root/repo/_bench_build/tests/random
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[random.hpp: discrete_distribution]=] "/root/repo/_bench_build/bin/test_random_discrete_distribution")
+set_tests_properties([=[random.hpp: discrete_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: exponential_distribution]=] "/root/repo/_bench_build/bin/test_random_exponential_distribution")
+set_tests_properties([=[random.hpp: exponential_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: normal_distribution]=] "/root/repo/_bench_build/bin/test_random_normal_distribution")
+set_tests_properties([=[random.hpp: normal_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: pcg]=] "/root/repo/_bench_build/bin/test_random_pcg")
+set_tests_properties([=[random.hpp: pcg]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: poisson_distribution]=] "/root/repo/_bench_build/bin/test_random_poisson_distribution")
+set_tests_properties([=[random.hpp: poisson_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: splitmix64]=] "/root/repo/_bench_build/bin/test_random_splitmix64")
+set_tests_properties([=[random.hpp: splitmix64]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;8;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: uniform_int_distribution]=] "/root/repo/_bench_build/bin/test_random_uniform_int_distribution")
+set_tests_properties([=[random.hpp: uniform_int_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;9;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: uniform_real_distribution]=] "/root/repo/_bench_build/bin/test_random_uniform_real_distribution")
+set_tests_properties([=[random.hpp: uniform_real_distribution]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;10;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: xorshift]=] "/root/repo/_bench_build/bin/test_random_xorshift")
+set_tests_properties([=[random.hpp: xorshift]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;11;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
+add_test([=[random.hpp: xoshiro256]=] "/root/repo/_bench_build/bin/test_random_xoshiro256")
+set_tests_properties([=[random.hpp: xoshiro256]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/random/CMakeLists.txt;12;tetl_add_test;/root/repo/tests/random/CMakeLists.txt;0;")
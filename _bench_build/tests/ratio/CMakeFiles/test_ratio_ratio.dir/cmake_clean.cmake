@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_ratio_ratio"
+  "../../bin/test_ratio_ratio.pdb"
+  "CMakeFiles/test_ratio_ratio.dir/ratio.t.cpp.o"
+  "CMakeFiles/test_ratio_ratio.dir/ratio.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ratio_ratio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/ratio
+# Build directory: /root/repo/_bench_build/tests/ratio
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[ratio.hpp: ratio]=] "/root/repo/_bench_build/bin/test_ratio_ratio")
+set_tests_properties([=[ratio.hpp: ratio]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/ratio/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/ratio/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_scope_scope_exit"
+  "../../bin/test_scope_scope_exit.pdb"
+  "CMakeFiles/test_scope_scope_exit.dir/scope_exit.t.cpp.o"
+  "CMakeFiles/test_scope_scope_exit.dir/scope_exit.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scope_scope_exit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
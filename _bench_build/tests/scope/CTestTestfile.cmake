@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/scope
+# Build directory: /root/repo/_bench_build/tests/scope
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[scope.hpp: scope_exit]=] "/root/repo/_bench_build/bin/test_scope_scope_exit")
+set_tests_properties([=[scope.hpp: scope_exit]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/scope/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/scope/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_set_static_set"
+  "../../bin/test_set_static_set.pdb"
+  "CMakeFiles/test_set_static_set.dir/static_set.t.cpp.o"
+  "CMakeFiles/test_set_static_set.dir/static_set.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_set_static_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
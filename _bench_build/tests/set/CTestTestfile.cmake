@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/set
+# Build directory: /root/repo/_bench_build/tests/set
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[set.hpp: static_set]=] "/root/repo/_bench_build/bin/test_set_static_set")
+set_tests_properties([=[set.hpp: static_set]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/set/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/set/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_simd_simd"
+  "../../bin/test_simd_simd.pdb"
+  "CMakeFiles/test_simd_simd.dir/simd.t.cpp.o"
+  "CMakeFiles/test_simd_simd.dir/simd.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_simd_simd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_simd_vmath"
+  "../../bin/test_simd_vmath.pdb"
+  "CMakeFiles/test_simd_vmath.dir/vmath.t.cpp.o"
+  "CMakeFiles/test_simd_vmath.dir/vmath.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_simd_vmath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
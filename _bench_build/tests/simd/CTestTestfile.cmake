@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/simd
+# Build directory: /root/repo/_bench_build/tests/simd
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[simd.hpp: simd]=] "/root/repo/_bench_build/bin/test_simd_simd")
+set_tests_properties([=[simd.hpp: simd]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/simd/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/simd/CMakeLists.txt;0;")
+add_test([=[simd.hpp: vmath]=] "/root/repo/_bench_build/bin/test_simd_vmath")
+set_tests_properties([=[simd.hpp: vmath]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/simd/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/simd/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_span_span"
+  "../../bin/test_span_span.pdb"
+  "CMakeFiles/test_span_span.dir/span.t.cpp.o"
+  "CMakeFiles/test_span_span.dir/span.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_span_span.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
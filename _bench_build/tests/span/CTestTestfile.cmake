@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/span
+# Build directory: /root/repo/_bench_build/tests/span
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[span.hpp: span]=] "/root/repo/_bench_build/bin/test_span_span")
+set_tests_properties([=[span.hpp: span]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/span/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/span/CMakeLists.txt;0;")
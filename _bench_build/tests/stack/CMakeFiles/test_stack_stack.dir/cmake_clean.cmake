@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_stack_stack"
+  "../../bin/test_stack_stack.pdb"
+  "CMakeFiles/test_stack_stack.dir/stack.t.cpp.o"
+  "CMakeFiles/test_stack_stack.dir/stack.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stack_stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/stack
+# Build directory: /root/repo/_bench_build/tests/stack
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[stack.hpp: stack]=] "/root/repo/_bench_build/bin/test_stack_stack")
+set_tests_properties([=[stack.hpp: stack]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/stack/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/stack/CMakeLists.txt;0;")
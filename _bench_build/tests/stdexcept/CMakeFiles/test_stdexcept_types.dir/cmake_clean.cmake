@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_stdexcept_types"
+  "../../bin/test_stdexcept_types.pdb"
+  "CMakeFiles/test_stdexcept_types.dir/types.t.cpp.o"
+  "CMakeFiles/test_stdexcept_types.dir/types.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stdexcept_types.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
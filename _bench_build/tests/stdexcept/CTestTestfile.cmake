@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/stdexcept
+# Build directory: /root/repo/_bench_build/tests/stdexcept
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[stdexcept.hpp: types]=] "/root/repo/_bench_build/bin/test_stdexcept_types")
+set_tests_properties([=[stdexcept.hpp: types]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/stdexcept/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/stdexcept/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_string_conversion"
+  "../../bin/test_string_conversion.pdb"
+  "CMakeFiles/test_string_conversion.dir/conversion.t.cpp.o"
+  "CMakeFiles/test_string_conversion.dir/conversion.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_string_conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_string_static_string"
+  "../../bin/test_string_static_string.pdb"
+  "CMakeFiles/test_string_static_string.dir/static_string.t.cpp.o"
+  "CMakeFiles/test_string_static_string.dir/static_string.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_string_static_string.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
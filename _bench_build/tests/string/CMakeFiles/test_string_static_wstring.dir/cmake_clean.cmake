@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_string_static_wstring"
+  "../../bin/test_string_static_wstring.pdb"
+  "CMakeFiles/test_string_static_wstring.dir/static_wstring.t.cpp.o"
+  "CMakeFiles/test_string_static_wstring.dir/static_wstring.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_string_static_wstring.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
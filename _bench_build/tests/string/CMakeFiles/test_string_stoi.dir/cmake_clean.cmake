@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_string_stoi"
+  "../../bin/test_string_stoi.pdb"
+  "CMakeFiles/test_string_stoi.dir/stoi.t.cpp.o"
+  "CMakeFiles/test_string_stoi.dir/stoi.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_string_stoi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
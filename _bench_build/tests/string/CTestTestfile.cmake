@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/string
+# Build directory: /root/repo/_bench_build/tests/string
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[string.hpp: conversion]=] "/root/repo/_bench_build/bin/test_string_conversion")
+set_tests_properties([=[string.hpp: conversion]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/string/CMakeLists.txt;0;")
+add_test([=[string.hpp: static_string]=] "/root/repo/_bench_build/bin/test_string_static_string")
+set_tests_properties([=[string.hpp: static_string]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/string/CMakeLists.txt;0;")
+add_test([=[string.hpp: static_wstring]=] "/root/repo/_bench_build/bin/test_string_static_wstring")
+set_tests_properties([=[string.hpp: static_wstring]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/string/CMakeLists.txt;0;")
+add_test([=[string.hpp: stoi]=] "/root/repo/_bench_build/bin/test_string_stoi")
+set_tests_properties([=[string.hpp: stoi]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/string/CMakeLists.txt;0;")
+add_test([=[string.hpp: to_string]=] "/root/repo/_bench_build/bin/test_string_to_string")
+set_tests_properties([=[string.hpp: to_string]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/string/CMakeLists.txt;0;")
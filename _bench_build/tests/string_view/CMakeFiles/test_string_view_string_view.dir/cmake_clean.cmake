@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_string_view_string_view"
+  "../../bin/test_string_view_string_view.pdb"
+  "CMakeFiles/test_string_view_string_view.dir/string_view.t.cpp.o"
+  "CMakeFiles/test_string_view_string_view.dir/string_view.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_string_view_string_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/string_view
+# Build directory: /root/repo/_bench_build/tests/string_view
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[string_view.hpp: string_view]=] "/root/repo/_bench_build/bin/test_string_view_string_view")
+set_tests_properties([=[string_view.hpp: string_view]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/string_view/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/string_view/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_tuple_tuple"
+  "../../bin/test_tuple_tuple.pdb"
+  "CMakeFiles/test_tuple_tuple.dir/tuple.t.cpp.o"
+  "CMakeFiles/test_tuple_tuple.dir/tuple.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tuple_tuple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/tuple
+# Build directory: /root/repo/_bench_build/tests/tuple
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[tuple.hpp: tuple]=] "/root/repo/_bench_build/bin/test_tuple_tuple")
+set_tests_properties([=[tuple.hpp: tuple]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/tuple/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/tuple/CMakeLists.txt;0;")
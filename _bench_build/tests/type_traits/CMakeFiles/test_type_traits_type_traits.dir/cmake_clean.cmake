@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_type_traits_type_traits"
+  "../../bin/test_type_traits_type_traits.pdb"
+  "CMakeFiles/test_type_traits_type_traits.dir/type_traits.t.cpp.o"
+  "CMakeFiles/test_type_traits_type_traits.dir/type_traits.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_traits_type_traits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_type_traits_type_traits3"
+  "../../bin/test_type_traits_type_traits3.pdb"
+  "CMakeFiles/test_type_traits_type_traits3.dir/type_traits3.t.cpp.o"
+  "CMakeFiles/test_type_traits_type_traits3.dir/type_traits3.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_traits_type_traits3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
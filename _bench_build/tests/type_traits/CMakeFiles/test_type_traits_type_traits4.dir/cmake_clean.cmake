@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_type_traits_type_traits4"
+  "../../bin/test_type_traits_type_traits4.pdb"
+  "CMakeFiles/test_type_traits_type_traits4.dir/type_traits4.t.cpp.o"
+  "CMakeFiles/test_type_traits_type_traits4.dir/type_traits4.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_traits_type_traits4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
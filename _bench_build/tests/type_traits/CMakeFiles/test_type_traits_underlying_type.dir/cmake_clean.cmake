@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_type_traits_underlying_type"
+  "../../bin/test_type_traits_underlying_type.pdb"
+  "CMakeFiles/test_type_traits_underlying_type.dir/underlying_type.t.cpp.o"
+  "CMakeFiles/test_type_traits_underlying_type.dir/underlying_type.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_type_traits_underlying_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/type_traits
+# Build directory: /root/repo/_bench_build/tests/type_traits
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[type_traits.hpp: type_traits]=] "/root/repo/_bench_build/bin/test_type_traits_type_traits")
+set_tests_properties([=[type_traits.hpp: type_traits]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/type_traits/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/type_traits/CMakeLists.txt;0;")
+add_test([=[type_traits.hpp: type_traits2]=] "/root/repo/_bench_build/bin/test_type_traits_type_traits2")
+set_tests_properties([=[type_traits.hpp: type_traits2]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/type_traits/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/type_traits/CMakeLists.txt;0;")
+add_test([=[type_traits.hpp: type_traits3]=] "/root/repo/_bench_build/bin/test_type_traits_type_traits3")
+set_tests_properties([=[type_traits.hpp: type_traits3]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/type_traits/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/type_traits/CMakeLists.txt;0;")
+add_test([=[type_traits.hpp: type_traits4]=] "/root/repo/_bench_build/bin/test_type_traits_type_traits4")
+set_tests_properties([=[type_traits.hpp: type_traits4]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/type_traits/CMakeLists.txt;6;tetl_add_test;/root/repo/tests/type_traits/CMakeLists.txt;0;")
+add_test([=[type_traits.hpp: underlying_type]=] "/root/repo/_bench_build/bin/test_type_traits_underlying_type")
+set_tests_properties([=[type_traits.hpp: underlying_type]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/type_traits/CMakeLists.txt;7;tetl_add_test;/root/repo/tests/type_traits/CMakeLists.txt;0;")
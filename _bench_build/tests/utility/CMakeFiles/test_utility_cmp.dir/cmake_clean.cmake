@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_utility_cmp"
+  "../../bin/test_utility_cmp.pdb"
+  "CMakeFiles/test_utility_cmp.dir/cmp.t.cpp.o"
+  "CMakeFiles/test_utility_cmp.dir/cmp.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utility_cmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_utility_pair"
+  "../../bin/test_utility_pair.pdb"
+  "CMakeFiles/test_utility_pair.dir/pair.t.cpp.o"
+  "CMakeFiles/test_utility_pair.dir/pair.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utility_pair.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
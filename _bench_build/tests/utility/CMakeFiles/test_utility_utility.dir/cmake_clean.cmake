@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_utility_utility"
+  "../../bin/test_utility_utility.pdb"
+  "CMakeFiles/test_utility_utility.dir/utility.t.cpp.o"
+  "CMakeFiles/test_utility_utility.dir/utility.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_utility_utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
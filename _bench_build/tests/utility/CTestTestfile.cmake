@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/utility
+# Build directory: /root/repo/_bench_build/tests/utility
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[utility.hpp: cmp]=] "/root/repo/_bench_build/bin/test_utility_cmp")
+set_tests_properties([=[utility.hpp: cmp]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/utility/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/utility/CMakeLists.txt;0;")
+add_test([=[utility.hpp: pair]=] "/root/repo/_bench_build/bin/test_utility_pair")
+set_tests_properties([=[utility.hpp: pair]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/utility/CMakeLists.txt;4;tetl_add_test;/root/repo/tests/utility/CMakeLists.txt;0;")
+add_test([=[utility.hpp: utility]=] "/root/repo/_bench_build/bin/test_utility_utility")
+set_tests_properties([=[utility.hpp: utility]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/utility/CMakeLists.txt;5;tetl_add_test;/root/repo/tests/utility/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_variant_variant"
+  "../../bin/test_variant_variant.pdb"
+  "CMakeFiles/test_variant_variant.dir/variant.t.cpp.o"
+  "CMakeFiles/test_variant_variant.dir/variant.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_variant_variant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/variant
+# Build directory: /root/repo/_bench_build/tests/variant
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[variant.hpp: variant]=] "/root/repo/_bench_build/bin/test_variant_variant")
+set_tests_properties([=[variant.hpp: variant]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/variant/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/variant/CMakeLists.txt;0;")
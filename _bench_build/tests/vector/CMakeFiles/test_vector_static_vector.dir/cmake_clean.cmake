@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_vector_static_vector"
+  "../../bin/test_vector_static_vector.pdb"
+  "CMakeFiles/test_vector_static_vector.dir/static_vector.t.cpp.o"
+  "CMakeFiles/test_vector_static_vector.dir/static_vector.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_static_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/vector
+# Build directory: /root/repo/_bench_build/tests/vector
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[vector.hpp: static_vector]=] "/root/repo/_bench_build/bin/test_vector_static_vector")
+set_tests_properties([=[vector.hpp: static_vector]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/vector/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/vector/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/test_version_version"
+  "../../bin/test_version_version.pdb"
+  "CMakeFiles/test_version_version.dir/version.t.cpp.o"
+  "CMakeFiles/test_version_version.dir/version.t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_version_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/version
+# Build directory: /root/repo/_bench_build/tests/version
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[version.hpp: version]=] "/root/repo/_bench_build/bin/test_version_version")
+set_tests_properties([=[version.hpp: version]=] PROPERTIES  WILL_FAIL "FALSE" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;12;add_test;/root/repo/tests/version/CMakeLists.txt;3;tetl_add_test;/root/repo/tests/version/CMakeLists.txt;0;")
@@ -160,7 +160,8 @@ def run_all_benchmarks(cpp_std, o):
         'all_headers.bench',
         'array.bench',
         'string.bench',
-        'tuple.bench'
+        'tuple.bench',
+        'variant.bench'
     ]:
         std = run_file(f"{cpp}", opt, define='TETL_BENCH_USE_STD=1')
         etl = run_file(f"{cpp}", opt)
@@ -0,0 +1,45 @@
+#if defined(TETL_BENCH_USE_STD)
+    #include <variant>
+
+using std::get_if;
+using std::monostate;
+using std::variant;
+using std::visit;
+#else
+    #include <etl/variant.hpp>
+
+using etl::get_if;
+using etl::monostate;
+using etl::variant;
+using etl::visit;
+#endif
+
+template <int I>
+struct message {
+    int payload;
+};
+
+using message_t = variant<monostate, message<1>, message<2>, message<3>, message<4>, message<5>, message<6>,
+    message<7>, message<8>, message<9>, message<10>, message<11>, message<12>, message<13>, message<14>,
+    message<15>, message<16>, message<17>, message<18>, message<19>>;
+
+auto payload(message_t const& m) -> int
+{
+    return visit(
+        [](auto const& msg) -> int {
+            if constexpr (requires { msg.payload; }) {
+                return msg.payload;
+            } else {
+                return 0;
+            }
+        },
+        m);
+}
+
+auto same_kind(message_t const& lhs, message_t const& rhs) -> bool
+{
+    return visit([](auto const& l, auto const& r) { return sizeof(l) == sizeof(r); }, lhs, rhs);
+}
+
+auto first(message_t* m) -> message<1>* { return get_if<message<1>>(m); }
+auto last(message_t* m) -> message<19>* { return get_if<message<19>>(m); }
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// sort and stable_sort of random integers against the standard library. The
+// unsorted input is copied into the work buffer on every call, the copy is
+// part of both measurements.
+
+#include "harness.hpp"
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace {
+
+template <etl::size_t Size>
+auto run(bench::suite& suite) -> void
+{
+    static auto input = [] {
+        auto values = etl::array<int, Size> {};
+        auto rng    = std::mt19937 { 42 };
+        for (auto& v : values) { v = static_cast<int>(rng() % 1000U); }
+        return values;
+    }();
+    static auto work = etl::array<int, Size> {};
+
+    auto const n      = std::to_string(Size);
+    auto const sorted = [](auto sort) {
+        return [sort] {
+            work = input;
+            sort(work.begin(), work.end());
+            bench::do_not_optimize(work);
+        };
+    };
+
+    suite.run("sort/etl/" + n, Size, sorted([](auto f, auto l) { etl::sort(f, l); }));
+    suite.run("sort/std/" + n, Size, sorted([](auto f, auto l) { std::sort(f, l); }));
+    suite.run("stable_sort/etl/" + n, Size, sorted([](auto f, auto l) { etl::stable_sort(f, l); }));
+    suite.run("stable_sort/std/" + n, Size, sorted([](auto f, auto l) { std::stable_sort(f, l); }));
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+    run<16>(suite);
+    run<256>(suite);
+    run<2048>(suite);
+    return 0;
+}
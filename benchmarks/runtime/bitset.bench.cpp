@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// bitset set/test, bitwise operators and count against std::bitset.
+
+#include "harness.hpp"
+
+#include <etl/bitset.hpp>
+
+#include <bitset>
+#include <random>
+#include <string>
+
+namespace {
+
+template <typename Bitset, etl::size_t Size>
+auto run(bench::suite& suite, std::string const& name) -> void
+{
+    static auto a = Bitset {};
+    static auto b = Bitset {};
+    auto rng      = std::mt19937 { 42 };
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        a.set(i, (rng() & 1U) != 0);
+        b.set(i, (rng() & 1U) != 0);
+    }
+
+    auto const prefix = name + "/" + std::to_string(Size);
+
+    suite.run(prefix + "/set", Size, [] {
+        for (auto i = etl::size_t(0); i < Size; i += 3) { a.set(i, not a.test(i)); }
+        bench::do_not_optimize(a);
+    });
+    suite.run(prefix + "/test", Size, [] {
+        auto n = etl::size_t(0);
+        for (auto i = etl::size_t(0); i < Size; ++i) { n += a.test(i) ? 1U : 0U; }
+        return n;
+    });
+    suite.run(prefix + "/and_or_xor", Size, [] {
+        auto c = a;
+        c &= b;
+        c |= a;
+        c ^= b;
+        return c.count();
+    });
+    suite.run(prefix + "/count", Size, [] {
+        bench::do_not_optimize(a);
+        return a.count();
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+    run<etl::bitset<64>, 64>(suite, "etl");
+    run<std::bitset<64>, 64>(suite, "std");
+    run<etl::bitset<1024>, 1024>(suite, "etl");
+    run<std::bitset<1024>, 1024>(suite, "std");
+    return 0;
+}
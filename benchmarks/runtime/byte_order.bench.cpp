@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// In-place conversion of big-endian sample streams with convert_endian
+// against a plain ntohl loop. convert_endian is only faster, if the target
+// has a byte shuffle instruction, e.g. build with -march=x86-64-v2.
+
+#include "harness.hpp"
+
+#include <etl/experimental/net/byte_order.hpp>
+
+#include <arpa/inet.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+template <typename T>
+auto run(bench::suite& suite, char const* type, std::size_t size) -> void
+{
+    auto data = std::vector<T>(size);
+    for (auto i = std::size_t(0); i < size; ++i) { data[i] = static_cast<T>(i); }
+
+    auto const n = std::to_string(size);
+    suite.run(std::string("convert_endian/") + type + "/" + n, static_cast<double>(size), [&data] {
+        etl::experimental::net::convert_endian(etl::span<T> { data.data(), data.size() });
+        bench::clobber();
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    for (auto size : { std::size_t(64), std::size_t(4096) }) {
+        run<std::uint32_t>(suite, "uint32", size);
+        run<std::uint64_t>(suite, "uint64", size);
+        run<float>(suite, "float", size);
+
+        auto data = std::vector<std::uint32_t>(size);
+        suite.run("ntohl/uint32/" + std::to_string(size), static_cast<double>(size), [&data] {
+            for (auto& v : data) { v = ntohl(v); }
+            bench::clobber();
+        });
+    }
+
+    return 0;
+}
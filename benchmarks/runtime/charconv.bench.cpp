@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Integer to_chars and from_chars against std::to_chars and std::from_chars.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/charconv.hpp>
+
+#include <charconv>
+#include <random>
+
+namespace {
+
+constexpr auto count = etl::size_t(1024);
+
+etl::array<int, count> values {};
+etl::array<etl::array<char, 16>, count> strings {};
+etl::array<char, 16> buffer {};
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto rng = std::mt19937 { 42 };
+    for (auto i = etl::size_t(0); i < count; ++i) {
+        values[i] = static_cast<int>(rng()) >> static_cast<int>(rng() % 31U);
+        std::to_chars(strings[i].begin(), strings[i].end(), values[i]);
+    }
+
+    auto suite = bench::suite { argc, argv };
+
+    suite.run("to_chars/etl", count, [] {
+        for (auto v : values) {
+            auto const res = etl::to_chars(buffer.begin(), buffer.end(), v);
+            bench::do_not_optimize(res.ptr);
+        }
+        bench::clobber();
+    });
+    suite.run("to_chars/std", count, [] {
+        for (auto v : values) {
+            auto const res = std::to_chars(buffer.begin(), buffer.end(), v);
+            bench::do_not_optimize(res.ptr);
+        }
+        bench::clobber();
+    });
+
+    suite.run("from_chars/etl", count, [] {
+        auto sum = 0;
+        for (auto const& str : strings) {
+            auto value = 0;
+            (void)etl::from_chars(str.begin(), str.end(), value);
+            sum += value;
+        }
+        return sum;
+    });
+    suite.run("from_chars/std", count, [] {
+        auto sum = 0;
+        for (auto const& str : strings) {
+            auto value = 0;
+            (void)std::from_chars(str.begin(), str.end(), value);
+            sum += value;
+        }
+        return sum;
+    });
+    return 0;
+}
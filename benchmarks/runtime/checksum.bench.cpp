@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Throughput of the checksum engines over frames of 64 bytes to 64 KiB. One
+// operation is one byte.
+// CRC-32C uses the hardware instruction only, if the build enables it, e.g.
+// with -march=x86-64-v2. The crc32c/by1 variant always uses the table.
+
+#include "harness.hpp"
+
+#include <etl/experimental/net/checksum.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace net = etl::experimental::net;
+
+namespace {
+
+template <typename Checksum>
+auto run(bench::suite& suite, char const* name, std::vector<std::uint8_t> const& data) -> void
+{
+    auto const label = std::string(name) + "/" + std::to_string(data.size());
+    suite.run(label, static_cast<double>(data.size()), [&data] {
+        return Checksum {}.update(etl::span<std::uint8_t const> { data.data(), data.size() }).value();
+    });
+}
+
+template <typename T, T Poly, T Init, bool Reflect, T XorOut>
+using crc_by1 = net::basic_crc<T, Poly, Init, Reflect, XorOut, 1>;
+
+template <typename T, T Poly, T Init, bool Reflect, T XorOut>
+using crc_by4 = net::basic_crc<T, Poly, Init, Reflect, XorOut, 4>;
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv, "GB/s" };
+
+    for (auto size : { std::size_t(64), std::size_t(1500), std::size_t(65536) }) {
+        auto data = std::vector<std::uint8_t>(size);
+        for (auto i = std::size_t(0); i < size; ++i) { data[i] = static_cast<std::uint8_t>(i * 131U + 7U); }
+
+        run<net::crc8>(suite, "crc8/by8", data);
+        run<net::crc16>(suite, "crc16/by8", data);
+        run<crc_by1<std::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF>>(suite, "crc32/by1", data);
+        run<crc_by4<std::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF>>(suite, "crc32/by4", data);
+        run<net::crc32>(suite, "crc32/by8", data);
+        run<crc_by1<std::uint32_t, 0x1EDC6F41, 0xFFFFFFFF, true, 0xFFFFFFFF>>(suite, "crc32c/by1", data);
+        run<net::crc32c>(suite, "crc32c", data);
+        run<net::adler32>(suite, "adler32", data);
+        run<net::fletcher16>(suite, "fletcher16", data);
+        run<net::fletcher32>(suite, "fletcher32", data);
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Runtime cost and accuracy of exp, log, sin, cos, tan and sqrt: the constexpr
+// implementation (gcem), the polynomial kernels used without libm, etl::xxx,
+// which calls the builtins in hosted builds, and libm. The error is measured
+// in ULP against the long double result of libm.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr auto count = 4096;
+
+etl::array<double, count> inputs {};
+etl::array<double, count> outputs {};
+
+template <typename Func, typename Reference>
+auto measure(bench::suite& suite, std::string const& name, Func func, Reference reference) -> void
+{
+    auto const run = [func] {
+        for (auto i = 0; i < count; ++i) { outputs[i] = func(inputs[i]); }
+        bench::do_not_optimize(outputs);
+    };
+
+    if (not suite.run(name, count, run) or suite.json()) { return; }
+
+    run();
+    auto max_ulp  = 0.0;
+    auto mean_ulp = 0.0;
+    for (auto i = 0; i < count; ++i) {
+        auto const expected = reference(static_cast<long double>(inputs[i]));
+        auto const rounded  = static_cast<double>(expected);
+        if (not std::isfinite(rounded) or rounded == 0.0) { continue; }
+
+        auto exponent = 0;
+        std::frexp(rounded, &exponent);
+        auto const ulp   = std::ldexp(1.0L, std::max(exponent - 53, -1074));
+        auto const error = static_cast<double>(std::fabs(static_cast<long double>(outputs[i]) - expected) / ulp);
+        max_ulp          = std::max(max_ulp, error);
+        mean_ulp += error / count;
+    }
+    std::printf("%-40s %10.3f max ulp %8.3f mean ulp\n", "  accuracy", max_ulp, mean_ulp);
+}
+
+template <typename Gcem, typename Kernel, typename Etl, typename Libm, typename Reference>
+auto run(
+    bench::suite& suite,
+    std::string const& name,
+    double lo,
+    double hi,
+    Gcem gcem,
+    Kernel kernel,
+    Etl etl,
+    Libm libm,
+    Reference ref
+) -> void
+{
+    auto rng  = std::mt19937_64 { 42 };
+    auto dist = std::uniform_real_distribution<double> { lo, hi };
+    for (auto& x : inputs) { x = dist(rng); }
+
+    measure(suite, name + "/gcem", gcem, ref);
+    measure(suite, name + "/kernel", kernel, ref);
+    measure(suite, name + "/etl", etl, ref);
+    measure(suite, name + "/libm", libm, ref);
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    namespace gcem = etl::detail::gcem;
+
+    auto suite = bench::suite { argc, argv };
+
+    run(
+        suite, "exp", -700.0, 700.0,                           //
+        [](double x) { return gcem::exp(x); },                 //
+        [](double x) { return etl::detail::exp_kernel(x); },   //
+        [](double x) { return etl::exp(x); },                  //
+        [](double x) { return std::exp(x); },                  //
+        [](long double x) { return std::exp(x); });
+
+    run(
+        suite, "log", 1e-10, 1e10,                             //
+        [](double x) { return gcem::log(x); },                 //
+        [](double x) { return etl::detail::log_kernel(x); },   //
+        [](double x) { return etl::log(x); },                  //
+        [](double x) { return std::log(x); },                  //
+        [](long double x) { return std::log(x); });
+
+    run(
+        suite, "sin", -100.0, 100.0,                           //
+        [](double x) { return gcem::sin(x); },                 //
+        [](double x) { return etl::detail::sin_kernel(x); },   //
+        [](double x) { return etl::sin(x); },                  //
+        [](double x) { return std::sin(x); },                  //
+        [](long double x) { return std::sin(x); });
+
+    run(
+        suite, "cos", -100.0, 100.0,                           //
+        [](double x) { return gcem::cos(x); },                 //
+        [](double x) { return etl::detail::cos_kernel(x); },   //
+        [](double x) { return etl::cos(x); },                  //
+        [](double x) { return std::cos(x); },                  //
+        [](long double x) { return std::cos(x); });
+
+    run(
+        suite, "tan", -100.0, 100.0,                           //
+        [](double x) { return gcem::tan(x); },                 //
+        [](double x) { return etl::detail::tan_kernel(x); },   //
+        [](double x) { return etl::tan(x); },                  //
+        [](double x) { return std::tan(x); },                  //
+        [](long double x) { return std::tan(x); });
+
+    run(
+        suite, "sqrt", 0.0, 1e10,                              //
+        [](double x) { return gcem::sqrt(x); },                //
+        [](double x) { return etl::detail::sqrt_kernel(x); },  //
+        [](double x) { return etl::sqrt(x); },                 //
+        [](double x) { return std::sqrt(x); },                 //
+        [](long double x) { return std::sqrt(x); });
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// The cstring kernels against the C library, which usually dispatches to
+// vectorized implementations. Sizes are in bytes.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cstring.hpp>
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+constexpr auto capacity = etl::size_t(4096);
+
+etl::array<char, capacity + 1> source {};
+etl::array<char, capacity + 1> destination {};
+
+auto run(bench::suite& suite, etl::size_t size) -> void
+{
+    for (auto i = etl::size_t(0); i < capacity; ++i) { source[i] = static_cast<char>('a' + i % 26); }
+    source[size]      = '\0';
+    destination       = source;
+    destination[size] = '\0';
+
+    auto const n = "/" + std::to_string(size);
+
+    suite.run("strlen/etl" + n, double(size), [] { return etl::strlen(source.data()); });
+    suite.run("strlen/std" + n, double(size), [] { return std::strlen(source.data()); });
+
+    suite.run("strcmp/etl" + n, double(size), [] { return etl::strcmp(source.data(), destination.data()); });
+    suite.run("strcmp/std" + n, double(size), [] { return std::strcmp(source.data(), destination.data()); });
+
+    suite.run("memchr/etl" + n, double(size), [size] { return etl::memchr(source.data(), '\0', size); });
+    suite.run("memchr/std" + n, double(size), [size] { return std::memchr(source.data(), '\0', size); });
+
+    suite.run("memcpy/etl" + n, double(size), [size] { return etl::memcpy(destination.data(), source.data(), size); });
+    suite.run("memcpy/std" + n, double(size), [size] { return std::memcpy(destination.data(), source.data(), size); });
+
+    suite.run("memset/etl" + n, double(size), [size] { return etl::memset(destination.data(), 'x', size); });
+    suite.run("memset/std" + n, double(size), [size] { return std::memset(destination.data(), 'x', size); });
+
+    source[size] = 'a';
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv, "GB/s" };
+    run(suite, 16);
+    run(suite, 256);
+    run(suite, 4096);
+    return 0;
+}
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// format_to into a static_string against snprintf, the standard library
+// shipped with the supported compilers has no std::format_to yet.
+
+#include "harness.hpp"
+
+#include <etl/format.hpp>
+#include <etl/iterator.hpp>
+#include <etl/string.hpp>
+
+#include <cstdio>
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    suite.run("format_to/etl/string", 1, [] {
+        auto str = etl::static_string<64> {};
+        etl::format_to(etl::back_inserter(str), "name: {} {}", "sensor", 'x');
+        return str.size();
+    });
+    suite.run("format_to/snprintf/string", 1, [] {
+        char str[64] {};
+        return std::snprintf(str, sizeof(str), "name: %s %c", "sensor", 'x');
+    });
+
+    suite.run("format_to/etl/int", 1, [] {
+        auto str = etl::static_string<64> {};
+        etl::format_to(etl::back_inserter(str), "{} of {}", 12345, 67890);
+        return str.size();
+    });
+    suite.run("format_to/snprintf/int", 1, [] {
+        char str[64] {};
+        return std::snprintf(str, sizeof(str), "%d of %d", 12345, 67890);
+    });
+    return 0;
+}
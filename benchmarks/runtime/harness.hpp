@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_BENCHMARKS_RUNTIME_HARNESS_HPP
+#define TETL_BENCHMARKS_RUNTIME_HARNESS_HPP
+
+// Minimal micro-benchmark harness. Every benchmark is calibrated to run for at
+// least min_sample_seconds per sample, warmed up and then repeated for a
+// number of samples. The table (or with --json a JSON document) reports the
+// median, minimum, mean and standard deviation of the time per operation and
+// the throughput at the median in operations per nanosecond, e.g. GFLOP/s if
+// one operation is one flop.
+//
+// Command line: [--json] [--filter=<substring>] [--samples=<n>] [--warmup=<n>]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) or defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+namespace bench {
+
+/// Forces value to be computed and treats its storage as read.
+template <typename T>
+auto do_not_optimize(T const& value) -> void
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Forces value to be computed and treats its storage as read and written.
+template <typename T>
+auto do_not_optimize(T& value) -> void
+{
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#else
+    asm volatile("" : "+m,r"(value) : : "memory");
+#endif
+}
+
+/// Acts as a read and write of all memory, stores before it can not be elided.
+inline auto clobber() -> void { asm volatile("" : : : "memory"); }
+
+/// Time stamp counter on x86, zero on all other targets.
+inline auto cycles() -> std::uint64_t
+{
+#if defined(__x86_64__) or defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct result {
+    std::string name;
+    double median_ns;
+    double min_ns;
+    double mean_ns;
+    double stddev_ns;
+    double cycles;
+    double throughput;
+    std::uint64_t iterations;
+    int samples;
+};
+
+struct options {
+    bool json                 = false;
+    char const* filter        = nullptr;
+    int samples               = 15;
+    int warmup                = 2;
+    double min_sample_seconds = 0.01;
+};
+
+class suite {
+public:
+    /// throughput is the unit of the throughput column, one billion operations
+    /// per second.
+    suite(int argc, char** argv, char const* throughput = "Gop/s") : throughput_ { throughput }
+    {
+        for (auto i = 1; i < argc; ++i) {
+            auto const arg = std::string(argv[i]);
+            if (arg == "--json") {
+                options_.json = true;
+            } else if (arg.rfind("--filter=", 0) == 0) {
+                options_.filter = argv[i] + 9;
+            } else if (arg.rfind("--samples=", 0) == 0) {
+                options_.samples = std::max(1, std::atoi(argv[i] + 10));
+            } else if (arg.rfind("--warmup=", 0) == 0) {
+                options_.warmup = std::max(0, std::atoi(argv[i] + 9));
+            } else {
+                std::fprintf(stderr, "unknown argument: %s\n", argv[i]);
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        if (not options_.json) {
+            std::printf(
+                "%-40s %12s %12s %8s %10s %12s\n",
+                "benchmark",
+                "median ns",
+                "min ns",
+                "stddev",
+                "cycles",
+                throughput_
+            );
+        }
+    }
+
+    suite(suite const&)                    = delete;
+    auto operator=(suite const&) -> suite& = delete;
+
+    ~suite()
+    {
+        if (not options_.json) { return; }
+
+        std::printf("{\n  \"throughput_unit\": \"%s\",\n  \"benchmarks\": [", throughput_);
+        for (auto i = std::size_t(0); i < results_.size(); ++i) {
+            auto const& r = results_[i];
+            std::printf(
+                "%s\n    {\"name\": \"%s\", \"median_ns\": %.4f, \"min_ns\": %.4f, \"mean_ns\": %.4f, "
+                "\"stddev_ns\": %.4f, \"cycles\": %.2f, \"throughput\": %.4f, \"iterations\": %llu, "
+                "\"samples\": %d}",
+                i == 0 ? "" : ",",
+                r.name.c_str(),
+                r.median_ns,
+                r.min_ns,
+                r.mean_ns,
+                r.stddev_ns,
+                r.cycles,
+                r.throughput,
+                static_cast<unsigned long long>(r.iterations),
+                r.samples
+            );
+        }
+        std::printf("\n  ]\n}\n");
+    }
+
+    [[nodiscard]] auto json() const noexcept -> bool { return options_.json; }
+
+    /// Measures func, which performs ops operations per call. The return value
+    /// of func, if any, is passed to do_not_optimize. Returns false if the
+    /// benchmark was skipped by --filter.
+    template <typename Func>
+    auto run(std::string const& name, double ops, Func func) -> bool
+    {
+        if (options_.filter != nullptr and name.find(options_.filter) == std::string::npos) { return false; }
+
+        auto const batch = [&func](std::uint64_t n) {
+            for (auto i = std::uint64_t(0); i < n; ++i) {
+                if constexpr (std::is_void_v<decltype(func())>) {
+                    func();
+                    clobber();
+                } else {
+                    do_not_optimize(func());
+                }
+            }
+        };
+
+        // double the batch size until a single batch is long enough to time
+        auto iterations = std::uint64_t(1);
+        while (true) {
+            auto const start = clock::now();
+            batch(iterations);
+            auto const seconds = std::chrono::duration<double>(clock::now() - start).count();
+            if (seconds >= options_.min_sample_seconds or iterations >= (std::uint64_t(1) << 40U)) { break; }
+            iterations *= 2U;
+        }
+
+        for (auto i = 0; i < options_.warmup; ++i) { batch(iterations); }
+
+        auto const n = static_cast<double>(iterations) * ops;
+        auto times   = std::vector<double>(static_cast<std::size_t>(options_.samples));
+        auto cycles  = std::vector<double>(static_cast<std::size_t>(options_.samples));
+        for (auto i = std::size_t(0); i < times.size(); ++i) {
+            auto const start = clock::now();
+            auto const c0    = bench::cycles();
+            batch(iterations);
+            auto const c1   = bench::cycles();
+            auto const stop = clock::now();
+            times[i]        = std::chrono::duration<double, std::nano>(stop - start).count() / n;
+            cycles[i]       = static_cast<double>(c1 - c0) / n;
+        }
+
+        auto r       = result {};
+        r.name       = name;
+        r.iterations = iterations;
+        r.samples    = options_.samples;
+        r.min_ns     = *std::min_element(times.begin(), times.end());
+        r.mean_ns    = mean(times);
+        r.stddev_ns  = stddev(times, r.mean_ns);
+        r.median_ns  = median(times);
+        r.cycles     = median(cycles);
+        r.throughput = r.median_ns > 0.0 ? 1.0 / r.median_ns : 0.0;
+
+        if (not options_.json) {
+            auto const relative = r.mean_ns > 0.0 ? 100.0 * r.stddev_ns / r.mean_ns : 0.0;
+            std::printf(
+                "%-40s %12.3f %12.3f %7.1f%% %10.2f %12.3f\n",
+                name.c_str(),
+                r.median_ns,
+                r.min_ns,
+                relative,
+                r.cycles,
+                r.throughput
+            );
+        }
+        results_.push_back(std::move(r));
+        return true;
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    static auto mean(std::vector<double> const& v) -> double
+    {
+        auto sum = 0.0;
+        for (auto x : v) { sum += x; }
+        return sum / static_cast<double>(v.size());
+    }
+
+    static auto stddev(std::vector<double> const& v, double m) -> double
+    {
+        if (v.size() < 2) { return 0.0; }
+        auto sum = 0.0;
+        for (auto x : v) { sum += (x - m) * (x - m); }
+        return std::sqrt(sum / static_cast<double>(v.size() - 1));
+    }
+
+    static auto median(std::vector<double> v) -> double
+    {
+        std::sort(v.begin(), v.end());
+        auto const mid = v.size() / 2;
+        return v.size() % 2 == 1 ? v[mid] : (v[mid - 1] + v[mid]) / 2.0;
+    }
+
+    options options_ {};
+    char const* throughput_;
+    std::vector<result> results_ {};
+};
+
+} // namespace bench
+
+#endif // TETL_BENCHMARKS_RUNTIME_HARNESS_HPP
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Small static-size matrix kernels, as used by filter updates running at a
+// fixed rate, compared against naive triple loops over raw arrays. One
+// operation is one flop.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/linalg.hpp>
+
+#include <string>
+
+namespace {
+
+template <int N>
+struct operands {
+    etl::array<float, N * N> a {};
+    etl::array<float, N * N> b {};
+    etl::array<float, N * N> c {};
+    etl::array<float, N> x {};
+    etl::array<float, N> y {};
+
+    operands()
+    {
+        for (auto i = 0; i < N * N; ++i) {
+            a[static_cast<etl::size_t>(i)] = static_cast<float>(i % 7) * 0.25F;
+            b[static_cast<etl::size_t>(i)] = static_cast<float>(i % 5) * 0.5F;
+        }
+        for (auto i = 0; i < N; ++i) { x[static_cast<etl::size_t>(i)] = static_cast<float>(i % 3); }
+    }
+};
+
+template <int N>
+[[gnu::noipa]] auto gemm_naive(float const* a, float const* b, float* c) -> void
+{
+    for (auto i = 0; i < N; ++i) {
+        for (auto j = 0; j < N; ++j) {
+            auto sum = 0.0F;
+            for (auto k = 0; k < N; ++k) { sum += a[i * N + k] * b[k * N + j]; }
+            c[i * N + j] = sum;
+        }
+    }
+}
+
+template <int N>
+[[gnu::noipa]] auto gemm_linalg(float const* a, float const* b, float* c) -> void
+{
+    using in_t  = etl::mdspan<float const, etl::extents<int, N, N>>;
+    using out_t = etl::mdspan<float, etl::extents<int, N, N>>;
+    etl::linalg::matrix_product(in_t { a }, in_t { b }, out_t { c });
+}
+
+template <int N>
+[[gnu::noipa]] auto gemv_naive(float const* a, float const* x, float* y) -> void
+{
+    for (auto i = 0; i < N; ++i) {
+        auto sum = 0.0F;
+        for (auto j = 0; j < N; ++j) { sum += a[i * N + j] * x[j]; }
+        y[i] = sum;
+    }
+}
+
+template <int N>
+[[gnu::noipa]] auto gemv_linalg(float const* a, float const* x, float* y) -> void
+{
+    using mat_t = etl::mdspan<float const, etl::extents<int, N, N>>;
+    using vec_t = etl::mdspan<float const, etl::extents<int, N>>;
+    etl::linalg::matrix_vector_product(mat_t { a }, vec_t { x }, etl::mdspan<float, etl::extents<int, N>> { y });
+}
+
+template <int N>
+auto run(bench::suite& suite) -> void
+{
+    static operands<N> ops {};
+    auto const size      = std::to_string(N) + "x" + std::to_string(N);
+    auto const gemmFlops = 2.0 * N * N * N;
+    auto const gemvFlops = 2.0 * N * N;
+
+    suite.run("gemm/" + size + "/naive", gemmFlops, [] {
+        gemm_naive<N>(ops.a.data(), ops.b.data(), ops.c.data());
+        bench::do_not_optimize(ops.c);
+    });
+    suite.run("gemm/" + size + "/linalg", gemmFlops, [] {
+        gemm_linalg<N>(ops.a.data(), ops.b.data(), ops.c.data());
+        bench::do_not_optimize(ops.c);
+    });
+    suite.run("gemv/" + size + "/naive", gemvFlops, [] {
+        gemv_naive<N>(ops.a.data(), ops.x.data(), ops.y.data());
+        bench::do_not_optimize(ops.y);
+    });
+    suite.run("gemv/" + size + "/linalg", gemvFlops, [] {
+        gemv_linalg<N>(ops.a.data(), ops.x.data(), ops.y.data());
+        bench::do_not_optimize(ops.y);
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv, "GFLOP/s" };
+    run<4>(suite);
+    run<8>(suite);
+    run<16>(suite);
+    return 0;
+}
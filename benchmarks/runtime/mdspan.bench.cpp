@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Element access through a static-extent mdspan compared against the
+// equivalent raw pointer arithmetic. Both kernels compile to identical code:
+//
+//   objdump -d --no-show-raw-insn bench_mdspan | less  # transpose_raw vs. transpose_mdspan
+//
+// One operation is one element.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/mdspan.hpp>
+
+namespace {
+
+constexpr auto rows = 64;
+constexpr auto cols = 96;
+
+using matrix_t     = etl::mdspan<float, etl::extents<int, rows, cols>>;
+using transposed_t = etl::mdspan<float const, etl::extents<int, cols, rows>>;
+
+[[gnu::noipa]] auto transpose_raw(float* out, float const* in) -> void
+{
+    for (auto i = 0; i < rows; ++i) {
+        for (auto j = 0; j < cols; ++j) { out[i * cols + j] = in[j * rows + i] * 2.0F; }
+    }
+}
+
+[[gnu::noipa]] auto transpose_mdspan(matrix_t out, transposed_t in) -> void
+{
+    for (auto i = 0; i < out.extent(0); ++i) {
+        for (auto j = 0; j < out.extent(1); ++j) { out(i, j) = in(j, i) * 2.0F; }
+    }
+}
+
+etl::array<float, rows * cols> src {};
+etl::array<float, rows * cols> dst {};
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    static_assert(sizeof(matrix_t) == sizeof(float*));
+
+    for (auto i = 0; i < rows * cols; ++i) { src[static_cast<etl::size_t>(i)] = static_cast<float>(i % 31); }
+
+    suite.run("transpose/raw", rows * cols, [] {
+        transpose_raw(dst.data(), src.data());
+        bench::do_not_optimize(dst);
+    });
+    suite.run("transpose/mdspan", rows * cols, [] {
+        transpose_mdspan(matrix_t { dst.data() }, transposed_t { src.data() });
+        bench::do_not_optimize(dst);
+    });
+    return 0;
+}
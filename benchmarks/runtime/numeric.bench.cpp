@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Throughput of the numeric reductions over float buffers, compared against
+// the in-order accumulate/inner_product loops. One operation is one flop.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/numeric.hpp>
+
+namespace {
+
+constexpr auto size = 10'000;
+
+etl::array<float, size> x {};
+etl::array<float, size> y {};
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv, "GFLOP/s" };
+
+    for (auto i = 0; i < size; ++i) {
+        x[static_cast<etl::size_t>(i)] = static_cast<float>(i % 17) * 0.25F;
+        y[static_cast<etl::size_t>(i)] = static_cast<float>(i % 13) * 0.5F;
+    }
+
+    // sum: 1 flop per element, dot: 2 flops per element
+    suite.run("sum/accumulate", size, [] { return etl::accumulate(x.begin(), x.end(), 0.0F); });
+    suite.run("sum/reduce", size, [] { return etl::reduce(x.begin(), x.end(), 0.0F); });
+    suite.run("dot/inner_product", 2.0 * size, [] {
+        return etl::inner_product(x.begin(), x.end(), y.begin(), 0.0F);
+    });
+    suite.run("dot/transform_reduce", 2.0 * size, [] {
+        return etl::transform_reduce(x.begin(), x.end(), y.begin(), 0.0F);
+    });
+    suite.run("sum_sq/transform_reduce", 2.0 * size, [] {
+        return etl::transform_reduce(x.begin(), x.end(), 0.0F, etl::plus<> {}, [](float v) { return v * v; });
+    });
+    return 0;
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Bounded random integers: the previous modulo reduction (biased, one
+// division per value) against Lemire's multiply-shift rejection and the
+// batched generate(), which also hoists the threshold out of the loop.
+//
+// Bulk fills of 64-bit words: scalar engines against the multi-lane
+// xoshiro256++, whose state update vectorizes across lanes.
+//
+// Ziggurat normal and exponential samples against Box-Muller and inversion
+// with etl::log, etl::sqrt and etl::cos, and against libstdc++.
+//
+// One operation is one value.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/numbers.hpp>
+#include <etl/random.hpp>
+
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr auto count = 4096;
+
+etl::array<unsigned, count> buffer {};
+etl::array<etl::uint64_t, count> words {};
+etl::array<double, count> reals {};
+
+template <typename URNG>
+auto run(bench::suite& suite, char const* name, unsigned bound) -> void
+{
+    auto urng         = URNG { 42 };
+    auto dist         = etl::uniform_int_distribution<unsigned> { 0U, bound - 1U };
+    auto const prefix = std::string("uniform/") + name + "/" + std::to_string(bound) + "/";
+
+    suite.run(prefix + "modulo", count, [&] {
+        for (auto& x : buffer) { x = static_cast<unsigned>(urng() % bound); }
+        bench::do_not_optimize(buffer);
+    });
+
+    suite.run(prefix + "operator()", count, [&] {
+        for (auto& x : buffer) { x = dist(urng); }
+        bench::do_not_optimize(buffer);
+    });
+
+    suite.run(prefix + "generate", count, [&] {
+        dist.generate(buffer.begin(), buffer.end(), urng);
+        bench::do_not_optimize(buffer);
+    });
+}
+
+template <typename Engine>
+auto fill(bench::suite& suite, char const* name) -> void
+{
+    auto rng = Engine { 42 };
+    suite.run(std::string("fill/") + name, count, [&] {
+        if constexpr (requires { rng.generate(words.begin(), words.end()); }) {
+            rng.generate(words.begin(), words.end());
+        } else {
+            for (auto& x : words) { x = rng(); }
+        }
+        bench::do_not_optimize(words);
+    });
+}
+
+template <typename Func>
+auto sample(bench::suite& suite, char const* name, Func func) -> void
+{
+    auto rng = etl::xoshiro256plusplus { 42 };
+    suite.run(std::string("sample/") + name, count, [&] {
+        for (auto& x : reals) { x = static_cast<double>(func(rng)); }
+        bench::do_not_optimize(reals);
+    });
+}
+
+auto box_muller(etl::xoshiro256plusplus& rng) -> double
+{
+    auto uniform  = etl::uniform_real_distribution<double> {};
+    auto const u1 = 1.0 - uniform(rng);
+    auto const u2 = uniform(rng);
+    return etl::sqrt(-2.0 * etl::log(u1)) * etl::cos(2.0 * etl::numbers::pi * u2);
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    run<etl::xoshiro128plusplus>(suite, "xoshiro128plusplus", 6U);
+    run<etl::xoshiro128plusplus>(suite, "xoshiro128plusplus", 1'000'003U);
+    run<etl::xorshift64>(suite, "xorshift64", 1'000'003U);
+
+    fill<etl::splitmix64>(suite, "splitmix64");
+    fill<etl::pcg64>(suite, "pcg64");
+    fill<etl::xoshiro256plusplus>(suite, "xoshiro256plusplus");
+    fill<etl::xoshiro256starstar>(suite, "xoshiro256starstar");
+    fill<etl::xoshiro256plusplus_x4>(suite, "xoshiro256plusplus_x4");
+    fill<etl::xoshiro256plusplus_x8>(suite, "xoshiro256plusplus_x8");
+
+    auto normal = etl::normal_distribution<double> {};
+    sample(suite, "normal", normal);
+    sample(suite, "normal box-muller", box_muller);
+    sample(suite, "std::normal", std::normal_distribution<double> {});
+
+    auto exponential = etl::exponential_distribution<double> {};
+    sample(suite, "exponential", exponential);
+    sample(suite, "exponential inversion", [](auto& rng) {
+        auto uniform = etl::uniform_real_distribution<double> {};
+        return -etl::log(1.0 - uniform(rng));
+    });
+    sample(suite, "std::exponential", std::exponential_distribution<double> {});
+
+    sample(suite, "poisson(4)", etl::poisson_distribution<int> { 4.0 });
+    sample(suite, "std::poisson(4)", std::poisson_distribution<int> { 4.0 });
+    sample(suite, "poisson(100)", etl::poisson_distribution<int> { 100.0 });
+    sample(suite, "std::poisson(100)", std::poisson_distribution<int> { 100.0 });
+
+    auto const weights = etl::array { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+    sample(suite, "discrete(8)", etl::discrete_distribution<int, 8> { weights.begin(), weights.end() });
+    sample(suite, "std::discrete(8)", std::discrete_distribution<int> { weights.begin(), weights.end() });
+    return 0;
+}
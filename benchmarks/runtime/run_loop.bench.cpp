@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Cost of a coroutine switch on etl::run_loop, i.e. one suspend, one pass
+// through the ready queue and one resume.
+
+#include "harness.hpp"
+
+#include <etl/coroutine.hpp>
+#include <etl/experimental/posix/monotonic_clock.hpp>
+
+namespace {
+
+using loop_t    = etl::run_loop<etl::experimental::posix::monotonic_clock, 16>;
+using channel_t = etl::async_channel<int, 4, loop_t>;
+
+auto spin(loop_t& loop) -> etl::task<>
+{
+    while (true) { co_await loop.yield(); }
+}
+
+auto produce(channel_t& channel) -> etl::task<>
+{
+    for (auto i = 0;; ++i) { co_await channel.send(i); }
+}
+
+auto consume(channel_t& channel, int& sink, long& count) -> etl::task<>
+{
+    while (true) {
+        sink += co_await channel.receive();
+        ++count;
+    }
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    {
+        auto loop = loop_t {};
+        auto a    = spin(loop);
+        auto b    = spin(loop);
+        a.start();
+        b.start();
+        suite.run("run_loop/yield", 2, [&loop] { return loop.poll(); });
+    }
+
+    {
+        auto loop    = loop_t {};
+        auto channel = channel_t { loop };
+        auto sink    = 0;
+        auto count   = 0L;
+        auto p       = produce(channel);
+        auto c       = consume(channel, sink, count);
+        p.start();
+        c.start();
+        suite.run("async_channel/send+receive", 64, [&] {
+            for (auto const target = count + 64; count < target;) { loop.poll(); }
+        });
+        bench::do_not_optimize(sink);
+    }
+
+    return 0;
+}
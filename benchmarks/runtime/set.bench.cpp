@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// static_set insert and find of random integers against std::set.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/set.hpp>
+
+#include <random>
+#include <set>
+#include <string>
+
+namespace {
+
+template <etl::size_t Size>
+auto run(bench::suite& suite) -> void
+{
+    static auto keys = [] {
+        auto values = etl::array<int, Size> {};
+        auto rng    = std::mt19937 { 42 };
+        for (auto& v : values) { v = static_cast<int>(rng()); }
+        return values;
+    }();
+
+    auto const n = std::to_string(Size);
+
+    suite.run("static_set/insert/" + n, Size, [] {
+        auto set = etl::static_set<int, Size> {};
+        for (auto key : keys) { set.insert(key); }
+        return set.size();
+    });
+    suite.run("std::set/insert/" + n, Size, [] {
+        auto set = std::set<int> {};
+        for (auto key : keys) { set.insert(key); }
+        return set.size();
+    });
+
+    static auto const etl_set = etl::static_set<int, Size> { keys.begin(), keys.end() };
+    static auto const std_set = std::set<int> { keys.begin(), keys.end() };
+
+    suite.run("static_set/find/" + n, Size, [] {
+        auto found = 0;
+        for (auto key : keys) { found += etl_set.find(key + (key & 1)) != etl_set.end() ? 1 : 0; }
+        return found;
+    });
+    suite.run("std::set/find/" + n, Size, [] {
+        auto found = 0;
+        for (auto key : keys) { found += std_set.find(key + (key & 1)) != std_set.end() ? 1 : 0; }
+        return found;
+    });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+    run<16>(suite);
+    run<256>(suite);
+    run<1024>(suite);
+    return 0;
+}
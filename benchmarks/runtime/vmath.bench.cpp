@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSL-1.0
+
+// Throughput of the batched math functions vexp, vlog, vsin and vcos with
+// both accuracies, compared to a loop over the scalar etl::xxx and libm.
+// One operation is one value.
+
+#include "harness.hpp"
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/simd.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+
+namespace {
+
+constexpr auto count = 4096;
+
+etl::array<float, count> inputs {};
+etl::array<float, count> outputs {};
+
+template <typename Func>
+auto measure(bench::suite& suite, std::string const& name, Func func) -> void
+{
+    suite.run(name, count, [func] {
+        func(etl::span<float const> { inputs }, etl::span<float> { outputs });
+        bench::do_not_optimize(outputs);
+    });
+}
+
+template <typename Batched, typename Scalar, typename Libm>
+auto run(bench::suite& suite, char const* name, float lo, float hi, Batched batched, Scalar scalar, Libm libm)
+    -> void
+{
+    auto rng  = std::mt19937_64 { 42 };
+    auto dist = std::uniform_real_distribution<float> { lo, hi };
+    for (auto& x : inputs) { x = dist(rng); }
+
+    auto const prefix = std::string(name) + "/";
+    measure(suite, prefix + "etl", [scalar](auto in, auto out) {
+        for (auto i = 0U; i < in.size(); ++i) { out[i] = scalar(in[i]); }
+    });
+    measure(suite, prefix + "libm", [libm](auto in, auto out) {
+        for (auto i = 0U; i < in.size(); ++i) { out[i] = libm(in[i]); }
+    });
+    measure(suite, prefix + "precise", [batched](auto in, auto out) {
+        batched(in, out, etl::vmath_accuracy::precise);
+    });
+    measure(suite, prefix + "fast", [batched](auto in, auto out) { batched(in, out, etl::vmath_accuracy::fast); });
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    auto suite = bench::suite { argc, argv };
+
+    run(
+        suite,
+        "exp", -80.0F, 80.0F,                                               //
+        [](auto in, auto out, auto accuracy) { etl::vexp(in, out, accuracy); }, //
+        [](float x) { return etl::exp(x); },                                //
+        [](float x) { return std::exp(x); });
+
+    run(
+        suite,
+        "log", 1e-10F, 1e10F,                                               //
+        [](auto in, auto out, auto accuracy) { etl::vlog(in, out, accuracy); }, //
+        [](float x) { return etl::log(x); },                                //
+        [](float x) { return std::log(x); });
+
+    run(
+        suite,
+        "sin", -100.0F, 100.0F,                                             //
+        [](auto in, auto out, auto accuracy) { etl::vsin(in, out, accuracy); }, //
+        [](float x) { return etl::sin(x); },                                //
+        [](float x) { return std::sin(x); });
+
+    run(
+        suite,
+        "cos", -100.0F, 100.0F,                                             //
+        [](auto in, auto out, auto accuracy) { etl::vcos(in, out, accuracy); }, //
+        [](float x) { return etl::cos(x); },                                //
+        [](float x) { return std::cos(x); });
+
+    return 0;
+}
@@ -26,12 +26,14 @@
 #include <etl/cwctype.hpp>
 #include <etl/exception.hpp>
 #include <etl/expected.hpp>
+#include <etl/fixed_point.hpp>
 #include <etl/flat_set.hpp>
 #include <etl/format.hpp>
 #include <etl/functional.hpp>
 #include <etl/ios.hpp>
 #include <etl/iterator.hpp>
 #include <etl/limits.hpp>
+#include <etl/linalg.hpp>
 #include <etl/map.hpp>
 #include <etl/mdspan.hpp>
 #include <etl/memory.hpp>
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ACOS_HPP
 #define TETL_CMATH_ACOS_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto acos_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_acosf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_acos(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_acosl(arg); }
+    }
+#endif
+    return detail::gcem::acos(arg);
+}
+} // namespace detail
+
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
-[[nodiscard]] constexpr auto acos(float arg) noexcept -> float { return etl::detail::gcem::acos(arg); }
+[[nodiscard]] constexpr auto acos(float arg) noexcept -> float { return detail::acos_impl(arg); }
 
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
-[[nodiscard]] constexpr auto acosf(float arg) noexcept -> float { return etl::detail::gcem::acos(arg); }
+[[nodiscard]] constexpr auto acosf(float arg) noexcept -> float { return detail::acos_impl(arg); }
 
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
-[[nodiscard]] constexpr auto acos(double arg) noexcept -> double { return etl::detail::gcem::acos(arg); }
+[[nodiscard]] constexpr auto acos(double arg) noexcept -> double { return detail::acos_impl(arg); }
 
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
-[[nodiscard]] constexpr auto acos(long double arg) noexcept -> long double { return etl::detail::gcem::acos(arg); }
+[[nodiscard]] constexpr auto acos(long double arg) noexcept -> long double { return detail::acos_impl(arg); }
 
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
-[[nodiscard]] constexpr auto acosl(long double arg) noexcept -> long double { return etl::detail::gcem::acos(arg); }
+[[nodiscard]] constexpr auto acosl(long double arg) noexcept -> long double { return detail::acos_impl(arg); }
 
 /// \brief Computes the principal value of the arc cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acos
 template <integral T>
 [[nodiscard]] constexpr auto acos(T arg) noexcept -> double
 {
-    return etl::detail::gcem::acos(static_cast<double>(arg));
+    return detail::acos_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ACOSH_HPP
 #define TETL_CMATH_ACOSH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto acosh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_acoshf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_acosh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_acoshl(arg); }
+    }
+#endif
+    return detail::gcem::acosh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
-[[nodiscard]] constexpr auto acosh(float arg) noexcept -> float { return etl::detail::gcem::acosh(arg); }
+[[nodiscard]] constexpr auto acosh(float arg) noexcept -> float { return detail::acosh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
-[[nodiscard]] constexpr auto acoshf(float arg) noexcept -> float { return etl::detail::gcem::acosh(arg); }
+[[nodiscard]] constexpr auto acoshf(float arg) noexcept -> float { return detail::acosh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
-[[nodiscard]] constexpr auto acosh(double arg) noexcept -> double { return etl::detail::gcem::acosh(arg); }
+[[nodiscard]] constexpr auto acosh(double arg) noexcept -> double { return detail::acosh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
-[[nodiscard]] constexpr auto acosh(long double arg) noexcept -> long double { return etl::detail::gcem::acosh(arg); }
+[[nodiscard]] constexpr auto acosh(long double arg) noexcept -> long double { return detail::acosh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
-[[nodiscard]] constexpr auto acoshl(long double arg) noexcept -> long double { return etl::detail::gcem::acosh(arg); }
+[[nodiscard]] constexpr auto acoshl(long double arg) noexcept -> long double { return detail::acosh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic cosine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/acosh
 template <integral T>
 [[nodiscard]] constexpr auto acosh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::acosh(static_cast<double>(arg));
+    return detail::acosh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ASIN_HPP
 #define TETL_CMATH_ASIN_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto asin_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_asinf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_asin(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_asinl(arg); }
+    }
+#endif
+    return detail::gcem::asin(arg);
+}
+} // namespace detail
+
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
-[[nodiscard]] constexpr auto asin(float arg) noexcept -> float { return etl::detail::gcem::asin(arg); }
+[[nodiscard]] constexpr auto asin(float arg) noexcept -> float { return detail::asin_impl(arg); }
 
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
-[[nodiscard]] constexpr auto asinf(float arg) noexcept -> float { return etl::detail::gcem::asin(arg); }
+[[nodiscard]] constexpr auto asinf(float arg) noexcept -> float { return detail::asin_impl(arg); }
 
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
-[[nodiscard]] constexpr auto asin(double arg) noexcept -> double { return etl::detail::gcem::asin(arg); }
+[[nodiscard]] constexpr auto asin(double arg) noexcept -> double { return detail::asin_impl(arg); }
 
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
-[[nodiscard]] constexpr auto asin(long double arg) noexcept -> long double { return etl::detail::gcem::asin(arg); }
+[[nodiscard]] constexpr auto asin(long double arg) noexcept -> long double { return detail::asin_impl(arg); }
 
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
-[[nodiscard]] constexpr auto asinl(long double arg) noexcept -> long double { return etl::detail::gcem::asin(arg); }
+[[nodiscard]] constexpr auto asinl(long double arg) noexcept -> long double { return detail::asin_impl(arg); }
 
 /// \brief Computes the principal value of the arc sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asin
 template <integral T>
 [[nodiscard]] constexpr auto asin(T arg) noexcept -> double
 {
-    return etl::detail::gcem::asin(static_cast<double>(arg));
+    return detail::asin_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ASINH_HPP
 #define TETL_CMATH_ASINH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto asinh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_asinhf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_asinh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_asinhl(arg); }
+    }
+#endif
+    return detail::gcem::asinh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
-[[nodiscard]] constexpr auto asinh(float arg) noexcept -> float { return etl::detail::gcem::asinh(arg); }
+[[nodiscard]] constexpr auto asinh(float arg) noexcept -> float { return detail::asinh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
-[[nodiscard]] constexpr auto asinhf(float arg) noexcept -> float { return etl::detail::gcem::asinh(arg); }
+[[nodiscard]] constexpr auto asinhf(float arg) noexcept -> float { return detail::asinh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
-[[nodiscard]] constexpr auto asinh(double arg) noexcept -> double { return etl::detail::gcem::asinh(arg); }
+[[nodiscard]] constexpr auto asinh(double arg) noexcept -> double { return detail::asinh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
-[[nodiscard]] constexpr auto asinh(long double arg) noexcept -> long double { return etl::detail::gcem::asinh(arg); }
+[[nodiscard]] constexpr auto asinh(long double arg) noexcept -> long double { return detail::asinh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
-[[nodiscard]] constexpr auto asinhl(long double arg) noexcept -> long double { return etl::detail::gcem::asinh(arg); }
+[[nodiscard]] constexpr auto asinhl(long double arg) noexcept -> long double { return detail::asinh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic sine of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/asinh
 template <integral T>
 [[nodiscard]] constexpr auto asinh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::asinh(static_cast<double>(arg));
+    return detail::asinh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
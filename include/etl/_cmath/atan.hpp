@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ATAN_HPP
 #define TETL_CMATH_ATAN_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto atan_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_atanf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_atan(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_atanl(arg); }
+    }
+#endif
+    return detail::gcem::atan(arg);
+}
+} // namespace detail
+
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
-[[nodiscard]] constexpr auto atan(float arg) noexcept -> float { return etl::detail::gcem::atan(arg); }
+[[nodiscard]] constexpr auto atan(float arg) noexcept -> float { return detail::atan_impl(arg); }
 
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
-[[nodiscard]] constexpr auto atanf(float arg) noexcept -> float { return etl::detail::gcem::atan(arg); }
+[[nodiscard]] constexpr auto atanf(float arg) noexcept -> float { return detail::atan_impl(arg); }
 
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
-[[nodiscard]] constexpr auto atan(double arg) noexcept -> double { return etl::detail::gcem::atan(arg); }
+[[nodiscard]] constexpr auto atan(double arg) noexcept -> double { return detail::atan_impl(arg); }
 
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
-[[nodiscard]] constexpr auto atan(long double arg) noexcept -> long double { return etl::detail::gcem::atan(arg); }
+[[nodiscard]] constexpr auto atan(long double arg) noexcept -> long double { return detail::atan_impl(arg); }
 
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
-[[nodiscard]] constexpr auto atanl(long double arg) noexcept -> long double { return etl::detail::gcem::atan(arg); }
+[[nodiscard]] constexpr auto atanl(long double arg) noexcept -> long double { return detail::atan_impl(arg); }
 
 /// \brief Computes the principal value of the arc tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atan
 template <integral T>
 [[nodiscard]] constexpr auto atan(T arg) noexcept -> double
 {
-    return etl::detail::gcem::atan(static_cast<double>(arg));
+    return detail::atan_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
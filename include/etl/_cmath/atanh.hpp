@@ -3,36 +3,55 @@
 #ifndef TETL_CMATH_ATANH_HPP
 #define TETL_CMATH_ATANH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto atanh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_atanhf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_atanh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_atanhl(arg); }
+    }
+#endif
+    return detail::gcem::atanh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
-[[nodiscard]] constexpr auto atanh(float arg) noexcept -> float { return etl::detail::gcem::atanh(arg); }
+[[nodiscard]] constexpr auto atanh(float arg) noexcept -> float { return detail::atanh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
-[[nodiscard]] constexpr auto atanhf(float arg) noexcept -> float { return etl::detail::gcem::atanh(arg); }
+[[nodiscard]] constexpr auto atanhf(float arg) noexcept -> float { return detail::atanh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
-[[nodiscard]] constexpr auto atanh(double arg) noexcept -> double { return etl::detail::gcem::atanh(arg); }
+[[nodiscard]] constexpr auto atanh(double arg) noexcept -> double { return detail::atanh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
-[[nodiscard]] constexpr auto atanh(long double arg) noexcept -> long double { return etl::detail::gcem::atanh(arg); }
+[[nodiscard]] constexpr auto atanh(long double arg) noexcept -> long double { return detail::atanh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
-[[nodiscard]] constexpr auto atanhl(long double arg) noexcept -> long double { return etl::detail::gcem::atanh(arg); }
+[[nodiscard]] constexpr auto atanhl(long double arg) noexcept -> long double { return detail::atanh_impl(arg); }
 
 /// \brief Computes the inverse hyperbolic tangent of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/atanh
 template <integral T>
 [[nodiscard]] constexpr auto atanh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::atanh(static_cast<double>(arg));
+    return detail::atanh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -4,37 +4,56 @@
 #ifndef TETL_CMATH_CEIL_HPP
 #define TETL_CMATH_CEIL_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto ceil_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_ceilf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_ceil(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_ceill(arg); }
+    }
+#endif
+    return detail::gcem::ceil(arg);
+}
+} // namespace detail
+
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
-[[nodiscard]] constexpr auto ceil(float arg) noexcept -> float { return etl::detail::gcem::ceil(arg); }
+[[nodiscard]] constexpr auto ceil(float arg) noexcept -> float { return detail::ceil_impl(arg); }
 
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
-[[nodiscard]] constexpr auto ceilf(float arg) noexcept -> float { return etl::detail::gcem::ceil(arg); }
+[[nodiscard]] constexpr auto ceilf(float arg) noexcept -> float { return detail::ceil_impl(arg); }
 
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
-[[nodiscard]] constexpr auto ceil(double arg) noexcept -> double { return etl::detail::gcem::ceil(arg); }
+[[nodiscard]] constexpr auto ceil(double arg) noexcept -> double { return detail::ceil_impl(arg); }
 
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
-[[nodiscard]] constexpr auto ceil(long double arg) noexcept -> long double { return etl::detail::gcem::ceil(arg); }
+[[nodiscard]] constexpr auto ceil(long double arg) noexcept -> long double { return detail::ceil_impl(arg); }
 
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
-[[nodiscard]] constexpr auto ceill(long double arg) noexcept -> long double { return etl::detail::gcem::ceil(arg); }
+[[nodiscard]] constexpr auto ceill(long double arg) noexcept -> long double { return detail::ceil_impl(arg); }
 
 /// \brief Computes the smallest integer value not less than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/ceil
 template <integral T>
 [[nodiscard]] constexpr auto ceil(T arg) noexcept -> double
 {
-    return etl::detail::gcem::ceil(static_cast<double>(arg));
+    return detail::ceil_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
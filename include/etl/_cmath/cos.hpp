@@ -3,37 +3,60 @@
 #ifndef TETL_CMATH_CMATH_HPP
 #define TETL_CMATH_CMATH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/trig_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto cos_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_cosf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_cos(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_cosl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::cos_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::cos_kernel(arg); }
+#endif
+    }
+    return detail::gcem::cos(arg);
+}
+} // namespace detail
+
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
-[[nodiscard]] constexpr auto cos(float arg) noexcept -> float { return etl::detail::gcem::cos(arg); }
+[[nodiscard]] constexpr auto cos(float arg) noexcept -> float { return detail::cos_impl(arg); }
 
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
-[[nodiscard]] constexpr auto cosf(float arg) noexcept -> float { return etl::detail::gcem::cos(arg); }
+[[nodiscard]] constexpr auto cosf(float arg) noexcept -> float { return detail::cos_impl(arg); }
 
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
-[[nodiscard]] constexpr auto cos(double arg) noexcept -> double { return etl::detail::gcem::cos(arg); }
+[[nodiscard]] constexpr auto cos(double arg) noexcept -> double { return detail::cos_impl(arg); }
 
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
-[[nodiscard]] constexpr auto cos(long double arg) noexcept -> long double { return etl::detail::gcem::cos(arg); }
+[[nodiscard]] constexpr auto cos(long double arg) noexcept -> long double { return detail::cos_impl(arg); }
 
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
-[[nodiscard]] constexpr auto cosl(long double arg) noexcept -> long double { return etl::detail::gcem::cos(arg); }
+[[nodiscard]] constexpr auto cosl(long double arg) noexcept -> long double { return detail::cos_impl(arg); }
 
 /// \brief Computes the cosine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/cos
 template <integral T>
 [[nodiscard]] constexpr auto cos(T arg) noexcept -> double
 {
-    return etl::detail::gcem::cos(static_cast<double>(arg));
+    return detail::cos_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_COSH_HPP
 #define TETL_CMATH_COSH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto cosh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_coshf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_cosh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_coshl(arg); }
+    }
+#endif
+    return detail::gcem::cosh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
-[[nodiscard]] constexpr auto cosh(float arg) noexcept -> float { return etl::detail::gcem::cosh(arg); }
+[[nodiscard]] constexpr auto cosh(float arg) noexcept -> float { return detail::cosh_impl(arg); }
 
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
-[[nodiscard]] constexpr auto coshf(float arg) noexcept -> float { return etl::detail::gcem::cosh(arg); }
+[[nodiscard]] constexpr auto coshf(float arg) noexcept -> float { return detail::cosh_impl(arg); }
 
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
-[[nodiscard]] constexpr auto cosh(double arg) noexcept -> double { return etl::detail::gcem::cosh(arg); }
+[[nodiscard]] constexpr auto cosh(double arg) noexcept -> double { return detail::cosh_impl(arg); }
 
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
-[[nodiscard]] constexpr auto cosh(long double arg) noexcept -> long double { return etl::detail::gcem::cosh(arg); }
+[[nodiscard]] constexpr auto cosh(long double arg) noexcept -> long double { return detail::cosh_impl(arg); }
 
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
-[[nodiscard]] constexpr auto coshl(long double arg) noexcept -> long double { return etl::detail::gcem::cosh(arg); }
+[[nodiscard]] constexpr auto coshl(long double arg) noexcept -> long double { return detail::cosh_impl(arg); }
 
 /// \brief Computes the hyperbolic cosine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/cosh
 template <integral T>
 [[nodiscard]] constexpr auto cosh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::cosh(static_cast<double>(arg));
+    return detail::cosh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
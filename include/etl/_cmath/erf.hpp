@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_ERF_HPP
 #define TETL_CMATH_ERF_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto erf_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_erff(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_erf(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_erfl(arg); }
+    }
+#endif
+    return detail::gcem::erf(arg);
+}
+} // namespace detail
+
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
-[[nodiscard]] constexpr auto erf(float arg) noexcept -> float { return etl::detail::gcem::erf(arg); }
+[[nodiscard]] constexpr auto erf(float arg) noexcept -> float { return detail::erf_impl(arg); }
 
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
-[[nodiscard]] constexpr auto erff(float arg) noexcept -> float { return etl::detail::gcem::erf(arg); }
+[[nodiscard]] constexpr auto erff(float arg) noexcept -> float { return detail::erf_impl(arg); }
 
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
-[[nodiscard]] constexpr auto erf(double arg) noexcept -> double { return etl::detail::gcem::erf(arg); }
+[[nodiscard]] constexpr auto erf(double arg) noexcept -> double { return detail::erf_impl(arg); }
 
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
-[[nodiscard]] constexpr auto erf(long double arg) noexcept -> long double { return etl::detail::gcem::erf(arg); }
+[[nodiscard]] constexpr auto erf(long double arg) noexcept -> long double { return detail::erf_impl(arg); }
 
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
-[[nodiscard]] constexpr auto erfl(long double arg) noexcept -> long double { return etl::detail::gcem::erf(arg); }
+[[nodiscard]] constexpr auto erfl(long double arg) noexcept -> long double { return detail::erf_impl(arg); }
 
 /// \brief Computes the error function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/erf
 template <integral T>
 [[nodiscard]] constexpr auto erf(T arg) noexcept -> double
 {
-    return etl::detail::gcem::erf(static_cast<double>(arg));
+    return detail::erf_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
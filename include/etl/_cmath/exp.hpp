@@ -3,37 +3,60 @@
 #ifndef TETL_CMATH_EXP_HPP
 #define TETL_CMATH_EXP_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/exp_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto exp_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_expf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_exp(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_expl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::exp_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::exp_kernel(arg); }
+#endif
+    }
+    return detail::gcem::exp(arg);
+}
+} // namespace detail
+
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
-[[nodiscard]] constexpr auto exp(float v) noexcept -> float { return etl::detail::gcem::exp(v); }
+[[nodiscard]] constexpr auto exp(float v) noexcept -> float { return detail::exp_impl(v); }
 
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
-[[nodiscard]] constexpr auto expf(float v) noexcept -> float { return etl::detail::gcem::exp(v); }
+[[nodiscard]] constexpr auto expf(float v) noexcept -> float { return detail::exp_impl(v); }
 
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
-[[nodiscard]] constexpr auto exp(double v) noexcept -> double { return etl::detail::gcem::exp(v); }
+[[nodiscard]] constexpr auto exp(double v) noexcept -> double { return detail::exp_impl(v); }
 
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
-[[nodiscard]] constexpr auto exp(long double v) noexcept -> long double { return etl::detail::gcem::exp(v); }
+[[nodiscard]] constexpr auto exp(long double v) noexcept -> long double { return detail::exp_impl(v); }
 
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
-[[nodiscard]] constexpr auto expl(long double v) noexcept -> long double { return etl::detail::gcem::exp(v); }
+[[nodiscard]] constexpr auto expl(long double v) noexcept -> long double { return detail::exp_impl(v); }
 
 /// \brief Computes e (Euler's number, 2.7182...) raised to the given power v
 /// https://en.cppreference.com/w/cpp/numeric/math/exp
 template <integral T>
 [[nodiscard]] constexpr auto exp(T v) noexcept -> double
 {
-    return etl::detail::gcem::exp(static_cast<double>(v));
+    return detail::exp_impl(static_cast<double>(v));
 }
 
 } // namespace etl
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_CMATH_EXP_KERNEL_HPP
+#define TETL_CMATH_EXP_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_bit/bit_cast.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+
+namespace etl::detail {
+
+/// \brief 2^k for k in [-1022, 1023].
+[[nodiscard]] constexpr auto pow2_kernel(int k) noexcept -> double
+{
+    return etl::bit_cast<double>(static_cast<uint64_t>(k + 1023) << 52U);
+}
+
+/// \brief Computes e^x without libm. The error is below 1 ULP.
+///
+/// \details x is reduced to k ln2 + r with |r| <= ln2/2. ln2 is split into a
+/// high part with trailing zeros, so k * ln2_hi is exact, and a low part.
+/// e^r = 1 + r + r c / (2 - c), where c = r - r^2 P(r^2) and P is a minimax
+/// polynomial of degree 4 with an error below 2^-59 on the reduced range.
+/// The result is scaled by 2^k in two steps, if it is subnormal.
+///
+/// Sun Microsystems, fdlibm 5.3, e_exp.c.
+[[nodiscard]] constexpr auto exp_kernel(double x) noexcept -> double
+{
+    constexpr auto overflow  = 7.09782712893383973096e+02;
+    constexpr auto underflow = -7.45133219101941108420e+02;
+
+    if (x != x) { return x; }
+    if (x > overflow) { return TETL_BUILTIN_HUGE_VAL; }
+    if (x < underflow) { return 0.0; }
+
+    constexpr auto inv_ln2 = 1.44269504088896338700e+00;
+    constexpr auto ln2_hi  = 6.93147180369123816490e-01;
+    constexpr auto ln2_lo  = 1.90821492927058770002e-10;
+
+    constexpr auto p1 = 1.66666666666666019037e-01;
+    constexpr auto p2 = -2.77777777770155933842e-03;
+    constexpr auto p3 = 6.61375632143793436117e-05;
+    constexpr auto p4 = -1.65339022054652515390e-06;
+    constexpr auto p5 = 4.13813679705723846039e-08;
+
+    auto const k  = static_cast<int>(x * inv_ln2 + (x < 0.0 ? -0.5 : 0.5));
+    auto const kd = static_cast<double>(k);
+    auto const hi = x - kd * ln2_hi;
+    auto const lo = kd * ln2_lo;
+    auto const r  = hi - lo;
+
+    auto const t = r * r;
+    auto const c = r - t * (p1 + t * (p2 + t * (p3 + t * (p4 + t * p5))));
+    auto const y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+
+    if (k > 1023) { return y * 2.0 * pow2_kernel(k - 1); }
+    if (k < -1022) { return y * pow2_kernel(k + 1000) * 0x1.0p-1000; }
+    return y * pow2_kernel(k);
+}
+
+} // namespace etl::detail
+
+#endif // TETL_CMATH_EXP_KERNEL_HPP
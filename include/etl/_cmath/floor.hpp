@@ -4,37 +4,56 @@
 #ifndef TETL_CMATH_FLOOR_HPP
 #define TETL_CMATH_FLOOR_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto floor_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_floorf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_floor(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_floorl(arg); }
+    }
+#endif
+    return detail::gcem::floor(arg);
+}
+} // namespace detail
+
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
-[[nodiscard]] constexpr auto floor(float arg) noexcept -> float { return etl::detail::gcem::floor(arg); }
+[[nodiscard]] constexpr auto floor(float arg) noexcept -> float { return detail::floor_impl(arg); }
 
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
-[[nodiscard]] constexpr auto floorf(float arg) noexcept -> float { return etl::detail::gcem::floor(arg); }
+[[nodiscard]] constexpr auto floorf(float arg) noexcept -> float { return detail::floor_impl(arg); }
 
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
-[[nodiscard]] constexpr auto floor(double arg) noexcept -> double { return etl::detail::gcem::floor(arg); }
+[[nodiscard]] constexpr auto floor(double arg) noexcept -> double { return detail::floor_impl(arg); }
 
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
-[[nodiscard]] constexpr auto floor(long double arg) noexcept -> long double { return etl::detail::gcem::floor(arg); }
+[[nodiscard]] constexpr auto floor(long double arg) noexcept -> long double { return detail::floor_impl(arg); }
 
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
-[[nodiscard]] constexpr auto floorl(long double arg) noexcept -> long double { return etl::detail::gcem::floor(arg); }
+[[nodiscard]] constexpr auto floorl(long double arg) noexcept -> long double { return detail::floor_impl(arg); }
 
 /// \brief Computes the largest integer value not greater than arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/floor
 template <integral T>
 [[nodiscard]] constexpr auto floor(T arg) noexcept -> double
 {
-    return etl::detail::gcem::floor(static_cast<double>(arg));
+    return detail::floor_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,34 +3,53 @@
 #ifndef TETL_CMATH_FMOD_HPP
 #define TETL_CMATH_FMOD_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto fmod_impl(T x, T y) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_fmodf(x, y); }
+        if constexpr (is_same_v<T, double>) { return __builtin_fmod(x, y); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_fmodl(x, y); }
+    }
+#endif
+    return detail::gcem::fmod(x, y);
+}
+} // namespace detail
+
 /// \brief Computes the floating-point remainder of the division operation x/y.
 /// https://en.cppreference.com/w/cpp/numeric/math/fmod
-[[nodiscard]] constexpr auto fmod(float x, float y) noexcept -> float { return etl::detail::gcem::fmod(x, y); }
+[[nodiscard]] constexpr auto fmod(float x, float y) noexcept -> float { return detail::fmod_impl(x, y); }
 
 /// \brief Computes the floating-point remainder of the division operation x/y.
 /// https://en.cppreference.com/w/cpp/numeric/math/fmod
-[[nodiscard]] constexpr auto fmodf(float x, float y) noexcept -> float { return etl::detail::gcem::fmod(x, y); }
+[[nodiscard]] constexpr auto fmodf(float x, float y) noexcept -> float { return detail::fmod_impl(x, y); }
 
 /// \brief Computes the floating-point remainder of the division operation x/y.
 /// https://en.cppreference.com/w/cpp/numeric/math/fmod
-[[nodiscard]] constexpr auto fmod(double x, double y) noexcept -> double { return etl::detail::gcem::fmod(x, y); }
+[[nodiscard]] constexpr auto fmod(double x, double y) noexcept -> double { return detail::fmod_impl(x, y); }
 
 /// \brief Computes the floating-point remainder of the division operation x/y.
 /// https://en.cppreference.com/w/cpp/numeric/math/fmod
 [[nodiscard]] constexpr auto fmod(long double x, long double y) noexcept -> long double
 {
-    return etl::detail::gcem::fmod(x, y);
+    return detail::fmod_impl(x, y);
 }
 
 /// \brief Computes the floating-point remainder of the division operation x/y.
 /// https://en.cppreference.com/w/cpp/numeric/math/fmod
 [[nodiscard]] constexpr auto fmodl(long double x, long double y) noexcept -> long double
 {
-    return etl::detail::gcem::fmod(x, y);
+    return detail::fmod_impl(x, y);
 }
 
 } // namespace etl
@@ -3,40 +3,59 @@
 #ifndef TETL_CMATH_LGAMMA_HPP
 #define TETL_CMATH_LGAMMA_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto lgamma_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_lgammaf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_lgamma(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_lgammal(arg); }
+    }
+#endif
+    return detail::gcem::lgamma(arg);
+}
+} // namespace detail
+
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/lgamma
-[[nodiscard]] constexpr auto lgamma(float arg) noexcept -> float { return etl::detail::gcem::lgamma(arg); }
+[[nodiscard]] constexpr auto lgamma(float arg) noexcept -> float { return detail::lgamma_impl(arg); }
 
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/lgamma
-[[nodiscard]] constexpr auto lgammaf(float arg) noexcept -> float { return etl::detail::gcem::lgamma(arg); }
+[[nodiscard]] constexpr auto lgammaf(float arg) noexcept -> float { return detail::lgamma_impl(arg); }
 
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/lgamma
-[[nodiscard]] constexpr auto lgamma(double arg) noexcept -> double { return etl::detail::gcem::lgamma(arg); }
+[[nodiscard]] constexpr auto lgamma(double arg) noexcept -> double { return detail::lgamma_impl(arg); }
 
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/lgamma
-[[nodiscard]] constexpr auto lgamma(long double arg) noexcept -> long double { return etl::detail::gcem::lgamma(arg); }
+[[nodiscard]] constexpr auto lgamma(long double arg) noexcept -> long double { return detail::lgamma_impl(arg); }
 
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/lgamma
-[[nodiscard]] constexpr auto lgammal(long double arg) noexcept -> long double { return etl::detail::gcem::lgamma(arg); }
+[[nodiscard]] constexpr auto lgammal(long double arg) noexcept -> long double { return detail::lgamma_impl(arg); }
 
 /// \brief Computes the natural logarithm of the absolute value of the gamma
 /// function of arg.
@@ -45,7 +64,7 @@ namespace etl {
 template <integral T>
 [[nodiscard]] constexpr auto lgamma(T arg) noexcept -> double
 {
-    return etl::detail::gcem::lgamma(static_cast<double>(arg));
+    return detail::lgamma_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
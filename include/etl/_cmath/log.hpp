@@ -3,35 +3,58 @@
 #ifndef TETL_CMATH_LOG_HPP
 #define TETL_CMATH_LOG_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/log_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto log_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_logf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_log(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_logl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::log_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::log_kernel(arg); }
+#endif
+    }
+    return detail::gcem::log(arg);
+}
+} // namespace detail
+
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log
-[[nodiscard]] constexpr auto log(float v) noexcept -> float { return etl::detail::gcem::log(v); }
+[[nodiscard]] constexpr auto log(float v) noexcept -> float { return detail::log_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log
-[[nodiscard]] constexpr auto logf(float v) noexcept -> float { return etl::detail::gcem::log(v); }
+[[nodiscard]] constexpr auto logf(float v) noexcept -> float { return detail::log_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log
-[[nodiscard]] constexpr auto log(double v) noexcept -> double { return etl::detail::gcem::log(v); }
+[[nodiscard]] constexpr auto log(double v) noexcept -> double { return detail::log_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log
-[[nodiscard]] constexpr auto log(long double v) noexcept -> long double { return etl::detail::gcem::log(v); }
+[[nodiscard]] constexpr auto log(long double v) noexcept -> long double { return detail::log_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log
-[[nodiscard]] constexpr auto logl(long double v) noexcept -> long double { return etl::detail::gcem::log(v); }
+[[nodiscard]] constexpr auto logl(long double v) noexcept -> long double { return detail::log_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of arg.
 ///
@@ -39,7 +62,7 @@ namespace etl {
 template <integral T>
 [[nodiscard]] constexpr auto log(T arg) noexcept -> double
 {
-    return etl::detail::gcem::log(static_cast<double>(arg));
+    return detail::log_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
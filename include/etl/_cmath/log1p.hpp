@@ -3,40 +3,59 @@
 #ifndef TETL_CMATH_LOG1P_HPP
 #define TETL_CMATH_LOG1P_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto log1p_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_log1pf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_log1p(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_log1pl(arg); }
+    }
+#endif
+    return detail::gcem::log1p(arg);
+}
+} // namespace detail
+
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log1p
-[[nodiscard]] constexpr auto log1p(float v) noexcept -> float { return etl::detail::gcem::log1p(v); }
+[[nodiscard]] constexpr auto log1p(float v) noexcept -> float { return detail::log1p_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log1p
-[[nodiscard]] constexpr auto log1pf(float v) noexcept -> float { return etl::detail::gcem::log1p(v); }
+[[nodiscard]] constexpr auto log1pf(float v) noexcept -> float { return detail::log1p_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log1p
-[[nodiscard]] constexpr auto log1p(double v) noexcept -> double { return etl::detail::gcem::log1p(v); }
+[[nodiscard]] constexpr auto log1p(double v) noexcept -> double { return detail::log1p_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log1p
-[[nodiscard]] constexpr auto log1p(long double v) noexcept -> long double { return etl::detail::gcem::log1p(v); }
+[[nodiscard]] constexpr auto log1p(long double v) noexcept -> long double { return detail::log1p_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
 ///
 /// https://en.cppreference.com/w/cpp/numeric/math/log1p
-[[nodiscard]] constexpr auto log1pl(long double v) noexcept -> long double { return etl::detail::gcem::log1p(v); }
+[[nodiscard]] constexpr auto log1pl(long double v) noexcept -> long double { return detail::log1p_impl(v); }
 
 /// \brief Computes the natural (base e) logarithm of 1+arg. This function is
 /// more precise than the expression etl::log(1+arg) if arg is close to zero.
@@ -45,7 +64,7 @@ namespace etl {
 template <integral T>
 [[nodiscard]] constexpr auto log1p(T arg) noexcept -> double
 {
-    return etl::detail::gcem::log1p(static_cast<double>(arg));
+    return detail::log1p_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_LOG2_HPP
 #define TETL_CMATH_LOG2_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto log2_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_log2f(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_log2(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_log2l(arg); }
+    }
+#endif
+    return detail::gcem::log2(arg);
+}
+} // namespace detail
+
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
-[[nodiscard]] constexpr auto log2(float v) noexcept -> float { return etl::detail::gcem::log2(v); }
+[[nodiscard]] constexpr auto log2(float v) noexcept -> float { return detail::log2_impl(v); }
 
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
-[[nodiscard]] constexpr auto log2f(float v) noexcept -> float { return etl::detail::gcem::log2(v); }
+[[nodiscard]] constexpr auto log2f(float v) noexcept -> float { return detail::log2_impl(v); }
 
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
-[[nodiscard]] constexpr auto log2(double v) noexcept -> double { return etl::detail::gcem::log2(v); }
+[[nodiscard]] constexpr auto log2(double v) noexcept -> double { return detail::log2_impl(v); }
 
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
-[[nodiscard]] constexpr auto log2(long double v) noexcept -> long double { return etl::detail::gcem::log2(v); }
+[[nodiscard]] constexpr auto log2(long double v) noexcept -> long double { return detail::log2_impl(v); }
 
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
-[[nodiscard]] constexpr auto log2l(long double v) noexcept -> long double { return etl::detail::gcem::log2(v); }
+[[nodiscard]] constexpr auto log2l(long double v) noexcept -> long double { return detail::log2_impl(v); }
 
 /// \brief Computes the binary (base-2) logarithm of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/log2
 template <integral T>
 [[nodiscard]] constexpr auto log2(T arg) noexcept -> double
 {
-    return etl::detail::gcem::log2(static_cast<double>(arg));
+    return detail::log2_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_CMATH_LOG_KERNEL_HPP
+#define TETL_CMATH_LOG_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_bit/bit_cast.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+
+namespace etl::detail {
+
+/// \brief Computes the natural logarithm of x without libm. The error is
+/// below 1 ULP.
+///
+/// \details x is reduced to 2^k (1 + f) with sqrt(2)/2 < 1 + f < sqrt(2).
+/// With s = f / (2 + f), log(1 + f) = 2s + s R(s^2), where R is a minimax
+/// polynomial of degree 7 with an error below 2^-58.45 on the reduced range.
+/// ln2 is split into a high part with trailing zeros, so k * ln2_hi is exact.
+///
+/// Sun Microsystems, fdlibm 5.3, e_log.c.
+[[nodiscard]] constexpr auto log_kernel(double x) noexcept -> double
+{
+    if (x != x) { return x; }
+    if (x < 0.0) { return TETL_BUILTIN_NAN(""); }
+    if (x == 0.0) { return -TETL_BUILTIN_HUGE_VAL; }
+    if (x == TETL_BUILTIN_HUGE_VAL) { return x; }
+
+    constexpr auto ln2_hi = 6.93147180369123816490e-01;
+    constexpr auto ln2_lo = 1.90821492927058770002e-10;
+
+    constexpr auto lg1 = 6.666666666666735130e-01;
+    constexpr auto lg2 = 3.999999999940941908e-01;
+    constexpr auto lg3 = 2.857142874366239149e-01;
+    constexpr auto lg4 = 2.222219843214978396e-01;
+    constexpr auto lg5 = 1.818357216161805012e-01;
+    constexpr auto lg6 = 1.531383769920937332e-01;
+    constexpr auto lg7 = 1.479819860511658591e-01;
+
+    auto k = 0;
+    if (x < 0x1.0p-1022) {
+        // subnormal
+        x *= 0x1.0p54;
+        k -= 54;
+    }
+
+    auto const bits = etl::bit_cast<uint64_t>(x);
+    auto hx         = static_cast<uint32_t>(bits >> 32U);
+    k += static_cast<int>(hx >> 20U) - 1023;
+    hx &= 0x000F'FFFFU;
+
+    // exponent of x or x/2, so the mantissa is in [sqrt(2)/2, sqrt(2))
+    auto const i = (hx + 0x9'5F64U) & 0x10'0000U;
+    k += static_cast<int>(i >> 20U);
+    auto const high = static_cast<uint64_t>(hx | (i ^ 0x3FF0'0000U)) << 32U;
+    auto const f    = etl::bit_cast<double>(high | (bits & 0xFFFF'FFFFU)) - 1.0;
+
+    auto const dk = static_cast<double>(k);
+    auto const s  = f / (2.0 + f);
+    auto const z  = s * s;
+    auto const w  = z * z;
+    auto const t1 = w * (lg2 + w * (lg4 + w * lg6));
+    auto const t2 = z * (lg1 + w * (lg3 + w * (lg5 + w * lg7)));
+    auto const r  = t2 + t1;
+
+    // mantissa of x in [1.38, 1.42], where |f| is largest
+    if (((hx - 0x6'147AU) | (0x6'B851U - hx)) < 0x8000'0000U) {
+        auto const hfsq = 0.5 * f * f;
+        return dk * ln2_hi - ((hfsq - (s * (hfsq + r) + dk * ln2_lo)) - f);
+    }
+    return dk * ln2_hi - ((s * (f - r) - dk * ln2_lo) - f);
+}
+
+} // namespace etl::detail
+
+#endif // TETL_CMATH_LOG_KERNEL_HPP
@@ -3,55 +3,74 @@
 #ifndef TETL_CMATH_POW_HPP
 #define TETL_CMATH_POW_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto pow_impl(T x, T y) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_powf(x, y); }
+        if constexpr (is_same_v<T, double>) { return __builtin_pow(x, y); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_powl(x, y); }
+    }
+#endif
+    return detail::gcem::pow(x, y);
+}
+} // namespace detail
+
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
-[[nodiscard]] constexpr auto pow(float base, float exp) -> float { return detail::gcem::pow(base, exp); }
+[[nodiscard]] constexpr auto pow(float base, float exp) -> float { return detail::pow_impl(base, exp); }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
-[[nodiscard]] constexpr auto powf(float base, float exp) -> float { return detail::gcem::pow(base, exp); }
+[[nodiscard]] constexpr auto powf(float base, float exp) -> float { return detail::pow_impl(base, exp); }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
-[[nodiscard]] constexpr auto pow(double base, double exp) -> double { return detail::gcem::pow(base, exp); }
+[[nodiscard]] constexpr auto pow(double base, double exp) -> double { return detail::pow_impl(base, exp); }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
 [[nodiscard]] constexpr auto pow(long double base, long double exp) -> long double
 {
-    return detail::gcem::pow(base, exp);
+    return detail::pow_impl(base, exp);
 }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
 [[nodiscard]] constexpr auto powl(long double base, long double exp) -> long double
 {
-    return detail::gcem::pow(base, exp);
+    return detail::pow_impl(base, exp);
 }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
 [[nodiscard]] constexpr auto pow(float base, int iexp) -> float
 {
-    return detail::gcem::pow(base, static_cast<float>(iexp));
+    return detail::pow_impl(base, static_cast<float>(iexp));
 }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
 [[nodiscard]] constexpr auto pow(double base, int iexp) -> double
 {
-    return detail::gcem::pow(base, static_cast<double>(iexp));
+    return detail::pow_impl(base, static_cast<double>(iexp));
 }
 
 /// \brief Computes the value of base raised to the power exp
 /// https://en.cppreference.com/w/cpp/numeric/math/pow
 [[nodiscard]] constexpr auto pow(long double base, int iexp) -> long double
 {
-    return detail::gcem::pow(base, static_cast<long double>(iexp));
+    return detail::pow_impl(base, static_cast<long double>(iexp));
 }
 
 } // namespace etl
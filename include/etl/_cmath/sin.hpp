@@ -3,37 +3,60 @@
 #ifndef TETL_CMATH_SIN_HPP
 #define TETL_CMATH_SIN_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/trig_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto sin_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_sinf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_sin(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_sinl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::sin_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::sin_kernel(arg); }
+#endif
+    }
+    return detail::gcem::sin(arg);
+}
+} // namespace detail
+
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
-[[nodiscard]] constexpr auto sin(float arg) noexcept -> float { return etl::detail::gcem::sin(arg); }
+[[nodiscard]] constexpr auto sin(float arg) noexcept -> float { return detail::sin_impl(arg); }
 
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
-[[nodiscard]] constexpr auto sinf(float arg) noexcept -> float { return etl::detail::gcem::sin(arg); }
+[[nodiscard]] constexpr auto sinf(float arg) noexcept -> float { return detail::sin_impl(arg); }
 
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
-[[nodiscard]] constexpr auto sin(double arg) noexcept -> double { return etl::detail::gcem::sin(arg); }
+[[nodiscard]] constexpr auto sin(double arg) noexcept -> double { return detail::sin_impl(arg); }
 
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
-[[nodiscard]] constexpr auto sin(long double arg) noexcept -> long double { return etl::detail::gcem::sin(arg); }
+[[nodiscard]] constexpr auto sin(long double arg) noexcept -> long double { return detail::sin_impl(arg); }
 
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
-[[nodiscard]] constexpr auto sinl(long double arg) noexcept -> long double { return etl::detail::gcem::sin(arg); }
+[[nodiscard]] constexpr auto sinl(long double arg) noexcept -> long double { return detail::sin_impl(arg); }
 
 /// \brief Computes the sine of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/sin
 template <integral T>
 [[nodiscard]] constexpr auto sin(T arg) noexcept -> double
 {
-    return etl::detail::gcem::sin(static_cast<double>(arg));
+    return detail::sin_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_SINH_HPP
 #define TETL_CMATH_SINH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto sinh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_sinhf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_sinh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_sinhl(arg); }
+    }
+#endif
+    return detail::gcem::sinh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
-[[nodiscard]] constexpr auto sinh(float arg) noexcept -> float { return etl::detail::gcem::sinh(arg); }
+[[nodiscard]] constexpr auto sinh(float arg) noexcept -> float { return detail::sinh_impl(arg); }
 
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
-[[nodiscard]] constexpr auto sinhf(float arg) noexcept -> float { return etl::detail::gcem::sinh(arg); }
+[[nodiscard]] constexpr auto sinhf(float arg) noexcept -> float { return detail::sinh_impl(arg); }
 
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
-[[nodiscard]] constexpr auto sinh(double arg) noexcept -> double { return etl::detail::gcem::sinh(arg); }
+[[nodiscard]] constexpr auto sinh(double arg) noexcept -> double { return detail::sinh_impl(arg); }
 
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
-[[nodiscard]] constexpr auto sinh(long double arg) noexcept -> long double { return etl::detail::gcem::sinh(arg); }
+[[nodiscard]] constexpr auto sinh(long double arg) noexcept -> long double { return detail::sinh_impl(arg); }
 
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
-[[nodiscard]] constexpr auto sinhl(long double arg) noexcept -> long double { return etl::detail::gcem::sinh(arg); }
+[[nodiscard]] constexpr auto sinhl(long double arg) noexcept -> long double { return detail::sinh_impl(arg); }
 
 /// \brief Computes the hyperbolic sine of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/sinh
 template <integral T>
 [[nodiscard]] constexpr auto sinh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::sinh(static_cast<double>(arg));
+    return detail::sinh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
@@ -3,37 +3,60 @@
 #ifndef TETL_CMATH_SQRT_HPP
 #define TETL_CMATH_SQRT_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/sqrt_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto sqrt_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_sqrtf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_sqrt(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_sqrtl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::sqrt_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::sqrt_kernel(arg); }
+#endif
+    }
+    return detail::gcem::sqrt(arg);
+}
+} // namespace detail
+
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
-[[nodiscard]] constexpr auto sqrt(float arg) noexcept -> float { return etl::detail::gcem::sqrt(arg); }
+[[nodiscard]] constexpr auto sqrt(float arg) noexcept -> float { return detail::sqrt_impl(arg); }
 
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
-[[nodiscard]] constexpr auto sqrtf(float arg) noexcept -> float { return etl::detail::gcem::sqrt(arg); }
+[[nodiscard]] constexpr auto sqrtf(float arg) noexcept -> float { return detail::sqrt_impl(arg); }
 
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
-[[nodiscard]] constexpr auto sqrt(double arg) noexcept -> double { return etl::detail::gcem::sqrt(arg); }
+[[nodiscard]] constexpr auto sqrt(double arg) noexcept -> double { return detail::sqrt_impl(arg); }
 
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
-[[nodiscard]] constexpr auto sqrt(long double arg) noexcept -> long double { return etl::detail::gcem::sqrt(arg); }
+[[nodiscard]] constexpr auto sqrt(long double arg) noexcept -> long double { return detail::sqrt_impl(arg); }
 
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
-[[nodiscard]] constexpr auto sqrtl(long double arg) noexcept -> long double { return etl::detail::gcem::sqrt(arg); }
+[[nodiscard]] constexpr auto sqrtl(long double arg) noexcept -> long double { return detail::sqrt_impl(arg); }
 
 /// \brief Computes the square root of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/sqrt
 template <integral T>
 [[nodiscard]] constexpr auto sqrt(T arg) noexcept -> double
 {
-    return etl::detail::gcem::sqrt(static_cast<double>(arg));
+    return detail::sqrt_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
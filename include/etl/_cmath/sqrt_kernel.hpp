@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_CMATH_SQRT_KERNEL_HPP
+#define TETL_CMATH_SQRT_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_bit/bit_cast.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+
+namespace etl::detail {
+
+/// \brief Computes the square root of x without libm or a hardware square
+/// root. The error is below 1 ULP.
+///
+/// \details Halving the exponent bits gives an estimate within 6%, four Newton
+/// steps y = (y + x/y) / 2 refine it to full precision. Subnormal arguments
+/// are scaled by 2^54 first.
+[[nodiscard]] constexpr auto sqrt_kernel(double x) noexcept -> double
+{
+    if (x != x or x == 0.0 or x == TETL_BUILTIN_HUGE_VAL) { return x; }
+    if (x < 0.0) { return TETL_BUILTIN_NAN(""); }
+
+    auto scale = 1.0;
+    if (x < 0x1.0p-1022) {
+        x *= 0x1.0p54;
+        scale = 0x1.0p-27;
+    }
+
+    auto y = etl::bit_cast<double>((etl::bit_cast<uint64_t>(x) >> 1U) + 0x1FF8'0000'0000'0000U);
+    y      = 0.5 * (y + x / y);
+    y      = 0.5 * (y + x / y);
+    y      = 0.5 * (y + x / y);
+    y      = 0.5 * (y + x / y);
+    return y * scale;
+}
+
+} // namespace etl::detail
+
+#endif // TETL_CMATH_SQRT_KERNEL_HPP
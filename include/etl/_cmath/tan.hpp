@@ -3,37 +3,60 @@
 #ifndef TETL_CMATH_TAN_HPP
 #define TETL_CMATH_TAN_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_cmath/trig_kernel.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto tan_impl(T arg) noexcept -> T
+{
+    if (not is_constant_evaluated()) {
+#if defined(TETL_BUILTIN_MATH)
+        if constexpr (is_same_v<T, float>) { return __builtin_tanf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_tan(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_tanl(arg); }
+#else
+        if constexpr (is_same_v<T, float>) { return static_cast<float>(detail::tan_kernel(static_cast<double>(arg))); }
+        if constexpr (is_same_v<T, double>) { return detail::tan_kernel(arg); }
+#endif
+    }
+    return detail::gcem::tan(arg);
+}
+} // namespace detail
+
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
-[[nodiscard]] constexpr auto tan(float arg) noexcept -> float { return etl::detail::gcem::tan(arg); }
+[[nodiscard]] constexpr auto tan(float arg) noexcept -> float { return detail::tan_impl(arg); }
 
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
-[[nodiscard]] constexpr auto tanf(float arg) noexcept -> float { return etl::detail::gcem::tan(arg); }
+[[nodiscard]] constexpr auto tanf(float arg) noexcept -> float { return detail::tan_impl(arg); }
 
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
-[[nodiscard]] constexpr auto tan(double arg) noexcept -> double { return etl::detail::gcem::tan(arg); }
+[[nodiscard]] constexpr auto tan(double arg) noexcept -> double { return detail::tan_impl(arg); }
 
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
-[[nodiscard]] constexpr auto tan(long double arg) noexcept -> long double { return etl::detail::gcem::tan(arg); }
+[[nodiscard]] constexpr auto tan(long double arg) noexcept -> long double { return detail::tan_impl(arg); }
 
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
-[[nodiscard]] constexpr auto tanl(long double arg) noexcept -> long double { return etl::detail::gcem::tan(arg); }
+[[nodiscard]] constexpr auto tanl(long double arg) noexcept -> long double { return detail::tan_impl(arg); }
 
 /// \brief Computes the tangent of arg (measured in radians).
 /// https://en.cppreference.com/w/cpp/numeric/math/tan
 template <integral T>
 [[nodiscard]] constexpr auto tan(T arg) noexcept -> double
 {
-    return etl::detail::gcem::tan(static_cast<double>(arg));
+    return detail::tan_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
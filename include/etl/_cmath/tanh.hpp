@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_TANH_HPP
 #define TETL_CMATH_TANH_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto tanh_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_tanhf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_tanh(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_tanhl(arg); }
+    }
+#endif
+    return detail::gcem::tanh(arg);
+}
+} // namespace detail
+
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
-[[nodiscard]] constexpr auto tanh(float arg) noexcept -> float { return etl::detail::gcem::tanh(arg); }
+[[nodiscard]] constexpr auto tanh(float arg) noexcept -> float { return detail::tanh_impl(arg); }
 
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
-[[nodiscard]] constexpr auto tanhf(float arg) noexcept -> float { return etl::detail::gcem::tanh(arg); }
+[[nodiscard]] constexpr auto tanhf(float arg) noexcept -> float { return detail::tanh_impl(arg); }
 
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
-[[nodiscard]] constexpr auto tanh(double arg) noexcept -> double { return etl::detail::gcem::tanh(arg); }
+[[nodiscard]] constexpr auto tanh(double arg) noexcept -> double { return detail::tanh_impl(arg); }
 
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
-[[nodiscard]] constexpr auto tanh(long double arg) noexcept -> long double { return etl::detail::gcem::tanh(arg); }
+[[nodiscard]] constexpr auto tanh(long double arg) noexcept -> long double { return detail::tanh_impl(arg); }
 
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
-[[nodiscard]] constexpr auto tanhl(long double arg) noexcept -> long double { return etl::detail::gcem::tanh(arg); }
+[[nodiscard]] constexpr auto tanhl(long double arg) noexcept -> long double { return detail::tanh_impl(arg); }
 
 /// \brief Computes the hyperbolic tangent of arg
 /// https://en.cppreference.com/w/cpp/numeric/math/tanh
 template <integral T>
 [[nodiscard]] constexpr auto tanh(T arg) noexcept -> double
 {
-    return etl::detail::gcem::tanh(static_cast<double>(arg));
+    return detail::tanh_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
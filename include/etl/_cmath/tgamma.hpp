@@ -3,37 +3,56 @@
 #ifndef TETL_CMATH_TGAMMA_HPP
 #define TETL_CMATH_TGAMMA_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_3rd_party/gcem/gcem.hpp"
 #include "etl/_concepts/integral.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_same.hpp"
 
 namespace etl {
 
+namespace detail {
+template <typename T>
+[[nodiscard]] constexpr auto tgamma_impl(T arg) noexcept -> T
+{
+#if defined(TETL_BUILTIN_MATH)
+    if (not is_constant_evaluated()) {
+        if constexpr (is_same_v<T, float>) { return __builtin_tgammaf(arg); }
+        if constexpr (is_same_v<T, double>) { return __builtin_tgamma(arg); }
+        if constexpr (is_same_v<T, long double>) { return __builtin_tgammal(arg); }
+    }
+#endif
+    return detail::gcem::tgamma(arg);
+}
+} // namespace detail
+
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
-[[nodiscard]] constexpr auto tgamma(float arg) noexcept -> float { return etl::detail::gcem::tgamma(arg); }
+[[nodiscard]] constexpr auto tgamma(float arg) noexcept -> float { return detail::tgamma_impl(arg); }
 
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
-[[nodiscard]] constexpr auto tgammaf(float arg) noexcept -> float { return etl::detail::gcem::tgamma(arg); }
+[[nodiscard]] constexpr auto tgammaf(float arg) noexcept -> float { return detail::tgamma_impl(arg); }
 
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
-[[nodiscard]] constexpr auto tgamma(double arg) noexcept -> double { return etl::detail::gcem::tgamma(arg); }
+[[nodiscard]] constexpr auto tgamma(double arg) noexcept -> double { return detail::tgamma_impl(arg); }
 
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
-[[nodiscard]] constexpr auto tgamma(long double arg) noexcept -> long double { return etl::detail::gcem::tgamma(arg); }
+[[nodiscard]] constexpr auto tgamma(long double arg) noexcept -> long double { return detail::tgamma_impl(arg); }
 
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
-[[nodiscard]] constexpr auto tgammal(long double arg) noexcept -> long double { return etl::detail::gcem::tgamma(arg); }
+[[nodiscard]] constexpr auto tgammal(long double arg) noexcept -> long double { return detail::tgamma_impl(arg); }
 
 /// \brief Computes the gamma function of arg.
 /// https://en.cppreference.com/w/cpp/numeric/math/tgamma
 template <integral T>
 [[nodiscard]] constexpr auto tgamma(T arg) noexcept -> double
 {
-    return etl::detail::gcem::tgamma(static_cast<double>(arg));
+    return detail::tgamma_impl(static_cast<double>(arg));
 }
 
 } // namespace etl
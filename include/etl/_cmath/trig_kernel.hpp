@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_CMATH_TRIG_KERNEL_HPP
+#define TETL_CMATH_TRIG_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_3rd_party/gcem/gcem.hpp"
+#include "etl/_bit/bit_cast.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+
+namespace etl::detail {
+
+/// \brief x - n pi/2 as the unevaluated sum hi + lo with |hi + lo| <= pi/4.
+struct rem_pio2_result {
+    int n;
+    double hi;
+    double lo;
+};
+
+/// \brief Largest argument reduced by rem_pio2_kernel, about 2^20 pi/2. The
+/// kernels fall back to the constexpr implementation beyond this bound.
+inline constexpr auto rem_pio2_limit = 0x1.921FB5p+20;
+
+/// \brief Reduces |x| < rem_pio2_limit to x - n pi/2.
+///
+/// \details pi/2 is split into three parts of 33 bits each, so n times each
+/// part is exact. The second and third part are only subtracted, if the
+/// cancellation in the previous step lost too many bits, which happens only
+/// close to multiples of pi/2.
+///
+/// Sun Microsystems, fdlibm 5.3, e_rem_pio2.c.
+[[nodiscard]] constexpr auto rem_pio2_kernel(double x) noexcept -> rem_pio2_result
+{
+    constexpr auto inv_pio2 = 6.36619772367581382433e-01;
+    constexpr auto pio2_1   = 1.57079632673412561417e+00;
+    constexpr auto pio2_1t  = 6.07710050650619224932e-11;
+    constexpr auto pio2_2   = 6.07710050630396597660e-11;
+    constexpr auto pio2_2t  = 2.02226624879595063154e-21;
+    constexpr auto pio2_3   = 2.02226624871116645580e-21;
+    constexpr auto pio2_3t  = 8.47842766036889956997e-32;
+
+    auto const exponent = [](double v) { return static_cast<int>((etl::bit_cast<uint64_t>(v) >> 52U) & 0x7FFU); };
+
+    auto const t  = x < 0.0 ? -x : x;
+    auto const n  = static_cast<int>(t * inv_pio2 + 0.5);
+    auto const fn = static_cast<double>(n);
+
+    auto r  = t - fn * pio2_1;
+    auto w  = fn * pio2_1t;
+    auto hi = r - w;
+
+    auto const j = exponent(t);
+    if (j - exponent(hi) > 16) {
+        auto const r0 = r;
+        w             = fn * pio2_2;
+        r             = r0 - w;
+        w             = fn * pio2_2t - ((r0 - r) - w);
+        hi            = r - w;
+
+        if (j - exponent(hi) > 49) {
+            auto const r1 = r;
+            w             = fn * pio2_3;
+            r             = r1 - w;
+            w             = fn * pio2_3t - ((r1 - r) - w);
+            hi            = r - w;
+        }
+    }
+
+    auto const lo = (r - hi) - w;
+    if (x < 0.0) { return {-n, -hi, -lo}; }
+    return {n, hi, lo};
+}
+
+/// \brief sin(x + y) for |x + y| <= pi/4, where y is the tail of x. S is a
+/// minimax polynomial of degree 6 in x^2 with an error below 2^-58.
+///
+/// Sun Microsystems, fdlibm 5.3, k_sin.c.
+[[nodiscard]] constexpr auto sin_kernel(double x, double y) noexcept -> double
+{
+    constexpr auto s1 = -1.66666666666666324348e-01;
+    constexpr auto s2 = 8.33333333332248946124e-03;
+    constexpr auto s3 = -1.98412698298579493134e-04;
+    constexpr auto s4 = 2.75573137070700676789e-06;
+    constexpr auto s5 = -2.50507602534068634195e-08;
+    constexpr auto s6 = 1.58969099521155010221e-10;
+
+    auto const z = x * x;
+    auto const v = z * x;
+    auto const r = s2 + z * (s3 + z * (s4 + z * (s5 + z * s6)));
+    return x - ((z * (0.5 * y - v * r) - y) - v * s1);
+}
+
+/// \brief cos(x + y) for |x + y| <= pi/4, where y is the tail of x. C is a
+/// minimax polynomial of degree 6 in x^2 with an error below 2^-58.
+///
+/// FreeBSD msun, k_cos.c, derived from fdlibm 5.3.
+[[nodiscard]] constexpr auto cos_kernel(double x, double y) noexcept -> double
+{
+    constexpr auto c1 = 4.16666666666666019037e-02;
+    constexpr auto c2 = -1.38888888888741095749e-03;
+    constexpr auto c3 = 2.48015872894767294178e-05;
+    constexpr auto c4 = -2.75573143513906633035e-07;
+    constexpr auto c5 = 2.08757232129817482790e-09;
+    constexpr auto c6 = -1.13596475577881948265e-11;
+
+    auto const z  = x * x;
+    auto const w  = z * z;
+    auto const r  = z * (c1 + z * (c2 + z * c3)) + w * w * (c4 + z * (c5 + z * c6));
+    auto const hz = 0.5 * z;
+    auto const v  = 1.0 - hz;
+    return v + (((1.0 - v) - hz) + (z * r - x * y));
+}
+
+/// \brief Computes sin(x) without libm. The error is below 1 ULP for
+/// |x| < rem_pio2_limit.
+[[nodiscard]] constexpr auto sin_kernel(double x) noexcept -> double
+{
+    if (x != x) { return x; }
+    if (x > -0x1.921FB54442D18p-1 and x < 0x1.921FB54442D18p-1) { return sin_kernel(x, 0.0); }
+    if (not(x > -rem_pio2_limit and x < rem_pio2_limit)) { return etl::detail::gcem::sin(x); }
+
+    auto const [n, hi, lo] = rem_pio2_kernel(x);
+    switch (n & 3) {
+        case 0: return sin_kernel(hi, lo);
+        case 1: return cos_kernel(hi, lo);
+        case 2: return -sin_kernel(hi, lo);
+        default: return -cos_kernel(hi, lo);
+    }
+}
+
+/// \brief Computes cos(x) without libm. The error is below 1 ULP for
+/// |x| < rem_pio2_limit.
+[[nodiscard]] constexpr auto cos_kernel(double x) noexcept -> double
+{
+    if (x != x) { return x; }
+    if (x > -0x1.921FB54442D18p-1 and x < 0x1.921FB54442D18p-1) { return cos_kernel(x, 0.0); }
+    if (not(x > -rem_pio2_limit and x < rem_pio2_limit)) { return etl::detail::gcem::cos(x); }
+
+    auto const [n, hi, lo] = rem_pio2_kernel(x);
+    switch (n & 3) {
+        case 0: return cos_kernel(hi, lo);
+        case 1: return -sin_kernel(hi, lo);
+        case 2: return -cos_kernel(hi, lo);
+        default: return sin_kernel(hi, lo);
+    }
+}
+
+/// \brief tan(x + y) for |x + y| <= pi/4, where y is the tail of x, or
+/// -1 / tan(x + y) if odd is true. T is a minimax polynomial of degree 13 in
+/// x^2 for |x| < 0.6744, larger arguments use tan(pi/4 - x) instead.
+///
+/// Sun Microsystems, fdlibm 5.3, k_tan.c.
+[[nodiscard]] constexpr auto tan_kernel(double x, double y, bool odd) noexcept -> double
+{
+    constexpr double t[] = {
+        3.33333333333334091986e-01,
+        1.33333333333201242699e-01,
+        5.39682539762260521377e-02,
+        2.18694882948595424599e-02,
+        8.86323982359930005737e-03,
+        3.59207910759131235356e-03,
+        1.45620945432529025516e-03,
+        5.88041240820264096874e-04,
+        2.46463134818469906812e-04,
+        7.81794442939557092300e-05,
+        7.14072491382608190305e-05,
+        -1.85586374855275456654e-05,
+        2.59073051863633712884e-05,
+    };
+    constexpr auto pio4   = 7.85398163397448278999e-01;
+    constexpr auto pio4lo = 3.06161699786838301793e-17;
+
+    auto const negative = x < 0.0;
+    auto const large    = (negative ? -x : x) >= 0.6744;
+    if (large) {
+        if (negative) {
+            x = -x;
+            y = -y;
+        }
+        x = (pio4 - x) + (pio4lo - y);
+        y = 0.0;
+    }
+
+    auto z = x * x;
+    auto w = z * z;
+    auto r = t[1] + w * (t[3] + w * (t[5] + w * (t[7] + w * (t[9] + w * t[11]))));
+    auto v = z * (t[2] + w * (t[4] + w * (t[6] + w * (t[8] + w * (t[10] + w * t[12])))));
+    auto s = z * x;
+    r      = y + z * (s * (r + v) + y);
+    r += t[0] * s;
+    w = x + r;
+
+    if (large) {
+        v = odd ? -1.0 : 1.0;
+        return (negative ? -1.0 : 1.0) * (v - 2.0 * (x - (w * w / (w + v) - r)));
+    }
+    if (not odd) { return w; }
+
+    // -1 / (x + r) with the high halves of w and the quotient exact
+    auto const clear_low = [](double d) {
+        return etl::bit_cast<double>(etl::bit_cast<uint64_t>(d) & 0xFFFF'FFFF'0000'0000U);
+    };
+    z            = clear_low(w);
+    v            = r - (z - x);
+    auto const a = -1.0 / w;
+    auto const q = clear_low(a);
+    s            = 1.0 + q * z;
+    return q + a * (s + q * v);
+}
+
+/// \brief Computes tan(x) without libm. The error is below 1 ULP for
+/// |x| < rem_pio2_limit.
+[[nodiscard]] constexpr auto tan_kernel(double x) noexcept -> double
+{
+    if (x != x) { return x; }
+    if (x > -0x1.921FB54442D18p-1 and x < 0x1.921FB54442D18p-1) { return tan_kernel(x, 0.0, false); }
+    if (not(x > -rem_pio2_limit and x < rem_pio2_limit)) { return etl::detail::gcem::tan(x); }
+
+    auto const [n, hi, lo] = rem_pio2_kernel(x);
+    return tan_kernel(hi, lo, (n & 1) != 0);
+}
+
+} // namespace etl::detail
+
+#endif // TETL_CMATH_TRIG_KERNEL_HPP
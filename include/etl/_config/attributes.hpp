@@ -25,6 +25,12 @@
     #define TETL_COLD
 #endif
 
+#if defined(_MSC_VER) and not defined(__clang__)
+    #define TETL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+    #define TETL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 // EXPECT
 #if __has_builtin(__builtin_expect)
     #define TETL_LIKELY(expr) __builtin_expect(static_cast<bool>(expr), true)
@@ -107,6 +107,15 @@
     #define TETL_BUILTIN_HUGE_VALL (1.0L / 0.0L)
 #endif
 
+// MATH
+// Outside of constant evaluation the cmath functions call the compiler
+// builtins, which are lowered to instructions or calls into libm. Freestanding
+// builds, or builds defining TETL_NO_BUILTIN_MATH for targets without libm, use
+// the polynomial kernels of the library instead.
+#if __has_builtin(__builtin_exp) and __STDC_HOSTED__ and not defined(TETL_NO_BUILTIN_MATH)
+    #define TETL_BUILTIN_MATH 1
+#endif
+
 // VA LIST
 #define TETL_BUILTIN_VA_LIST __builtin_va_list
 
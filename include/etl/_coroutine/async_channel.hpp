@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_ASYNC_CHANNEL_HPP
+#define TETL_COROUTINE_ASYNC_CHANNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_array/array.hpp"
+#include "etl/_coroutine/coroutine_handle.hpp"
+#include "etl/_coroutine/waiter_list.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_optional/optional.hpp"
+#include "etl/_utility/move.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace etl {
+
+/// \brief Bounded FIFO channel between coroutines on a run_loop.
+/// `co_await channel.send(value)` suspends while the channel is full,
+/// `co_await channel.receive()` suspends while it is empty.
+///
+/// \details A value sent to a waiting receiver is handed over directly,
+/// without going through the buffer. Woken coroutines are scheduled on the
+/// loop. T must be default constructible and move assignable.
+///
+/// \headerfile etl/coroutine.hpp
+template <typename T, size_t Capacity, typename Loop>
+struct async_channel {
+    static_assert(Capacity > 0, "channel needs a buffer");
+
+    struct send_awaiter {
+        [[nodiscard]] auto await_ready() -> bool { return channel->try_send(value); }
+
+        auto await_suspend(coroutine_handle<> h) noexcept -> void
+        {
+            handle = h;
+            channel->senders_.push_back(this);
+        }
+
+        auto await_resume() const noexcept -> void { }
+
+        async_channel* channel;
+        T value;
+        coroutine_handle<> handle { nullptr };
+        send_awaiter* next { nullptr };
+    };
+
+    struct receive_awaiter {
+        [[nodiscard]] auto await_ready() -> bool
+        {
+            value = channel->try_receive();
+            return value.has_value();
+        }
+
+        auto await_suspend(coroutine_handle<> h) noexcept -> void
+        {
+            handle = h;
+            channel->receivers_.push_back(this);
+        }
+
+        [[nodiscard]] auto await_resume() -> T { return etl::move(*value); }
+
+        async_channel* channel;
+        optional<T> value {};
+        coroutine_handle<> handle { nullptr };
+        receive_awaiter* next { nullptr };
+    };
+
+    explicit async_channel(Loop& loop) noexcept : loop_ { etl::addressof(loop) } { }
+
+    async_channel(async_channel const&)                    = delete;
+    auto operator=(async_channel const&) -> async_channel& = delete;
+
+    [[nodiscard]] auto send(T value) -> send_awaiter { return send_awaiter { this, etl::move(value) }; }
+
+    [[nodiscard]] auto receive() noexcept -> receive_awaiter { return receive_awaiter { this }; }
+
+    /// \brief Moves value to a waiting receiver or into the buffer. Returns
+    /// false and leaves value unchanged, if the channel is full.
+    [[nodiscard]] auto try_send(T& value) -> bool
+    {
+        if (auto* r = receivers_.pop_front(); r != nullptr) {
+            r->value.emplace(etl::move(value));
+            loop_->schedule(r->handle);
+            return true;
+        }
+
+        if (size_ == Capacity) { return false; }
+        buffer_[(head_ + size_) % Capacity] = etl::move(value);
+        ++size_;
+        return true;
+    }
+
+    /// \brief Returns the oldest value or nullopt, if the channel is empty.
+    [[nodiscard]] auto try_receive() -> optional<T>
+    {
+        if (size_ == 0) { return nullopt; }
+
+        auto value = optional<T> { etl::move(buffer_[head_]) };
+        head_      = (head_ + 1) % Capacity;
+        --size_;
+
+        // a slot became free, move the value of the oldest waiting sender in
+        if (auto* s = senders_.pop_front(); s != nullptr) {
+            buffer_[(head_ + size_) % Capacity] = etl::move(s->value);
+            ++size_;
+            loop_->schedule(s->handle);
+        }
+        return value;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_t { return size_; }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto full() const noexcept -> bool { return size_ == Capacity; }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_t { return Capacity; }
+
+private:
+    Loop* loop_;
+    array<T, Capacity> buffer_ {};
+    size_t head_ { 0 };
+    size_t size_ { 0 };
+    detail::waiter_list<send_awaiter> senders_ {};
+    detail::waiter_list<receive_awaiter> receivers_ {};
+};
+
+} // namespace etl
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_ASYNC_CHANNEL_HPP
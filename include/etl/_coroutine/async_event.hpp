@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_ASYNC_EVENT_HPP
+#define TETL_COROUTINE_ASYNC_EVENT_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_coroutine/coroutine_handle.hpp"
+#include "etl/_coroutine/waiter_list.hpp"
+#include "etl/_memory/addressof.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace etl {
+
+/// \brief Manual reset event for coroutines on a run_loop. `co_await event`
+/// suspends until set() is called. set() schedules all waiting coroutines on
+/// the loop, they are resumed in the order they started waiting.
+///
+/// \headerfile etl/coroutine.hpp
+template <typename Loop>
+struct async_event {
+    struct awaiter {
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return event->is_set(); }
+
+        auto await_suspend(coroutine_handle<> h) noexcept -> void
+        {
+            handle = h;
+            event->waiters_.push_back(this);
+        }
+
+        auto await_resume() const noexcept -> void { }
+
+        async_event* event;
+        coroutine_handle<> handle { nullptr };
+        awaiter* next { nullptr };
+    };
+
+    explicit async_event(Loop& loop, bool initiallySet = false) noexcept
+        : loop_ { etl::addressof(loop) }
+        , set_ { initiallySet }
+    {
+    }
+
+    async_event(async_event const&)                    = delete;
+    auto operator=(async_event const&) -> async_event& = delete;
+
+    [[nodiscard]] auto operator co_await() noexcept -> awaiter { return awaiter { this }; }
+
+    /// \brief Sets the event and schedules all waiting coroutines.
+    auto set() -> void
+    {
+        set_ = true;
+        while (auto* w = waiters_.pop_front()) { loop_->schedule(w->handle); }
+    }
+
+    /// \brief Clears the event, following co_awaits suspend again.
+    auto reset() noexcept -> void { set_ = false; }
+
+    [[nodiscard]] auto is_set() const noexcept -> bool { return set_; }
+
+private:
+    Loop* loop_;
+    bool set_;
+    detail::waiter_list<awaiter> waiters_ {};
+};
+
+} // namespace etl
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_ASYNC_EVENT_HPP
@@ -3,50 +3,17 @@
 #ifndef TETL_COROUTINE_COROUTINE_HANDLE_HPP
 #define TETL_COROUTINE_COROUTINE_HANDLE_HPP
 
-#include "etl/_cstddef/nullptr_t.hpp"
+#include "etl/_coroutine/std_coroutine.hpp"
 #include "etl/_functional/hash.hpp"
 
-#if defined(__cpp_coroutines)
+#if defined(__cpp_impl_coroutine)
 
 namespace etl {
 
-template <typename Promise = void>
-struct coroutine_handle;
-
-template <>
-struct coroutine_handle<void> {
-    constexpr coroutine_handle() noexcept = default;
-
-    constexpr coroutine_handle(nullptr_t handle) noexcept : handle_(handle) { }
-
-    constexpr auto operator=(nullptr_t) noexcept -> coroutine_handle&
-    {
-        handle_ = nullptr;
-        return *this;
-    }
-
-    [[nodiscard]] constexpr auto address() const noexcept -> void* { return handle_; }
-
-    [[nodiscard]] static constexpr auto from_address(void* addr) noexcept -> coroutine_handle
-    {
-        auto self    = coroutine_handle {};
-        self.handle_ = addr;
-        return self;
-    }
-
-    [[nodiscard]] constexpr explicit operator bool() const noexcept { return handle_ != nullptr; }
-
-    [[nodiscard]] auto done() const noexcept -> bool { return __builtin_coro_done(handle_); }
-
-    auto operator()() const -> void { resume(); }
-
-    auto resume() const -> void { __builtin_coro_resume(handle_); }
-
-    auto destroy() const -> void { __builtin_coro_destroy(handle_); }
-
-protected:
-    void* handle_ { nullptr };
-};
+using std::coroutine_handle;
+using std::noop_coroutine;
+using std::noop_coroutine_handle;
+using std::noop_coroutine_promise;
 
 template <typename T>
 struct hash<coroutine_handle<T>> {
@@ -58,6 +25,6 @@ struct hash<coroutine_handle<T>> {
 
 } // namespace etl
 
-#endif // defined(__cpp_coroutines)
+#endif // defined(__cpp_impl_coroutine)
 
 #endif // TETL_COROUTINE_COROUTINE_HANDLE_HPP
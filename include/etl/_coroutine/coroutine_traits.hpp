@@ -3,27 +3,16 @@
 #ifndef TETL_COROUTINE_COROUTINE_TRAITS_HPP
 #define TETL_COROUTINE_COROUTINE_TRAITS_HPP
 
-#include "etl/_type_traits/void_t.hpp"
+#include "etl/_coroutine/std_coroutine.hpp"
 
-#if defined(__cpp_coroutines)
+#if defined(__cpp_impl_coroutine)
 
 namespace etl {
 
-namespace detail {
-template <typename R, typename = void>
-struct coro_traits { };
-
-template <typename R>
-struct coro_traits<R, void_t<typename R::promise_type>> {
-    using promise_type = typename R::promise_type;
-};
-} // namespace detail
-
-template <typename R, typename... Args>
-struct coroutine_traits : detail::coro_traits<R> { };
+using std::coroutine_traits;
 
 } // namespace etl
 
-#endif // defined(__cpp_coroutines)
+#endif // defined(__cpp_impl_coroutine)
 
 #endif // TETL_COROUTINE_COROUTINE_TRAITS_HPP
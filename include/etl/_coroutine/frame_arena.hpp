@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_FRAME_ARENA_HPP
+#define TETL_COROUTINE_FRAME_ARENA_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/max_align_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_exception/raise.hpp"
+#include "etl/_memory/align.hpp"
+#include "etl/_stdexcept/length_error.hpp"
+
+namespace etl {
+
+/// \brief Fixed size memory resource for coroutine frames, which are passed
+/// to task and generator with allocator_arg, e.g.
+/// `auto read(allocator_arg_t, frame_arena<512>& arena, ...) -> task<int>`.
+///
+/// \details Frames are bump allocated in multiples of alignof(max_align_t).
+/// Deallocating the most recent frame gives its memory back, which is the
+/// common case for nested tasks, all other frames are only reclaimed by
+/// reset(). Running out of memory raises length_error.
+///
+/// \headerfile etl/coroutine.hpp
+template <size_t Capacity>
+struct frame_arena {
+    frame_arena() = default;
+
+    frame_arena(frame_arena const&)                    = delete;
+    auto operator=(frame_arena const&) -> frame_arena& = delete;
+
+    /// \brief Returns size bytes aligned to alignment.
+    [[nodiscard]] auto allocate(size_t size, size_t alignment = alignof(max_align_t)) -> void*
+    {
+        // the rounded size must fit, otherwise used_ may exceed Capacity
+        auto const rounded = round_up(size);
+        auto* ptr          = static_cast<void*>(buffer_ + used_);
+        auto space         = Capacity - used_;
+        auto* block        = etl::align(alignment, rounded, ptr, space);
+        if (block == nullptr) { etl::raise<etl::length_error>("frame_arena: out of memory"); }
+
+        used_ = Capacity - space + rounded;
+        return block;
+    }
+
+    /// \brief Releases the memory of ptr, if it is the most recent allocation.
+    auto deallocate(void* ptr, size_t size, size_t alignment = alignof(max_align_t)) noexcept -> void
+    {
+        (void)alignment;
+        if (static_cast<char*>(ptr) + round_up(size) == buffer_ + used_) {
+            used_ = static_cast<size_t>(static_cast<char*>(ptr) - buffer_);
+        }
+    }
+
+    /// \brief Releases all frames. Frames, that are still alive, must not be
+    /// used or destroyed afterwards.
+    auto reset() noexcept -> void { used_ = 0; }
+
+    [[nodiscard]] auto used() const noexcept -> size_t { return used_; }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_t { return Capacity; }
+
+private:
+    [[nodiscard]] static constexpr auto round_up(size_t size) noexcept -> size_t
+    {
+        return (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+    }
+
+    alignas(max_align_t) char buffer_[Capacity] {};
+    size_t used_ { 0 };
+};
+
+} // namespace etl
+
+#endif // TETL_COROUTINE_FRAME_ARENA_HPP
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_GENERATOR_HPP
+#define TETL_COROUTINE_GENERATOR_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_coroutine/coroutine_handle.hpp"
+#include "etl/_coroutine/promise_allocator.hpp"
+#include "etl/_coroutine/suspend_always.hpp"
+#include "etl/_cstddef/ptrdiff_t.hpp"
+#include "etl/_iterator/default_sentinel.hpp"
+#include "etl/_iterator/tags.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
+#include "etl/_utility/exchange.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace etl {
+
+/// \brief A lazy sequence of values, produced by a coroutine with co_yield.
+/// Each increment of the iterator resumes the coroutine until the next
+/// co_yield, the yielded value is referenced, not copied.
+///
+/// \details The frame is allocated from a memory resource, if the coroutine
+/// takes (allocator_arg_t, Resource&, ...) as its first parameters, e.g.
+/// frame_arena. Exceptions thrown by the coroutine propagate to the caller
+/// of begin() or operator++.
+///
+/// \code
+/// auto iota(allocator_arg_t, frame_arena<256>&, int n) -> generator<int>
+/// {
+///     for (auto i = 0; i < n; ++i) { co_yield i; }
+/// }
+/// \endcode
+///
+/// \headerfile etl/coroutine.hpp
+template <typename T>
+struct generator {
+    using value_type = remove_cvref_t<T>;
+    using reference  = value_type const&;
+
+    struct promise_type : detail::promise_allocator {
+        [[nodiscard]] auto get_return_object() noexcept -> generator
+        {
+            return generator { coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        [[nodiscard]] auto initial_suspend() const noexcept -> suspend_always { return {}; }
+        [[nodiscard]] auto final_suspend() const noexcept -> suspend_always { return {}; }
+
+        auto yield_value(value_type const& value) noexcept -> suspend_always
+        {
+            value_ = etl::addressof(value);
+            return {};
+        }
+
+        auto return_void() const noexcept -> void { }
+
+        auto unhandled_exception() -> void
+        {
+    #if defined(__cpp_exceptions)
+            throw;
+    #endif
+        }
+
+        // co_await is not allowed inside of a generator
+        template <typename U>
+        auto await_transform(U&& value) -> suspend_always = delete;
+
+    private:
+        friend generator;
+        value_type const* value_ { nullptr };
+    };
+
+    struct iterator {
+        using iterator_category = input_iterator_tag;
+        using value_type        = generator::value_type;
+        using difference_type   = ptrdiff_t;
+        using reference         = generator::reference;
+
+        auto operator++() -> iterator&
+        {
+            handle_.resume();
+            return *this;
+        }
+
+        auto operator++(int) -> void { ++*this; }
+
+        [[nodiscard]] auto operator*() const noexcept -> reference { return *handle_.promise().value_; }
+
+        [[nodiscard]] friend auto operator==(iterator const& it, default_sentinel_t /*end*/) noexcept -> bool
+        {
+            return it.handle_.done();
+        }
+
+    private:
+        friend generator;
+        explicit iterator(coroutine_handle<promise_type> handle) noexcept : handle_ { handle } { }
+        coroutine_handle<promise_type> handle_;
+    };
+
+    generator(generator&& other) noexcept : handle_ { etl::exchange(other.handle_, nullptr) } { }
+
+    auto operator=(generator&& other) noexcept -> generator&
+    {
+        if (this != &other) {
+            if (handle_) { handle_.destroy(); }
+            handle_ = etl::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    generator(generator const&)                    = delete;
+    auto operator=(generator const&) -> generator& = delete;
+
+    ~generator()
+    {
+        if (handle_) { handle_.destroy(); }
+    }
+
+    /// \brief Runs the coroutine until the first co_yield. Must be called only
+    /// once.
+    [[nodiscard]] auto begin() -> iterator
+    {
+        handle_.resume();
+        return iterator { handle_ };
+    }
+
+    [[nodiscard]] auto end() const noexcept -> default_sentinel_t { return default_sentinel; }
+
+private:
+    explicit generator(coroutine_handle<promise_type> handle) noexcept : handle_ { handle } { }
+    coroutine_handle<promise_type> handle_;
+};
+
+} // namespace etl
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_GENERATOR_HPP
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_PROMISE_ALLOCATOR_HPP
+#define TETL_COROUTINE_PROMISE_ALLOCATOR_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/max_align_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_memory/allocator_arg_t.hpp"
+#include "etl/_new/operator.hpp"
+
+namespace etl::detail {
+
+/// \brief Base class of promise types, whose coroutine frames are allocated
+/// from a memory resource, if the coroutine is called with
+/// (allocator_arg, resource, args...). For member functions, the object
+/// parameter comes first. The resource needs allocate(size, alignment) and
+/// deallocate(ptr, size, alignment) members. Other coroutines fall back to
+/// the global operator new.
+///
+/// \details The resource and its deallocate function are stored behind the
+/// frame, because operator delete only receives the frame and its size. The
+/// template overloads of operator new are always inlined, otherwise GCC
+/// reports them as mismatched with the non-template operator delete.
+struct promise_allocator {
+    template <typename Resource, typename... Args>
+    [[nodiscard]] TETL_ALWAYS_INLINE static auto
+    operator new(size_t size, allocator_arg_t /*tag*/, Resource& resource, Args&... /*args*/) -> void*
+    {
+        return allocate(size, resource);
+    }
+
+    template <typename This, typename Resource, typename... Args>
+    [[nodiscard]] TETL_ALWAYS_INLINE static auto
+    operator new(size_t size, This& /*self*/, allocator_arg_t /*tag*/, Resource& resource, Args&... /*args*/) -> void*
+    {
+        return allocate(size, resource);
+    }
+
+    [[nodiscard]] static auto operator new(size_t size) -> void*
+    {
+        auto* frame              = ::operator new(padded(size) + sizeof(trailer));
+        *trailer_of(frame, size) = trailer { &deallocate_global, nullptr };
+        return frame;
+    }
+
+    static auto operator delete(void* frame, size_t size) noexcept -> void
+    {
+        auto const t = *trailer_of(frame, size);
+        t.deallocate(t.resource, frame, padded(size) + sizeof(trailer));
+    }
+
+private:
+    struct trailer {
+        void (*deallocate)(void*, void*, size_t);
+        void* resource;
+    };
+
+    [[nodiscard]] static constexpr auto padded(size_t size) noexcept -> size_t
+    {
+        return (size + alignof(trailer) - 1) & ~(alignof(trailer) - 1);
+    }
+
+    [[nodiscard]] static auto trailer_of(void* frame, size_t size) noexcept -> trailer*
+    {
+        return static_cast<trailer*>(static_cast<void*>(static_cast<char*>(frame) + padded(size)));
+    }
+
+    template <typename Resource>
+    [[nodiscard]] static auto allocate(size_t size, Resource& resource) -> void*
+    {
+        auto* frame = resource.allocate(padded(size) + sizeof(trailer), alignof(max_align_t));
+        *trailer_of(frame, size) = trailer { &deallocate<Resource>, etl::addressof(resource) };
+        return frame;
+    }
+
+    template <typename Resource>
+    static auto deallocate(void* resource, void* frame, size_t size) -> void
+    {
+        static_cast<Resource*>(resource)->deallocate(frame, size, alignof(max_align_t));
+    }
+
+    static auto deallocate_global(void* /*resource*/, void* frame, size_t size) -> void
+    {
+#if defined(__cpp_sized_deallocation)
+        ::operator delete(frame, size);
+#else
+        (void)size;
+        ::operator delete(frame);
+#endif
+    }
+};
+
+} // namespace etl::detail
+
+#endif // TETL_COROUTINE_PROMISE_ALLOCATOR_HPP
@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_RUN_LOOP_HPP
+#define TETL_COROUTINE_RUN_LOOP_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_array/array.hpp"
+#include "etl/_chrono/ceil.hpp"
+#include "etl/_chrono/duration.hpp"
+#include "etl/_coroutine/coroutine_handle.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_exception/raise.hpp"
+#include "etl/_stdexcept/length_error.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace etl {
+
+/// \brief Cooperative single-threaded scheduler for coroutines, e.g. task.
+///
+/// \details Ready coroutines are resumed in FIFO order from a queue of
+/// Capacity handles. Up to Capacity coroutines can wait for a deadline,
+/// which are kept sorted, so the earliest timer is found in constant time.
+/// Both raise length_error when full.
+///
+/// Clock needs the members duration, time_point and a static now(). If
+/// Clock also has a static wait_until(time_point), e.g. a sleep or WFI
+/// until the next timer interrupt, run() calls it while all coroutines wait
+/// for a timer. Otherwise run() polls the clock.
+///
+/// Coroutines that wait for an async_event or async_channel are not known to
+/// the loop, they are scheduled again once the event is set.
+///
+/// \headerfile etl/coroutine.hpp
+template <typename Clock, size_t Capacity = 16>
+struct run_loop {
+    using clock      = Clock;
+    using duration   = typename Clock::duration;
+    using time_point = typename Clock::time_point;
+
+    run_loop() = default;
+
+    run_loop(run_loop const&)                    = delete;
+    auto operator=(run_loop const&) -> run_loop& = delete;
+
+    /// \brief Appends handle to the ready queue.
+    auto schedule(coroutine_handle<> handle) -> void
+    {
+        if (num_ready_ == Capacity) { etl::raise<etl::length_error>("run_loop: ready queue is full"); }
+        ready_[(head_ + num_ready_) % Capacity] = handle;
+        ++num_ready_;
+    }
+
+    /// \brief Schedules handle, once Clock::now() reaches deadline. Timers
+    /// with the same deadline are resumed in the order they were added.
+    auto schedule_at(time_point deadline, coroutine_handle<> handle) -> void
+    {
+        if (num_timers_ == Capacity) { etl::raise<etl::length_error>("run_loop: too many timers"); }
+
+        // sorted by descending deadline, the next timer is the last one
+        auto i = num_timers_;
+        for (; i > 0 and timers_[i - 1].deadline <= deadline; --i) { timers_[i] = timers_[i - 1]; }
+        timers_[i] = timer { deadline, handle };
+        ++num_timers_;
+    }
+
+    struct yield_awaiter {
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+        auto await_suspend(coroutine_handle<> handle) const -> void { loop->schedule(handle); }
+        auto await_resume() const noexcept -> void { }
+
+        run_loop* loop;
+    };
+
+    struct sleep_awaiter {
+        [[nodiscard]] auto await_ready() const -> bool { return deadline <= Clock::now(); }
+        auto await_suspend(coroutine_handle<> handle) const -> void { loop->schedule_at(deadline, handle); }
+        auto await_resume() const noexcept -> void { }
+
+        run_loop* loop;
+        time_point deadline;
+    };
+
+    /// \brief `co_await loop.yield()` resumes all other ready coroutines first.
+    [[nodiscard]] auto yield() noexcept -> yield_awaiter { return yield_awaiter { this }; }
+
+    /// \brief `co_await loop.sleep_until(deadline)` suspends until deadline.
+    [[nodiscard]] auto sleep_until(time_point deadline) noexcept -> sleep_awaiter
+    {
+        return sleep_awaiter { this, deadline };
+    }
+
+    /// \brief `co_await loop.sleep_for(10ms)` suspends for at least d.
+    template <typename Rep, typename Period>
+    [[nodiscard]] auto sleep_for(chrono::duration<Rep, Period> d) -> sleep_awaiter
+    {
+        auto deadline = Clock::now();
+        deadline += chrono::ceil<duration>(d);
+        return sleep_until(deadline);
+    }
+
+    /// \brief Resumes the coroutines of all expired timers and all coroutines,
+    /// that were ready before the call. Returns the number of resumed
+    /// coroutines. Never waits.
+    auto poll() -> size_t
+    {
+        // reading the clock may be a system call, skip it without timers
+        if (num_timers_ != 0) {
+            auto const now = Clock::now();
+            while (num_timers_ != 0 and timers_[num_timers_ - 1].deadline <= now) {
+                schedule(timers_[num_timers_ - 1].handle);
+                --num_timers_;
+            }
+        }
+
+        // coroutines scheduled in the meantime run in the next call, so a
+        // yielding coroutine can not starve the timers
+        auto const count = num_ready_;
+        for (auto i = size_t(0); i < count; ++i) {
+            auto const handle = ready_[head_];
+            head_             = (head_ + 1) % Capacity;
+            --num_ready_;
+            handle.resume();
+        }
+        return count;
+    }
+
+    /// \brief Runs until no coroutine is ready or waiting for a timer.
+    auto run() -> void
+    {
+        while (num_ready_ != 0 or num_timers_ != 0) {
+            if constexpr (requires(time_point tp) { Clock::wait_until(tp); }) {
+                if (num_ready_ == 0) { Clock::wait_until(timers_[num_timers_ - 1].deadline); }
+            }
+            (void)poll();
+        }
+    }
+
+    /// \brief Returns the number of coroutines in the ready queue.
+    [[nodiscard]] auto num_ready() const noexcept -> size_t { return num_ready_; }
+
+    /// \brief Returns the number of coroutines waiting for a timer.
+    [[nodiscard]] auto num_timers() const noexcept -> size_t { return num_timers_; }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_t { return Capacity; }
+
+private:
+    struct timer {
+        time_point deadline;
+        coroutine_handle<> handle;
+    };
+
+    array<coroutine_handle<>, Capacity> ready_ {};
+    size_t head_ { 0 };
+    size_t num_ready_ { 0 };
+
+    array<timer, Capacity> timers_ {};
+    size_t num_timers_ { 0 };
+};
+
+} // namespace etl
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_RUN_LOOP_HPP
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_STD_COROUTINE_HPP
+#define TETL_COROUTINE_STD_COROUTINE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/nullptr_t.hpp"
+
+// The compiler looks up coroutine_traits and coroutine_handle in namespace
+// std. To avoid ODR violations, we include the header <coroutine> if it is
+// available and only declare the minimal interface otherwise.
+#if defined(__cpp_impl_coroutine)
+    #if __has_include(<coroutine>)
+        #include <coroutine>
+    #else
+
+namespace std {
+
+template <typename R, typename... Args>
+struct coroutine_traits { };
+
+template <typename R, typename... Args>
+    requires requires { typename R::promise_type; }
+struct coroutine_traits<R, Args...> {
+    using promise_type = typename R::promise_type;
+};
+
+template <typename Promise = void>
+struct coroutine_handle;
+
+template <>
+struct coroutine_handle<void> {
+    constexpr coroutine_handle() noexcept = default;
+    constexpr coroutine_handle(decltype(nullptr) /*null*/) noexcept { }
+
+    constexpr auto operator=(decltype(nullptr) /*null*/) noexcept -> coroutine_handle&
+    {
+        frame_ = nullptr;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr auto address() const noexcept -> void* { return frame_; }
+
+    [[nodiscard]] static constexpr auto from_address(void* addr) noexcept -> coroutine_handle
+    {
+        auto self   = coroutine_handle {};
+        self.frame_ = addr;
+        return self;
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return frame_ != nullptr; }
+
+    [[nodiscard]] auto done() const noexcept -> bool { return __builtin_coro_done(frame_); }
+
+    auto operator()() const -> void { resume(); }
+
+    auto resume() const -> void { __builtin_coro_resume(frame_); }
+
+    auto destroy() const -> void { __builtin_coro_destroy(frame_); }
+
+    friend constexpr auto operator==(coroutine_handle lhs, coroutine_handle rhs) noexcept -> bool
+    {
+        return lhs.address() == rhs.address();
+    }
+
+protected:
+    void* frame_ { nullptr };
+};
+
+template <typename Promise>
+struct coroutine_handle : coroutine_handle<> {
+    using coroutine_handle<>::coroutine_handle;
+
+    [[nodiscard]] static auto from_promise(Promise& promise) noexcept -> coroutine_handle
+    {
+        auto self   = coroutine_handle {};
+        self.frame_ = __builtin_coro_promise(static_cast<char*>(static_cast<void*>(&promise)), alignof(Promise), true);
+        return self;
+    }
+
+    [[nodiscard]] static constexpr auto from_address(void* addr) noexcept -> coroutine_handle
+    {
+        auto self   = coroutine_handle {};
+        self.frame_ = addr;
+        return self;
+    }
+
+    [[nodiscard]] auto promise() const -> Promise&
+    {
+        return *static_cast<Promise*>(__builtin_coro_promise(frame_, alignof(Promise), false));
+    }
+};
+
+struct noop_coroutine_promise { };
+
+using noop_coroutine_handle = coroutine_handle<noop_coroutine_promise>;
+
+[[nodiscard]] inline auto noop_coroutine() noexcept -> noop_coroutine_handle
+{
+        #if __has_builtin(__builtin_coro_noop)
+    return noop_coroutine_handle::from_address(__builtin_coro_noop());
+        #else
+    // GCC and Clang start every frame with its resume and destroy functions
+    struct noop_frame {
+        static auto noop(noop_frame* /*frame*/) -> void { }
+
+        void (*resume)(noop_frame*) { noop };
+        void (*destroy)(noop_frame*) { noop };
+        noop_coroutine_promise promise;
+    };
+
+    static auto frame = noop_frame {};
+    return noop_coroutine_handle::from_address(&frame);
+        #endif
+}
+
+} // namespace std
+
+    #endif
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_STD_COROUTINE_HPP
@@ -5,7 +5,7 @@
 
 #include "etl/_coroutine/coroutine_handle.hpp"
 
-#if defined(__cpp_coroutines)
+#if defined(__cpp_impl_coroutine)
 
 namespace etl {
 
@@ -21,6 +21,6 @@ struct suspend_always {
 
 } // namespace etl
 
-#endif // defined(__cpp_coroutines)
+#endif // defined(__cpp_impl_coroutine)
 
 #endif // TETL_COROUTINE_SUSPEND_ALWAYS_HPP
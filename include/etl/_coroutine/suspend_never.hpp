@@ -5,7 +5,7 @@
 
 #include "etl/_coroutine/coroutine_handle.hpp"
 
-#if defined(__cpp_coroutines)
+#if defined(__cpp_impl_coroutine)
 
 namespace etl {
 
@@ -13,7 +13,7 @@ struct suspend_never {
     [[nodiscard]] constexpr auto await_ready() const noexcept -> bool
     {
         (void)this;
-        return false;
+        return true;
     }
     constexpr auto await_suspend(coroutine_handle<> /*unused*/) const noexcept -> void { (void)this; }
     constexpr auto await_resume() const noexcept -> void { (void)this; }
@@ -21,6 +21,6 @@ struct suspend_never {
 
 } // namespace etl
 
-#endif // defined(__cpp_coroutines)
+#endif // defined(__cpp_impl_coroutine)
 
 #endif // TETL_COROUTINE_SUSPEND_NEVER_HPP
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_TASK_HPP
+#define TETL_COROUTINE_TASK_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cassert/macro.hpp"
+#include "etl/_coroutine/coroutine_handle.hpp"
+#include "etl/_coroutine/promise_allocator.hpp"
+#include "etl/_coroutine/suspend_always.hpp"
+#include "etl/_optional/optional.hpp"
+#include "etl/_type_traits/is_reference.hpp"
+#include "etl/_utility/exchange.hpp"
+#include "etl/_utility/forward.hpp"
+#include "etl/_utility/move.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace etl {
+
+template <typename T = void>
+struct task;
+
+namespace detail {
+
+struct task_promise_base : promise_allocator {
+    struct final_awaiter {
+        [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+
+        // symmetric transfer to the awaiting coroutine, resuming it from here
+        // would grow the stack with every completed task
+        template <typename Promise>
+        [[nodiscard]] auto await_suspend(coroutine_handle<Promise> handle) const noexcept -> coroutine_handle<>
+        {
+            auto const continuation = handle.promise().continuation_;
+            return continuation ? continuation : noop_coroutine();
+        }
+
+        auto await_resume() const noexcept -> void { }
+    };
+
+    [[nodiscard]] auto initial_suspend() const noexcept -> suspend_always { return {}; }
+    [[nodiscard]] auto final_suspend() const noexcept -> final_awaiter { return {}; }
+
+    auto unhandled_exception() -> void
+    {
+    #if defined(__cpp_exceptions)
+        throw;
+    #endif
+    }
+
+    coroutine_handle<> continuation_ { nullptr };
+};
+
+template <typename T>
+struct task_promise : task_promise_base {
+    [[nodiscard]] auto get_return_object() noexcept -> task<T>;
+
+    template <typename U = T>
+    auto return_value(U&& value) -> void
+    {
+        value_.emplace(etl::forward<U>(value));
+    }
+
+    [[nodiscard]] auto result() -> T&&
+    {
+        TETL_ASSERT(value_.has_value());
+        return etl::move(*value_);
+    }
+
+private:
+    optional<T> value_;
+};
+
+template <>
+struct task_promise<void> : task_promise_base {
+    [[nodiscard]] auto get_return_object() noexcept -> task<void>;
+
+    auto return_void() const noexcept -> void { }
+
+    auto result() const noexcept -> void { }
+};
+
+} // namespace detail
+
+/// \brief A lazily started asynchronous operation, which produces a T. Awaiting
+/// a task starts it and resumes the awaiting coroutine, once it completes.
+///
+/// \details Completion resumes the awaiting coroutine by symmetric transfer,
+/// so long chains of synchronously completing tasks run in constant stack
+/// space. The frame is allocated from a memory resource, if the coroutine
+/// takes (allocator_arg_t, Resource&, ...) as its first parameters, e.g.
+/// frame_arena. A top-level task is started with start() and runs until its
+/// first suspension that is not an awaited task, e.g. an I/O awaiter.
+///
+/// \headerfile etl/coroutine.hpp
+template <typename T>
+struct task {
+    static_assert(not is_reference_v<T>, "task does not support references");
+
+    using promise_type = detail::task_promise<T>;
+
+    task(task&& other) noexcept : handle_ { etl::exchange(other.handle_, nullptr) } { }
+
+    auto operator=(task&& other) noexcept -> task&
+    {
+        if (this != &other) {
+            if (handle_) { handle_.destroy(); }
+            handle_ = etl::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    task(task const&)                    = delete;
+    auto operator=(task const&) -> task& = delete;
+
+    ~task()
+    {
+        if (handle_) { handle_.destroy(); }
+    }
+
+    /// \brief Starts a top-level task, which is not awaited by a coroutine.
+    auto start() -> void
+    {
+        TETL_ASSERT(handle_ and not handle_.done());
+        handle_.resume();
+    }
+
+    [[nodiscard]] auto done() const noexcept -> bool { return not handle_ or handle_.done(); }
+
+    /// \brief Returns the result of a completed top-level task.
+    [[nodiscard]] auto result() -> decltype(auto)
+    {
+        TETL_ASSERT(handle_.done());
+        return handle_.promise().result();
+    }
+
+    [[nodiscard]] auto operator co_await() && noexcept
+    {
+        struct awaiter {
+            [[nodiscard]] auto await_ready() const noexcept -> bool { return handle.done(); }
+
+            [[nodiscard]] auto await_suspend(coroutine_handle<> awaiting) const noexcept -> coroutine_handle<>
+            {
+                handle.promise().continuation_ = awaiting;
+                return handle;
+            }
+
+            auto await_resume() const -> decltype(auto) { return handle.promise().result(); }
+
+            coroutine_handle<promise_type> handle;
+        };
+        return awaiter { handle_ };
+    }
+
+private:
+    friend promise_type;
+    explicit task(coroutine_handle<promise_type> handle) noexcept : handle_ { handle } { }
+    coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+auto task_promise<T>::get_return_object() noexcept -> task<T>
+{
+    return task<T> { coroutine_handle<task_promise>::from_promise(*this) };
+}
+
+inline auto task_promise<void>::get_return_object() noexcept -> task<void>
+{
+    return task<void> { coroutine_handle<task_promise>::from_promise(*this) };
+}
+
+} // namespace detail
+
+} // namespace etl
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // TETL_COROUTINE_TASK_HPP
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_COROUTINE_WAITER_LIST_HPP
+#define TETL_COROUTINE_WAITER_LIST_HPP
+
+#include "etl/_config/all.hpp"
+
+namespace etl::detail {
+
+/// \brief Intrusive FIFO of awaiters. The nodes live in the frames of the
+/// suspended coroutines, so waiting never allocates. Node needs a public
+/// `Node* next` member.
+template <typename Node>
+struct waiter_list {
+    auto push_back(Node* node) noexcept -> void
+    {
+        node->next = nullptr;
+        if (tail_ != nullptr) {
+            tail_->next = node;
+        } else {
+            head_ = node;
+        }
+        tail_ = node;
+    }
+
+    [[nodiscard]] auto pop_front() noexcept -> Node*
+    {
+        auto* node = head_;
+        if (node != nullptr) {
+            head_ = node->next;
+            if (head_ == nullptr) { tail_ = nullptr; }
+        }
+        return node;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return head_ == nullptr; }
+
+private:
+    Node* head_ { nullptr };
+    Node* tail_ { nullptr };
+};
+
+} // namespace etl::detail
+
+#endif // TETL_COROUTINE_WAITER_LIST_HPP
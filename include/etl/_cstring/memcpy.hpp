@@ -3,8 +3,11 @@
 #ifndef TETL_CSTRING_MEMCPY_HPP
 #define TETL_CSTRING_MEMCPY_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_cstddef/size_t.hpp"
 #include "etl/_strings/cstr_algorithm.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
 
 namespace etl {
 
@@ -13,6 +16,11 @@ namespace etl {
 /// might overlap, memmove() must be used instead.
 constexpr auto memcpy(void* dest, void const* src, etl::size_t n) -> void*
 {
+    if (!is_constant_evaluated()) {
+#if __has_builtin(__builtin_memcpy)
+        return __builtin_memcpy(dest, src, n);
+#endif
+    }
     return detail::memcpy_impl<unsigned char, etl::size_t>(dest, src, n);
 }
 
@@ -3,8 +3,11 @@
 #ifndef TETL_CSTRING_MEMMOVE_HPP
 #define TETL_CSTRING_MEMMOVE_HPP
 
+#include "etl/_config/all.hpp"
+
 #include "etl/_cstddef/size_t.hpp"
 #include "etl/_strings/cstr_algorithm.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
 
 namespace etl {
 
@@ -12,6 +15,11 @@ namespace etl {
 /// dest. Source and destination may overlap.
 constexpr auto memmove(void* dest, void const* src, etl::size_t count) -> void*
 {
+    if (!is_constant_evaluated()) {
+#if __has_builtin(__builtin_memmove)
+        return __builtin_memmove(dest, src, count);
+#endif
+    }
     return detail::memmove_impl<unsigned char>(dest, src, count);
 }
 
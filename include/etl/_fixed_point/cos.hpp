@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_COS_HPP
+#define TETL_FIXED_POINT_COS_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_fixed_point/trig_kernel.hpp"
+
+namespace etl {
+
+/// \brief Computes the cosine of x (measured in radians) without floating
+/// point arithmetic.
+///
+/// \details The result is computed in Q31 with an absolute error of a few
+/// 2^-31 for |x| < 2^31 and then rounded to F fractional bits. 1.0 saturates
+/// to max() if there are no integer bits.
+///
+/// \headerfile etl/fixed_point.hpp
+template <int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto cos(fixed_point<I, F, S, O> x) noexcept -> fixed_point<I, F, S, O>
+{
+    static_assert(F <= 62, "at most 62 fractional bits are supported");
+
+    // cos is even, only |x| is reduced
+    auto const u = x.raw() < 0 ? uint64_t(0) - static_cast<uint64_t>(x.raw()) : static_cast<uint64_t>(x.raw());
+    return detail::fixed_point_from_q31<I, F, S, O>(detail::fixed_point_sincos(u, F, 1));
+}
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_COS_HPP
@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_FIXED_POINT_HPP
+#define TETL_FIXED_POINT_FIXED_POINT_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cassert/macro.hpp"
+#include "etl/_concepts/floating_point.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/int_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_fixed_point/fixed_point_overflow.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_type_traits/is_signed.hpp"
+#include "etl/_utility/cmp.hpp"
+
+namespace etl {
+
+namespace detail {
+
+template <bool Signed, size_t Size>
+struct fixed_point_wide;
+
+template <>
+struct fixed_point_wide<true, 1> {
+    using type = int16_t;
+};
+
+template <>
+struct fixed_point_wide<false, 1> {
+    using type = uint16_t;
+};
+
+template <>
+struct fixed_point_wide<true, 2> {
+    using type = int32_t;
+};
+
+template <>
+struct fixed_point_wide<false, 2> {
+    using type = uint32_t;
+};
+
+template <>
+struct fixed_point_wide<true, 4> {
+    using type = int64_t;
+};
+
+template <>
+struct fixed_point_wide<false, 4> {
+    using type = uint64_t;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <>
+struct fixed_point_wide<true, 8> {
+    __extension__ using type = __int128;
+};
+
+template <>
+struct fixed_point_wide<false, 8> {
+    __extension__ using type = unsigned __int128;
+};
+#endif
+
+/// \brief Signed integer type with twice the width of Storage, used for the
+/// intermediate results of arithmetic and conversions. 64 bit storage
+/// requires __int128.
+template <typename Storage>
+using fixed_point_wide_t = typename fixed_point_wide<true, sizeof(Storage)>::type;
+
+/// \brief Unsigned integer type with twice the width of Storage.
+template <typename Storage>
+using fixed_point_uwide_t = typename fixed_point_wide<false, sizeof(Storage)>::type;
+
+/// \brief Type of products with the raw value of a fixed_point, unsigned for
+/// unsigned Storage, so the product of two 64 bit values does not overflow.
+template <typename Storage>
+using fixed_point_product_t = typename fixed_point_wide<is_signed_v<Storage>, sizeof(Storage)>::type;
+
+/// \brief Divides v by 2^shift and rounds half up.
+template <typename Wide>
+[[nodiscard]] constexpr auto fixed_point_shift_right(Wide v, int shift) noexcept -> Wide
+{
+    if (shift == 0) { return v; }
+    return (v + (Wide(1) << (shift - 1))) >> shift;
+}
+
+/// \brief Divides num by den and rounds half away from zero.
+template <typename Wide>
+[[nodiscard]] constexpr auto fixed_point_divide(Wide num, Wide den) noexcept -> Wide
+{
+    auto const half = (den < Wide(0) ? Wide(0) - den : den) / Wide(2);
+    return (num < Wide(0) ? num - half : num + half) / den;
+}
+
+/// \brief Converts a wide intermediate result to the raw value of a
+/// fixed_point with Bits value bits, i.e. without the sign bit.
+template <typename Storage, int Bits, fixed_point_overflow Overflow, typename Wide>
+[[nodiscard]] constexpr auto fixed_point_narrow(Wide v) noexcept -> Storage
+{
+    constexpr auto is_signed = etl::is_signed_v<Storage>;
+    constexpr auto max       = (Wide(1) << Bits) - Wide(1);
+    constexpr auto lowest    = is_signed ? Wide(0) - (Wide(1) << Bits) : Wide(0);
+
+    if constexpr (Overflow == fixed_point_overflow::saturate) {
+        if (v > max) { return static_cast<Storage>(max); }
+        if (v < lowest) { return static_cast<Storage>(lowest); }
+        return static_cast<Storage>(v);
+    } else {
+        using uwide_t    = fixed_point_uwide_t<Storage>;
+        constexpr auto w = Bits + static_cast<int>(is_signed);
+        auto const bits  = static_cast<uwide_t>(v) & ((uwide_t(1) << w) - uwide_t(1));
+        if (is_signed and ((bits >> Bits) & uwide_t(1)) != 0) {
+            return static_cast<Storage>(static_cast<Wide>(bits) - (Wide(1) << w));
+        }
+        return static_cast<Storage>(bits);
+    }
+}
+
+/// \brief Returns 2^exponent.
+template <typename T>
+[[nodiscard]] constexpr auto fixed_point_scale(int exponent) noexcept -> T
+{
+    auto scale = T(1);
+    for (auto i = 0; i < exponent; ++i) { scale *= T(2); }
+    return scale;
+}
+
+} // namespace detail
+
+/// \brief A binary fixed-point number in Q format with IntBits integer and
+/// FracBits fractional bits, stored as the integer raw() / 2^FracBits.
+///
+/// \details For signed Storage the sign bit is not counted in IntBits, so
+/// fixed_point<0, 15, int16_t> is Q15 with the range [-1, 1). The arithmetic
+/// needs no FPU: products and quotients are computed in an integer type of
+/// twice the width of Storage and rounded to the nearest representable value.
+/// Results outside of [lowest(), max()] are handled according to Overflow.
+///
+/// \headerfile etl/fixed_point.hpp
+template <int IntBits, int FracBits, typename Storage = int32_t,
+    fixed_point_overflow Overflow = fixed_point_overflow::saturate>
+struct fixed_point {
+    static_assert(detail::int_and_not_char_v<Storage>, "Storage must be an integer type");
+    static_assert(IntBits >= 0 and FracBits >= 0, "number of bits must not be negative");
+    static_assert(IntBits + FracBits <= numeric_limits<Storage>::digits, "Storage is too small");
+
+    using storage_type = Storage;
+    using wide_type    = detail::fixed_point_wide_t<Storage>;
+
+    static constexpr int integer_bits              = IntBits;
+    static constexpr int fractional_bits           = FracBits;
+    static constexpr fixed_point_overflow overflow = Overflow;
+
+    /// \brief Constructs zero.
+    constexpr fixed_point() noexcept = default;
+
+    /// \brief Constructs the value of the integer value. Values outside of the
+    /// range saturate or wrap according to Overflow.
+    template <typename Int>
+        requires(detail::int_and_not_char_v<Int>)
+    constexpr explicit fixed_point(Int value) noexcept
+    {
+        if constexpr (Overflow == fixed_point_overflow::saturate) {
+            if (cmp_greater(value, max().raw_ >> FracBits)) {
+                raw_ = max().raw_;
+            } else if (cmp_less(value, lowest().raw_ >> FracBits)) {
+                raw_ = lowest().raw_;
+            } else {
+                raw_ = static_cast<Storage>(static_cast<wide_type>(value) << FracBits);
+            }
+        } else {
+            using uwide_t = detail::fixed_point_uwide_t<Storage>;
+            auto const v  = static_cast<wide_type>(static_cast<uwide_t>(value) << FracBits);
+            raw_          = detail::fixed_point_narrow<Storage, IntBits + FracBits, Overflow>(v);
+        }
+    }
+
+    /// \brief Constructs the value closest to value, halfway cases are rounded
+    /// away from zero. Values outside of the range saturate with both
+    /// overflow policies, NaN is converted to zero.
+    template <floating_point Float>
+    constexpr explicit fixed_point(Float value) noexcept
+    {
+        if (value != value) { return; }
+
+        auto const scaled = value * detail::fixed_point_scale<Float>(FracBits);
+        auto const round  = scaled < Float(0) ? scaled - Float(0.5) : scaled + Float(0.5);
+        if (round >= static_cast<Float>(max().raw_)) {
+            raw_ = max().raw_;
+        } else if (round <= static_cast<Float>(lowest().raw_)) {
+            raw_ = lowest().raw_;
+        } else {
+            raw_ = static_cast<Storage>(round);
+        }
+    }
+
+    /// \brief Converts from a different Q format. Fractional bits that are
+    /// dropped are rounded half up, the integer part saturates or wraps
+    /// according to Overflow.
+    template <int I, int F, typename S, fixed_point_overflow O>
+    constexpr explicit fixed_point(fixed_point<I, F, S, O> const& other) noexcept
+    {
+        // the signed double width type of the larger storage holds both values
+        constexpr auto size = sizeof(S) > sizeof(Storage) ? sizeof(S) : sizeof(Storage);
+        using calc_t        = typename detail::fixed_point_wide<true, size>::type;
+
+        auto v = static_cast<calc_t>(other.raw());
+        if constexpr (F > FracBits) {
+            v = detail::fixed_point_shift_right(v, F - FracBits);
+        } else {
+            v = v << (FracBits - F);
+        }
+        raw_ = detail::fixed_point_narrow<Storage, IntBits + FracBits, Overflow>(v);
+    }
+
+    /// \brief Returns the fixed_point with the raw value raw, i.e. raw / 2^FracBits.
+    [[nodiscard]] static constexpr auto from_raw(Storage raw) noexcept -> fixed_point
+    {
+        auto result = fixed_point {};
+        result.raw_ = raw;
+        return result;
+    }
+
+    /// \brief Returns the stored integer, i.e. the value times 2^FracBits.
+    [[nodiscard]] constexpr auto raw() const noexcept -> Storage { return raw_; }
+
+    /// \brief Returns the lowest representable value.
+    [[nodiscard]] static constexpr auto lowest() noexcept -> fixed_point
+    {
+        if constexpr (is_signed_v<Storage>) {
+            return from_raw(static_cast<Storage>(-max().raw_ - 1));
+        } else {
+            return from_raw(Storage(0));
+        }
+    }
+
+    /// \brief Returns the largest representable value.
+    [[nodiscard]] static constexpr auto max() noexcept -> fixed_point
+    {
+        if constexpr (IntBits + FracBits == numeric_limits<Storage>::digits) {
+            return from_raw(numeric_limits<Storage>::max());
+        } else {
+            return from_raw(static_cast<Storage>((Storage(1) << (IntBits + FracBits)) - 1));
+        }
+    }
+
+    /// \brief Returns the difference between two adjacent values, 2^-FracBits.
+    [[nodiscard]] static constexpr auto epsilon() noexcept -> fixed_point { return from_raw(Storage(1)); }
+
+    /// \brief Converts to the nearest floating point value.
+    template <floating_point Float>
+    [[nodiscard]] constexpr explicit operator Float() const noexcept
+    {
+        return static_cast<Float>(raw_) / detail::fixed_point_scale<Float>(FracBits);
+    }
+
+    /// \brief Converts to an integer, the fractional part is truncated.
+    template <typename Int>
+        requires(detail::int_and_not_char_v<Int>)
+    [[nodiscard]] constexpr explicit operator Int() const noexcept
+    {
+        return static_cast<Int>(static_cast<wide_type>(raw_) / (wide_type(1) << FracBits));
+    }
+
+    [[nodiscard]] constexpr auto operator+() const noexcept -> fixed_point { return *this; }
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> fixed_point
+    {
+        return make(wide_type(0) - static_cast<wide_type>(raw_));
+    }
+
+    constexpr auto operator+=(fixed_point other) noexcept -> fixed_point& { return *this = *this + other; }
+
+    constexpr auto operator-=(fixed_point other) noexcept -> fixed_point& { return *this = *this - other; }
+
+    constexpr auto operator*=(fixed_point other) noexcept -> fixed_point& { return *this = *this * other; }
+
+    constexpr auto operator/=(fixed_point other) noexcept -> fixed_point& { return *this = *this / other; }
+
+    [[nodiscard]] friend constexpr auto operator+(fixed_point lhs, fixed_point rhs) noexcept -> fixed_point
+    {
+        return make(static_cast<wide_type>(lhs.raw_) + static_cast<wide_type>(rhs.raw_));
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(fixed_point lhs, fixed_point rhs) noexcept -> fixed_point
+    {
+        return make(static_cast<wide_type>(lhs.raw_) - static_cast<wide_type>(rhs.raw_));
+    }
+
+    /// \brief Multiplies in the double width type, the result is rounded half up.
+    [[nodiscard]] friend constexpr auto operator*(fixed_point lhs, fixed_point rhs) noexcept -> fixed_point
+    {
+        using product_t    = detail::fixed_point_product_t<Storage>;
+        auto const lhs_raw = static_cast<product_t>(lhs.raw_);
+        auto const product = static_cast<product_t>(lhs_raw * static_cast<product_t>(rhs.raw_));
+        return make(detail::fixed_point_shift_right(product, FracBits));
+    }
+
+    /// \brief Divides in the double width type, the result is rounded half away
+    /// from zero. The behavior is undefined if rhs is zero.
+    [[nodiscard]] friend constexpr auto operator/(fixed_point lhs, fixed_point rhs) noexcept -> fixed_point
+    {
+        TETL_ASSERT(rhs.raw_ != 0);
+        using product_t = detail::fixed_point_product_t<Storage>;
+        auto const num  = static_cast<product_t>(static_cast<product_t>(lhs.raw_) * (product_t(1) << FracBits));
+        return make(detail::fixed_point_divide(num, static_cast<product_t>(rhs.raw_)));
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(fixed_point lhs, fixed_point rhs) noexcept -> bool = default;
+
+    [[nodiscard]] friend constexpr auto operator<(fixed_point lhs, fixed_point rhs) noexcept -> bool
+    {
+        return lhs.raw_ < rhs.raw_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator<=(fixed_point lhs, fixed_point rhs) noexcept -> bool
+    {
+        return lhs.raw_ <= rhs.raw_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator>(fixed_point lhs, fixed_point rhs) noexcept -> bool
+    {
+        return lhs.raw_ > rhs.raw_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator>=(fixed_point lhs, fixed_point rhs) noexcept -> bool
+    {
+        return lhs.raw_ >= rhs.raw_;
+    }
+
+private:
+    template <typename Wide>
+    [[nodiscard]] static constexpr auto make(Wide v) noexcept -> fixed_point
+    {
+        return from_raw(detail::fixed_point_narrow<Storage, IntBits + FracBits, Overflow>(v));
+    }
+
+    Storage raw_ { 0 };
+};
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_FIXED_POINT_HPP
@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_FIXED_POINT_OVERFLOW_HPP
+#define TETL_FIXED_POINT_FIXED_POINT_OVERFLOW_HPP
+
+namespace etl {
+
+/// \brief Selects what the arithmetic of fixed_point does with results
+/// outside of its range.
+/// \headerfile etl/fixed_point.hpp
+enum struct fixed_point_overflow : unsigned char {
+    /// \brief Clamps the result to lowest() or max().
+    saturate,
+
+    /// \brief Keeps the low bits of the result, like unsigned integer
+    /// arithmetic does.
+    wrap,
+};
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_FIXED_POINT_OVERFLOW_HPP
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_FROM_CHARS_HPP
+#define TETL_FIXED_POINT_FROM_CHARS_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_charconv/from_chars.hpp"
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_system_error/errc.hpp"
+#include "etl/_type_traits/is_signed.hpp"
+
+namespace etl {
+
+/// \brief Parses a decimal number of the form [-]digits[.digits] from
+/// [first, last) and stores the closest fixed_point to value. Halfway cases
+/// are rounded away from zero.
+///
+/// \details Returns { first, errc::invalid_argument } if no digits match the
+/// pattern and { end of the pattern, errc::result_out_of_range } if the number
+/// is outside of the range of value. value is unmodified in both cases. The
+/// minus sign is only accepted for signed storage.
+///
+/// The fractional digits are divided by 10 from the last one to the first
+/// in a fixed-point accumulator with 4 bits less than the double width type,
+/// which is exact for every decimal that is a halfway case.
+///
+/// \headerfile etl/fixed_point.hpp
+template <int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto from_chars(char const* first, char const* last, fixed_point<I, F, S, O>& value)
+    -> from_chars_result
+{
+    using fixed_t = fixed_point<I, F, S, O>;
+    using wide_t  = typename fixed_t::wide_type;
+    using uwide_t = detail::fixed_point_uwide_t<S>;
+
+    auto const is_digit = [](char c) { return c >= '0' and c <= '9'; };
+
+    auto const* p       = first;
+    auto const negative = is_signed_v<S> and p != last and *p == '-';
+    if (negative) { ++p; }
+
+    // magnitude of lowest() or max() in units of epsilon()
+    auto const limit = negative ? uwide_t(0) - static_cast<uwide_t>(static_cast<wide_t>(fixed_t::lowest().raw()))
+                                : static_cast<uwide_t>(fixed_t::max().raw());
+
+    auto const* const int_first = p;
+    auto integer                = uwide_t(0);
+    auto overflow               = false;
+    for (; p != last and is_digit(*p); ++p) {
+        integer  = integer * 10U + static_cast<uwide_t>(*p - '0');
+        overflow = overflow or integer > (limit >> F);
+        if (overflow) { integer = 0; }
+    }
+    auto const* const int_last = p;
+
+    auto const* frac_first = p;
+    auto const* frac_last  = p;
+    if (p != last and *p == '.') {
+        frac_first = ++p;
+        while (p != last and is_digit(*p)) { ++p; }
+        frac_last = p;
+    }
+
+    if (int_first == int_last and frac_first == frac_last) { return { first, errc::invalid_argument }; }
+    if (overflow) { return { p, errc::result_out_of_range }; }
+
+    constexpr auto bits  = static_cast<int>(sizeof(uwide_t) * 8) - 4;
+    constexpr auto guard = bits - F;
+
+    auto fraction = uwide_t(0);
+    for (auto const* digit = frac_last; digit != frac_first; --digit) {
+        fraction = (fraction + (static_cast<uwide_t>(digit[-1] - '0') << bits)) / 10U;
+    }
+    fraction = (fraction + (uwide_t(1) << (guard - 1))) >> guard;
+
+    auto const magnitude = (integer << F) + fraction;
+    if (magnitude > limit) { return { p, errc::result_out_of_range }; }
+
+    auto const raw = static_cast<wide_t>(magnitude);
+    value          = fixed_t::from_raw(static_cast<S>(negative ? wide_t(0) - raw : raw));
+    return { p, {} };
+}
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_FROM_CHARS_HPP
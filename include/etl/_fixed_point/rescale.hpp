@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_RESCALE_HPP
+#define TETL_FIXED_POINT_RESCALE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_utility/cmp.hpp"
+
+namespace etl {
+
+/// \brief Multiplies x by the compile-time rational constant Ratio, e.g.
+/// rescale<ratio<3300, 4096>>(adc) to convert ADC counts to millivolts.
+///
+/// \details The product with Ratio::num is exact in the double width type,
+/// the division by Ratio::den is rounded half away from zero. The result
+/// saturates or wraps according to the overflow policy of x.
+///
+/// \headerfile etl/fixed_point.hpp
+template <typename Ratio, int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto rescale(fixed_point<I, F, S, O> x) noexcept -> fixed_point<I, F, S, O>
+{
+    using wide_t = detail::fixed_point_product_t<S>;
+    static_assert(in_range<S>(Ratio::num), "numerator must fit into the storage type");
+    static_assert(in_range<S>(Ratio::den), "denominator must fit into the storage type");
+
+    auto const product = static_cast<wide_t>(x.raw()) * static_cast<wide_t>(Ratio::num);
+    auto const result  = detail::fixed_point_divide(product, static_cast<wide_t>(Ratio::den));
+    return fixed_point<I, F, S, O>::from_raw(detail::fixed_point_narrow<S, I + F, O>(result));
+}
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_RESCALE_HPP
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_SQRT_HPP
+#define TETL_FIXED_POINT_SQRT_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_fixed_point/fixed_point.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/// \brief Integer square root of v, rounded to nearest. Computes one bit of
+/// the result per step like long division.
+template <typename UInt>
+[[nodiscard]] constexpr auto fixed_point_isqrt(UInt v) noexcept -> UInt
+{
+    auto root = UInt(0);
+    auto bit  = UInt(1) << (sizeof(UInt) * 8 - 2);
+    while (bit > v) { bit >>= 2U; }
+
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1U) + bit;
+        } else {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+
+    // v is the remainder, round up if v > root^2 + root, i.e. root + 0.5 < sqrt
+    return v > root ? root + 1 : root;
+}
+
+} // namespace detail
+
+/// \brief Computes the square root of x, rounded to the nearest
+/// representable value. Returns zero for negative arguments.
+///
+/// \details The raw value shifted by FracBits is an integer in the double
+/// width type, its integer square root is the raw result. Results above
+/// max(), which are only possible without integer bits, saturate.
+///
+/// \headerfile etl/fixed_point.hpp
+template <int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto sqrt(fixed_point<I, F, S, O> x) noexcept -> fixed_point<I, F, S, O>
+{
+    using uwide_t = detail::fixed_point_uwide_t<S>;
+    if (x.raw() <= 0) { return {}; }
+
+    auto const root = detail::fixed_point_isqrt(static_cast<uwide_t>(static_cast<uwide_t>(x.raw()) << F));
+    if (root > static_cast<uwide_t>(fixed_point<I, F, S, O>::max().raw())) { return fixed_point<I, F, S, O>::max(); }
+    return fixed_point<I, F, S, O>::from_raw(static_cast<S>(root));
+}
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_SQRT_HPP
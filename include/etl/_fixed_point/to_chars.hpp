@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_TO_CHARS_HPP
+#define TETL_FIXED_POINT_TO_CHARS_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_charconv/to_chars.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_system_error/errc.hpp"
+
+namespace etl {
+
+/// \brief Converts value into the shortest decimal string, that from_chars
+/// converts back to value, e.g. "-1.5" or "0.1" for Q15 0.100006.
+///
+/// \details The fractional digits are generated one by one, until the
+/// truncated or the rounded up decimal is closer to value than half of
+/// epsilon(). On success, ptr points one past the last character written.
+/// If the string does not fit into [first, last), returns
+/// { last, errc::value_too_large }.
+///
+/// \headerfile etl/fixed_point.hpp
+template <int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto to_chars(char* first, char* last, fixed_point<I, F, S, O> value) -> to_chars_result
+{
+    using wide_t  = typename fixed_point<I, F, S, O>::wide_type;
+    using uwide_t = detail::fixed_point_uwide_t<S>;
+
+    auto const raw       = static_cast<wide_t>(value.raw());
+    auto const magnitude = static_cast<uwide_t>(raw < wide_t(0) ? wide_t(0) - raw : raw);
+    auto const integer   = static_cast<uint64_t>(magnitude >> F);
+    auto const fraction  = magnitude & ((uwide_t(1) << F) - uwide_t(1));
+
+    auto* out = first;
+    if (raw < wide_t(0)) {
+        if (out == last) { return { last, errc::value_too_large }; }
+        *out++ = '-';
+    }
+
+    auto const [end, ec] = etl::to_chars(out, last, integer);
+    if (ec != errc {}) { return { last, errc::value_too_large }; }
+    out += end - out;
+    if (fraction == 0) { return { out, {} }; }
+
+    if (out == last) { return { last, errc::value_too_large }; }
+    *out++ = '.';
+
+    // after k digits, rest / scale is the remaining fraction and delta / scale
+    // is half of epsilon(), both times 10^k
+    auto const scale = uwide_t(2) << F;
+    auto rest        = static_cast<uwide_t>(fraction << 1U);
+    auto delta       = uwide_t(1);
+    auto low         = false;
+    auto high        = false;
+    while (not low and not high) {
+        if (out == last) { return { last, errc::value_too_large }; }
+        rest *= 10U;
+        delta *= 10U;
+        *out++ = static_cast<char>('0' + static_cast<int>(rest >> (F + 1)));
+        rest &= scale - 1U;
+        low  = rest < delta;
+        high = scale - rest < delta;
+    }
+
+    // the rounded up decimal is closer. The last digit is never a 9, the loop
+    // would have stopped one digit earlier with the same margin.
+    if (high and (not low or rest > scale - rest)) { ++out[-1]; }
+    return { out, {} };
+}
+
+} // namespace etl
+
+#endif // TETL_FIXED_POINT_TO_CHARS_HPP
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_TRIG_KERNEL_HPP
+#define TETL_FIXED_POINT_TRIG_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstdint/int_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_math/mul_wide.hpp"
+
+namespace etl::detail {
+
+/// \brief Rounds the Q31 product of a and b.
+[[nodiscard]] constexpr auto fixed_point_mul_q31(int64_t a, int64_t b) noexcept -> int64_t
+{
+    return (a * b + (int64_t(1) << 30)) >> 31;
+}
+
+/// \brief sin(x) for quadrant 0 or cos(x) for quadrant 1 of |x| = u / 2^frac
+/// in Q31, i.e. with an absolute error of a few 2^-31.
+///
+/// \details u is reduced to r + n pi/2 with r in Q62. u 2^(62 - frac) and
+/// n pi/2 2^62 overflow for large u, but their difference is small, so it is
+/// exact modulo 2^64. The rounding error of pi/2 in Q62 times n stays below
+/// 2^-31 as long as n < 2^31, i.e. |x| < 2^31. The Taylor polynomials of
+/// degree 11 and 12 are evaluated in Q31.
+[[nodiscard]] constexpr auto fixed_point_sincos(uint64_t u, int frac, unsigned quadrant) noexcept -> int64_t
+{
+    constexpr auto two_over_pi = uint64_t(0xA2F9'836E'4E44'152A); // 2/pi 2^64
+    constexpr auto pi_over_two = uint64_t(0x6487'ED51'10B4'611A); // pi/2 2^62
+
+    auto const [lo, hi] = mul_wide(u, two_over_pi);
+    auto const n        = frac == 0 ? hi + (lo >> 63U) : (hi + (uint64_t(1) << (frac - 1))) >> frac;
+    auto const x62      = u << (62 - frac);
+    auto const r62      = static_cast<int64_t>(x62 - n * pi_over_two);
+
+    auto const r = (r62 + (int64_t(1) << 30)) >> 31;
+    auto const z = fixed_point_mul_q31(r, r);
+
+    auto s = int64_t(-54);
+    s      = fixed_point_mul_q31(s, z) + 5918;
+    s      = fixed_point_mul_q31(s, z) - 426088;
+    s      = fixed_point_mul_q31(s, z) + 17895697;
+    s      = fixed_point_mul_q31(s, z) - 357913941;
+    s      = r + fixed_point_mul_q31(fixed_point_mul_q31(r, z), s);
+
+    auto c = int64_t(4);
+    c      = fixed_point_mul_q31(c, z) - 592;
+    c      = fixed_point_mul_q31(c, z) + 53261;
+    c      = fixed_point_mul_q31(c, z) - 2982616;
+    c      = fixed_point_mul_q31(c, z) + 89478485;
+    c      = fixed_point_mul_q31(c, z) - 1073741824;
+    c      = (int64_t(1) << 31) + fixed_point_mul_q31(c, z);
+
+    switch ((n + quadrant) & 3U) {
+        case 0: return s;
+        case 1: return c;
+        case 2: return -s;
+        default: return -c;
+    }
+}
+
+/// \brief Converts the Q31 result of fixed_point_sincos to the raw value of
+/// fixed_point<I, F, S, O>, saturating values outside of its range.
+template <int I, int F, typename S, fixed_point_overflow O>
+[[nodiscard]] constexpr auto fixed_point_from_q31(int64_t q31) noexcept -> fixed_point<I, F, S, O>
+{
+    using wide_t = typename fixed_point<I, F, S, O>::wide_type;
+
+    auto const v = F <= 31 ? fixed_point_shift_right(q31, 31 - F) : q31 * (int64_t(1) << (F - 31));
+    if (v < 0 and not is_signed_v<S>) { return {}; }
+    return fixed_point<I, F, S, O>::from_raw(
+        fixed_point_narrow<S, I + F, fixed_point_overflow::saturate>(static_cast<wide_t>(v))
+    );
+}
+
+} // namespace etl::detail
+
+#endif // TETL_FIXED_POINT_TRIG_KERNEL_HPP
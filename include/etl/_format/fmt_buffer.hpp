@@ -14,9 +14,10 @@ template <typename CharType>
 struct fmt_buffer {
     using value_type = CharType;
 
+    /// \brief Writes through out, which must outlive the buffer.
     template <typename It>
-    fmt_buffer(It out) noexcept
-        : it_ { addressof(out) }, push_back_ { [](void* ptr, CharType ch) { (*static_cast<It*>(ptr)) = ch; } }
+    fmt_buffer(It& out) noexcept
+        : it_ { addressof(out) }, push_back_ { [](void* ptr, CharType ch) { *(*static_cast<It*>(ptr))++ = ch; } }
     {
     }
 
@@ -5,6 +5,8 @@
 
 #include <etl/_format/argument.hpp>
 #include <etl/_format/basic_format_context.hpp>
+#include <etl/_format/fmt_buffer.hpp>
+#include <etl/_iterator/back_insert_iterator.hpp>
 #include <etl/_type_traits/remove_cvref.hpp>
 #include <etl/_vector/static_vector.hpp>
 
@@ -19,7 +21,8 @@ using diff_t = typename etl::iterator_traits<etl::remove_cvref_t<It>>::differenc
 template <typename OutputIt, typename... Args>
 auto format_to(OutputIt out, etl::string_view fmt, Args const&... args) -> OutputIt
 {
-    auto ctx = format_context { out };
+    auto buffer = detail::fmt_buffer<char> { out };
+    auto ctx    = format_context { back_inserter(buffer) };
 
     // Format leading text before the first argument.
     auto const slices = detail::split_at_next_argument(fmt);
@@ -50,7 +53,7 @@ auto format_to(OutputIt out, etl::string_view fmt, Args const&... args) -> Outpu
         TETL_ASSERT(trailing.second.empty());
     }
 
-    return ctx.out();
+    return out;
 }
 
 /// \brief etl::format_to_n_result has no base classes, or members other than
@@ -48,7 +48,7 @@ struct formatter<char[N], char> {
     template <typename FormatContext>
     constexpr auto format(char const* val, FormatContext& fc) -> decltype(fc.out())
     {
-        return etl::copy(val, val + N, fc.out());
+        return etl::copy(val, val + etl::strlen(val), fc.out());
     }
 };
 
@@ -4,11 +4,171 @@
 #define TETL_FUNCTIONAL_HASH_HPP
 
 #include "etl/_bit/bit_cast.hpp"
+#include "etl/_bit/endian.hpp"
 #include "etl/_cstddef/nullptr_t.hpp"
 #include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_cstdint/uintptr_t.hpp"
+#include "etl/_cstring/memcpy.hpp"
+#include "etl/_math/mul_wide.hpp"
+#include "etl/_type_traits/conditional.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
 
 namespace etl {
 
+namespace detail {
+
+/// \brief Finalizer of splitmix64. A bijection, so distinct keys never collide.
+[[nodiscard]] constexpr auto hash_mix(etl::uint64_t x) noexcept -> etl::uint64_t
+{
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31U);
+}
+
+/// \brief Finalizer of murmur3 for 32-bit platforms.
+[[nodiscard]] constexpr auto hash_mix(etl::uint32_t x) noexcept -> etl::uint32_t
+{
+    x = (x ^ (x >> 16U)) * 0x85EBCA6BU;
+    x = (x ^ (x >> 13U)) * 0xC2B2AE35U;
+    return x ^ (x >> 16U);
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto hash_integer(T val) noexcept -> etl::size_t
+{
+    if constexpr (sizeof(etl::size_t) <= 4 and sizeof(T) <= 4) {
+        return static_cast<etl::size_t>(hash_mix(static_cast<etl::uint32_t>(val)));
+    } else {
+        return static_cast<etl::size_t>(hash_mix(static_cast<etl::uint64_t>(val)));
+    }
+}
+
+/// \brief Returns byte i of the object representation of data, read in
+/// little-endian order. Works on integers and etl::byte during constant
+/// evaluation, where reinterpret_cast is not allowed.
+template <typename T>
+[[nodiscard]] constexpr auto hash_read_byte(T const* data, etl::size_t i) noexcept -> etl::uint64_t
+{
+    if constexpr (sizeof(T) == 1) {
+        return static_cast<etl::uint64_t>(static_cast<unsigned char>(data[i]));
+    } else {
+        auto const unit = static_cast<etl::uint64_t>(data[i / sizeof(T)]);
+        return (unit >> (8U * (i % sizeof(T)))) & 0xFFU;
+    }
+}
+
+/// \brief Reads N bytes starting at byte i as a little-endian integer. Uses a
+/// single unaligned load at runtime, the result is the same as during
+/// constant evaluation.
+template <etl::size_t N, typename T>
+[[nodiscard]] constexpr auto hash_read_unaligned(T const* data, etl::size_t i, etl::uint64_t& out) noexcept -> bool
+{
+    if constexpr (sizeof(T) == 1 and etl::endian::native == etl::endian::little) {
+        if (not is_constant_evaluated()) {
+            auto tmp = etl::conditional_t<N == 4, etl::uint32_t, etl::uint64_t> {};
+            etl::memcpy(&tmp, data + i, N);
+            out = tmp;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto hash_read4(T const* data, etl::size_t i) noexcept -> etl::uint64_t
+{
+    if (auto v = etl::uint64_t {}; hash_read_unaligned<4>(data, i, v)) { return v; }
+    return hash_read_byte(data, i) | (hash_read_byte(data, i + 1) << 8U) | (hash_read_byte(data, i + 2) << 16U)
+         | (hash_read_byte(data, i + 3) << 24U);
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto hash_read8(T const* data, etl::size_t i) noexcept -> etl::uint64_t
+{
+    if (auto v = etl::uint64_t {}; hash_read_unaligned<8>(data, i, v)) { return v; }
+    return hash_read4(data, i) | (hash_read4(data, i + 4) << 32U);
+}
+
+/// \brief Full 64x64 -> 128 bit multiply, stores the low half in a and the
+/// high half in b.
+constexpr auto hash_mum(etl::uint64_t& a, etl::uint64_t& b) noexcept -> void
+{
+    auto const r = mul_wide(a, b);
+    a            = r.lo;
+    b            = r.hi;
+}
+
+/// \brief 128 bit product of a and b, folded to 64 bits by xor of the halves.
+[[nodiscard]] constexpr auto hash_fold_mul(etl::uint64_t a, etl::uint64_t b) noexcept -> etl::uint64_t
+{
+    hash_mum(a, b);
+    return a ^ b;
+}
+
+/// \brief Hashes the first size bytes of the object representation of the
+/// range starting at data.
+///
+/// \details Based on the final version 4 of wyhash by Wang Yi
+/// (https://github.com/wangyi-fudan/wyhash, public domain). Short inputs are
+/// read with at most four overlapping loads, long inputs in 48 byte blocks on
+/// three independent lanes.
+template <typename T>
+[[nodiscard]] constexpr auto hash_bytes(T const* data, etl::size_t size, etl::uint64_t seed = 0) noexcept
+    -> etl::size_t
+{
+    constexpr etl::uint64_t secret[4] {
+        0x2D358DCCAA6C78A5ULL,
+        0x8BB84B93962EACC9ULL,
+        0x4B33A62ED433D4A3ULL,
+        0x4D5A2DA51DE1AA47ULL,
+    };
+
+    seed ^= hash_fold_mul(seed ^ secret[0], secret[1]);
+
+    auto a = etl::uint64_t { 0 };
+    auto b = etl::uint64_t { 0 };
+    if (size <= 16) {
+        if (size >= 4) {
+            auto const offset = (size >> 3U) << 2U;
+            a                 = (hash_read4(data, 0) << 32U) | hash_read4(data, offset);
+            b                 = (hash_read4(data, size - 4) << 32U) | hash_read4(data, size - 4 - offset);
+        } else if (size > 0) {
+            a = (hash_read_byte(data, 0) << 16U) | (hash_read_byte(data, size >> 1U) << 8U)
+              | hash_read_byte(data, size - 1);
+        }
+    } else {
+        auto i   = size;
+        auto pos = etl::size_t { 0 };
+        if (i > 48) {
+            auto see1 = seed;
+            auto see2 = seed;
+            do {
+                seed = hash_fold_mul(hash_read8(data, pos) ^ secret[1], hash_read8(data, pos + 8) ^ seed);
+                see1 = hash_fold_mul(hash_read8(data, pos + 16) ^ secret[2], hash_read8(data, pos + 24) ^ see1);
+                see2 = hash_fold_mul(hash_read8(data, pos + 32) ^ secret[3], hash_read8(data, pos + 40) ^ see2);
+                pos += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = hash_fold_mul(hash_read8(data, pos) ^ secret[1], hash_read8(data, pos + 8) ^ seed);
+            pos += 16;
+            i -= 16;
+        }
+        a = hash_read8(data, pos + i - 16);
+        b = hash_read8(data, pos + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    hash_mum(a, b);
+    return static_cast<etl::size_t>(hash_fold_mul(a ^ secret[0] ^ static_cast<etl::uint64_t>(size), b ^ secret[1]));
+}
+
+} // namespace detail
+
 /// \brief hash
 template <typename T>
 struct hash;
@@ -17,28 +177,28 @@ template <>
 struct hash<bool> {
     [[nodiscard]] constexpr auto operator()(bool val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<char> {
     [[nodiscard]] constexpr auto operator()(char val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<signed char> {
     [[nodiscard]] constexpr auto operator()(signed char val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<unsigned char> {
     [[nodiscard]] constexpr auto operator()(unsigned char val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 
@@ -47,7 +207,7 @@ template <>
 struct hash<char8_t> {
     [[nodiscard]] constexpr auto operator()(char8_t val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 #endif
@@ -56,98 +216,101 @@ template <>
 struct hash<char16_t> {
     [[nodiscard]] constexpr auto operator()(char16_t val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<char32_t> {
     [[nodiscard]] constexpr auto operator()(char32_t val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<wchar_t> {
     [[nodiscard]] constexpr auto operator()(wchar_t val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<short> {
     [[nodiscard]] constexpr auto operator()(short val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<unsigned short> {
     [[nodiscard]] constexpr auto operator()(unsigned short val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<int> {
     [[nodiscard]] constexpr auto operator()(int val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<unsigned int> {
     [[nodiscard]] constexpr auto operator()(unsigned int val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<long> {
     [[nodiscard]] constexpr auto operator()(long val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<long long> {
     [[nodiscard]] constexpr auto operator()(long long val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<unsigned long> {
     [[nodiscard]] constexpr auto operator()(unsigned long val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<unsigned long long> {
     [[nodiscard]] constexpr auto operator()(unsigned long long val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        return detail::hash_integer(val);
     }
 };
 template <>
 struct hash<float> {
     [[nodiscard]] constexpr auto operator()(float val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        // +0.0 and -0.0 compare equal, so they must have the same hash
+        return val == 0.0F ? 0 : detail::hash_integer(etl::bit_cast<etl::uint32_t>(val));
     }
 };
 template <>
 struct hash<double> {
     [[nodiscard]] constexpr auto operator()(double val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        // +0.0 and -0.0 compare equal, so they must have the same hash
+        return val == 0.0 ? 0 : detail::hash_integer(etl::bit_cast<etl::uint64_t>(val));
     }
 };
 template <>
 struct hash<long double> {
     [[nodiscard]] constexpr auto operator()(long double val) const noexcept -> etl::size_t
     {
-        return static_cast<etl::size_t>(val);
+        // The object representation of long double may contain padding bits
+        return hash<double> {}(static_cast<double>(val));
     }
 };
 
@@ -161,9 +324,25 @@ struct hash<etl::nullptr_t> {
 
 template <typename T>
 struct hash<T*> {
-    [[nodiscard]] auto operator()(T* val) const noexcept -> etl::size_t { return etl::bit_cast<etl::size_t>(val); }
+    [[nodiscard]] auto operator()(T* val) const noexcept -> etl::size_t
+    {
+        return detail::hash_integer(etl::bit_cast<etl::uintptr_t>(val));
+    }
 };
 
+/// \brief Mixes the hash value of v into seed and returns the new seed.
+/// Use it to build hashes of aggregates from the hashes of their members:
+///
+/// \code
+/// auto h = etl::hash_combine(etl::hash_combine(0, p.x), p.y);
+/// \endcode
+template <typename T>
+[[nodiscard]] constexpr auto hash_combine(etl::size_t seed, T const& v) noexcept(noexcept(hash<T> {}(v)))
+    -> etl::size_t
+{
+    return detail::hash_integer(seed + static_cast<etl::size_t>(0x9E3779B97F4A7C15ULL) + hash<T> {}(v));
+}
+
 } // namespace etl
 
 #endif // TETL_FUNCTIONAL_HASH_HPP
@@ -5,14 +5,20 @@
 
 #include "etl/_cstddef/nullptr_t.hpp"
 #include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstring/memcpy.hpp"
 #include "etl/_exception/exception.hpp"
 #include "etl/_exception/raise.hpp"
+#include "etl/_functional/invoke_r.hpp"
 #include "etl/_memory/addressof.hpp"
+#include "etl/_memory/relocate_at.hpp"
 #include "etl/_new/operator.hpp"
 #include "etl/_type_traits/aligned_storage.hpp"
 #include "etl/_type_traits/bool_constant.hpp"
+#include "etl/_type_traits/decay.hpp"
+#include "etl/_type_traits/integral_constant.hpp"
 #include "etl/_type_traits/is_copy_constructible.hpp"
 #include "etl/_type_traits/is_invocable_r.hpp"
+#include "etl/_type_traits/is_trivially_copyable.hpp"
 #include "etl/_utility/exchange.hpp"
 #include "etl/_utility/forward.hpp"
 #include "etl/_utility/swap.hpp"
@@ -26,61 +32,61 @@ struct bad_function_call : exception {
 
 namespace detail {
 
-template <typename T>
-struct wrapper {
-    using type = T;
-};
-
+/// \brief Invoke, copy, relocate and destroy operations for a type-erased
+/// callable. The copy, relocate and destroy pointers are null for trivially
+/// copyable callables, those are copied with memcpy and need no destructor
+/// call.
 template <typename R, typename... Args>
 struct inplace_func_vtable {
-    using storage_ptr_t = void*;
-
+    using storage_ptr_t    = void*;
     using invoke_ptr_t     = R (*)(storage_ptr_t, Args&&...);
     using process_ptr_t    = void (*)(storage_ptr_t, storage_ptr_t);
     using destructor_ptr_t = void (*)(storage_ptr_t);
 
-    const invoke_ptr_t invoke_ptr;
-    const process_ptr_t copy_ptr;
-    const process_ptr_t relocate_ptr;
-    const destructor_ptr_t destructor_ptr;
-
-    explicit constexpr inplace_func_vtable()
-        : invoke_ptr { [](storage_ptr_t /*p*/, Args&&... /*args*/) -> R {
-            etl::raise<etl::bad_function_call>("empty inplace_func_vtable");
-        } }
-        , copy_ptr { [](storage_ptr_t /*p*/, storage_ptr_t /*p*/) -> void {} }
-        , relocate_ptr { [](storage_ptr_t /*p*/, storage_ptr_t /*p*/) -> void {} }
-        , destructor_ptr { [](storage_ptr_t /*p*/) -> void {} }
-    {
-    }
+    invoke_ptr_t invoke_ptr;
+    process_ptr_t copy_ptr;
+    process_ptr_t relocate_ptr;
+    destructor_ptr_t destructor_ptr;
+};
 
-    template <typename C>
-    explicit constexpr inplace_func_vtable(wrapper<C> /*ignore*/)
-        : invoke_ptr { [](storage_ptr_t storagePtr, Args&&... args) -> R {
-            return (*static_cast<C*>(storagePtr))(static_cast<Args&&>(args)...);
-        } }
-        , copy_ptr { [](storage_ptr_t dstPtr, storage_ptr_t srcPtr) -> void {
-            ::new (dstPtr) C { (*static_cast<C*>(srcPtr)) };
-        } }
-        , relocate_ptr { [](storage_ptr_t dstPtr, storage_ptr_t srcPtr) -> void {
-            ::new (dstPtr) C { etl::move(*static_cast<C*>(srcPtr)) };
-            static_cast<C*>(srcPtr)->~C();
-        } }
-        , destructor_ptr { [](storage_ptr_t srcPtr) -> void { static_cast<C*>(srcPtr)->~C(); } }
-    {
+template <typename C, typename R, typename... Args>
+[[nodiscard]] constexpr auto make_inplace_func_vtable() -> inplace_func_vtable<R, Args...>
+{
+    auto const invoke = [](void* storagePtr, Args&&... args) -> R {
+        return etl::invoke_r<R>(*static_cast<C*>(storagePtr), static_cast<Args&&>(args)...);
+    };
+
+    if constexpr (is_trivially_copyable_v<C>) {
+        return { invoke, nullptr, nullptr, nullptr };
+    } else {
+        auto copy = typename inplace_func_vtable<R, Args...>::process_ptr_t { nullptr };
+        if constexpr (is_copy_constructible_v<C>) {
+            copy = [](void* dstPtr, void* srcPtr) -> void { ::new (dstPtr) C { (*static_cast<C*>(srcPtr)) }; };
+        }
+
+        return {
+            invoke,
+            copy,
+            [](void* dstPtr, void* srcPtr) -> void {
+                etl::relocate_at(static_cast<C*>(srcPtr), static_cast<C*>(dstPtr));
+            },
+            [](void* srcPtr) -> void { static_cast<C*>(srcPtr)->~C(); },
+        };
     }
+}
 
-    inplace_func_vtable(inplace_func_vtable const&) = delete;
-    inplace_func_vtable(inplace_func_vtable&&)      = delete;
-
-    auto operator=(inplace_func_vtable const&) -> inplace_func_vtable& = delete;
-    auto operator=(inplace_func_vtable&&) -> inplace_func_vtable&      = delete;
-
-    ~inplace_func_vtable() = default;
-};
+template <typename C, typename R, typename... Args>
+inline constexpr auto inplace_func_vtable_for = make_inplace_func_vtable<C, R, Args...>();
 
 template <typename R, typename... Args>
-inline constexpr auto empty_vtable = inplace_func_vtable<R, Args...> {};
+inline constexpr auto empty_inplace_func_vtable = inplace_func_vtable<R, Args...> {
+    [](void* /*storagePtr*/, Args&&... /*args*/) -> R {
+        etl::raise<etl::bad_function_call>("empty inplace_function");
+    },
+    nullptr,
+    nullptr,
+    nullptr,
+};
 
 template <size_t DstCap, size_t DstAlign, size_t SrcCap, size_t SrcAlign>
 struct is_valid_inplace_destination : etl::true_type {
@@ -88,137 +94,198 @@ struct is_valid_inplace_destination : etl::true_type {
     static_assert(DstAlign % SrcAlign == 0);
 };
 
-} // namespace detail
+/// \brief Storage and type-erasure shared by inplace_function and
+/// move_only_inplace_function.
+template <typename Signature, size_t Capacity, size_t Alignment>
+struct inplace_func_base;
 
-template <typename Signature, size_t Capacity = sizeof(void*), size_t Alignment = alignof(aligned_storage_t<Capacity>)>
-struct inplace_function;
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+struct inplace_func_base<R(Args...), Capacity, Alignment> {
+    using capacity  = integral_constant<size_t, Capacity>;
+    using alignment = integral_constant<size_t, Alignment>;
 
-namespace detail {
-template <typename>
-struct is_inplace_function : false_type { };
-template <typename Sig, size_t Cap, size_t Align>
-struct is_inplace_function<inplace_function<Sig, Cap, Align>> : etl::true_type { };
-} // namespace detail
+    /// \brief Invokes the stored callable function target with the parameters args.
+    auto operator()(Args... args) const -> R
+    {
+        return vtable_->invoke_ptr(addressof(storage_), forward<Args>(args)...);
+    }
 
-template <typename R, typename... Args, size_t Capacity, size_t Alignment>
-struct inplace_function<R(Args...), Capacity, Alignment> {
-private:
+    /// \brief Checks whether *this stores a callable function target, i.e. is not empty.
+    [[nodiscard]] explicit operator bool() const noexcept { return vtable_ != empty_vtable(); }
+
+protected:
     using storage_t    = aligned_storage_t<Capacity, Alignment>;
-    using vtable_t     = detail::inplace_func_vtable<R, Args...>;
-    using vtable_ptr_t = vtable_t const*;
+    using vtable_ptr_t = inplace_func_vtable<R, Args...> const*;
 
     template <typename, size_t, size_t>
-    friend struct inplace_function;
+    friend struct inplace_func_base;
 
-public:
-    using capacity  = integral_constant<size_t, Capacity>;
-    using alignment = integral_constant<size_t, Alignment>;
+    inplace_func_base() noexcept = default;
 
-    /// \brief Creates an empty function.
-    inplace_function() noexcept : vtable_ { addressof(detail::empty_vtable<R, Args...>) } { }
+    inplace_func_base(inplace_func_base const&) = delete;
+    inplace_func_base(inplace_func_base&&)      = delete;
 
-    template <typename T, typename C = decay_t<T>>
-        requires(!detail::is_inplace_function<C>::value && is_invocable_r_v<R, C&, Args...>)
-    inplace_function(T&& closure)
+    auto operator=(inplace_func_base const&) -> inplace_func_base& = delete;
+    auto operator=(inplace_func_base&&) -> inplace_func_base&      = delete;
+
+    ~inplace_func_base() { destroy(); }
+
+    template <typename C, typename T>
+    auto emplace(T&& closure) -> void
     {
-        static_assert(is_copy_constructible_v<C>, "inplace_function cannot be constructed from non-copyable type");
-        static_assert(
-            sizeof(C) <= Capacity, "inplace_function cannot be constructed from object with this (large) size");
+        static_assert(sizeof(C) <= Capacity, "inplace_function cannot be constructed from object with this (large) size");
         static_assert(Alignment % alignof(C) == 0,
             "inplace_function cannot be constructed from object with this (large) alignment");
 
-        static constexpr vtable_t const vt { detail::wrapper<C> {} };
-        vtable_ = addressof(vt);
-
         ::new (addressof(storage_)) C { forward<T>(closure) };
+        vtable_ = addressof(inplace_func_vtable_for<C, R, Args...>);
     }
 
     template <size_t Cap, size_t Align>
-    inplace_function(inplace_function<R(Args...), Cap, Align> const& other)
-        : inplace_function { other.vtable_, other.vtable_->copy_ptr, addressof(other.storage_) }
+    auto copy_from(inplace_func_base<R(Args...), Cap, Align> const& other) -> void
     {
         static_assert(
             detail::is_valid_inplace_destination<Capacity, Alignment, Cap, Align>::value, "conversion not allowed");
+
+        if (other.vtable_->copy_ptr == nullptr) {
+            etl::memcpy(addressof(storage_), addressof(other.storage_), Cap);
+        } else {
+            other.vtable_->copy_ptr(addressof(storage_), addressof(other.storage_));
+        }
+        vtable_ = other.vtable_;
     }
 
     template <size_t Cap, size_t Align>
-    inplace_function(inplace_function<R(Args...), Cap, Align>&& other) noexcept
-        : inplace_function { other.vtable_, other.vtable_->relocate_ptr, addressof(other.storage_) }
+    auto relocate_from(inplace_func_base<R(Args...), Cap, Align>& other) noexcept -> void
     {
         static_assert(
             detail::is_valid_inplace_destination<Capacity, Alignment, Cap, Align>::value, "conversion not allowed");
-        other.vtable_ = addressof(detail::empty_vtable<R, Args...>);
+
+        relocate_storage(addressof(storage_), addressof(other.storage_), other.vtable_, Cap);
+        vtable_ = exchange(other.vtable_, empty_vtable());
     }
 
-    /// \brief Creates an empty function.
-    inplace_function(nullptr_t /*ignore*/) noexcept : vtable_ { addressof(detail::empty_vtable<R, Args...>) } { }
+    auto reset() noexcept -> void
+    {
+        destroy();
+        vtable_ = empty_vtable();
+    }
 
-    inplace_function(inplace_function const& other) : vtable_ { other.vtable_ }
+    auto swap_with(inplace_func_base& other) noexcept -> void
     {
-        vtable_->copy_ptr(addressof(storage_), addressof(other.storage_));
+        if (this == addressof(other)) { return; }
+
+        auto tmp = storage_t {};
+        relocate_storage(addressof(tmp), addressof(storage_), vtable_, Capacity);
+        relocate_storage(addressof(storage_), addressof(other.storage_), other.vtable_, Capacity);
+        relocate_storage(addressof(other.storage_), addressof(tmp), vtable_, Capacity);
+        etl::swap(vtable_, other.vtable_);
     }
 
-    inplace_function(inplace_function&& other) noexcept
-        : vtable_ { exchange(other.vtable_, addressof(detail::empty_vtable<R, Args...>)) }
+private:
+    [[nodiscard]] static auto empty_vtable() noexcept -> vtable_ptr_t
     {
-        vtable_->relocate_ptr(addressof(storage_), addressof(other.storage_));
+        return addressof(empty_inplace_func_vtable<R, Args...>);
     }
 
-    /// \brief Assigns a new target to etl::inplace_function. Drops the current target. *this is empty after the call.
-    auto operator=(nullptr_t) noexcept -> inplace_function&
+    static auto relocate_storage(void* dst, void* src, vtable_ptr_t vtable, size_t size) noexcept -> void
     {
-        vtable_->destructor_ptr(addressof(storage_));
-        vtable_ = addressof(detail::empty_vtable<R, Args...>);
-        return *this;
+        if (vtable->relocate_ptr == nullptr) {
+            etl::memcpy(dst, src, size);
+        } else {
+            vtable->relocate_ptr(dst, src);
+        }
     }
 
-    auto operator=(inplace_function other) noexcept -> inplace_function&
+    auto destroy() noexcept -> void
     {
-        vtable_->destructor_ptr(addressof(storage_));
-        vtable_ = exchange(other.vtable_, addressof(detail::empty_vtable<R, Args...>));
-        vtable_->relocate_ptr(addressof(storage_), addressof(other.storage_));
-        return *this;
+        if (vtable_->destructor_ptr != nullptr) { vtable_->destructor_ptr(addressof(storage_)); }
     }
 
-    /// \brief Destroys the etl::inplace_function instance.
-    /// If the etl::inplace_function is not empty, its target is destroyed also.
-    ~inplace_function() { vtable_->destructor_ptr(addressof(storage_)); }
+    vtable_ptr_t vtable_ { empty_vtable() };
+    storage_t mutable storage_ {};
+};
 
-    /// \brief Invokes the stored callable function target with the parameters args.
-    auto operator()(Args... args) const -> R
+} // namespace detail
+
+template <typename Signature, size_t Capacity = sizeof(void*), size_t Alignment = alignof(aligned_storage_t<Capacity>)>
+struct inplace_function;
+
+template <typename Signature, size_t Capacity = sizeof(void*), size_t Alignment = alignof(aligned_storage_t<Capacity>)>
+struct move_only_inplace_function;
+
+namespace detail {
+template <typename>
+struct is_inplace_function : false_type { };
+template <typename Sig, size_t Cap, size_t Align>
+struct is_inplace_function<inplace_function<Sig, Cap, Align>> : etl::true_type { };
+template <typename Sig, size_t Cap, size_t Align>
+struct is_inplace_function<move_only_inplace_function<Sig, Cap, Align>> : etl::true_type { };
+} // namespace detail
+
+/// \brief Owning, copyable wrapper for a callable stored in a fixed-size buffer
+/// of Capacity bytes aligned to Alignment.
+///
+/// \details The object is a single table pointer and the storage. Copy,
+/// relocation and destruction of trivially copyable callables (e.g. lambdas
+/// capturing pointers or integers) is done with memcpy, only other callables
+/// pay for an indirect call through the table.
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+struct inplace_function<R(Args...), Capacity, Alignment> : detail::inplace_func_base<R(Args...), Capacity, Alignment> {
+private:
+    using base_t = detail::inplace_func_base<R(Args...), Capacity, Alignment>;
+
+public:
+    /// \brief Creates an empty function.
+    inplace_function() noexcept = default;
+
+    /// \brief Creates an empty function.
+    inplace_function(nullptr_t /*ignore*/) noexcept { }
+
+    template <typename T, typename C = decay_t<T>>
+        requires(!detail::is_inplace_function<C>::value && is_invocable_r_v<R, C&, Args...>)
+    inplace_function(T&& closure)
     {
-        return vtable_->invoke_ptr(addressof(storage_), forward<Args>(args)...);
+        static_assert(is_copy_constructible_v<C>, "inplace_function cannot be constructed from non-copyable type");
+        this->template emplace<C>(forward<T>(closure));
     }
 
-    /// \brief Checks whether *this stores a callable function target, i.e. is not empty.
-    [[nodiscard]] explicit constexpr operator bool() const noexcept
+    template <size_t Cap, size_t Align>
+    inplace_function(inplace_function<R(Args...), Cap, Align> const& other)
     {
-        return vtable_ != addressof(detail::empty_vtable<R, Args...>);
+        this->copy_from(other);
     }
 
-    /// \brief Exchanges the stored callable objects of *this and other.
-    auto swap(inplace_function& other) noexcept -> void
+    template <size_t Cap, size_t Align>
+    inplace_function(inplace_function<R(Args...), Cap, Align>&& other) noexcept
     {
-        if (this == addressof(other)) { return; }
+        this->relocate_from(other);
+    }
 
-        auto tmp = storage_t {};
-        vtable_->relocate_ptr(addressof(tmp), addressof(storage_));
-        other.vtable_->relocate_ptr(addressof(storage_), addressof(other.storage_));
-        vtable_->relocate_ptr(addressof(other.storage_), addressof(tmp));
+    inplace_function(inplace_function const& other) : base_t {} { this->copy_from(other); }
 
-        etl::swap(vtable_, other.vtable_);
+    inplace_function(inplace_function&& other) noexcept { this->relocate_from(other); }
+
+    /// \brief Assigns a new target to etl::inplace_function. Drops the current target. *this is empty after the call.
+    auto operator=(nullptr_t) noexcept -> inplace_function&
+    {
+        this->reset();
+        return *this;
     }
 
-private:
-    inplace_function(
-        vtable_ptr_t vtable, typename vtable_t::process_ptr_t process, typename vtable_t::storage_ptr_t storage)
-        : vtable_ { vtable }
+    auto operator=(inplace_function other) noexcept -> inplace_function&
     {
-        process(addressof(storage_), storage);
+        this->reset();
+        this->relocate_from(other);
+        return *this;
     }
 
-    vtable_ptr_t vtable_;
-    storage_t mutable storage_;
+    /// \brief Destroys the etl::inplace_function instance.
+    /// If the etl::inplace_function is not empty, its target is destroyed also.
+    ~inplace_function() = default;
+
+    /// \brief Exchanges the stored callable objects of *this and other.
+    auto swap(inplace_function& other) noexcept -> void { this->swap_with(other); }
 };
 
 /// \brief Overloads the etl::swap algorithm for etl::inplace_function.
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FUNCTIONAL_MOVE_ONLY_INPLACE_FUNCTION_HPP
+#define TETL_FUNCTIONAL_MOVE_ONLY_INPLACE_FUNCTION_HPP
+
+#include "etl/_cstddef/nullptr_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_functional/inplace_function.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_type_traits/decay.hpp"
+#include "etl/_type_traits/is_invocable_r.hpp"
+#include "etl/_type_traits/is_move_constructible.hpp"
+#include "etl/_utility/forward.hpp"
+
+namespace etl {
+
+/// \brief Owning, move-only wrapper for a callable stored in a fixed-size
+/// buffer of Capacity bytes aligned to Alignment.
+///
+/// \details Same layout as etl::inplace_function, but accepts callables that
+/// can not be copied, e.g. lambdas capturing a unique resource handle.
+/// Can be constructed from an etl::inplace_function rvalue.
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+struct move_only_inplace_function<R(Args...), Capacity, Alignment>
+    : detail::inplace_func_base<R(Args...), Capacity, Alignment> {
+    /// \brief Creates an empty function.
+    move_only_inplace_function() noexcept = default;
+
+    /// \brief Creates an empty function.
+    move_only_inplace_function(nullptr_t /*ignore*/) noexcept { }
+
+    template <typename T, typename C = decay_t<T>>
+        requires(!detail::is_inplace_function<C>::value && is_invocable_r_v<R, C&, Args...>)
+    move_only_inplace_function(T&& closure)
+    {
+        static_assert(
+            is_move_constructible_v<C>, "move_only_inplace_function cannot be constructed from non-movable type");
+        this->template emplace<C>(forward<T>(closure));
+    }
+
+    template <size_t Cap, size_t Align>
+    move_only_inplace_function(move_only_inplace_function<R(Args...), Cap, Align>&& other) noexcept
+    {
+        this->relocate_from(other);
+    }
+
+    template <size_t Cap, size_t Align>
+    move_only_inplace_function(inplace_function<R(Args...), Cap, Align>&& other) noexcept
+    {
+        this->relocate_from(other);
+    }
+
+    move_only_inplace_function(move_only_inplace_function const& other) = delete;
+
+    move_only_inplace_function(move_only_inplace_function&& other) noexcept { this->relocate_from(other); }
+
+    /// \brief Drops the current target. *this is empty after the call.
+    auto operator=(nullptr_t) noexcept -> move_only_inplace_function&
+    {
+        this->reset();
+        return *this;
+    }
+
+    auto operator=(move_only_inplace_function const& other) -> move_only_inplace_function& = delete;
+
+    auto operator=(move_only_inplace_function&& other) noexcept -> move_only_inplace_function&
+    {
+        if (this != addressof(other)) {
+            this->reset();
+            this->relocate_from(other);
+        }
+        return *this;
+    }
+
+    /// \brief Destroys the etl::move_only_inplace_function instance.
+    /// If it is not empty, its target is destroyed also.
+    ~move_only_inplace_function() = default;
+
+    /// \brief Exchanges the stored callable objects of *this and other.
+    auto swap(move_only_inplace_function& other) noexcept -> void { this->swap_with(other); }
+};
+
+/// \brief Overloads the etl::swap algorithm for etl::move_only_inplace_function.
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+auto swap(move_only_inplace_function<R(Args...), Capacity, Alignment>& lhs,
+    move_only_inplace_function<R(Args...), Capacity, Alignment>& rhs) noexcept -> void
+{
+    lhs.swap(rhs);
+}
+
+/// \brief Compares a etl::move_only_inplace_function with a null pointer.
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+[[nodiscard]] constexpr auto operator==(
+    move_only_inplace_function<R(Args...), Capacity, Alignment> const& f, nullptr_t /*ignore*/) noexcept -> bool
+{
+    return !static_cast<bool>(f);
+}
+
+/// \brief Compares a etl::move_only_inplace_function with a null pointer.
+template <typename R, typename... Args, size_t Capacity, size_t Alignment>
+[[nodiscard]] constexpr auto operator!=(
+    move_only_inplace_function<R(Args...), Capacity, Alignment> const& f, nullptr_t /*ignore*/) noexcept -> bool
+{
+    return static_cast<bool>(f);
+}
+
+} // namespace etl
+
+#endif // TETL_FUNCTIONAL_MOVE_ONLY_INPLACE_FUNCTION_HPP
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_ITERATOR_DEFAULT_SENTINEL_HPP
+#define TETL_ITERATOR_DEFAULT_SENTINEL_HPP
+
+namespace etl {
+
+/// \brief default_sentinel_t is an empty class type used to denote the end of
+/// a range. It can be used together with iterator types that know the bound
+/// of their range.
+///
+/// https://en.cppreference.com/w/cpp/iterator/default_sentinel_t
+struct default_sentinel_t { };
+
+/// \brief A constant of type default_sentinel_t.
+inline constexpr default_sentinel_t default_sentinel {};
+
+} // namespace etl
+
+#endif // TETL_ITERATOR_DEFAULT_SENTINEL_HPP
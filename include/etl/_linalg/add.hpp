@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_ADD_HPP
+#define TETL_LINALG_ADD_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_linalg/concepts.hpp>
+
+namespace etl::linalg {
+
+/// \brief Computes z = x + y elementwise for vectors or matrices. z may alias
+/// x or y.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/add
+template <detail::in_object InObj1, detail::in_object InObj2, detail::out_object OutObj>
+    requires(InObj1::rank() == OutObj::rank() and InObj2::rank() == OutObj::rank())
+constexpr auto add(InObj1 x, InObj2 y, OutObj z) -> void
+{
+    using value_type = typename OutObj::value_type;
+
+    if constexpr (OutObj::rank() == 1) {
+        TETL_ASSERT(x.extent(0) == z.extent(0) and y.extent(0) == z.extent(0));
+        for (size_t i = 0; i < static_cast<size_t>(z.extent(0)); ++i) { z(i) = static_cast<value_type>(x(i) + y(i)); }
+    } else {
+        TETL_ASSERT(x.extent(0) == z.extent(0) and y.extent(0) == z.extent(0));
+        TETL_ASSERT(x.extent(1) == z.extent(1) and y.extent(1) == z.extent(1));
+        for (size_t i = 0; i < static_cast<size_t>(z.extent(0)); ++i) {
+            for (size_t j = 0; j < static_cast<size_t>(z.extent(1)); ++j) {
+                z(i, j) = static_cast<value_type>(x(i, j) + y(i, j));
+            }
+        }
+    }
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_ADD_HPP
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_CONCEPTS_HPP
+#define TETL_LINALG_CONCEPTS_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/mdspan.hpp>
+#include <etl/_type_traits/is_assignable.hpp>
+
+namespace etl::linalg::detail {
+
+template <typename T>
+inline constexpr bool is_mdspan = false;
+
+template <typename T, typename Extents, typename Layout, typename Accessor>
+inline constexpr bool is_mdspan<mdspan<T, Extents, Layout, Accessor>> = true;
+
+template <typename T>
+concept in_vector = is_mdspan<T> and T::rank() == 1;
+
+template <typename T>
+concept out_vector = is_mdspan<T> and T::rank() == 1
+                 and is_assignable_v<typename T::reference, typename T::element_type> and T::is_always_unique();
+
+template <typename T>
+concept in_matrix = is_mdspan<T> and T::rank() == 2;
+
+template <typename T>
+concept out_matrix = is_mdspan<T> and T::rank() == 2
+                 and is_assignable_v<typename T::reference, typename T::element_type> and T::is_always_unique();
+
+template <typename T>
+concept in_object = is_mdspan<T> and (T::rank() == 1 or T::rank() == 2);
+
+template <typename T>
+concept out_object = is_mdspan<T> and (T::rank() == 1 or T::rank() == 2)
+                 and is_assignable_v<typename T::reference, typename T::element_type> and T::is_always_unique();
+
+} // namespace etl::linalg::detail
+
+#endif // TETL_LINALG_CONCEPTS_HPP
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_DOT_HPP
+#define TETL_LINALG_DOT_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_linalg/concepts.hpp>
+#include <etl/_type_traits/declval.hpp>
+#include <etl/_utility/move.hpp>
+
+namespace etl::linalg {
+
+/// \brief Returns init plus the sum of v1(i) * v2(i).
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/dot
+template <detail::in_vector InVec1, detail::in_vector InVec2, typename Scalar>
+[[nodiscard]] constexpr auto dot(InVec1 v1, InVec2 v2, Scalar init) -> Scalar
+{
+    TETL_ASSERT(v1.extent(0) == v2.extent(0));
+
+    for (size_t i = 0; i < static_cast<size_t>(v1.extent(0)); ++i) { init = static_cast<Scalar>(init + v1(i) * v2(i)); }
+    return init;
+}
+
+/// \brief Returns the sum of v1(i) * v2(i).
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/dot
+template <detail::in_vector InVec1, detail::in_vector InVec2>
+[[nodiscard]] constexpr auto dot(InVec1 v1, InVec2 v2)
+{
+    using scalar_type = decltype(declval<typename InVec1::value_type>() * declval<typename InVec2::value_type>());
+    return linalg::dot(etl::move(v1), etl::move(v2), scalar_type {});
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_DOT_HPP
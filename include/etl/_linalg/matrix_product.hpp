@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_MATRIX_PRODUCT_HPP
+#define TETL_LINALG_MATRIX_PRODUCT_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_linalg/concepts.hpp>
+#include <etl/_mdspan/default_accessor.hpp>
+#include <etl/_mdspan/layout.hpp>
+#include <etl/_simd/alignment_tags.hpp>
+#include <etl/_simd/is_vectorizable.hpp>
+#include <etl/_simd/simd.hpp>
+#include <etl/_span/dynamic_extent.hpp>
+#include <etl/_type_traits/is_constant_evaluated.hpp>
+#include <etl/_type_traits/is_same.hpp>
+
+namespace etl::linalg {
+
+namespace detail {
+
+/// \brief Columns of C, that are computed together by matrix_product.
+inline constexpr auto matrix_product_panel_width = size_t(16);
+
+/// \brief A panel of Width columns of a matrix can be loaded or stored row
+/// by row as native_simd<T>.
+template <size_t Width, typename InMat, typename T>
+[[nodiscard]] consteval auto matrix_product_use_simd() -> bool
+{
+    if constexpr (etl::detail::is_vectorizable_v<T>) {
+        return Width % native_simd<T>::size() == 0 and is_same_v<typename InMat::value_type, T>
+           and is_same_v<typename InMat::layout_type, layout_right>
+           and is_same_v<typename InMat::accessor_type, default_accessor<typename InMat::element_type>>;
+    } else {
+        return false;
+    }
+}
+
+/// \brief Computes the columns [j0, j0 + Width) of C = A * B. The rows of the
+/// panel are accumulated in Width / lanes simd registers.
+template <size_t Width, typename InMat1, typename InMat2, typename OutMat>
+auto matrix_product_panel_simd(InMat1 a, InMat2 b, OutMat c, size_t j0) -> void
+{
+    using value_type = typename OutMat::value_type;
+    using simd_t     = native_simd<value_type>;
+
+    constexpr auto lanes = simd_t::size();
+    constexpr auto vecs  = Width / lanes;
+
+    auto const rows  = static_cast<size_t>(c.extent(0));
+    auto const depth = static_cast<size_t>(a.extent(1));
+
+    for (size_t i = 0; i < rows; ++i) {
+        simd_t acc[vecs];
+        for (auto& v : acc) { v = simd_t { value_type(0) }; }
+
+        for (size_t k = 0; k < depth; ++k) {
+            auto const aik = simd_t { static_cast<value_type>(a(i, k)) };
+            auto const* row = b.data_handle() + b.mapping()(k, j0);
+            for (size_t v = 0; v < vecs; ++v) { acc[v] += aik * simd_t { row + v * lanes, element_aligned }; }
+        }
+
+        if constexpr (matrix_product_use_simd<Width, OutMat, value_type>()) {
+            auto* out = c.data_handle() + c.mapping()(i, j0);
+            for (size_t v = 0; v < vecs; ++v) { acc[v].copy_to(out + v * lanes, element_aligned); }
+        } else {
+            for (size_t v = 0; v < vecs; ++v) {
+                for (size_t j = 0; j < lanes; ++j) { c(i, j0 + v * lanes + j) = acc[v][j]; }
+            }
+        }
+    }
+}
+
+/// \brief Computes the columns [j0, j0 + width) of C = A * B, where width is
+/// at most MaxWidth. Each row of the panel is accumulated in registers, while
+/// the columns of B stay in cache for all rows of A.
+template <size_t MaxWidth, typename InMat1, typename InMat2, typename OutMat>
+constexpr auto matrix_product_panel(InMat1 a, InMat2 b, OutMat c, size_t j0, size_t width) -> void
+{
+    using value_type = typename OutMat::value_type;
+
+    if constexpr (matrix_product_use_simd<MaxWidth, InMat2, value_type>()) {
+        if (not is_constant_evaluated() and width == MaxWidth) {
+            matrix_product_panel_simd<MaxWidth>(a, b, c, j0);
+            return;
+        }
+    }
+
+    auto const rows  = static_cast<size_t>(c.extent(0));
+    auto const depth = static_cast<size_t>(a.extent(1));
+
+    for (size_t i = 0; i < rows; ++i) {
+        value_type acc[MaxWidth] {};
+        for (size_t k = 0; k < depth; ++k) {
+            auto const aik = a(i, k);
+            for (size_t j = 0; j < width; ++j) { acc[j] = static_cast<value_type>(acc[j] + aik * b(k, j0 + j)); }
+        }
+        for (size_t j = 0; j < width; ++j) { c(i, j0 + j) = acc[j]; }
+    }
+}
+
+} // namespace detail
+
+/// \brief Computes C = A * B. C must not alias A or B.
+///
+/// \details C is computed in panels of up to 16 columns. If C has at most 16
+/// static columns (e.g. 4x4, 8x8 or 16x16), the whole product is a single
+/// panel with constant trip counts. Larger or dynamic matrices are processed
+/// panel by panel. If the rows of B are contiguous, full panels are
+/// accumulated in native_simd registers at runtime.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/matrix_product
+template <detail::in_matrix InMat1, detail::in_matrix InMat2, detail::out_matrix OutMat>
+constexpr auto matrix_product(InMat1 a, InMat2 b, OutMat c) -> void
+{
+    TETL_ASSERT(a.extent(0) == c.extent(0));
+    TETL_ASSERT(a.extent(1) == b.extent(0));
+    TETL_ASSERT(b.extent(1) == c.extent(1));
+
+    constexpr auto panel       = detail::matrix_product_panel_width;
+    constexpr auto static_cols = OutMat::static_extent(1) != dynamic_extent ? OutMat::static_extent(1)
+                                                                             : InMat2::static_extent(1);
+
+    if constexpr (static_cols != dynamic_extent and static_cols <= panel) {
+        detail::matrix_product_panel<static_cols>(a, b, c, 0, static_cols);
+    } else {
+        auto const cols = static_cast<size_t>(c.extent(1));
+        auto j0         = size_t(0);
+        for (; j0 + panel <= cols; j0 += panel) { detail::matrix_product_panel<panel>(a, b, c, j0, panel); }
+        if (j0 != cols) { detail::matrix_product_panel<panel>(a, b, c, j0, cols - j0); }
+    }
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_MATRIX_PRODUCT_HPP
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_MATRIX_VECTOR_PRODUCT_HPP
+#define TETL_LINALG_MATRIX_VECTOR_PRODUCT_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_linalg/concepts.hpp>
+
+namespace etl::linalg {
+
+namespace detail {
+
+template <typename InMat, typename InVec, typename OutVec, typename Init>
+constexpr auto matrix_vector_product(InMat a, InVec x, OutVec y, Init init) -> void
+{
+    using value_type = typename OutVec::value_type;
+
+    TETL_ASSERT(a.extent(1) == x.extent(0));
+    TETL_ASSERT(a.extent(0) == y.extent(0));
+
+    for (size_t i = 0; i < static_cast<size_t>(a.extent(0)); ++i) {
+        auto sum = init(i);
+        for (size_t j = 0; j < static_cast<size_t>(a.extent(1)); ++j) {
+            sum = static_cast<value_type>(sum + a(i, j) * x(j));
+        }
+        y(i) = sum;
+    }
+}
+
+} // namespace detail
+
+/// \brief Computes y = A * x. y must not alias A or x.
+///
+/// \details With static extents both trip counts are constants, so the
+/// compiler fully unrolls and vectorizes small matrices. Combined with transposed and scaled this also computes
+/// y = alpha * A^T * x.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/matrix_vector_product
+template <detail::in_matrix InMat, detail::in_vector InVec, detail::out_vector OutVec>
+constexpr auto matrix_vector_product(InMat a, InVec x, OutVec y) -> void
+{
+    using value_type = typename OutVec::value_type;
+    detail::matrix_vector_product(a, x, y, [](size_t /*i*/) { return value_type {}; });
+}
+
+/// \brief Computes y = A * x + z. y may alias z, but not A or x.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/matrix_vector_product
+template <detail::in_matrix InMat, detail::in_vector InVec1, detail::in_vector InVec2, detail::out_vector OutVec>
+constexpr auto matrix_vector_product(InMat a, InVec1 x, InVec2 z, OutVec y) -> void
+{
+    using value_type = typename OutVec::value_type;
+    TETL_ASSERT(z.extent(0) == y.extent(0));
+    detail::matrix_vector_product(a, x, y, [z](size_t i) { return static_cast<value_type>(z(i)); });
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_MATRIX_VECTOR_PRODUCT_HPP
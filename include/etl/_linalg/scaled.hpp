@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_SCALED_HPP
+#define TETL_LINALG_SCALED_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/mdspan.hpp>
+#include <etl/_type_traits/add_const.hpp>
+#include <etl/_type_traits/declval.hpp>
+#include <etl/_type_traits/remove_const.hpp>
+
+namespace etl::linalg {
+
+/// \brief Accessor, that multiplies each element of the nested accessor by a
+/// scaling factor on read. The resulting mdspan is read-only.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/scaled_accessor
+template <typename ScalingFactor, typename NestedAccessor>
+struct scaled_accessor {
+    using element_type
+        = add_const_t<decltype(declval<ScalingFactor>() * declval<typename NestedAccessor::element_type>())>;
+    using reference        = remove_const_t<element_type>;
+    using data_handle_type = typename NestedAccessor::data_handle_type;
+    using offset_policy    = scaled_accessor<ScalingFactor, typename NestedAccessor::offset_policy>;
+
+    constexpr scaled_accessor() = default;
+
+    constexpr scaled_accessor(ScalingFactor const& s, NestedAccessor const& a)
+        : scaling_factor_ { s }
+        , nested_ { a }
+    {
+    }
+
+    template <typename OtherScalingFactor, typename OtherNestedAccessor>
+    constexpr explicit scaled_accessor(scaled_accessor<OtherScalingFactor, OtherNestedAccessor> const& other)
+        : scaling_factor_ { other.scaling_factor() }
+        , nested_ { other.nested_accessor() }
+    {
+    }
+
+    [[nodiscard]] constexpr auto access(data_handle_type p, size_t i) const -> reference
+    {
+        return scaling_factor_ * typename NestedAccessor::element_type(nested_.access(p, i));
+    }
+
+    [[nodiscard]] constexpr auto offset(data_handle_type p, size_t i) const ->
+        typename offset_policy::data_handle_type
+    {
+        return nested_.offset(p, i);
+    }
+
+    [[nodiscard]] constexpr auto scaling_factor() const noexcept -> ScalingFactor const& { return scaling_factor_; }
+    [[nodiscard]] constexpr auto nested_accessor() const noexcept -> NestedAccessor const& { return nested_; }
+
+private:
+    ScalingFactor scaling_factor_ {};
+    TETL_NO_UNIQUE_ADDRESS NestedAccessor nested_ {};
+};
+
+/// \brief Returns a read-only view of x, where each element is multiplied
+/// by alpha. No elements are modified or copied.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/scaled
+template <typename ScalingFactor, typename ElementType, typename Extents, typename Layout, typename Accessor>
+[[nodiscard]] constexpr auto scaled(ScalingFactor alpha, mdspan<ElementType, Extents, Layout, Accessor> x)
+{
+    using accessor_type = scaled_accessor<ScalingFactor, Accessor>;
+    using element_type  = typename accessor_type::element_type;
+    return mdspan<element_type, Extents, Layout, accessor_type> {
+        x.data_handle(),
+        x.mapping(),
+        accessor_type { alpha, x.accessor() },
+    };
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_SCALED_HPP
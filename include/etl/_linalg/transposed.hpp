@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_TRANSPOSED_HPP
+#define TETL_LINALG_TRANSPOSED_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_array/array.hpp>
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/extents.hpp>
+#include <etl/_mdspan/layout.hpp>
+#include <etl/_mdspan/layout_left.hpp>
+#include <etl/_mdspan/layout_right.hpp>
+#include <etl/_mdspan/layout_stride.hpp>
+#include <etl/_mdspan/mdspan.hpp>
+#include <etl/_type_traits/is_same.hpp>
+
+namespace etl::linalg {
+
+namespace detail {
+
+template <typename Extents>
+struct transpose_extents;
+
+template <typename IndexType, size_t E0, size_t E1>
+struct transpose_extents<extents<IndexType, E0, E1>> {
+    using type = extents<IndexType, E1, E0>;
+};
+
+template <typename Layout>
+struct transpose_layout {
+    using type = layout_stride;
+};
+
+template <>
+struct transpose_layout<layout_left> {
+    using type = layout_right;
+};
+
+template <>
+struct transpose_layout<layout_right> {
+    using type = layout_left;
+};
+
+} // namespace detail
+
+/// \brief Returns a view of the matrix a with rows and columns swapped.
+/// layout_right becomes layout_left and vice versa, so the transposed view
+/// keeps static extents and needs no stride storage.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/transposed
+template <typename ElementType, typename Extents, typename Layout, typename Accessor>
+    requires(Extents::rank() == 2)
+[[nodiscard]] constexpr auto transposed(mdspan<ElementType, Extents, Layout, Accessor> a)
+{
+    using extents_type = typename detail::transpose_extents<Extents>::type;
+    using layout_type  = typename detail::transpose_layout<Layout>::type;
+    using mapping_type = typename layout_type::template mapping<extents_type>;
+
+    auto const ext = extents_type { a.extent(1), a.extent(0) };
+    if constexpr (is_same_v<layout_type, layout_stride>) {
+        auto const strides = array { a.stride(1), a.stride(0) };
+        return mdspan<ElementType, extents_type, layout_type, Accessor> {
+            a.data_handle(),
+            mapping_type { ext, strides },
+            a.accessor(),
+        };
+    } else {
+        return mdspan<ElementType, extents_type, layout_type, Accessor> {
+            a.data_handle(),
+            mapping_type { ext },
+            a.accessor(),
+        };
+    }
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_TRANSPOSED_HPP
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_VECTOR_TWO_NORM_HPP
+#define TETL_LINALG_VECTOR_TWO_NORM_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cmath/sqrt.hpp>
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_linalg/concepts.hpp>
+#include <etl/_utility/move.hpp>
+
+namespace etl::linalg {
+
+/// \brief Returns the euclidean norm sqrt(init^2 + sum(v(i)^2)). The squares
+/// are not rescaled, so the sum may overflow for very large elements.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/vector_two_norm
+template <detail::in_vector InVec, typename Scalar>
+[[nodiscard]] constexpr auto vector_two_norm(InVec v, Scalar init) -> Scalar
+{
+    auto sum = static_cast<Scalar>(init * init);
+    for (size_t i = 0; i < static_cast<size_t>(v.extent(0)); ++i) {
+        auto const x = static_cast<Scalar>(v(i));
+        sum          = static_cast<Scalar>(sum + x * x);
+    }
+    return static_cast<Scalar>(etl::sqrt(sum));
+}
+
+/// \brief Returns the euclidean norm of v.
+///
+/// https://en.cppreference.com/w/cpp/numeric/linalg/vector_two_norm
+template <detail::in_vector InVec>
+[[nodiscard]] constexpr auto vector_two_norm(InVec v)
+{
+    return linalg::vector_two_norm(etl::move(v), typename InVec::value_type {});
+}
+
+} // namespace etl::linalg
+
+#endif // TETL_LINALG_VECTOR_TWO_NORM_HPP
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MAP_STATIC_PERFECT_MAP_HPP
+#define TETL_MAP_STATIC_PERFECT_MAP_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_array/array.hpp"
+#include "etl/_array/to_array.hpp"
+#include "etl/_bit/bit_ceil.hpp"
+#include "etl/_container/smallest_size_t.hpp"
+#include "etl/_cstddef/ptrdiff_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_exception/raise.hpp"
+#include "etl/_functional/equal_to.hpp"
+#include "etl/_functional/hash.hpp"
+#include "etl/_stdexcept/invalid_argument.hpp"
+#include "etl/_utility/pair.hpp"
+
+namespace etl {
+
+/// \brief Immutable associative container for a set of keys known at compile
+/// time. Lookup computes one hash, reads one slot of a table and does at most
+/// one key comparison.
+///
+/// \details The table is a minimal-probe perfect hash in the style of
+/// PTHash. Keys are split into buckets by their hash. For every bucket,
+/// starting with the largest, the constructor searches a small pilot value,
+/// that sends all keys of the bucket to distinct free slots. If two keys
+/// compare equal or share the same hash value, no table exists and
+/// compilation fails.
+///
+/// Elements are iterated in the order they were passed to the constructor.
+///
+/// \code
+/// using namespace etl::string_view_literals;
+/// constexpr auto commands = etl::make_static_perfect_map<etl::string_view, int>({
+///     {"start"_sv, 1},
+///     {"stop"_sv, 2},
+///     {"reset"_sv, 3},
+/// });
+/// static_assert(commands.find("stop"_sv)->second == 2);
+/// \endcode
+///
+/// https://arxiv.org/abs/2104.10402
+template <typename Key, typename Value, size_t Size, typename Hash = hash<Key>, typename KeyEqual = equal_to<Key>>
+struct static_perfect_map {
+    static_assert(Size > 0, "static_perfect_map needs at least one element");
+
+    using key_type        = Key;
+    using mapped_type     = Value;
+    using value_type      = pair<Key, Value>;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using reference       = value_type const&;
+    using const_reference = value_type const&;
+    using pointer         = value_type const*;
+    using const_pointer   = value_type const*;
+    using iterator        = value_type const*;
+    using const_iterator  = value_type const*;
+
+private:
+    using index_type = smallest_size_t<Size>;
+    using pilot_type = uint16_t;
+
+    // Load factor between 0.4 and 0.8, two keys per bucket on average.
+    static constexpr auto table_size   = bit_ceil(Size + Size / 4 + 1);
+    static constexpr auto bucket_count = bit_ceil(Size / 2 + 1);
+    static constexpr auto empty_slot   = static_cast<index_type>(Size);
+    static constexpr auto max_pilot    = static_cast<size_t>(pilot_type(-1));
+
+public:
+    /// \brief Builds the table for the given entries. Declare the map
+    /// constexpr or use make_static_perfect_map, so the search runs during
+    /// compilation. Raises invalid_argument (fails to compile) if two keys are
+    /// equal.
+    constexpr explicit static_perfect_map(value_type const (&entries)[Size]) : entries_ { to_array(entries) }
+    {
+        auto hashes = array<size_t, Size> {};
+        for (auto i = size_t { 0 }; i < Size; ++i) { hashes[i] = hasher {}(entries_[i].first); }
+
+        for (auto i = size_t { 0 }; i < Size; ++i) {
+            for (auto j = i + 1; j < Size; ++j) {
+                if (hashes[i] != hashes[j]) { continue; }
+                if (key_equal {}(entries_[i].first, entries_[j].first)) {
+                    raise<invalid_argument>("static_perfect_map: duplicate key");
+                }
+                raise<invalid_argument>("static_perfect_map: keys with equal hash");
+            }
+        }
+
+        auto bucketSizes = array<size_t, bucket_count> {};
+        auto largest     = size_t { 0 };
+        for (auto h : hashes) {
+            auto& count = bucketSizes[bucket_of(h)];
+            ++count;
+            largest = count > largest ? count : largest;
+        }
+
+        for (auto& slot : slots_) { slot = empty_slot; }
+        for (auto& pilot : pilots_) { pilot = 0; }
+
+        // Large buckets first, while most of the slots are still free.
+        for (auto size = largest; size > 0; --size) {
+            for (auto b = size_t { 0 }; b < bucket_count; ++b) {
+                if (bucketSizes[b] == size) { place_bucket(b, hashes); }
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return entries_.begin(); }
+    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return entries_.end(); }
+    [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+    [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return false; }
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type { return Size; }
+    [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return Size; }
+
+    /// \brief Returns an iterator to the element with key equivalent to key,
+    /// or end() if there is no such element.
+    [[nodiscard]] constexpr auto find(key_type const& key) const -> const_iterator
+    {
+        auto const h     = hasher {}(key);
+        auto const index = slots_[slot_of(h, pilots_[bucket_of(h)])];
+        if (index != empty_slot and key_equal {}(entries_[index].first, key)) { return begin() + index; }
+        return end();
+    }
+
+    /// \brief Checks if there is an element with key equivalent to key.
+    [[nodiscard]] constexpr auto contains(key_type const& key) const -> bool { return find(key) != end(); }
+
+    /// \brief Returns the number of elements with key equivalent to key, either 1 or 0.
+    [[nodiscard]] constexpr auto count(key_type const& key) const -> size_type { return contains(key) ? 1 : 0; }
+
+private:
+    [[nodiscard]] static constexpr auto bucket_of(size_t h) noexcept -> size_t { return h & (bucket_count - 1); }
+
+    [[nodiscard]] static constexpr auto slot_of(size_t h, pilot_type pilot) noexcept -> size_t
+    {
+        return detail::hash_integer(h ^ pilot) & (table_size - 1);
+    }
+
+    constexpr auto place_bucket(size_t bucket, array<size_t, Size> const& hashes) -> void
+    {
+        for (auto pilot = size_t { 0 }; pilot <= max_pilot; ++pilot) {
+            if (try_pilot(bucket, static_cast<pilot_type>(pilot), hashes)) {
+                pilots_[bucket] = static_cast<pilot_type>(pilot);
+                return;
+            }
+        }
+        raise<invalid_argument>("static_perfect_map: no pilot found");
+    }
+
+    constexpr auto try_pilot(size_t bucket, pilot_type pilot, array<size_t, Size> const& hashes) -> bool
+    {
+        for (auto i = size_t { 0 }; i < Size; ++i) {
+            if (bucket_of(hashes[i]) != bucket) { continue; }
+
+            auto& slot = slots_[slot_of(hashes[i], pilot)];
+            if (slot != empty_slot) {
+                // Roll back the keys of this bucket, that were already placed
+                for (auto j = size_t { 0 }; j < i; ++j) {
+                    if (bucket_of(hashes[j]) == bucket) { slots_[slot_of(hashes[j], pilot)] = empty_slot; }
+                }
+                return false;
+            }
+            slot = static_cast<index_type>(i);
+        }
+        return true;
+    }
+
+    array<value_type, Size> entries_;
+    array<index_type, table_size> slots_ {};
+    array<pilot_type, bucket_count> pilots_ {};
+};
+
+/// \brief Creates a static_perfect_map from a braced list of key-value pairs.
+/// The number of elements is deduced. The table is always built at compile-time.
+template <typename Key, typename Value, typename Hash = hash<Key>, typename KeyEqual = equal_to<Key>, size_t Size>
+[[nodiscard]] TETL_CONSTEVAL auto make_static_perfect_map(pair<Key, Value> const (&entries)[Size])
+    -> static_perfect_map<Key, Value, Size, Hash, KeyEqual>
+{
+    return static_perfect_map<Key, Value, Size, Hash, KeyEqual> { entries };
+}
+
+} // namespace etl
+
+#endif // TETL_MAP_STATIC_PERFECT_MAP_HPP
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MATH_MUL_WIDE_HPP
+#define TETL_MATH_MUL_WIDE_HPP
+
+#include "etl/_cstdint/uint_t.hpp"
+
+namespace etl::detail {
+
+template <typename UInt>
+struct mul_wide_result {
+    UInt lo;
+    UInt hi;
+};
+
+/// \brief Full 32x32 -> 64 bit multiply, split into the low and high half.
+[[nodiscard]] constexpr auto mul_wide(etl::uint32_t a, etl::uint32_t b) noexcept -> mul_wide_result<etl::uint32_t>
+{
+    auto const r = static_cast<etl::uint64_t>(a) * static_cast<etl::uint64_t>(b);
+    return { static_cast<etl::uint32_t>(r), static_cast<etl::uint32_t>(r >> 32U) };
+}
+
+/// \brief Full 64x64 -> 128 bit multiply, split into the low and high half.
+[[nodiscard]] constexpr auto mul_wide(etl::uint64_t a, etl::uint64_t b) noexcept -> mul_wide_result<etl::uint64_t>
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128_t = unsigned __int128;
+    auto const r = static_cast<uint128_t>(a) * static_cast<uint128_t>(b);
+    return { static_cast<etl::uint64_t>(r), static_cast<etl::uint64_t>(r >> 64U) };
+#else
+    auto const ha = a >> 32U;
+    auto const hb = b >> 32U;
+    auto const la = a & 0xFFFFFFFFULL;
+    auto const lb = b & 0xFFFFFFFFULL;
+
+    auto const rh  = ha * hb;
+    auto const rm0 = ha * lb;
+    auto const rm1 = hb * la;
+    auto const rl  = la * lb;
+    auto const t   = rl + (rm0 << 32U);
+    auto const lo  = t + (rm1 << 32U);
+    auto const c   = static_cast<etl::uint64_t>(t < rl) + static_cast<etl::uint64_t>(lo < t);
+    return { lo, rh + (rm0 >> 32U) + (rm1 >> 32U) + c };
+#endif
+}
+
+} // namespace etl::detail
+
+#endif // TETL_MATH_MUL_WIDE_HPP
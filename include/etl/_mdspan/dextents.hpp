@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_DEXTENTS_HPP
+#define TETL_MDSPAN_DEXTENTS_HPP
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/extents.hpp>
+#include <etl/_span/dynamic_extent.hpp>
+#include <etl/_utility/index_sequence.hpp>
+
+namespace etl {
+
+namespace detail {
+template <typename IndexType, typename Seq>
+struct dextents_impl;
+
+template <typename IndexType, size_t... Is>
+struct dextents_impl<IndexType, index_sequence<Is...>> {
+    using type = extents<IndexType, ((void)Is, dynamic_extent)...>;
+};
+} // namespace detail
+
+/// \brief extents of rank Rank, where all extents are dynamic.
+template <typename IndexType, size_t Rank>
+using dextents = typename detail::dextents_impl<IndexType, make_index_sequence<Rank>>::type;
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_DEXTENTS_HPP
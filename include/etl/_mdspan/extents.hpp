@@ -3,19 +3,35 @@
 #ifndef TETL_MDSPAN_EXTENTS_HPP
 #define TETL_MDSPAN_EXTENTS_HPP
 
+#include <etl/_config/all.hpp>
+
 #include <etl/_array/array.hpp>
 #include <etl/_cstddef/size_t.hpp>
 #include <etl/_limits/numeric_limits.hpp>
 #include <etl/_span/dynamic_extent.hpp>
 #include <etl/_span/span.hpp>
+#include <etl/_type_traits/conditional.hpp>
+#include <etl/_type_traits/is_convertible.hpp>
+#include <etl/_type_traits/is_nothrow_constructible.hpp>
+#include <etl/_type_traits/make_unsigned.hpp>
 #include <etl/_utility/integer_sequence.hpp>
+#include <etl/_utility/move.hpp>
 
 namespace etl {
 
-template <typename SizeType, size_t... Extents>
+/// \brief Represents a multidimensional index space of rank equal to
+/// sizeof...(Extents). Each extent is either a compile-time constant or
+/// dynamic_extent, in which case it is stored in the object.
+///
+/// \details Static extents take no space. extent(r) folds to a constant, if r
+/// is known at compile-time and the r-th extent is static.
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/extents
+template <typename IndexType, size_t... Extents>
 struct extents {
-    using size_type = SizeType;
-    using rank_type = size_t;
+    using index_type = IndexType;
+    using size_type  = make_unsigned_t<index_type>;
+    using rank_type  = size_t;
 
     // [mdspan.extents.obs], Observers of the multidimensional index space
     [[nodiscard]] static constexpr auto rank() noexcept -> rank_type { return sizeof...(Extents); }
@@ -35,67 +51,135 @@ struct extents {
         return impl(i, make_integer_sequence<size_t, rank()> {});
     }
 
-    [[nodiscard]] constexpr auto extent(rank_type i) const noexcept -> size_type
+    [[nodiscard]] constexpr auto extent(rank_type i) const noexcept -> index_type
     {
-        return extents_[static_cast<size_t>(i)];
+        if constexpr (rank_dynamic() == 0) {
+            return static_cast<index_type>(static_extent(i));
+        } else {
+            if (auto const ext = static_extent(i); ext != dynamic_extent) { return static_cast<index_type>(ext); }
+            return dynamic_[dynamic_index(i)];
+        }
     }
 
     // [mdspan.extents.ctor], Constructors
     constexpr extents() noexcept = default;
 
-    template <typename OtherSizeType, size_t... OtherExtents>
-        requires requires {
-                     sizeof...(OtherExtents) == rank();
-                     ((OtherExtents == dynamic_extent || Extents == dynamic_extent || OtherExtents == Extents) && ...);
-                 }
-    explicit((((Extents != dynamic_extent) && (OtherExtents == dynamic_extent)) || ...)
-             || (numeric_limits<size_type>::max()
-                 < numeric_limits<OtherSizeType>::max())) constexpr extents(extents<OtherSizeType,
-        OtherExtents...> const& e) noexcept
+    template <typename OtherIndexType, size_t... OtherExtents>
+        requires(sizeof...(OtherExtents) == rank()
+                 and ((OtherExtents == dynamic_extent or Extents == dynamic_extent or OtherExtents == Extents) and ...))
+    explicit((((Extents != dynamic_extent) and (OtherExtents == dynamic_extent)) or ...)
+             or (static_cast<unsigned long long>(numeric_limits<index_type>::max())
+                 < static_cast<unsigned long long>(numeric_limits<OtherIndexType>::max())))
+        constexpr extents(extents<OtherIndexType, OtherExtents...> const& other) noexcept
     {
-        for (rank_type i { 0 }; i < rank(); ++i) { extents_[static_cast<size_t>(i)] = e.extents(i); }
+        if constexpr (rank_dynamic() > 0) {
+            for (rank_type r = 0; r < rank(); ++r) {
+                if (static_extent(r) == dynamic_extent) {
+                    dynamic_[dynamic_index(r)] = static_cast<index_type>(other.extent(r));
+                }
+            }
+        }
     }
 
-    template <typename... OtherSizeTypes>
-        requires requires {
-                     (is_convertible_v<OtherSizeTypes, size_type> && ...);
-                     (is_nothrow_constructible_v<size_type, OtherSizeTypes> && ...)
-                         and (sizeof...(OtherSizeTypes) == rank_dynamic() || sizeof...(OtherSizeTypes) == rank());
-                 }
-    explicit constexpr extents(OtherSizeTypes... es) noexcept
+    /// \brief Initializes the dynamic extents. Either all extents or only the
+    /// dynamic ones are passed.
+    template <typename... OtherIndexTypes>
+        requires((is_convertible_v<OtherIndexTypes, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, OtherIndexTypes> and ...)
+                 and (sizeof...(OtherIndexTypes) == rank_dynamic() or sizeof...(OtherIndexTypes) == rank()))
+    explicit constexpr extents(OtherIndexTypes... exts) noexcept
     {
-        array<size_type, sizeof...(OtherSizeTypes)> { static_cast<size_type>(move(es))... };
+        if constexpr (sizeof...(OtherIndexTypes) == rank_dynamic() and rank_dynamic() > 0) {
+            dynamic_ = { static_cast<index_type>(etl::move(exts))... };
+        } else if constexpr (rank_dynamic() > 0) {
+            index_type const all[] { static_cast<index_type>(etl::move(exts))... };
+            for (rank_type r = 0; r < rank(); ++r) {
+                if (static_extent(r) == dynamic_extent) { dynamic_[dynamic_index(r)] = all[r]; }
+            }
+        }
     }
 
-    template <typename OtherSizeType, size_t N>
-    explicit(N != rank_dynamic()) constexpr extents(span<OtherSizeType, N> e) noexcept;
+    template <typename OtherIndexType, size_t N>
+        requires(is_convertible_v<OtherIndexType const&, index_type> and (N == rank_dynamic() or N == rank()))
+    explicit(N != rank_dynamic()) constexpr extents(span<OtherIndexType, N> exts) noexcept
+    {
+        init_from_range(exts);
+    }
 
-    template <typename OtherSizeType, size_t N>
-    explicit(N != rank_dynamic()) constexpr extents(array<OtherSizeType, N> const& e) noexcept;
+    template <typename OtherIndexType, size_t N>
+        requires(is_convertible_v<OtherIndexType const&, index_type> and (N == rank_dynamic() or N == rank()))
+    explicit(N != rank_dynamic()) constexpr extents(array<OtherIndexType, N> const& exts) noexcept
+    {
+        init_from_range(exts);
+    }
 
     // [mdspan.extents.cmp], extents comparison operators
-    template <typename OtherSizeType, size_t... OtherExtents>
-    friend constexpr auto operator==(extents const& lhs, extents<OtherSizeType, OtherExtents...> const& rhs) noexcept
-        -> bool;
+    template <typename OtherIndexType, size_t... OtherExtents>
+    friend constexpr auto operator==(extents const& lhs, extents<OtherIndexType, OtherExtents...> const& rhs) noexcept
+        -> bool
+    {
+        if constexpr (rank() != sizeof...(OtherExtents)) {
+            return false;
+        } else {
+            for (rank_type r = 0; r < rank(); ++r) {
+                if (static_cast<size_t>(lhs.extent(r)) != static_cast<size_t>(rhs.extent(r))) { return false; }
+            }
+            return true;
+        }
+    }
+
+    /// \internal Product of the extents [0, r).
+    [[nodiscard]] constexpr auto _fwd_prod(rank_type r) const noexcept -> index_type
+    {
+        auto prod = index_type(1);
+        for (rank_type i = 0; i < r; ++i) { prod *= extent(i); }
+        return prod;
+    }
 
-    // // [mdspan.extents.helpers], exposition only helpers
-    // constexpr size_t fwd - prod - of - extents(rank_type) const noexcept; // exposition only
-    // constexpr size_t rev - prod - of - extents(rank_type) const noexcept; // exposition only
-    // template <typename OtherSizeType>
-    //     static constexpr auto index - cast(OtherSizeType&&) noexcept; // exposition only
+    /// \internal Product of the extents (r, rank()).
+    [[nodiscard]] constexpr auto _rev_prod(rank_type r) const noexcept -> index_type
+    {
+        auto prod = index_type(1);
+        for (rank_type i = r + 1; i < rank(); ++i) { prod *= extent(i); }
+        return prod;
+    }
 
 private:
-    struct empty_dextents_t { };
-    using extents_storage_t = conditional_t<rank_dynamic() == 0, empty_dextents_t, array<size_type, rank_dynamic()>>;
+    [[nodiscard]] static constexpr auto dynamic_index(rank_type r) noexcept -> rank_type
+    {
+        auto const impl = []<size_t... Idxs>(size_t idx, integer_sequence<size_t, Idxs...>)
+        {
+            return (((Idxs < idx and Extents == dynamic_extent) ? rank_type(1) : rank_type(0)) + ... + 0);
+        };
+
+        return impl(r, make_integer_sequence<size_t, rank()> {});
+    }
+
+    template <typename Range>
+    constexpr auto init_from_range(Range const& exts) noexcept -> void
+    {
+        if constexpr (rank_dynamic() > 0) {
+            for (rank_type r = 0; r < rank(); ++r) {
+                if (static_extent(r) != dynamic_extent) { continue; }
+                auto const i               = exts.size() == rank() ? r : dynamic_index(r);
+                dynamic_[dynamic_index(r)] = static_cast<index_type>(exts[i]);
+            }
+        }
+    }
 
-    // static constexpr rank_type _dynamic_index(rank_type) noexcept;     // exposition only
-    // static constexpr rank_type _dynamic_index_inv(rank_type) noexcept; // exposition only
+    struct empty_dextents_t { };
+    using extents_storage_t = conditional_t<rank_dynamic() == 0, empty_dextents_t, array<index_type, rank_dynamic()>>;
 
-    extents_storage_t extents_ {};
+    TETL_NO_UNIQUE_ADDRESS extents_storage_t dynamic_ {};
 };
 
-// template <typename... Integrals>
-// explicit extents(Integrals...)->see below;
+namespace detail {
+template <typename T>
+inline constexpr size_t dynamic_extent_for = dynamic_extent;
+} // namespace detail
+
+template <typename... Integrals>
+explicit extents(Integrals...) -> extents<size_t, detail::dynamic_extent_for<Integrals>...>;
 
 } // namespace etl
 
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_FULL_EXTENT_HPP
+#define TETL_MDSPAN_FULL_EXTENT_HPP
+
+namespace etl {
+
+/// \brief Slice specifier for submdspan, that selects the whole extent.
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/submdspan
+struct full_extent_t {
+    explicit full_extent_t() = default;
+};
+
+inline constexpr auto full_extent = full_extent_t {};
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_FULL_EXTENT_HPP
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_LAYOUT_RIGHT_HPP
+#define TETL_MDSPAN_LAYOUT_RIGHT_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/is_extents.hpp>
+#include <etl/_mdspan/layout.hpp>
+#include <etl/_type_traits/is_constructible.hpp>
+#include <etl/_type_traits/is_convertible.hpp>
+#include <etl/_type_traits/is_nothrow_constructible.hpp>
+
+namespace etl {
+
+/// \brief Row-major layout: the rightmost extent has stride 1, like a
+/// multidimensional C array. With static extents the offset computation
+/// folds to constants.
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/layout_right
+template <typename Extents>
+struct layout_right::mapping {
+    static_assert(detail::is_extents<Extents>, "layout_right::mapping: Extents must be a specialization of extents");
+
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_right;
+
+    // constructors
+    constexpr mapping() noexcept               = default;
+    constexpr mapping(mapping const&) noexcept = default;
+    constexpr mapping(extents_type const& ext) noexcept : extents_ { ext } { }
+
+    template <typename OtherExtents>
+        requires(is_constructible_v<extents_type, OtherExtents>)
+    constexpr explicit(not is_convertible_v<OtherExtents, extents_type>)
+        mapping(mapping<OtherExtents> const& other) noexcept
+        : extents_ { other.extents() }
+    {
+    }
+
+    template <typename OtherExtents>
+        requires(extents_type::rank() <= 1 and is_constructible_v<extents_type, OtherExtents>)
+    constexpr explicit(not is_convertible_v<OtherExtents, extents_type>)
+        mapping(layout_left::mapping<OtherExtents> const& other) noexcept
+        : extents_ { other.extents() }
+    {
+    }
+
+    template <typename OtherExtents>
+        requires(is_constructible_v<extents_type, OtherExtents>)
+    constexpr explicit(extents_type::rank() > 0) mapping(layout_stride::mapping<OtherExtents> const& other) noexcept
+        : extents_ { other.extents() }
+    {
+        if constexpr (extents_type::rank() > 0) {
+            for (rank_type r = 0; r < extents_type::rank(); ++r) { TETL_ASSERT(other.stride(r) == stride(r)); }
+        }
+    }
+
+    constexpr auto operator=(mapping const&) noexcept -> mapping& = default;
+
+    [[nodiscard]] constexpr auto extents() const noexcept -> extents_type const& { return extents_; }
+
+    [[nodiscard]] constexpr auto required_span_size() const noexcept -> index_type
+    {
+        return extents_._fwd_prod(extents_type::rank());
+    }
+
+    template <typename... Indices>
+        requires(sizeof...(Indices) == extents_type::rank() and (is_convertible_v<Indices, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, Indices> and ...))
+    [[nodiscard]] constexpr auto operator()(Indices... indices) const noexcept -> index_type
+    {
+        // Horner scheme: ((i0 * e1 + i1) * e2 + i2) ...
+        auto offset             = index_type(0);
+        [[maybe_unused]] auto r = rank_type(0);
+        ((offset = static_cast<index_type>(offset * extents_.extent(r++) + static_cast<index_type>(indices))), ...);
+        return offset;
+    }
+
+    [[nodiscard]] static constexpr auto is_always_unique() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_always_exhaustive() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_always_strided() noexcept -> bool { return true; }
+
+    [[nodiscard]] static constexpr auto is_unique() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_exhaustive() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_strided() noexcept -> bool { return true; }
+
+    [[nodiscard]] constexpr auto stride(rank_type r) const noexcept -> index_type
+        requires(extents_type::rank() > 0)
+    {
+        return extents_._rev_prod(r);
+    }
+
+    template <typename OtherExtents>
+        requires(OtherExtents::rank() == extents_type::rank())
+    friend constexpr auto operator==(mapping const& lhs, mapping<OtherExtents> const& rhs) noexcept -> bool
+    {
+        return lhs.extents() == rhs.extents();
+    }
+
+private:
+    TETL_NO_UNIQUE_ADDRESS extents_type extents_ {};
+};
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_LAYOUT_RIGHT_HPP
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_LAYOUT_STRIDE_HPP
+#define TETL_MDSPAN_LAYOUT_STRIDE_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_array/array.hpp>
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/is_extents.hpp>
+#include <etl/_mdspan/layout.hpp>
+#include <etl/_mdspan/layout_mapping_alike.hpp>
+#include <etl/_mdspan/layout_right.hpp>
+#include <etl/_span/span.hpp>
+#include <etl/_type_traits/conditional.hpp>
+#include <etl/_type_traits/is_constructible.hpp>
+#include <etl/_type_traits/is_convertible.hpp>
+#include <etl/_type_traits/is_nothrow_constructible.hpp>
+
+namespace etl {
+
+/// \brief Layout with a user-defined stride for each extent. Results of
+/// submdspan, that are not contiguous, use this layout.
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/layout_stride
+template <typename Extents>
+struct layout_stride::mapping {
+    static_assert(detail::is_extents<Extents>, "layout_stride::mapping: Extents must be a specialization of extents");
+
+    using extents_type = Extents;
+    using index_type   = typename extents_type::index_type;
+    using size_type    = typename extents_type::size_type;
+    using rank_type    = typename extents_type::rank_type;
+    using layout_type  = layout_stride;
+
+private:
+    static constexpr auto rank_ = extents_type::rank();
+
+    struct empty_strides_t { };
+    using strides_storage_t = conditional_t<rank_ == 0, empty_strides_t, array<index_type, rank_>>;
+
+public:
+    /// \brief Strides of layout_right for the default constructed extents.
+    constexpr mapping() noexcept : mapping(layout_right::mapping<extents_type> {}) { }
+
+    constexpr mapping(mapping const&) noexcept = default;
+
+    template <typename OtherIndexType>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>)
+    constexpr mapping(extents_type const& ext, span<OtherIndexType, rank_> strides) noexcept : extents_ { ext }
+    {
+        if constexpr (rank_ > 0) {
+            for (rank_type r = 0; r < rank_; ++r) { strides_[r] = static_cast<index_type>(strides[r]); }
+        }
+    }
+
+    template <typename OtherIndexType>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>)
+    constexpr mapping(extents_type const& ext, array<OtherIndexType, rank_> const& strides) noexcept
+        : extents_ { ext }
+    {
+        if constexpr (rank_ > 0) {
+            for (rank_type r = 0; r < rank_; ++r) { strides_[r] = static_cast<index_type>(strides[r]); }
+        }
+    }
+
+    /// \brief Copies the strides of any other strided mapping, e.g.
+    /// layout_left or layout_right.
+    template <typename StridedLayoutMapping>
+        requires(detail::layout_mapping_alike<StridedLayoutMapping>
+                 and is_constructible_v<extents_type, typename StridedLayoutMapping::extents_type>
+                 and StridedLayoutMapping::is_always_unique() and StridedLayoutMapping::is_always_strided())
+    constexpr explicit(not is_convertible_v<typename StridedLayoutMapping::extents_type, extents_type>)
+        mapping(StridedLayoutMapping const& other) noexcept
+        : extents_ { other.extents() }
+    {
+        if constexpr (rank_ > 0) {
+            for (rank_type r = 0; r < rank_; ++r) { strides_[r] = static_cast<index_type>(other.stride(r)); }
+        }
+    }
+
+    constexpr auto operator=(mapping const&) noexcept -> mapping& = default;
+
+    [[nodiscard]] constexpr auto extents() const noexcept -> extents_type const& { return extents_; }
+
+    [[nodiscard]] constexpr auto strides() const noexcept -> array<index_type, rank_>
+        requires(rank_ > 0)
+    {
+        return strides_;
+    }
+
+    /// \brief 1 + sum((extent(r) - 1) * stride(r)), or 0 if any extent is 0.
+    [[nodiscard]] constexpr auto required_span_size() const noexcept -> index_type
+    {
+        auto size = index_type(1);
+        if constexpr (rank_ > 0) {
+            for (rank_type r = 0; r < rank_; ++r) {
+                if (extents_.extent(r) == 0) { return 0; }
+                size = static_cast<index_type>(size + (extents_.extent(r) - 1) * strides_[r]);
+            }
+        }
+        return size;
+    }
+
+    template <typename... Indices>
+        requires(sizeof...(Indices) == rank_ and (is_convertible_v<Indices, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, Indices> and ...))
+    [[nodiscard]] constexpr auto operator()(Indices... indices) const noexcept -> index_type
+    {
+        auto offset             = index_type(0);
+        [[maybe_unused]] auto r = rank_type(0);
+        ((offset = static_cast<index_type>(offset + static_cast<index_type>(indices) * strides_[r++])), ...);
+        return offset;
+    }
+
+    [[nodiscard]] static constexpr auto is_always_unique() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_always_exhaustive() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto is_always_strided() noexcept -> bool { return true; }
+
+    [[nodiscard]] static constexpr auto is_unique() noexcept -> bool { return true; }
+    [[nodiscard]] static constexpr auto is_strided() noexcept -> bool { return true; }
+
+    /// \brief True, if the elements cover [0, required_span_size()) without gaps.
+    [[nodiscard]] constexpr auto is_exhaustive() const noexcept -> bool
+    {
+        return required_span_size() == extents_._fwd_prod(rank_);
+    }
+
+    [[nodiscard]] constexpr auto stride(rank_type r) const noexcept -> index_type
+        requires(rank_ > 0)
+    {
+        return strides_[r];
+    }
+
+    template <typename OtherMapping>
+        requires(detail::layout_mapping_alike<OtherMapping> and OtherMapping::extents_type::rank() == rank_
+                 and OtherMapping::is_always_strided())
+    friend constexpr auto operator==(mapping const& lhs, OtherMapping const& rhs) noexcept -> bool
+    {
+        if (not(lhs.extents() == rhs.extents())) { return false; }
+        if constexpr (rank_ > 0) {
+            for (rank_type r = 0; r < rank_; ++r) {
+                if (lhs.stride(r) != static_cast<index_type>(rhs.stride(r))) { return false; }
+            }
+        }
+        return true;
+    }
+
+private:
+    TETL_NO_UNIQUE_ADDRESS extents_type extents_ {};
+    TETL_NO_UNIQUE_ADDRESS strides_storage_t strides_ {};
+};
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_LAYOUT_STRIDE_HPP
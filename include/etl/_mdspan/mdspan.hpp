@@ -5,10 +5,280 @@
 
 #include "etl/_config/all.hpp"
 
+#include "etl/_array/array.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_mdspan/default_accessor.hpp"
+#include "etl/_mdspan/dextents.hpp"
+#include "etl/_mdspan/extents.hpp"
+#include "etl/_mdspan/is_extents.hpp"
+#include "etl/_mdspan/layout.hpp"
+#include "etl/_mdspan/layout_left.hpp"
+#include "etl/_mdspan/layout_right.hpp"
+#include "etl/_mdspan/layout_stride.hpp"
+#include "etl/_span/span.hpp"
+#include "etl/_type_traits/extent.hpp"
+#include "etl/_type_traits/is_array.hpp"
+#include "etl/_type_traits/is_constructible.hpp"
+#include "etl/_type_traits/is_convertible.hpp"
+#include "etl/_type_traits/is_default_constructible.hpp"
+#include "etl/_type_traits/is_nothrow_constructible.hpp"
 #include "etl/_type_traits/is_object.hpp"
+#include "etl/_type_traits/is_pointer.hpp"
+#include "etl/_type_traits/rank.hpp"
+#include "etl/_type_traits/remove_all_extents.hpp"
+#include "etl/_type_traits/remove_cv.hpp"
+#include "etl/_type_traits/remove_pointer.hpp"
+#include "etl/_type_traits/remove_reference.hpp"
+#include "etl/_utility/index_sequence.hpp"
+#include "etl/_utility/move.hpp"
+#include "etl/_utility/swap.hpp"
 
 namespace etl {
 
+/// \brief A non-owning view into a contiguous sequence of objects, that is
+/// reinterpreted as a multidimensional array.
+///
+/// \details With static extents, layout_right or layout_left and the default
+/// accessor, an mdspan is a single pointer and element access compiles to the
+/// same code as the equivalent pointer arithmetic.
+///
+/// Multidimensional operator[] requires C++23. In C++20 use operator() or
+/// operator[] with an array of indices.
+///
+/// \code
+/// float data[6] {};
+/// auto m = etl::mdspan<float, etl::extents<int, 2, 3>> { data };
+/// m(1, 2) = 42.0F; // data[5]
+/// \endcode
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan
+template <typename ElementType, typename Extents, typename LayoutPolicy = layout_right,
+    typename AccessorPolicy = default_accessor<ElementType>>
+struct mdspan {
+    static_assert(is_object_v<ElementType>, "mdspan: ElementType must be a complete object type");
+    static_assert(detail::is_extents<Extents>, "mdspan: Extents must be a specialization of extents");
+
+    using extents_type     = Extents;
+    using layout_type      = LayoutPolicy;
+    using accessor_type    = AccessorPolicy;
+    using mapping_type     = typename layout_type::template mapping<extents_type>;
+    using element_type     = ElementType;
+    using value_type       = remove_cv_t<element_type>;
+    using index_type       = typename extents_type::index_type;
+    using size_type        = typename extents_type::size_type;
+    using rank_type        = typename extents_type::rank_type;
+    using data_handle_type = typename accessor_type::data_handle_type;
+    using reference        = typename accessor_type::reference;
+
+    [[nodiscard]] static constexpr auto rank() noexcept -> rank_type { return extents_type::rank(); }
+    [[nodiscard]] static constexpr auto rank_dynamic() noexcept -> rank_type { return extents_type::rank_dynamic(); }
+    [[nodiscard]] static constexpr auto static_extent(rank_type r) noexcept -> size_t
+    {
+        return extents_type::static_extent(r);
+    }
+
+    [[nodiscard]] constexpr auto extent(rank_type r) const noexcept -> index_type { return extents().extent(r); }
+
+    // [mdspan.mdspan.cons], constructors
+    constexpr mdspan()
+        requires(rank_dynamic() > 0 and is_default_constructible_v<data_handle_type>
+                 and is_default_constructible_v<mapping_type> and is_default_constructible_v<accessor_type>)
+    = default;
+
+    constexpr mdspan(mdspan const& rhs) = default;
+    constexpr mdspan(mdspan&& rhs)      = default;
+
+    template <typename... OtherIndexTypes>
+        requires((is_convertible_v<OtherIndexTypes, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, OtherIndexTypes> and ...)
+                 and (sizeof...(OtherIndexTypes) == rank() or sizeof...(OtherIndexTypes) == rank_dynamic())
+                 and is_constructible_v<mapping_type, extents_type> and is_default_constructible_v<accessor_type>)
+    explicit constexpr mdspan(data_handle_type ptr, OtherIndexTypes... exts)
+        : ptr_ { etl::move(ptr) }
+        , map_ { extents_type { static_cast<index_type>(etl::move(exts))... } }
+    {
+    }
+
+    template <typename OtherIndexType, size_t N>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>
+                 and (N == rank() or N == rank_dynamic()) and is_constructible_v<mapping_type, extents_type>
+                 and is_default_constructible_v<accessor_type>)
+    explicit(N != rank_dynamic()) constexpr mdspan(data_handle_type ptr, array<OtherIndexType, N> const& exts)
+        : ptr_ { etl::move(ptr) }
+        , map_ { extents_type { exts } }
+    {
+    }
+
+    template <typename OtherIndexType, size_t N>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>
+                 and (N == rank() or N == rank_dynamic()) and is_constructible_v<mapping_type, extents_type>
+                 and is_default_constructible_v<accessor_type>)
+    explicit(N != rank_dynamic()) constexpr mdspan(data_handle_type ptr, span<OtherIndexType, N> exts)
+        : ptr_ { etl::move(ptr) }
+        , map_ { extents_type { exts } }
+    {
+    }
+
+    constexpr mdspan(data_handle_type ptr, extents_type const& ext)
+        requires(is_constructible_v<mapping_type, extents_type const&> and is_default_constructible_v<accessor_type>)
+        : ptr_ { etl::move(ptr) }
+        , map_ { ext }
+    {
+    }
+
+    constexpr mdspan(data_handle_type ptr, mapping_type const& m)
+        requires(is_default_constructible_v<accessor_type>)
+        : ptr_ { etl::move(ptr) }
+        , map_ { m }
+    {
+    }
+
+    constexpr mdspan(data_handle_type ptr, mapping_type const& m, accessor_type const& a)
+        : ptr_ { etl::move(ptr) }
+        , map_ { m }
+        , acc_ { a }
+    {
+    }
+
+    template <typename OtherElementType, typename OtherExtents, typename OtherLayoutPolicy, typename OtherAccessor>
+        requires(is_constructible_v<mapping_type, typename OtherLayoutPolicy::template mapping<OtherExtents> const&>
+                 and is_constructible_v<accessor_type, OtherAccessor const&>
+                 and is_constructible_v<data_handle_type, typename OtherAccessor::data_handle_type const&>)
+    constexpr explicit(
+        not is_convertible_v<typename OtherLayoutPolicy::template mapping<OtherExtents> const&, mapping_type>
+        or not is_convertible_v<OtherAccessor const&, accessor_type>)
+        mdspan(mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor> const& other)
+        : ptr_ { other.data_handle() }
+        , map_ { other.mapping() }
+        , acc_ { other.accessor() }
+    {
+    }
+
+    constexpr auto operator=(mdspan const& rhs) -> mdspan& = default;
+    constexpr auto operator=(mdspan&& rhs) -> mdspan&      = default;
+
+    // [mdspan.mdspan.members], members
+    template <typename... OtherIndexTypes>
+        requires((is_convertible_v<OtherIndexTypes, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, OtherIndexTypes> and ...)
+                 and sizeof...(OtherIndexTypes) == rank())
+    [[nodiscard]] constexpr auto operator()(OtherIndexTypes... indices) const -> reference
+    {
+        auto const i = map_(static_cast<index_type>(etl::move(indices))...);
+        TETL_ASSERT(i < map_.required_span_size());
+        return acc_.access(ptr_, static_cast<size_t>(i));
+    }
+
+#if defined(__cpp_multidimensional_subscript)
+    template <typename... OtherIndexTypes>
+        requires((is_convertible_v<OtherIndexTypes, index_type> and ...)
+                 and (is_nothrow_constructible_v<index_type, OtherIndexTypes> and ...)
+                 and sizeof...(OtherIndexTypes) == rank())
+    [[nodiscard]] constexpr auto operator[](OtherIndexTypes... indices) const -> reference
+    {
+        return (*this)(etl::move(indices)...);
+    }
+#else
+    template <typename OtherIndexType>
+        requires(is_convertible_v<OtherIndexType, index_type> and is_nothrow_constructible_v<index_type, OtherIndexType>
+                 and rank() == 1)
+    [[nodiscard]] constexpr auto operator[](OtherIndexType index) const -> reference
+    {
+        return (*this)(etl::move(index));
+    }
+#endif
+
+    template <typename OtherIndexType>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>)
+    [[nodiscard]] constexpr auto operator[](array<OtherIndexType, rank()> const& indices) const -> reference
+    {
+        return access_with(indices, make_index_sequence<rank()> {});
+    }
+
+    template <typename OtherIndexType>
+        requires(is_convertible_v<OtherIndexType const&, index_type>
+                 and is_nothrow_constructible_v<index_type, OtherIndexType const&>)
+    [[nodiscard]] constexpr auto operator[](span<OtherIndexType, rank()> indices) const -> reference
+    {
+        return access_with(indices, make_index_sequence<rank()> {});
+    }
+
+    /// \brief Number of elements, the product of all extents.
+    [[nodiscard]] constexpr auto size() const noexcept -> size_type
+    {
+        return static_cast<size_type>(extents()._fwd_prod(rank()));
+    }
+
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size() == 0; }
+
+    friend constexpr auto swap(mdspan& x, mdspan& y) noexcept -> void
+    {
+        etl::swap(x.ptr_, y.ptr_);
+        etl::swap(x.map_, y.map_);
+        etl::swap(x.acc_, y.acc_);
+    }
+
+    [[nodiscard]] constexpr auto extents() const noexcept -> extents_type const& { return map_.extents(); }
+    [[nodiscard]] constexpr auto data_handle() const noexcept -> data_handle_type const& { return ptr_; }
+    [[nodiscard]] constexpr auto mapping() const noexcept -> mapping_type const& { return map_; }
+    [[nodiscard]] constexpr auto accessor() const noexcept -> accessor_type const& { return acc_; }
+
+    [[nodiscard]] static constexpr auto is_always_unique() -> bool { return mapping_type::is_always_unique(); }
+    [[nodiscard]] static constexpr auto is_always_exhaustive() -> bool { return mapping_type::is_always_exhaustive(); }
+    [[nodiscard]] static constexpr auto is_always_strided() -> bool { return mapping_type::is_always_strided(); }
+
+    [[nodiscard]] constexpr auto is_unique() const -> bool { return map_.is_unique(); }
+    [[nodiscard]] constexpr auto is_exhaustive() const -> bool { return map_.is_exhaustive(); }
+    [[nodiscard]] constexpr auto is_strided() const -> bool { return map_.is_strided(); }
+    [[nodiscard]] constexpr auto stride(rank_type r) const -> index_type { return map_.stride(r); }
+
+private:
+    template <typename Indices, size_t... Rs>
+    [[nodiscard]] constexpr auto access_with(Indices const& indices, index_sequence<Rs...> /*ranks*/) const
+        -> reference
+    {
+        return (*this)(static_cast<index_type>(indices[Rs])...);
+    }
+
+    data_handle_type ptr_ {};
+    TETL_NO_UNIQUE_ADDRESS mapping_type map_ {};
+    TETL_NO_UNIQUE_ADDRESS accessor_type acc_ {};
+};
+
+template <typename CArray>
+    requires(is_array_v<CArray> and rank_v<CArray> == 1)
+mdspan(CArray&) -> mdspan<remove_all_extents_t<CArray>, extents<size_t, extent<CArray>::value>>;
+
+template <typename Pointer>
+    requires(is_pointer_v<remove_reference_t<Pointer>>)
+mdspan(Pointer&&) -> mdspan<remove_pointer_t<remove_reference_t<Pointer>>, extents<size_t>>;
+
+template <typename ElementType, typename... Integrals>
+    requires((is_convertible_v<Integrals, size_t> and ...) and sizeof...(Integrals) > 0)
+explicit mdspan(ElementType*, Integrals...) -> mdspan<ElementType, dextents<size_t, sizeof...(Integrals)>>;
+
+template <typename ElementType, typename OtherIndexType, size_t N>
+mdspan(ElementType*, span<OtherIndexType, N>) -> mdspan<ElementType, dextents<size_t, N>>;
+
+template <typename ElementType, typename OtherIndexType, size_t N>
+mdspan(ElementType*, array<OtherIndexType, N> const&) -> mdspan<ElementType, dextents<size_t, N>>;
+
+template <typename ElementType, typename IndexType, size_t... ExtentsPack>
+mdspan(ElementType*, extents<IndexType, ExtentsPack...> const&)
+    -> mdspan<ElementType, extents<IndexType, ExtentsPack...>>;
+
+template <typename ElementType, typename MappingType>
+mdspan(ElementType*, MappingType const&)
+    -> mdspan<ElementType, typename MappingType::extents_type, typename MappingType::layout_type>;
+
+template <typename MappingType, typename AccessorType>
+mdspan(typename AccessorType::data_handle_type const&, MappingType const&, AccessorType const&)
+    -> mdspan<typename AccessorType::element_type, typename MappingType::extents_type,
+        typename MappingType::layout_type, AccessorType>;
+
 } // namespace etl
 
 #endif // TETL_MDSPAN_MDSPAN_HPP
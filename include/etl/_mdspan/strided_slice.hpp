@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_STRIDED_SLICE_HPP
+#define TETL_MDSPAN_STRIDED_SLICE_HPP
+
+#include <etl/_config/all.hpp>
+
+namespace etl {
+
+/// \brief Slice specifier for submdspan, that selects every stride-th index
+/// of [offset, offset + extent). If extent and stride are integral_constants,
+/// the resulting extent is static.
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/strided_slice
+template <typename OffsetType, typename ExtentType, typename StrideType>
+struct strided_slice {
+    using offset_type = OffsetType;
+    using extent_type = ExtentType;
+    using stride_type = StrideType;
+
+    TETL_NO_UNIQUE_ADDRESS OffsetType offset {};
+    TETL_NO_UNIQUE_ADDRESS ExtentType extent {};
+    TETL_NO_UNIQUE_ADDRESS StrideType stride {};
+};
+
+template <typename OffsetType, typename ExtentType, typename StrideType>
+strided_slice(OffsetType, ExtentType, StrideType) -> strided_slice<OffsetType, ExtentType, StrideType>;
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_STRIDED_SLICE_HPP
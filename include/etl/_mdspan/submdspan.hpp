@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MDSPAN_SUBMDSPAN_HPP
+#define TETL_MDSPAN_SUBMDSPAN_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/_array/array.hpp>
+#include <etl/_cstddef/size_t.hpp>
+#include <etl/_mdspan/extents.hpp>
+#include <etl/_mdspan/full_extent.hpp>
+#include <etl/_mdspan/layout.hpp>
+#include <etl/_mdspan/layout_left.hpp>
+#include <etl/_mdspan/layout_right.hpp>
+#include <etl/_mdspan/layout_stride.hpp>
+#include <etl/_mdspan/mdspan.hpp>
+#include <etl/_mdspan/strided_slice.hpp>
+#include <etl/_span/dynamic_extent.hpp>
+#include <etl/_tuple/tuple.hpp>
+#include <etl/_type_traits/conditional.hpp>
+#include <etl/_type_traits/integral_constant.hpp>
+#include <etl/_type_traits/is_convertible.hpp>
+#include <etl/_type_traits/is_same.hpp>
+#include <etl/_type_traits/type_pack_element.hpp>
+#include <etl/_utility/index_sequence.hpp>
+#include <etl/_utility/pair.hpp>
+
+namespace etl {
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_integral_constant_slice = false;
+
+template <typename T, T V>
+inline constexpr bool is_integral_constant_slice<integral_constant<T, V>> = true;
+
+template <typename T>
+inline constexpr bool is_strided_slice = false;
+
+template <typename O, typename E, typename S>
+inline constexpr bool is_strided_slice<strided_slice<O, E, S>> = true;
+
+template <typename T>
+inline constexpr bool is_pair_slice = false;
+
+template <typename T1, typename T2>
+inline constexpr bool is_pair_slice<pair<T1, T2>> = true;
+
+/// \brief The slice selects a single index and removes the rank.
+template <typename IndexType, typename Slice>
+inline constexpr bool is_index_slice = is_convertible_v<Slice, IndexType>;
+
+/// \brief The slice selects a contiguous range [first, last).
+template <typename Slice>
+inline constexpr bool is_unit_stride_slice = is_same_v<Slice, full_extent_t> or is_pair_slice<Slice>;
+
+template <typename IndexType, typename Slice>
+[[nodiscard]] constexpr auto submdspan_first_of(Slice const& slice) noexcept -> IndexType
+{
+    if constexpr (is_index_slice<IndexType, Slice>) {
+        return static_cast<IndexType>(slice);
+    } else if constexpr (is_same_v<Slice, full_extent_t>) {
+        return IndexType(0);
+    } else if constexpr (is_pair_slice<Slice>) {
+        return static_cast<IndexType>(slice.first);
+    } else {
+        static_assert(is_strided_slice<Slice>, "submdspan: unsupported slice specifier");
+        return static_cast<IndexType>(slice.offset);
+    }
+}
+
+template <typename IndexType, typename Slice>
+[[nodiscard]] constexpr auto submdspan_extent_of(IndexType src, Slice const& slice) noexcept -> IndexType
+{
+    if constexpr (is_same_v<Slice, full_extent_t>) {
+        return src;
+    } else if constexpr (is_pair_slice<Slice>) {
+        return static_cast<IndexType>(static_cast<IndexType>(slice.second) - static_cast<IndexType>(slice.first));
+    } else {
+        auto const extent = static_cast<IndexType>(slice.extent);
+        auto const stride = static_cast<IndexType>(slice.stride);
+        return extent == 0 ? IndexType(0) : static_cast<IndexType>(1 + (extent - 1) / stride);
+    }
+}
+
+template <typename IndexType, typename Slice>
+[[nodiscard]] constexpr auto submdspan_stride_of(Slice const& slice) noexcept -> IndexType
+{
+    if constexpr (is_strided_slice<Slice>) {
+        return static_cast<IndexType>(slice.stride);
+    } else {
+        return IndexType(1);
+    }
+}
+
+template <size_t SrcExtent, typename Slice>
+[[nodiscard]] consteval auto submdspan_static_extent_of() -> size_t
+{
+    if constexpr (is_same_v<Slice, full_extent_t>) {
+        return SrcExtent;
+    } else if constexpr (is_strided_slice<Slice>) {
+        using extent_type = typename Slice::extent_type;
+        using stride_type = typename Slice::stride_type;
+        if constexpr (is_integral_constant_slice<extent_type> and is_integral_constant_slice<stride_type>) {
+            constexpr auto extent = static_cast<size_t>(extent_type::value);
+            constexpr auto stride = static_cast<size_t>(stride_type::value);
+            return extent == 0 ? 0 : 1 + (extent - 1) / stride;
+        } else {
+            return dynamic_extent;
+        }
+    } else {
+        return dynamic_extent;
+    }
+}
+
+template <typename Extents, typename... Slices>
+struct submdspan_traits {
+    using index_type = typename Extents::index_type;
+
+    static constexpr auto rank     = Extents::rank();
+    static constexpr auto sub_rank = (size_t(not is_index_slice<index_type, Slices>) + ... + 0);
+
+    /// \brief Source rank for each rank of the result.
+    static constexpr auto src_ranks = [] {
+        bool const is_index[] { is_index_slice<index_type, Slices>..., false };
+        auto ranks = array<size_t, sub_rank + 1> {};
+        auto k     = size_t(0);
+        for (size_t r = 0; r < rank; ++r) {
+            if (not is_index[r]) { ranks[k++] = r; }
+        }
+        return ranks;
+    }();
+
+    template <size_t K>
+    using slice_t = type_pack_element_t<src_ranks[K], Slices...>;
+
+    template <typename Seq>
+    struct extents_impl;
+
+    template <size_t... Ks>
+    struct extents_impl<index_sequence<Ks...>> {
+        using type = extents<index_type,
+            submdspan_static_extent_of<Extents::static_extent(src_ranks[Ks]), slice_t<Ks>>()...>;
+    };
+
+    using extents_type = typename extents_impl<make_index_sequence<sub_rank>>::type;
+
+    /// \brief layout_right is kept, if the result selects a contiguous range
+    /// of the rightmost extents, e.g. m[i, j, a:b, :, :].
+    static constexpr auto keeps_layout_right = [] {
+        if constexpr (sub_rank == 0) {
+            return true;
+        } else {
+            bool const unit[] { is_unit_stride_slice<Slices>..., false };
+            bool const full[] { is_same_v<Slices, full_extent_t>..., false };
+            for (size_t r = rank - sub_rank + 1; r < rank; ++r) {
+                if (not full[r]) { return false; }
+            }
+            return unit[rank - sub_rank];
+        }
+    }();
+
+    /// \brief layout_left is kept, if the result selects a contiguous range
+    /// of the leftmost extents, e.g. m[:, :, a:b, i, j].
+    static constexpr auto keeps_layout_left = [] {
+        if constexpr (sub_rank == 0) {
+            return true;
+        } else {
+            bool const unit[] { is_unit_stride_slice<Slices>..., false };
+            bool const full[] { is_same_v<Slices, full_extent_t>..., false };
+            for (size_t r = 0; r + 1 < sub_rank; ++r) {
+                if (not full[r]) { return false; }
+            }
+            return unit[sub_rank - 1];
+        }
+    }();
+
+    template <typename LayoutPolicy>
+    using layout_type = conditional_t<(is_same_v<LayoutPolicy, layout_right> and keeps_layout_right)
+                                          or (is_same_v<LayoutPolicy, layout_left> and keeps_layout_left),
+        LayoutPolicy, layout_stride>;
+};
+
+template <typename Traits, typename Mapping, typename SliceTuple, size_t... Ks>
+[[nodiscard]] constexpr auto submdspan_mapping(
+    Mapping const& src, SliceTuple const& slices, index_sequence<Ks...> /*ranks*/)
+{
+    using index_type   = typename Traits::index_type;
+    using extents_type = typename Traits::extents_type;
+    using layout_type  = typename Traits::template layout_type<typename Mapping::layout_type>;
+    using mapping_type = typename layout_type::template mapping<extents_type>;
+
+    auto const exts = extents_type {
+        submdspan_extent_of(src.extents().extent(Traits::src_ranks[Ks]), get<Traits::src_ranks[Ks]>(slices))...
+    };
+
+    if constexpr (is_same_v<layout_type, layout_stride> and sizeof...(Ks) > 0) {
+        auto const strides = array<index_type, sizeof...(Ks)> {
+            static_cast<index_type>(src.stride(Traits::src_ranks[Ks])
+                                    * submdspan_stride_of<index_type>(get<Traits::src_ranks[Ks]>(slices)))...
+        };
+        return mapping_type { exts, strides };
+    } else if constexpr (is_same_v<layout_type, layout_stride>) {
+        return mapping_type { layout_right::mapping<extents_type> { exts } };
+    } else {
+        return mapping_type { exts };
+    }
+}
+
+} // namespace detail
+
+/// \brief Returns a view of a subset of the elements of src. For each rank
+/// the slice specifier is either an index, which removes the rank,
+/// full_extent, a pair [first, last) or a strided_slice.
+///
+/// \details The result keeps layout_left or layout_right, if the selected
+/// elements are still contiguous in the fastest changing ranks, otherwise it
+/// is layout_stride. Full slices of static extents and strided slices with
+/// integral_constant extent and stride produce static extents.
+///
+/// \code
+/// float data[12] {};
+/// auto m   = etl::mdspan<float, etl::extents<int, 3, 4>> { data };
+/// auto row = etl::submdspan(m, 1, etl::full_extent); // extents<int, 4>, layout_right
+/// auto col = etl::submdspan(m, etl::full_extent, 2); // extents<int, 3>, layout_stride
+/// \endcode
+///
+/// https://en.cppreference.com/w/cpp/container/mdspan/submdspan
+template <typename ElementType, typename Extents, typename LayoutPolicy, typename AccessorPolicy,
+    typename... SliceSpecifiers>
+    requires(sizeof...(SliceSpecifiers) == Extents::rank()
+             and (is_same_v<LayoutPolicy, layout_left> or is_same_v<LayoutPolicy, layout_right>
+                  or is_same_v<LayoutPolicy, layout_stride>))
+[[nodiscard]] constexpr auto submdspan(
+    mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy> const& src, SliceSpecifiers... slices)
+{
+    using index_type = typename Extents::index_type;
+    using traits     = detail::submdspan_traits<Extents, SliceSpecifiers...>;
+    using accessor   = typename AccessorPolicy::offset_policy;
+
+    auto const offset = static_cast<size_t>(src.mapping()(detail::submdspan_first_of<index_type>(slices)...));
+    auto const map    = detail::submdspan_mapping<traits>(
+        src.mapping(), tuple<SliceSpecifiers...> { slices... }, make_index_sequence<traits::sub_rank> {});
+
+    return mdspan { src.accessor().offset(src.data_handle(), offset), map, accessor { src.accessor() } };
+}
+
+} // namespace etl
+
+#endif // TETL_MDSPAN_SUBMDSPAN_HPP
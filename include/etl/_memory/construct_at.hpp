@@ -4,6 +4,7 @@
 #define TETL_MEMORY_CONSTRUCT_AT_HPP
 
 #include "etl/_cassert/macro.hpp"
+#include "etl/_new/operator.hpp"
 #include "etl/_type_traits/declval.hpp"
 #include "etl/_utility/forward.hpp"
 
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MEMORY_RELOCATE_AT_HPP
+#define TETL_MEMORY_RELOCATE_AT_HPP
+
+#include "etl/_cstring/memcpy.hpp"
+#include "etl/_cstring/memmove.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_memory/construct_at.hpp"
+#include "etl/_memory/destroy_at.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_trivially_relocatable.hpp"
+#include "etl/_utility/move.hpp"
+
+namespace etl {
+
+/// \brief Relocates the object pointed to by source into the uninitialized
+/// storage pointed to by dest. After the call, source points to
+/// uninitialized storage.
+///
+/// \details If T is trivially relocatable, the object representation is
+/// copied bytewise. Otherwise equivalent to construct_at(dest, move(*source))
+/// followed by destroy_at(source).
+///
+/// https://wg21.link/p1144
+template <typename T>
+constexpr auto relocate_at(T* source, T* dest) -> T*
+{
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (!is_constant_evaluated()) {
+            etl::memmove(dest, source, sizeof(T));
+            return dest;
+        }
+    }
+
+    auto* result = etl::construct_at(dest, etl::move(*source));
+    etl::destroy_at(source);
+    return result;
+}
+
+namespace detail {
+
+/// \brief Exchanges lhs and rhs by swapping their object representations
+/// through a temporary buffer. Must not be called during constant
+/// evaluation.
+template <typename T>
+auto trivially_relocating_swap(T& lhs, T& rhs) noexcept -> void
+{
+    static_assert(is_trivially_relocatable_v<T>);
+    alignas(T) unsigned char tmp[sizeof(T)];
+    etl::memcpy(tmp, etl::addressof(lhs), sizeof(T));
+    etl::memcpy(etl::addressof(lhs), etl::addressof(rhs), sizeof(T));
+    etl::memcpy(etl::addressof(rhs), tmp, sizeof(T));
+}
+
+} // namespace detail
+
+} // namespace etl
+
+#endif // TETL_MEMORY_RELOCATE_AT_HPP
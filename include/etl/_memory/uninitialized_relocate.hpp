@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MEMORY_UNINITIALIZED_RELOCATE_HPP
+#define TETL_MEMORY_UNINITIALIZED_RELOCATE_HPP
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstring/memmove.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_memory/relocate_at.hpp"
+#include "etl/_type_traits/is_const.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_pointer.hpp"
+#include "etl/_type_traits/is_same.hpp"
+#include "etl/_type_traits/is_trivially_relocatable.hpp"
+#include "etl/_type_traits/remove_pointer.hpp"
+
+namespace etl {
+
+namespace detail {
+
+template <typename InputIt, typename ForwardIt>
+inline constexpr bool can_relocate_bytewise = [] {
+    if constexpr (is_pointer_v<InputIt> && is_same_v<InputIt, ForwardIt>) {
+        using value_type = remove_pointer_t<InputIt>;
+        return !is_const_v<value_type> && is_trivially_relocatable_v<value_type>;
+    } else {
+        return false;
+    }
+}();
+
+} // namespace detail
+
+/// \brief Relocates the elements from the range [first, last) to the
+/// uninitialized memory area beginning at dest. After the call, the source
+/// range holds uninitialized storage.
+///
+/// \details Contiguous ranges of trivially relocatable types are relocated
+/// with a single memmove, in which case the ranges may overlap in any way.
+/// Otherwise elements are relocated one by one with relocate_at from front to
+/// back, so dest must not be in the range (first, last).
+///
+/// \returns Iterator to the element past the last element relocated.
+///
+/// https://wg21.link/p1144
+template <typename InputIt, typename NoThrowForwardIt>
+constexpr auto uninitialized_relocate(InputIt first, InputIt last, NoThrowForwardIt dest) -> NoThrowForwardIt
+{
+    if constexpr (detail::can_relocate_bytewise<InputIt, NoThrowForwardIt>) {
+        if (!is_constant_evaluated()) {
+            auto const count = static_cast<size_t>(last - first);
+            etl::memmove(dest, first, count * sizeof(*first));
+            return dest + count;
+        }
+    }
+
+    for (; first != last; ++first, (void)++dest) { etl::relocate_at(etl::addressof(*first), etl::addressof(*dest)); }
+    return dest;
+}
+
+} // namespace etl
+
+#endif // TETL_MEMORY_UNINITIALIZED_RELOCATE_HPP
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_MEMORY_UNINITIALIZED_RELOCATE_BACKWARD_HPP
+#define TETL_MEMORY_UNINITIALIZED_RELOCATE_BACKWARD_HPP
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstring/memmove.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_memory/relocate_at.hpp"
+#include "etl/_memory/uninitialized_relocate.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+
+namespace etl {
+
+/// \brief Relocates the elements from the range [first, last) to the
+/// uninitialized memory area ending at destLast. The elements are relocated
+/// in reverse order (the last element is relocated first). After the call,
+/// the source range holds uninitialized storage.
+///
+/// \details Contiguous ranges of trivially relocatable types are relocated
+/// with a single memmove. Otherwise elements are relocated one by one with
+/// relocate_at from back to front, so destLast must not be in the range
+/// (first, last).
+///
+/// \returns Iterator to the first element relocated.
+///
+/// https://wg21.link/p1144
+template <typename BidirIt1, typename BidirIt2>
+constexpr auto uninitialized_relocate_backward(BidirIt1 first, BidirIt1 last, BidirIt2 destLast) -> BidirIt2
+{
+    if constexpr (detail::can_relocate_bytewise<BidirIt1, BidirIt2>) {
+        if (!is_constant_evaluated()) {
+            auto const count = static_cast<size_t>(last - first);
+            etl::memmove(destLast - count, first, count * sizeof(*first));
+            return destLast - count;
+        }
+    }
+
+    while (first != last) { etl::relocate_at(etl::addressof(*--last), etl::addressof(*--destLast)); }
+    return destLast;
+}
+
+} // namespace etl
+
+#endif // TETL_MEMORY_UNINITIALIZED_RELOCATE_BACKWARD_HPP
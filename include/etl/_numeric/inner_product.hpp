@@ -2,6 +2,11 @@
 #ifndef TETL_NUMERIC_INNER_PRODUCT_HPP
 #define TETL_NUMERIC_INNER_PRODUCT_HPP
 
+#include "etl/_iterator/iterator_traits.hpp"
+#include "etl/_numeric/transform_reduce.hpp"
+#include "etl/_type_traits/decay.hpp"
+#include "etl/_type_traits/is_integral.hpp"
+#include "etl/_type_traits/is_same.hpp"
 #include "etl/_utility/move.hpp"
 
 namespace etl {
@@ -9,9 +14,19 @@ namespace etl {
 /// \brief Computes inner product (i.e. sum of products) or performs ordered
 /// map/reduce operation on the range [first1, last1) and the range beginning at
 /// first2.
+///
+/// \details Integer sums don't depend on the order of the additions. If the
+/// elements, their products and init are integers, the unrolled or simd path
+/// of transform_reduce is used.
 template <typename InputIt1, typename InputIt2, typename T>
 [[nodiscard]] constexpr auto inner_product(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init) -> T
 {
+    using product_t = decay_t<decltype(*first1 * *first2)>;
+    if constexpr (is_integral_v<T> and not is_same_v<T, bool> and is_integral_v<product_t>
+                  and is_integral_v<typename iterator_traits<InputIt1>::value_type>
+                  and is_integral_v<typename iterator_traits<InputIt2>::value_type>) {
+        return etl::transform_reduce(first1, last1, first2, etl::move(init));
+    }
     for (; first1 != last1; ++first1, ++first2) { init = etl::move(init) + *first1 * *first2; }
     return init;
 }
@@ -2,18 +2,152 @@
 #ifndef TETL_NUMERIC_REDUCE_HPP
 #define TETL_NUMERIC_REDUCE_HPP
 
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_functional/multiplies.hpp"
 #include "etl/_functional/plus.hpp"
 #include "etl/_iterator/iterator_traits.hpp"
 #include "etl/_numeric/accumulate.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/reduce.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_type_traits/conditional.hpp"
+#include "etl/_type_traits/is_arithmetic.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_integral.hpp"
+#include "etl/_type_traits/is_pointer.hpp"
+#include "etl/_type_traits/is_same.hpp"
 #include "etl/_utility/move.hpp"
 
 namespace etl {
 
-/// \brief Similar to etl::accumulate.
+namespace detail {
+
+template <typename Op, typename T>
+inline constexpr bool reduce_is_plus = is_same_v<Op, plus<>> or is_same_v<Op, plus<T>>;
+
+template <typename Op, typename T>
+inline constexpr bool reduce_is_multiplies = is_same_v<Op, multiplies<>> or is_same_v<Op, multiplies<T>>;
+
+/// \brief Elements of type U can be converted to T one by one without
+/// changing the result. Integers wrap, so their order never matters. Mixed
+/// floating-point types would round or truncate each element on its own.
+template <typename T, typename U>
+inline constexpr bool reduce_same_domain
+    = is_same_v<T, U> or (is_integral_v<T> and is_integral_v<U> and not is_same_v<T, bool>);
+
+/// \brief Op is known to be associative and commutative on T, so the elements
+/// may be combined in any order. User provided operations keep the order of
+/// accumulate.
+template <typename Op, typename T, typename U>
+inline constexpr bool reduce_can_reorder = is_arithmetic_v<T> and is_arithmetic_v<U> and reduce_same_domain<T, U>
+                                       and (reduce_is_plus<Op, T> or reduce_is_multiplies<Op, T>);
+
+/// \brief Elements of type U can be combined in native_simd<T> lanes.
+template <typename Op, typename T, typename U>
+inline constexpr bool reduce_use_simd = reduce_can_reorder<Op, T, U> and is_same_v<T, U> and is_vectorizable_v<T>;
+
+/// \brief Combines init with elem(0), ..., elem(n - 1) using four independent
+/// accumulators, so consecutive operations don't wait on each other.
+///
+/// \details Integers narrower than int are accumulated in unsigned int, the
+/// result is the same modulo 2^N. This also avoids wrong code from the GCC 12
+/// vectorizer for widening sums of signed char and short (GCC PR 108950).
+template <typename T, typename Op, typename Elem>
+[[nodiscard]] constexpr auto reduce_unrolled(size_t n, T init, Op op, Elem elem) -> T
+{
+    using acc_t = conditional_t<is_integral_v<T> and sizeof(T) < sizeof(int), unsigned, T>;
+
+    auto const combine = [op] {
+        if constexpr (is_same_v<acc_t, T>) {
+            return op;
+        } else {
+            return conditional_t<reduce_is_plus<Op, T>, plus<>, multiplies<>> {};
+        }
+    }();
+    auto const blocks  = n - n % 4;
+    auto i             = size_t { 0 };
+    auto result        = static_cast<acc_t>(init);
+    if (blocks != 0) {
+        auto a0 = static_cast<acc_t>(elem(0));
+        auto a1 = static_cast<acc_t>(elem(1));
+        auto a2 = static_cast<acc_t>(elem(2));
+        auto a3 = static_cast<acc_t>(elem(3));
+        for (i = 4; i != blocks; i += 4) {
+            a0 = static_cast<acc_t>(combine(a0, static_cast<acc_t>(elem(i + 0))));
+            a1 = static_cast<acc_t>(combine(a1, static_cast<acc_t>(elem(i + 1))));
+            a2 = static_cast<acc_t>(combine(a2, static_cast<acc_t>(elem(i + 2))));
+            a3 = static_cast<acc_t>(combine(a3, static_cast<acc_t>(elem(i + 3))));
+        }
+        auto const lo = static_cast<acc_t>(combine(a0, a1));
+        auto const hi = static_cast<acc_t>(combine(a2, a3));
+        result        = static_cast<acc_t>(combine(result, static_cast<acc_t>(combine(lo, hi))));
+    }
+    for (; i < n; ++i) { result = static_cast<acc_t>(combine(result, static_cast<acc_t>(elem(i)))); }
+    return static_cast<T>(result);
+}
+
+/// \brief Combines init with elem(0), ..., elem(n - 1) in native_simd<T>
+/// lanes. load(i) returns the simd of elements [i, i + lanes). Four vector
+/// accumulators hide the latency of the vector add or multiply.
+template <typename T, typename Op, typename Load, typename Elem>
+[[nodiscard]] auto reduce_simd(size_t n, T init, Op op, Load load, Elem elem) -> T
+{
+    using simd_t  = native_simd<T>;
+    using simd_op = conditional_t<reduce_is_plus<Op, T>, plus<>, multiplies<>>;
+
+    constexpr auto lanes = simd_t::size();
+    auto const identity  = simd_t { reduce_is_plus<Op, T> ? T(0) : T(1) };
+    auto const combine   = simd_op {};
+    auto a0              = identity;
+    auto a1              = identity;
+    auto a2              = identity;
+    auto a3              = identity;
+    auto i               = size_t { 0 };
+
+    auto const blocks = n - n % (4 * lanes);
+    for (; i != blocks; i += 4 * lanes) {
+        a0 = combine(a0, load(i + 0 * lanes));
+        a1 = combine(a1, load(i + 1 * lanes));
+        a2 = combine(a2, load(i + 2 * lanes));
+        a3 = combine(a3, load(i + 3 * lanes));
+    }
+    for (; i + lanes <= n; i += lanes) { a0 = combine(a0, load(i)); }
+
+    auto result = etl::reduce(combine(combine(a0, a1), combine(a2, a3)), combine);
+    for (; i < n; ++i) { result = static_cast<T>(op(result, elem(i))); }
+    return static_cast<T>(op(etl::move(init), result));
+}
+
+} // namespace detail
+
+/// \brief Similar to etl::accumulate, but the elements may be combined in any
+/// order, so op must be associative and commutative.
+///
+/// \details For plus and multiplies on arithmetic types over a contiguous
+/// range (pointers), the runtime path uses multiple accumulators or simd lanes.
+/// Floating-point results may differ from accumulate in the last bits.
+/// Custom operations and constant evaluation combine the elements in order.
+///
 /// https://en.cppreference.com/w/cpp/algorithm/reduce
 template <typename InputIter, typename T, typename BinaryOp>
 [[nodiscard]] constexpr auto reduce(InputIter first, InputIter last, T init, BinaryOp op) -> T
 {
+    if constexpr (is_pointer_v<InputIter>) {
+        using value_type = typename iterator_traits<InputIter>::value_type;
+        if constexpr (detail::reduce_can_reorder<BinaryOp, T, value_type>) {
+            if (not is_constant_evaluated()) {
+                auto const n    = static_cast<size_t>(last - first);
+                auto const elem = [first](size_t i) { return first[i]; };
+                if constexpr (detail::reduce_use_simd<BinaryOp, T, value_type>) {
+                    auto const load = [first](size_t i) { return native_simd<T> { first + i, element_aligned }; };
+                    return detail::reduce_simd(n, etl::move(init), op, load, elem);
+                } else {
+                    return detail::reduce_unrolled(n, etl::move(init), op, elem);
+                }
+            }
+        }
+    }
     return accumulate(first, last, init, op);
 }
 
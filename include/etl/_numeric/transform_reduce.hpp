@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSL-1.0
+#ifndef TETL_NUMERIC_TRANSFORM_REDUCE_HPP
+#define TETL_NUMERIC_TRANSFORM_REDUCE_HPP
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_functional/multiplies.hpp"
+#include "etl/_functional/plus.hpp"
+#include "etl/_iterator/iterator_traits.hpp"
+#include "etl/_numeric/reduce.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_type_traits/decay.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_pointer.hpp"
+#include "etl/_type_traits/is_same.hpp"
+#include "etl/_utility/move.hpp"
+
+namespace etl {
+
+/// \brief Applies transform to each pair of elements from the ranges
+/// [first1, last1) and [first2, ...) and reduces the results (possibly
+/// permuted and aggregated in unspecified manner) along with the initial value
+/// init over reduce.
+///
+/// \details For plus as reduce on arithmetic types over contiguous ranges
+/// (pointers), the runtime path uses multiple accumulators. A dot product
+/// (plus and multiplies on equal types) runs in simd lanes.
+///
+/// https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+template <typename InputIt1, typename InputIt2, typename T, typename BinaryReductionOp, typename BinaryTransformOp>
+[[nodiscard]] constexpr auto transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+    BinaryReductionOp reduce, BinaryTransformOp transform) -> T
+{
+    if constexpr (is_pointer_v<InputIt1> and is_pointer_v<InputIt2>) {
+        using value_type1 = typename iterator_traits<InputIt1>::value_type;
+        using value_type2 = typename iterator_traits<InputIt2>::value_type;
+        using result_type = decay_t<decltype(transform(*first1, *first2))>;
+        if constexpr (detail::reduce_can_reorder<BinaryReductionOp, T, result_type>) {
+            if (not is_constant_evaluated()) {
+                auto const n    = static_cast<size_t>(last1 - first1);
+                auto const elem = [=](size_t i) { return transform(first1[i], first2[i]); };
+
+                constexpr auto isDot = detail::reduce_is_plus<BinaryReductionOp, T>
+                                   and detail::reduce_is_multiplies<BinaryTransformOp, T>
+                                   and is_same_v<value_type1, T> and is_same_v<value_type2, T>;
+                if constexpr (isDot and detail::reduce_use_simd<BinaryReductionOp, T, T>) {
+                    auto const load = [=](size_t i) {
+                        auto const a = native_simd<T> { first1 + i, element_aligned };
+                        auto const b = native_simd<T> { first2 + i, element_aligned };
+                        return a * b;
+                    };
+                    return detail::reduce_simd(n, etl::move(init), reduce, load, elem);
+                } else {
+                    return detail::reduce_unrolled(n, etl::move(init), reduce, elem);
+                }
+            }
+        }
+    }
+
+    for (; first1 != last1; ++first1, ++first2) { init = reduce(etl::move(init), transform(*first1, *first2)); }
+    return init;
+}
+
+/// \brief Sum of the products of the elements of [first1, last1) and
+/// [first2, ...), added to init. Like inner_product, but in unspecified order.
+///
+/// https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+template <typename InputIt1, typename InputIt2, typename T>
+[[nodiscard]] constexpr auto transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init) -> T
+{
+    return etl::transform_reduce(first1, last1, first2, etl::move(init), plus<>(), multiplies<>());
+}
+
+/// \brief Applies transform to each element in the range [first, last) and
+/// reduces the results (possibly permuted and aggregated in unspecified
+/// manner) along with the initial value init over reduce.
+///
+/// https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+template <typename InputIt, typename T, typename BinaryReductionOp, typename UnaryTransformOp>
+[[nodiscard]] constexpr auto transform_reduce(
+    InputIt first, InputIt last, T init, BinaryReductionOp reduce, UnaryTransformOp transform) -> T
+{
+    if constexpr (is_pointer_v<InputIt>) {
+        using result_type = decay_t<decltype(transform(*first))>;
+        if constexpr (detail::reduce_can_reorder<BinaryReductionOp, T, result_type>) {
+            if (not is_constant_evaluated()) {
+                auto const n    = static_cast<size_t>(last - first);
+                auto const elem = [=](size_t i) { return transform(first[i]); };
+                return detail::reduce_unrolled(n, etl::move(init), reduce, elem);
+            }
+        }
+    }
+
+    for (; first != last; ++first) { init = reduce(etl::move(init), transform(*first)); }
+    return init;
+}
+
+} // namespace etl
+
+#endif // TETL_NUMERIC_TRANSFORM_REDUCE_HPP
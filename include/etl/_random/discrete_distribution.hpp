@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_DISCRETE_DISTRIBUTION_HPP
+#define TETL_RANDOM_DISCRETE_DISTRIBUTION_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_container/smallest_size_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_math/mul_wide.hpp"
+#include "etl/_random/uniform_int_distribution.hpp"
+#include "etl/_random/ziggurat.hpp"
+#include "etl/_vector/static_vector.hpp"
+
+namespace etl {
+
+/// \brief Produces random integers in [0, n), where the probability of each
+/// integer i is the weight w_i divided by the sum of all n weights. At most
+/// Capacity weights are stored inline.
+///
+/// \details Sampling takes constant time with Walker's alias table: each of
+/// the n columns holds the probability of its own index and the alias, which
+/// fills the rest of the column. The high half of the product of a 64-bit draw
+/// and n selects the column without bias (Lemire), the low half is uniformly
+/// distributed within the column and decides between the index and its
+/// alias. The table is built in O(n) with Vose's method.
+///
+/// Michael D. Vose, "A Linear Algorithm for Generating Random Numbers with a
+/// Given Distribution", IEEE Transactions on Software Engineering 17 (9), 1991.
+///
+/// https://en.cppreference.com/w/cpp/numeric/random/discrete_distribution
+template <typename IntType, size_t Capacity>
+struct discrete_distribution {
+    static_assert(Capacity > 0, "discrete_distribution: Capacity must not be 0");
+
+    using result_type = IntType;
+
+    struct param_type {
+        using distribution_type = discrete_distribution;
+
+        /// \brief A single weight, the distribution always produces 0.
+        constexpr param_type() noexcept
+        {
+            double const weight = 1.0;
+            build(&weight, &weight + 1);
+        }
+
+        template <typename InputIt>
+        constexpr param_type(InputIt first, InputIt last) noexcept
+        {
+            build(first, last);
+        }
+
+        /// \brief Weight i is op(xmin + (i + 0.5) * (xmax - xmin) / count).
+        template <typename UnaryOperation>
+        constexpr param_type(size_t count, double xmin, double xmax, UnaryOperation op) noexcept
+        {
+            TETL_ASSERT(count <= Capacity);
+
+            double weights[Capacity] {};
+            auto const n     = count == 0 ? size_t(1) : count;
+            auto const delta = (xmax - xmin) / static_cast<double>(n);
+            for (size_t i = 0; i < n; ++i) {
+                weights[i] = static_cast<double>(op(xmin + (static_cast<double>(i) + 0.5) * delta));
+            }
+            build(&weights[0], &weights[0] + n);
+        }
+
+        [[nodiscard]] constexpr auto probabilities() const -> static_vector<double, Capacity>
+        {
+            auto result = static_vector<double, Capacity> {};
+            for (size_t i = 0; i < _size; ++i) { result.push_back(_probabilities[i]); }
+            return result;
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(param_type const& lhs, param_type const& rhs) noexcept -> bool
+        {
+            if (lhs._size != rhs._size) { return false; }
+            for (size_t i = 0; i < lhs._size; ++i) {
+                if (lhs._probabilities[i] != rhs._probabilities[i]) { return false; }
+            }
+            return true;
+        }
+
+    private:
+        friend discrete_distribution;
+
+        using index_type = smallest_size_t<Capacity>;
+
+        [[nodiscard]] static constexpr auto to_threshold(double p) noexcept -> uint64_t
+        {
+            if (p >= 1.0) { return numeric_limits<uint64_t>::max(); }
+            return static_cast<uint64_t>(p * 0x1.0p64);
+        }
+
+        template <typename InputIt>
+        constexpr auto build(InputIt first, InputIt last) noexcept -> void
+        {
+            auto sum = 0.0;
+            for (; first != last; ++first) {
+                TETL_ASSERT(_size < Capacity);
+                _probabilities[_size] = static_cast<double>(*first);
+                sum += _probabilities[_size];
+                ++_size;
+            }
+
+            // no weights or all zero, same as std::discrete_distribution
+            if (_size == 0 or sum <= 0.0) {
+                _size             = 1;
+                _probabilities[0] = 1.0;
+                sum               = 1.0;
+            }
+
+            auto const n = static_cast<double>(_size);
+            double scaled[Capacity] {};
+            index_type small[Capacity] {};
+            index_type large[Capacity] {};
+            auto num_small = size_t(0);
+            auto num_large = size_t(0);
+
+            for (size_t i = 0; i < _size; ++i) {
+                _probabilities[i] /= sum;
+                scaled[i] = _probabilities[i] * n;
+                if (scaled[i] < 1.0) {
+                    small[num_small++] = static_cast<index_type>(i);
+                } else {
+                    large[num_large++] = static_cast<index_type>(i);
+                }
+            }
+
+            while (num_small > 0 and num_large > 0) {
+                auto const s = small[--num_small];
+                auto const l = large[num_large - 1];
+
+                _threshold[s] = to_threshold(scaled[s]);
+                _alias[s]     = l;
+
+                scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+                if (scaled[l] < 1.0) {
+                    --num_large;
+                    small[num_small++] = l;
+                }
+            }
+
+            // the remaining columns are full, up to rounding errors
+            while (num_large > 0) { fill_column(large[--num_large]); }
+            while (num_small > 0) { fill_column(small[--num_small]); }
+        }
+
+        constexpr auto fill_column(index_type i) noexcept -> void
+        {
+            _threshold[i] = numeric_limits<uint64_t>::max();
+            _alias[i]     = i;
+        }
+
+        size_t _size { 0 };
+        double _probabilities[Capacity] {};
+        uint64_t _threshold[Capacity] {};
+        index_type _alias[Capacity] {};
+    };
+
+    constexpr discrete_distribution() = default;
+
+    explicit constexpr discrete_distribution(param_type const& parm) : param_ { parm } { }
+
+    template <typename InputIt>
+    constexpr discrete_distribution(InputIt first, InputIt last) : param_ { first, last }
+    {
+    }
+
+    template <typename UnaryOperation>
+    constexpr discrete_distribution(size_t count, double xmin, double xmax, UnaryOperation op)
+        : param_ { count, xmin, xmax, op }
+    {
+    }
+
+    constexpr auto param(param_type const& parm) -> void { param_ = parm; }
+    [[nodiscard]] constexpr auto param() const -> param_type { return param_; }
+
+    [[nodiscard]] constexpr auto probabilities() const -> static_vector<double, Capacity>
+    {
+        return param_.probabilities();
+    }
+
+    [[nodiscard]] constexpr auto min() const -> result_type { return result_type(0); }
+    [[nodiscard]] constexpr auto max() const -> result_type { return static_cast<result_type>(param_._size - 1); }
+
+    constexpr auto reset() -> void { (void)this; }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g) noexcept(noexcept(g())) -> result_type
+    {
+        return (*this)(g, param_);
+    }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g, param_type const& parm) noexcept(noexcept(g())) -> result_type
+    {
+        auto const n = static_cast<uint64_t>(parm._size);
+        auto m       = detail::mul_wide(detail::random_bits64(g), n);
+        if (m.lo < n) {
+            auto const threshold = detail::lemire_threshold(n);
+            while (m.lo < threshold) { m = detail::mul_wide(detail::random_bits64(g), n); }
+        }
+
+        auto const column = static_cast<size_t>(m.hi);
+        auto const index  = m.lo < parm._threshold[column] ? column : static_cast<size_t>(parm._alias[column]);
+        return static_cast<result_type>(index);
+    }
+
+    friend constexpr auto operator==(discrete_distribution const& x, discrete_distribution const& y) -> bool
+    {
+        return x.param() == y.param();
+    }
+
+private:
+    param_type param_;
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_DISCRETE_DISTRIBUTION_HPP
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+#define TETL_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
+
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/ziggurat.hpp"
+
+namespace etl {
+
+/// \brief Produces random non-negative floating-point values x, distributed
+/// according to the probability density function p(x) = lambda * e^(-lambda * x).
+///
+/// \details Samples are computed with the Ziggurat method, see
+/// normal_distribution.
+///
+/// https://en.cppreference.com/w/cpp/numeric/random/exponential_distribution
+template <typename RealType = double>
+struct exponential_distribution {
+    using result_type = RealType;
+
+    struct param_type {
+        using distribution_type = exponential_distribution;
+
+        constexpr param_type() noexcept = default;
+        explicit constexpr param_type(result_type lambda) noexcept : _lambda { lambda } { }
+
+        [[nodiscard]] constexpr auto lambda() const noexcept -> result_type { return _lambda; }
+
+        [[nodiscard]] friend constexpr auto operator==(param_type const& lhs, param_type const& rhs) noexcept -> bool
+        {
+            return lhs._lambda == rhs._lambda;
+        }
+
+    private:
+        result_type _lambda { 1 };
+    };
+
+    constexpr exponential_distribution() : exponential_distribution { result_type(1) } { }
+
+    explicit constexpr exponential_distribution(param_type const& parm) : param_ { parm } { }
+
+    explicit constexpr exponential_distribution(result_type lambda) : exponential_distribution { param_type { lambda } }
+    {
+    }
+
+    constexpr auto param(param_type const& parm) -> void { param_ = parm; }
+    [[nodiscard]] constexpr auto param() const -> param_type { return param_; }
+
+    [[nodiscard]] constexpr auto lambda() const -> result_type { return param_.lambda(); }
+
+    [[nodiscard]] constexpr auto min() const -> result_type { return result_type(0); }
+    [[nodiscard]] constexpr auto max() const -> result_type { return numeric_limits<result_type>::max(); }
+
+    constexpr auto reset() -> void { (void)this; }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g) noexcept(noexcept(g())) -> result_type
+    {
+        return (*this)(g, param_);
+    }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g, param_type const& parm) noexcept(noexcept(g())) -> result_type
+    {
+        return static_cast<result_type>(detail::ziggurat_exponential(g)) / parm.lambda();
+    }
+
+    friend constexpr auto operator==(exponential_distribution const& x, exponential_distribution const& y) -> bool
+    {
+        return x.param() == y.param();
+    }
+
+private:
+    param_type param_;
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_EXPONENTIAL_DISTRIBUTION_HPP
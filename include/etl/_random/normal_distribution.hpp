@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_NORMAL_DISTRIBUTION_HPP
+#define TETL_RANDOM_NORMAL_DISTRIBUTION_HPP
+
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/ziggurat.hpp"
+
+namespace etl {
+
+/// \brief Generates random numbers according to the normal (Gaussian)
+/// distribution with the given mean and standard deviation.
+///
+/// \details Samples are computed with the Ziggurat method from tables that are
+/// generated at compile-time. Almost all calls need a single 64-bit draw and
+/// no call to exp, log or sqrt.
+///
+/// https://en.cppreference.com/w/cpp/numeric/random/normal_distribution
+template <typename RealType = double>
+struct normal_distribution {
+    using result_type = RealType;
+
+    struct param_type {
+        using distribution_type = normal_distribution;
+
+        constexpr param_type() noexcept = default;
+        explicit constexpr param_type(result_type mean, result_type stddev = result_type(1)) noexcept
+            : _mean { mean }, _stddev { stddev }
+        {
+        }
+
+        [[nodiscard]] constexpr auto mean() const noexcept -> result_type { return _mean; }
+        [[nodiscard]] constexpr auto stddev() const noexcept -> result_type { return _stddev; }
+
+        [[nodiscard]] friend constexpr auto operator==(param_type const& lhs, param_type const& rhs) noexcept -> bool
+        {
+            return (lhs._mean == rhs._mean) and (lhs._stddev == rhs._stddev);
+        }
+
+    private:
+        result_type _mean { 0 };
+        result_type _stddev { 1 };
+    };
+
+    constexpr normal_distribution() : normal_distribution { result_type(0) } { }
+
+    explicit constexpr normal_distribution(param_type const& parm) : param_ { parm } { }
+
+    explicit constexpr normal_distribution(result_type mean, result_type stddev = result_type(1))
+        : normal_distribution { param_type { mean, stddev } }
+    {
+    }
+
+    constexpr auto param(param_type const& parm) -> void { param_ = parm; }
+    [[nodiscard]] constexpr auto param() const -> param_type { return param_; }
+
+    [[nodiscard]] constexpr auto mean() const -> result_type { return param_.mean(); }
+    [[nodiscard]] constexpr auto stddev() const -> result_type { return param_.stddev(); }
+
+    [[nodiscard]] constexpr auto min() const -> result_type { return numeric_limits<result_type>::lowest(); }
+    [[nodiscard]] constexpr auto max() const -> result_type { return numeric_limits<result_type>::max(); }
+
+    constexpr auto reset() -> void { (void)this; }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g) noexcept(noexcept(g())) -> result_type
+    {
+        return (*this)(g, param_);
+    }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g, param_type const& parm) noexcept(noexcept(g())) -> result_type
+    {
+        auto const z = static_cast<result_type>(detail::ziggurat_normal(g));
+        return parm.mean() + z * parm.stddev();
+    }
+
+    friend constexpr auto operator==(normal_distribution const& x, normal_distribution const& y) -> bool
+    {
+        return x.param() == y.param();
+    }
+
+private:
+    param_type param_;
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_NORMAL_DISTRIBUTION_HPP
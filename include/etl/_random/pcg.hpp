@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_PCG_HPP
+#define TETL_RANDOM_PCG_HPP
+
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_math/mul_wide.hpp"
+
+namespace etl::detail {
+
+/// \brief Minimal unsigned 128-bit arithmetic for the pcg64 state. Wraps
+/// around like the builtin unsigned types.
+struct pcg_uint128 {
+    uint64_t hi { 0 };
+    uint64_t lo { 0 };
+
+    constexpr pcg_uint128() = default;
+    constexpr pcg_uint128(uint64_t high, uint64_t low) noexcept : hi { high }, lo { low } { }
+    explicit constexpr pcg_uint128(uint64_t low) noexcept : lo { low } { }
+
+    [[nodiscard]] friend constexpr auto operator+(pcg_uint128 a, pcg_uint128 b) noexcept -> pcg_uint128
+    {
+        auto const lo = a.lo + b.lo;
+        return { a.hi + b.hi + static_cast<uint64_t>(lo < a.lo), lo };
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(pcg_uint128 a, pcg_uint128 b) noexcept -> pcg_uint128
+    {
+        auto const r = mul_wide(a.lo, b.lo);
+        return { r.hi + a.hi * b.lo + a.lo * b.hi, r.lo };
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(pcg_uint128 a, pcg_uint128 b) noexcept -> bool
+    {
+        return a.hi == b.hi and a.lo == b.lo;
+    }
+};
+
+/// \brief Advances the LCG state = state * mult + inc by delta steps in
+/// O(log(delta)).
+///
+/// Forrest B. Brown, "Random Number Generation with Arbitrary Strides",
+/// Transactions of the American Nuclear Society, 1994.
+template <typename UInt>
+[[nodiscard]] constexpr auto lcg_advance(UInt state, UInt mult, UInt inc, unsigned long long delta) noexcept -> UInt
+{
+    auto acc_mult = UInt(1);
+    auto acc_plus = UInt(0);
+    while (delta > 0) {
+        if ((delta & 1U) != 0) {
+            acc_mult = acc_mult * mult;
+            acc_plus = acc_plus * mult + inc;
+        }
+        inc  = (mult + UInt(1)) * inc;
+        mult = mult * mult;
+        delta >>= 1U;
+    }
+    return acc_mult * state + acc_plus;
+}
+
+} // namespace etl::detail
+
+#endif // TETL_RANDOM_PCG_HPP
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_PCG32_HPP
+#define TETL_RANDOM_PCG32_HPP
+
+#include "etl/_bit/rotr.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/pcg.hpp"
+
+namespace etl {
+
+/// \brief PCG-XSH-RR with 64 bits of state and 32-bit output. Each stream
+/// selects one of 2^63 distinct sequences with a period of 2^64, and discard
+/// skips ahead in logarithmic time.
+///
+/// https://www.pcg-random.org
+struct pcg32 {
+    using result_type                    = uint32_t;
+    static constexpr auto default_seed   = uint64_t { 0xCAFEF00DD15EA5E5ULL };
+    static constexpr auto default_stream = uint64_t { 0x14057B7EF767814FULL >> 1U };
+
+    constexpr pcg32() noexcept : pcg32 { default_seed } { }
+    explicit constexpr pcg32(uint64_t seed, uint64_t stream = default_stream) noexcept { this->seed(seed, stream); }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return numeric_limits<uint32_t>::min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint32_t>::max(); }
+
+    constexpr auto seed(uint64_t value = default_seed, uint64_t stream = default_stream) noexcept -> void
+    {
+        _inc   = (stream << 1U) | 1U;
+        _state = (value + _inc) * multiplier + _inc;
+    }
+
+    constexpr auto discard(unsigned long long z) noexcept -> void
+    {
+        _state = detail::lcg_advance(_state, multiplier, _inc, z);
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        auto const old = _state;
+        _state         = old * multiplier + _inc;
+
+        auto const xorshifted = static_cast<uint32_t>(((old >> 18U) ^ old) >> 27U);
+        return rotr(xorshifted, static_cast<int>(old >> 59U));
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(pcg32 const& lhs, pcg32 const& rhs) noexcept -> bool
+    {
+        return lhs._state == rhs._state and lhs._inc == rhs._inc;
+    }
+
+    [[nodiscard]] friend constexpr auto operator!=(pcg32 const& lhs, pcg32 const& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr auto multiplier = uint64_t { 6364136223846793005ULL };
+
+    uint64_t _state { 0 };
+    uint64_t _inc { 0 };
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_PCG32_HPP
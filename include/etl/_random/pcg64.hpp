@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_PCG64_HPP
+#define TETL_RANDOM_PCG64_HPP
+
+#include "etl/_bit/rotr.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/pcg.hpp"
+
+namespace etl {
+
+/// \brief PCG-XSL-RR with 128 bits of state and 64-bit output. Each stream
+/// selects one of 2^127 distinct sequences with a period of 2^128, and
+/// discard skips ahead in logarithmic time.
+///
+/// https://www.pcg-random.org
+struct pcg64 {
+    using result_type                    = uint64_t;
+    static constexpr auto default_seed   = uint64_t { 0xCAFEF00DD15EA5E5ULL };
+    static constexpr auto default_stream = uint64_t { 0x14057B7EF767814FULL >> 1U };
+
+    constexpr pcg64() noexcept : pcg64 { default_seed } { }
+    explicit constexpr pcg64(uint64_t seed, uint64_t stream = default_stream) noexcept { this->seed(seed, stream); }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return numeric_limits<uint64_t>::min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint64_t>::max(); }
+
+    /// \brief The 64-bit seed and stream are used for the low half of the
+    /// state and increment, like pcg64_srandom in the C reference.
+    constexpr auto seed(uint64_t value = default_seed, uint64_t stream = default_stream) noexcept -> void
+    {
+        _inc   = uint128 { stream >> 63U, (stream << 1U) | 1U };
+        _state = (uint128 { value } + _inc) * multiplier + _inc;
+    }
+
+    constexpr auto discard(unsigned long long z) noexcept -> void
+    {
+        _state = detail::lcg_advance(_state, multiplier, _inc, z);
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        _state = _state * multiplier + _inc;
+        return rotr(_state.hi ^ _state.lo, static_cast<int>(_state.hi >> 58U));
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(pcg64 const& lhs, pcg64 const& rhs) noexcept -> bool
+    {
+        return lhs._state == rhs._state and lhs._inc == rhs._inc;
+    }
+
+    [[nodiscard]] friend constexpr auto operator!=(pcg64 const& lhs, pcg64 const& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    using uint128 = detail::pcg_uint128;
+
+    static constexpr auto multiplier = uint128 { 2549297995355413924ULL, 4865540595714422341ULL };
+
+    uint128 _state {};
+    uint128 _inc {};
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_PCG64_HPP
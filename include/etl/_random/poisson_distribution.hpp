@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_POISSON_DISTRIBUTION_HPP
+#define TETL_RANDOM_POISSON_DISTRIBUTION_HPP
+
+#include "etl/_cmath/exp.hpp"
+#include "etl/_cmath/lgamma.hpp"
+#include "etl/_cmath/log.hpp"
+#include "etl/_cmath/sqrt.hpp"
+#include "etl/_cstdint/int_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/ziggurat.hpp"
+
+namespace etl {
+
+/// \brief Produces random non-negative integer values i, distributed
+/// according to the discrete probability function P(i|mean) = e^-mean * mean^i / i!
+///
+/// \details For mean < 12 the uniform samples are multiplied until the product
+/// drops below e^-mean, which needs mean + 1 draws on average. Larger means
+/// use the transformed rejection method PTRS, which needs about 1.2 pairs of
+/// draws independent of the mean. All logarithms and square roots of the mean
+/// are computed once, when the parameters are set.
+///
+/// W. Hörmann, "The Transformed Rejection Method for Generating Poisson
+/// Random Variables", Insurance: Mathematics and Economics 12 (1), 1993.
+///
+/// https://en.cppreference.com/w/cpp/numeric/random/poisson_distribution
+template <typename IntType = int>
+struct poisson_distribution {
+    using result_type = IntType;
+
+    struct param_type {
+        using distribution_type = poisson_distribution;
+
+        constexpr param_type() noexcept : param_type { 1.0 } { }
+
+        explicit constexpr param_type(double mean) noexcept : _mean { mean }
+        {
+            if (_mean < threshold) {
+                _exp_neg_mean = etl::exp(-_mean);
+            } else {
+                auto const slam = etl::sqrt(_mean);
+                _log_mean       = etl::log(_mean);
+                _b              = 0.931 + 2.53 * slam;
+                _a              = -0.059 + 0.02483 * _b;
+                _log_inv_alpha  = etl::log(1.1239 + 1.1328 / (_b - 3.4));
+                _vr             = 0.9277 - 3.6224 / (_b - 2.0);
+            }
+        }
+
+        [[nodiscard]] constexpr auto mean() const noexcept -> double { return _mean; }
+
+        [[nodiscard]] friend constexpr auto operator==(param_type const& lhs, param_type const& rhs) noexcept -> bool
+        {
+            return lhs._mean == rhs._mean;
+        }
+
+    private:
+        friend poisson_distribution;
+
+        static constexpr auto threshold = 12.0;
+
+        double _mean;
+        double _exp_neg_mean { 0.0 };
+        double _log_mean { 0.0 };
+        double _a { 0.0 };
+        double _b { 0.0 };
+        double _log_inv_alpha { 0.0 };
+        double _vr { 0.0 };
+    };
+
+    constexpr poisson_distribution() : poisson_distribution { 1.0 } { }
+
+    explicit constexpr poisson_distribution(param_type const& parm) : param_ { parm } { }
+
+    explicit constexpr poisson_distribution(double mean) : poisson_distribution { param_type { mean } } { }
+
+    constexpr auto param(param_type const& parm) -> void { param_ = parm; }
+    [[nodiscard]] constexpr auto param() const -> param_type { return param_; }
+
+    [[nodiscard]] constexpr auto mean() const -> double { return param_.mean(); }
+
+    [[nodiscard]] constexpr auto min() const -> result_type { return result_type(0); }
+    [[nodiscard]] constexpr auto max() const -> result_type { return numeric_limits<result_type>::max(); }
+
+    constexpr auto reset() -> void { (void)this; }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g) noexcept(noexcept(g())) -> result_type
+    {
+        return (*this)(g, param_);
+    }
+
+    template <typename URBG>
+    [[nodiscard]] constexpr auto operator()(URBG& g, param_type const& parm) noexcept(noexcept(g())) -> result_type
+    {
+        auto const uniform = [&g] { return detail::random_open01(detail::random_bits64(g)); };
+
+        if (parm._mean < param_type::threshold) {
+            auto k = result_type(0);
+            auto p = uniform();
+            while (p > parm._exp_neg_mean) {
+                ++k;
+                p *= uniform();
+            }
+            return k;
+        }
+
+        while (true) {
+            auto const u  = uniform() - 0.5;
+            auto const v  = uniform();
+            auto const us = 0.5 - (u < 0.0 ? -u : u);
+
+            auto const kf = (2.0 * parm._a / us + parm._b) * u + parm._mean + 0.43;
+            if (kf < 0.0) { continue; }
+            auto const k = static_cast<int64_t>(kf);
+
+            if (us >= 0.07 and v <= parm._vr) { return static_cast<result_type>(k); }
+            if (us < 0.013 and v > us) { continue; }
+
+            auto const x   = static_cast<double>(k);
+            auto const lhs = etl::log(v) + parm._log_inv_alpha - etl::log(parm._a / (us * us) + parm._b);
+            auto const rhs = -parm._mean + x * parm._log_mean - etl::lgamma(x + 1.0);
+            if (lhs <= rhs) { return static_cast<result_type>(k); }
+        }
+    }
+
+    friend constexpr auto operator==(poisson_distribution const& x, poisson_distribution const& y) -> bool
+    {
+        return x.param() == y.param();
+    }
+
+private:
+    param_type param_;
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_POISSON_DISTRIBUTION_HPP
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_SPLITMIX64_HPP
+#define TETL_RANDOM_SPLITMIX64_HPP
+
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+
+namespace etl {
+
+/// \brief 64-bit generator with a single word of state. Every seed, including
+/// 0, gives a full period sequence, so it is used to expand a single seed
+/// into the state of the xoshiro256 generators.
+///
+/// https://prng.di.unimi.it/splitmix64.c
+struct splitmix64 {
+    using result_type                  = uint64_t;
+    static constexpr auto default_seed = result_type { 5489U };
+
+    constexpr splitmix64() = default;
+    explicit constexpr splitmix64(result_type seed) noexcept : _state { seed } { }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return numeric_limits<uint64_t>::min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint64_t>::max(); }
+
+    constexpr auto seed(result_type value = default_seed) noexcept -> void { _state = value; }
+
+    /// \brief Constant time, the state is a counter.
+    constexpr auto discard(unsigned long long z) noexcept -> void { _state += z * increment; }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        auto z = (_state += increment);
+        z      = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        z      = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31U);
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(splitmix64 const& lhs, splitmix64 const& rhs) noexcept -> bool
+    {
+        return lhs._state == rhs._state;
+    }
+
+    [[nodiscard]] friend constexpr auto operator!=(splitmix64 const& lhs, splitmix64 const& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr auto increment = uint64_t { 0x9E3779B97F4A7C15ULL };
+
+    uint64_t _state { default_seed };
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_SPLITMIX64_HPP
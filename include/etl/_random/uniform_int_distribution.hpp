@@ -3,10 +3,150 @@
 #ifndef TETL_RANDOM_UNIFORM_INT_DISTRIBUTION_HPP
 #define TETL_RANDOM_UNIFORM_INT_DISTRIBUTION_HPP
 
+#include <etl/_cstdint/uint_t.hpp>
 #include <etl/_limits/numeric_limits.hpp>
+#include <etl/_math/mul_wide.hpp>
+#include <etl/_type_traits/make_unsigned.hpp>
 
 namespace etl {
 
+namespace detail {
+
+/// \brief Number of uniformly distributed bits returned by each call of g,
+/// if the generator covers the full 32 or 64 bit range, otherwise 0.
+template <typename URBG>
+[[nodiscard]] consteval auto urbg_word_bits() -> int
+{
+    constexpr auto range = static_cast<uint64_t>(URBG::max() - URBG::min());
+    if constexpr (range == numeric_limits<uint64_t>::max()) {
+        return 64;
+    } else if constexpr (range == numeric_limits<uint32_t>::max()) {
+        return 32;
+    } else {
+        return 0;
+    }
+}
+
+template <typename URBG>
+[[nodiscard]] constexpr auto urbg_next32(URBG& g) -> uint32_t
+{
+    if constexpr (urbg_word_bits<URBG>() == 32) {
+        return static_cast<uint32_t>(g() - URBG::min());
+    } else {
+        return static_cast<uint32_t>(static_cast<uint64_t>(g() - URBG::min()) >> 32U);
+    }
+}
+
+template <typename URBG>
+[[nodiscard]] constexpr auto urbg_next64(URBG& g) -> uint64_t
+{
+    if constexpr (urbg_word_bits<URBG>() == 64) {
+        return static_cast<uint64_t>(g() - URBG::min());
+    } else {
+        auto const hi = static_cast<uint64_t>(urbg_next32(g));
+        return (hi << 32U) | static_cast<uint64_t>(urbg_next32(g));
+    }
+}
+
+/// \brief 2^N mod s, where N is the width of UInt. Products with a low half
+/// below this threshold are rejected.
+template <typename UInt>
+[[nodiscard]] constexpr auto lemire_threshold(UInt s) noexcept -> UInt
+{
+    return static_cast<UInt>(static_cast<UInt>(UInt(0) - s) % s);
+}
+
+/// \brief Maps uniformly distributed words to [0, s) without bias.
+///
+/// \details The high half of word * s is the sample. It is biased only if the
+/// low half is below 2^N mod s, so the division computing the threshold is
+/// only needed if the low half is below s, which is rare for s much smaller
+/// than 2^N.
+///
+/// Daniel Lemire, "Fast Random Integer Generation in an Interval", ACM
+/// Transactions on Modeling and Computer Simulation 29 (1), 2019.
+/// https://arxiv.org/abs/1805.10941
+template <typename UInt, typename Next>
+[[nodiscard]] constexpr auto lemire_bounded(UInt s, Next next) -> UInt
+{
+    auto m = mul_wide(next(), s);
+    if (m.lo < s) {
+        auto const threshold = lemire_threshold(s);
+        while (m.lo < threshold) { m = mul_wide(next(), s); }
+    }
+    return m.hi;
+}
+
+/// \brief Same as lemire_bounded, but with a precomputed threshold.
+template <typename UInt, typename Next>
+[[nodiscard]] constexpr auto lemire_bounded(UInt s, UInt threshold, Next next) -> UInt
+{
+    auto m = mul_wide(next(), s);
+    while (m.lo < threshold) { m = mul_wide(next(), s); }
+    return m.hi;
+}
+
+/// \brief Returns a uniformly distributed value in [0, urange] for
+/// generators, that don't cover a full 32 or 64 bit range. Uses division.
+template <typename URBG>
+[[nodiscard]] constexpr auto uniform_int_fallback(URBG& g, uint64_t urange) -> uint64_t
+{
+    constexpr auto urbg_range = static_cast<uint64_t>(URBG::max() - URBG::min());
+
+    if (urbg_range > urange) {
+        auto const erange  = urange + 1;
+        auto const scaling = urbg_range / erange;
+        auto const past    = erange * scaling;
+        auto ret           = static_cast<uint64_t>(g() - URBG::min());
+        while (ret >= past) { ret = static_cast<uint64_t>(g() - URBG::min()); }
+        return ret / scaling;
+    }
+
+    if (urbg_range < urange) {
+        // Combine multiple calls: ret = hi * (urbg_range + 1) + lo
+        constexpr auto erange = urbg_range + 1;
+        auto ret              = uint64_t(0);
+        auto hi               = uint64_t(0);
+        do {
+            hi  = erange * uniform_int_fallback(g, urange / erange);
+            ret = hi + static_cast<uint64_t>(g() - URBG::min());
+        } while (ret > urange or ret < hi);
+        return ret;
+    }
+
+    return static_cast<uint64_t>(g() - URBG::min());
+}
+
+/// \brief Returns a uniformly distributed value in [0, urange].
+template <typename URBG>
+[[nodiscard]] constexpr auto uniform_int_sample(URBG& g, uint64_t urange) -> uint64_t
+{
+    if constexpr (urbg_word_bits<URBG>() == 0) {
+        return uniform_int_fallback(g, urange);
+    } else {
+        if (urange <= numeric_limits<uint32_t>::max()) {
+            auto const next = [&g] { return urbg_next32(g); };
+            if (urange == numeric_limits<uint32_t>::max()) { return next(); }
+            return lemire_bounded(static_cast<uint32_t>(urange + 1), next);
+        }
+
+        auto const next = [&g] { return urbg_next64(g); };
+        if (urange == numeric_limits<uint64_t>::max()) { return next(); }
+        return lemire_bounded(urange + 1, next);
+    }
+}
+
+} // namespace detail
+
+/// \brief Produces integer values evenly distributed across the closed
+/// interval [a, b].
+///
+/// \details For generators covering a full 32 or 64 bit range, values are
+/// computed with Lemire's multiply-shift rejection method, which is unbiased
+/// and needs no division in almost all calls. Other generators fall back to
+/// rejection sampling with a division per call.
+///
+/// https://en.cppreference.com/w/cpp/numeric/random/uniform_int_distribution
 template <typename IntType = int>
 struct uniform_int_distribution {
     using result_type = IntType;
@@ -62,8 +202,62 @@ struct uniform_int_distribution {
     template <typename URBG>
     [[nodiscard]] constexpr auto operator()(URBG& g, param_type const& parm) noexcept(noexcept(g())) -> result_type
     {
-        auto const range = static_cast<result_type>(parm.b() - parm.a());
-        return static_cast<result_type>(parm.a() + (g() % range));
+        auto const sample = detail::uniform_int_sample(g, urange(parm));
+        return static_cast<result_type>(static_cast<unsigned_type>(parm.a()) + static_cast<unsigned_type>(sample));
+    }
+
+    /// \brief Assigns a value of the distribution to each element of
+    /// [first, last).
+    ///
+    /// \details The rejection threshold is computed once for the whole range,
+    /// so no sample needs a division. 64-bit generators supply two samples
+    /// per call, if the range fits into 32 bits.
+    template <typename OutputIt, typename URBG>
+    constexpr auto generate(OutputIt first, OutputIt last, URBG& g) noexcept(noexcept(g())) -> void
+    {
+        generate(first, last, g, param_);
+    }
+
+    template <typename OutputIt, typename URBG>
+    constexpr auto generate(OutputIt first, OutputIt last, URBG& g, param_type const& parm) noexcept(noexcept(g()))
+        -> void
+    {
+        auto const a     = static_cast<unsigned_type>(parm.a());
+        auto const range = urange(parm);
+        auto const store = [a, &first](auto sample) {
+            *first = static_cast<result_type>(a + static_cast<unsigned_type>(sample));
+            ++first;
+        };
+
+        if constexpr (detail::urbg_word_bits<URBG>() == 0) {
+            while (first != last) { store(detail::uniform_int_fallback(g, range)); }
+        } else if (range < numeric_limits<uint32_t>::max()) {
+            auto const s         = static_cast<uint32_t>(range + 1);
+            auto const threshold = detail::lemire_threshold(s);
+            if constexpr (detail::urbg_word_bits<URBG>() == 64) {
+                auto buffer     = uint64_t(0);
+                auto buffered   = false;
+                auto const next = [&] {
+                    buffered = not buffered;
+                    if (buffered) {
+                        buffer = detail::urbg_next64(g);
+                        return static_cast<uint32_t>(buffer);
+                    }
+                    return static_cast<uint32_t>(buffer >> 32U);
+                };
+                while (first != last) { store(detail::lemire_bounded(s, threshold, next)); }
+            } else {
+                auto const next = [&g] { return detail::urbg_next32(g); };
+                while (first != last) { store(detail::lemire_bounded(s, threshold, next)); }
+            }
+        } else if (range < numeric_limits<uint64_t>::max()) {
+            auto const s         = range + 1;
+            auto const threshold = detail::lemire_threshold(s);
+            auto const next      = [&g] { return detail::urbg_next64(g); };
+            while (first != last) { store(detail::lemire_bounded(s, threshold, next)); }
+        } else {
+            while (first != last) { store(detail::urbg_next64(g)); }
+        }
     }
 
     friend constexpr auto operator==(uniform_int_distribution const& x, uniform_int_distribution const& y) -> bool
@@ -72,6 +266,16 @@ struct uniform_int_distribution {
     }
 
 private:
+    using unsigned_type = make_unsigned_t<result_type>;
+
+    [[nodiscard]] static constexpr auto urange(param_type const& parm) noexcept -> uint64_t
+    {
+        // cast again, because short operands are promoted to int
+        auto const b = static_cast<unsigned_type>(parm.b());
+        auto const a = static_cast<unsigned_type>(parm.a());
+        return static_cast<uint64_t>(static_cast<unsigned_type>(b - a));
+    }
+
     param_type param_;
 };
 
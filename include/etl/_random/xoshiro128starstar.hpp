@@ -20,7 +20,7 @@ struct xoshiro128starstar {
     explicit constexpr xoshiro128starstar(result_type seed) noexcept : _state { seed } { }
 
     [[nodiscard]] static constexpr auto min() noexcept -> result_type { return numeric_limits<uint32_t>::min(); }
-    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint32_t>::max() - 1; }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint32_t>::max(); }
 
     constexpr auto seed(result_type value = default_seed) noexcept -> void { _state[0] = value; }
 
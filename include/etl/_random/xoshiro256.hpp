@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_XOSHIRO256_HPP
+#define TETL_RANDOM_XOSHIRO256_HPP
+
+#include "etl/_bit/rotl.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_random/splitmix64.hpp"
+
+namespace etl::detail {
+
+/// \brief State transition and jump functions shared by the xoshiro256
+/// generators, which only differ in the output function.
+///
+/// https://prng.di.unimi.it/xoshiro256plusplus.c
+struct xoshiro256 {
+    /// \brief Equivalent to 2^128 calls, gives 2^128 non-overlapping streams.
+    static constexpr uint64_t jump_polynomial[4] {
+        0x180EC6D33CFD0ABAULL,
+        0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL,
+        0x39ABDC4529B1661CULL,
+    };
+
+    /// \brief Equivalent to 2^192 calls, gives 2^64 starting points, each
+    /// with 2^64 streams generated by jump.
+    static constexpr uint64_t long_jump_polynomial[4] {
+        0x76E15D3EFEFDCBBFULL,
+        0xC5004E441C522FB3ULL,
+        0x77710069854EE241ULL,
+        0x39109BB02ACBE635ULL,
+    };
+
+    /// \brief Expands a single word with splitmix64. The result is never all
+    /// zeros, which would be a fixed point.
+    static constexpr auto seed(uint64_t (&s)[4], uint64_t value) noexcept -> void
+    {
+        auto sm = splitmix64 { value };
+        for (auto& word : s) { word = sm(); }
+    }
+
+    static constexpr auto step(uint64_t (&s)[4]) noexcept -> void
+    {
+        auto const t = s[1] << 17U;
+
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+
+        s[2] ^= t;
+
+        s[3] = rotl(s[3], 45);
+    }
+
+    static constexpr auto jump(uint64_t (&s)[4], uint64_t const (&polynomial)[4]) noexcept -> void
+    {
+        uint64_t acc[4] {};
+        for (auto const word : polynomial) {
+            for (auto b = 0U; b < 64U; ++b) {
+                if ((word & (uint64_t(1) << b)) != 0) {
+                    for (auto i = 0; i < 4; ++i) { acc[i] ^= s[i]; }
+                }
+                step(s);
+            }
+        }
+        for (auto i = 0; i < 4; ++i) { s[i] = acc[i]; }
+    }
+};
+
+} // namespace etl::detail
+
+#endif // TETL_RANDOM_XOSHIRO256_HPP
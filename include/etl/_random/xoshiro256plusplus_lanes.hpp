@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_XOSHIRO256PLUSPLUS_LANES_HPP
+#define TETL_RANDOM_XOSHIRO256PLUSPLUS_LANES_HPP
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_random/xoshiro256.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_simd/simd_mask.hpp"
+#include "etl/_type_traits/is_same.hpp"
+
+namespace etl {
+
+/// \brief Runs Lanes independent xoshiro256++ generators side by side and
+/// returns one output of each per call as a simd. Each word of the state is a
+/// simd, so the update is a handful of vector instructions, if Lanes 64-bit
+/// values fit into a register of the target, e.g. 4 with AVX2 or 8 with
+/// AVX-512.
+///
+/// \details Lane i starts at the state of xoshiro256plusplus(seed) advanced
+/// by i jumps of 2^128 calls, so the lanes never overlap.
+///
+/// \code
+/// auto rng   = etl::xoshiro256plusplus_x4 { 42 };
+/// auto block = rng(); // simd with 4 values
+/// \endcode
+template <size_t Lanes>
+struct xoshiro256plusplus_lanes {
+    static_assert(Lanes > 0, "xoshiro256plusplus_lanes: Lanes must not be 0");
+
+    using value_type                   = uint64_t;
+    using result_type                  = simd<uint64_t, simd_abi::fixed_size<static_cast<int>(Lanes)>>;
+    static constexpr auto lanes        = Lanes;
+    static constexpr auto default_seed = uint64_t { 5489U };
+
+    constexpr xoshiro256plusplus_lanes() noexcept : xoshiro256plusplus_lanes { default_seed } { }
+    explicit constexpr xoshiro256plusplus_lanes(uint64_t seed) noexcept { this->seed(seed); }
+
+    constexpr auto seed(uint64_t value = default_seed) noexcept -> void
+    {
+        uint64_t s[Lanes][4] {};
+        detail::xoshiro256::seed(s[0], value);
+        for (size_t lane = 1; lane < Lanes; ++lane) {
+            for (size_t w = 0; w < 4; ++w) { s[lane][w] = s[lane - 1][w]; }
+            detail::xoshiro256::jump(s[lane], detail::xoshiro256::jump_polynomial);
+        }
+        store(s);
+    }
+
+    /// \brief Advances every lane by 2^128 calls.
+    constexpr auto jump() noexcept -> void { jump_lanes(detail::xoshiro256::jump_polynomial); }
+
+    /// \brief Advances every lane by 2^192 calls.
+    constexpr auto long_jump() noexcept -> void { jump_lanes(detail::xoshiro256::long_jump_polynomial); }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        auto const result = rotl(_state[0] + _state[3], 23) + _state[0];
+        auto const t      = _state[1] << result_type { uint64_t(17) };
+
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+
+        _state[2] ^= t;
+
+        _state[3] = rotl(_state[3], 45);
+
+        return result;
+    }
+
+    /// \brief Assigns a value to each element of [first, last), Lanes values
+    /// per step. The unused values of the last step are discarded.
+    template <typename OutputIt>
+    constexpr auto generate(OutputIt first, OutputIt last) noexcept -> void
+    {
+        if constexpr (is_same_v<OutputIt, uint64_t*>) {
+            for (; last - first >= static_cast<decltype(last - first)>(Lanes); first += Lanes) {
+                (*this)().copy_to(first, element_aligned);
+            }
+        }
+
+        while (first != last) {
+            auto const block = (*this)();
+            for (size_t i = 0; i < Lanes and first != last; ++i, ++first) { *first = block[i]; }
+        }
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(
+        xoshiro256plusplus_lanes const& lhs, xoshiro256plusplus_lanes const& rhs) noexcept -> bool
+    {
+        for (size_t w = 0; w < 4; ++w) {
+            if (not all_of(lhs._state[w] == rhs._state[w])) { return false; }
+        }
+        return true;
+    }
+
+    [[nodiscard]] friend constexpr auto operator!=(
+        xoshiro256plusplus_lanes const& lhs, xoshiro256plusplus_lanes const& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    [[nodiscard]] static constexpr auto rotl(result_type x, int k) noexcept -> result_type
+    {
+        auto const left  = result_type { static_cast<uint64_t>(k) };
+        auto const right = result_type { static_cast<uint64_t>(64 - k) };
+        return (x << left) | (x >> right);
+    }
+
+    constexpr auto load(uint64_t (&s)[Lanes][4]) const noexcept -> void
+    {
+        for (size_t w = 0; w < 4; ++w) {
+            for (size_t lane = 0; lane < Lanes; ++lane) { s[lane][w] = _state[w][lane]; }
+        }
+    }
+
+    constexpr auto store(uint64_t const (&s)[Lanes][4]) noexcept -> void
+    {
+        for (size_t w = 0; w < 4; ++w) {
+            _state[w] = result_type { [&s, w](auto lane) { return s[lane][w]; } };
+        }
+    }
+
+    constexpr auto jump_lanes(uint64_t const (&polynomial)[4]) noexcept -> void
+    {
+        uint64_t s[Lanes][4] {};
+        load(s);
+        for (auto& lane : s) { detail::xoshiro256::jump(lane, polynomial); }
+        store(s);
+    }
+
+    result_type _state[4] {};
+};
+
+using xoshiro256plusplus_x4 = xoshiro256plusplus_lanes<4>;
+using xoshiro256plusplus_x8 = xoshiro256plusplus_lanes<8>;
+
+} // namespace etl
+
+#endif // TETL_RANDOM_XOSHIRO256PLUSPLUS_LANES_HPP
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_RANDOM_XOSHIRO256STARSTAR_HPP
+#define TETL_RANDOM_XOSHIRO256STARSTAR_HPP
+
+#include "etl/_algorithm/equal.hpp"
+#include "etl/_bit/rotl.hpp"
+#include "etl/_cstdint/uint_t.hpp"
+#include "etl/_iterator/begin.hpp"
+#include "etl/_iterator/end.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_random/xoshiro256.hpp"
+
+namespace etl {
+
+/// \brief 64-bit generator with 256 bits of state and a period of 2^256 - 1.
+/// The seed is expanded to the full state with splitmix64.
+///
+/// https://prng.di.unimi.it/xoshiro256starstar.c
+struct xoshiro256starstar {
+    using result_type                  = uint64_t;
+    static constexpr auto default_seed = result_type { 5489U };
+
+    constexpr xoshiro256starstar() noexcept : xoshiro256starstar { default_seed } { }
+    explicit constexpr xoshiro256starstar(result_type seed) noexcept { detail::xoshiro256::seed(_state, seed); }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return numeric_limits<uint64_t>::min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return numeric_limits<uint64_t>::max(); }
+
+    constexpr auto seed(result_type value = default_seed) noexcept -> void { detail::xoshiro256::seed(_state, value); }
+
+    constexpr auto discard(unsigned long long z) noexcept -> void
+    {
+        for (auto i { 0ULL }; i < z; ++i) { detail::xoshiro256::step(_state); }
+    }
+
+    /// \brief Advances the state by 2^128 calls. Use it to create
+    /// non-overlapping streams for parallel computations.
+    constexpr auto jump() noexcept -> void
+    {
+        detail::xoshiro256::jump(_state, detail::xoshiro256::jump_polynomial);
+    }
+
+    /// \brief Advances the state by 2^192 calls. Use it to create starting
+    /// points, which are further split with jump.
+    constexpr auto long_jump() noexcept -> void
+    {
+        detail::xoshiro256::jump(_state, detail::xoshiro256::long_jump_polynomial);
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        auto const result = rotl(_state[1] * 5, 7) * 9;
+        detail::xoshiro256::step(_state);
+        return result;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(
+        xoshiro256starstar const& lhs, xoshiro256starstar const& rhs) noexcept -> bool
+    {
+        return equal(begin(lhs._state), end(lhs._state), begin(rhs._state), end(rhs._state));
+    }
+
+    [[nodiscard]] friend constexpr auto operator!=(
+        xoshiro256starstar const& lhs, xoshiro256starstar const& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    uint64_t _state[4] {};
+};
+
+} // namespace etl
+
+#endif // TETL_RANDOM_XOSHIRO256STARSTAR_HPP
@@ -3,23 +3,63 @@
 #ifndef TETL_SIMD_CONST_WHERE_EXPRESSION_HPP
 #define TETL_SIMD_CONST_WHERE_EXPRESSION_HPP
 
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_simd/is_simd_flag_type.hpp"
+#include "etl/_simd/simd_storage.hpp"
+
 namespace etl {
 
+/// \brief Selects the elements of a const simd (or simd_mask) object, for which
+/// the mask is true. Created by etl::where.
 template <typename M, typename T>
 struct const_where_expression {
+    constexpr const_where_expression(M const& mask, T const& data) noexcept
+        : mask_ { mask }
+        , data_ { const_cast<T&>(data) } // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    {
+    }
+
     const_where_expression(const_where_expression const&)                    = delete;
     auto operator=(const_where_expression const&) -> const_where_expression& = delete;
 
-    auto operator-() const&& noexcept -> T;
-    auto operator+() const&& noexcept -> T;
-    auto operator~() const&& noexcept -> T;
+    /// \brief Negated copy of the selected elements, the other elements are unchanged.
+    [[nodiscard]] constexpr auto operator-() const&& noexcept -> T { return select(-data_); }
+
+    /// \brief Copy of the value.
+    [[nodiscard]] constexpr auto operator+() const&& noexcept -> T { return data_; }
 
+    /// \brief Bitwise not of the selected elements, the other elements are unchanged.
+    [[nodiscard]] constexpr auto operator~() const&& noexcept -> T { return select(~data_); }
+
+    /// \brief Stores the selected elements to mem[i]. The other elements of mem
+    /// are not accessed.
     template <typename U, typename Flags>
-    auto copy_to(U* mem, Flags f) const&& -> void;
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_to(U* mem, Flags /*flags*/) const&& -> void
+    {
+        for (size_t i = 0; i < T::size(); ++i) {
+            if (mask_[i]) { mem[i] = static_cast<U>(data_[i]); }
+        }
+    }
+
+    /// \internal Used by the masked reductions.
+    [[nodiscard]] constexpr auto _mask() const noexcept -> M const& { return mask_; }
+
+    /// \internal Used by the masked reductions.
+    [[nodiscard]] constexpr auto _value() const noexcept -> T const& { return data_; }
+
+protected:
+    /// \brief Returns the elements of value where the mask is true, the
+    /// current elements otherwise.
+    [[nodiscard]] constexpr auto select(T const& value) const noexcept -> T
+    {
+        return T::make(detail::simd_select(mask_._data(), value._data(), data_._data()));
+    }
 
-private:
-    M const _mask;
-    T& _data;
+    M const mask_;
+    T& data_;
 };
 
 } // namespace etl
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_IS_ABI_TAG_HPP
+#define TETL_SIMD_IS_ABI_TAG_HPP
+
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
+
+namespace etl {
+
+/// \brief Checks if T is a simd ABI tag.
+template <typename T>
+struct is_abi_tag : false_type { };
+
+template <>
+struct is_abi_tag<simd_abi::scalar> : true_type { };
+
+template <int N>
+struct is_abi_tag<simd_abi::fixed_size<N>> : bool_constant<(N > 0)> { };
+
+template <typename T>
+struct is_abi_tag<simd_abi::compatible<T>> : true_type { };
+
+template <typename T>
+struct is_abi_tag<simd_abi::native<T>> : true_type { };
+
+template <typename T>
+inline constexpr bool is_abi_tag_v = is_abi_tag<T>::value;
+
+} // namespace etl
+
+#endif // TETL_SIMD_IS_ABI_TAG_HPP
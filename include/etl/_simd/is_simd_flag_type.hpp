@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_IS_SIMD_FLAG_TYPE_HPP
+#define TETL_SIMD_IS_SIMD_FLAG_TYPE_HPP
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
+
+namespace etl {
+
+/// \brief Checks if T is one of the load/store flags element_aligned_tag,
+/// vector_aligned_tag or overaligned_tag.
+template <typename T>
+struct is_simd_flag_type : false_type { };
+
+template <>
+struct is_simd_flag_type<element_aligned_tag> : true_type { };
+
+template <>
+struct is_simd_flag_type<vector_aligned_tag> : true_type { };
+
+template <size_t N>
+struct is_simd_flag_type<overaligned_tag<N>> : true_type { };
+
+template <typename T>
+inline constexpr bool is_simd_flag_type_v = is_simd_flag_type<T>::value;
+
+} // namespace etl
+
+#endif // TETL_SIMD_IS_SIMD_FLAG_TYPE_HPP
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_IS_SIMD_MASK_HPP
+#define TETL_SIMD_IS_SIMD_MASK_HPP
+
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
+
+namespace etl {
+
+/// \brief Checks if T is a specialization of etl::simd_mask.
+template <typename T>
+struct is_simd_mask : false_type { };
+
+template <typename T, typename Abi>
+struct is_simd_mask<simd_mask<T, Abi>> : true_type { };
+
+template <typename T>
+inline constexpr bool is_simd_mask_v = is_simd_mask<T>::value;
+
+} // namespace etl
+
+#endif // TETL_SIMD_IS_SIMD_MASK_HPP
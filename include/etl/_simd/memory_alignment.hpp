@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_MEMORY_ALIGNMENT_HPP
+#define TETL_SIMD_MEMORY_ALIGNMENT_HPP
+
+#include "etl/_bit/bit_ceil.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/simd_size.hpp"
+#include "etl/_type_traits/integral_constant.hpp"
+
+namespace etl {
+
+namespace detail {
+template <typename U, size_t N>
+inline constexpr size_t simd_memory_alignment = [] {
+    auto const all   = bit_ceil(sizeof(U) * N);
+    auto const limit = simd_native_bytes<U> > alignof(U) ? simd_native_bytes<U> : alignof(U);
+    return all < limit ? all : limit;
+}();
+} // namespace detail
+
+/// \brief Alignment of a pointer to U, that is required by loads and stores
+/// with the vector_aligned flag.
+template <typename T, typename U = typename T::value_type>
+struct memory_alignment;
+
+template <typename T, typename Abi, typename U>
+    requires(detail::is_vectorizable_v<U>)
+struct memory_alignment<simd<T, Abi>, U>
+    : integral_constant<size_t, detail::simd_memory_alignment<U, simd_size_v<T, Abi>>> { };
+
+template <typename T, typename Abi>
+struct memory_alignment<simd_mask<T, Abi>, bool> : integral_constant<size_t, alignof(bool)> { };
+
+template <typename T, typename U = typename T::value_type>
+inline constexpr size_t memory_alignment_v = memory_alignment<T, U>::value;
+
+} // namespace etl
+
+#endif // TETL_SIMD_MEMORY_ALIGNMENT_HPP
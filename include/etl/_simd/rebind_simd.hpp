@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_REBIND_SIMD_HPP
+#define TETL_SIMD_REBIND_SIMD_HPP
+
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/simd_size.hpp"
+
+namespace etl {
+
+/// \brief simd or simd_mask with the same number of elements as V, but with
+/// value type T.
+template <typename T, typename V>
+struct rebind_simd;
+
+template <typename T, typename U, typename Abi>
+struct rebind_simd<T, simd<U, Abi>> {
+    using type = simd<T, simd_abi::deduce_t<T, simd_size_v<U, Abi>, Abi>>;
+};
+
+template <typename T, typename U, typename Abi>
+struct rebind_simd<T, simd_mask<U, Abi>> {
+    using type = simd_mask<T, simd_abi::deduce_t<T, simd_size_v<U, Abi>, Abi>>;
+};
+
+template <typename T, typename V>
+using rebind_simd_t = typename rebind_simd<T, V>::type;
+
+} // namespace etl
+
+#endif // TETL_SIMD_REBIND_SIMD_HPP
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_REDUCE_HPP
+#define TETL_SIMD_REDUCE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_array/array.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_functional/multiplies.hpp"
+#include "etl/_functional/plus.hpp"
+#include "etl/_simd/const_where_expression.hpp"
+#include "etl/_simd/simd.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/// \brief Combines the lanes as a balanced tree, log2(N) dependent steps
+/// instead of N. Odd widths fold the upper part onto the lower one.
+template <typename T, size_t N, typename BinaryOp>
+[[nodiscard]] constexpr auto simd_reduce_lanes(array<T, N>& lanes, BinaryOp& op) -> T
+{
+    for (auto width = N; width > 1;) {
+        auto const half = width / 2;
+        for (size_t i = 0; i < half; ++i) { lanes[i] = static_cast<T>(op(lanes[i], lanes[i + width - half])); }
+        width -= half;
+    }
+    return lanes[0];
+}
+
+template <typename M, typename V>
+[[nodiscard]] constexpr auto simd_masked_lanes(const_where_expression<M, V> const& x, typename V::value_type identity)
+{
+    auto lanes = array<typename V::value_type, V::size()> {};
+    for (size_t i = 0; i < V::size(); ++i) { lanes[i] = x._mask()[i] ? x._value()[i] : identity; }
+    return lanes;
+}
+
+} // namespace detail
+
+/// \brief Reduces all elements of v with op. op must be associative, the order
+/// of the applications is unspecified.
+template <typename T, typename Abi, typename BinaryOp = plus<>>
+[[nodiscard]] constexpr auto reduce(simd<T, Abi> const& v, BinaryOp op = {}) -> T
+{
+    auto lanes = array<T, simd<T, Abi>::size()> {};
+    for (size_t i = 0; i < v.size(); ++i) { lanes[i] = v[i]; }
+    return detail::simd_reduce_lanes(lanes, op);
+}
+
+/// \brief Reduces the selected elements of x with op. Returns identity, if no
+/// element is selected.
+template <typename M, typename V, typename BinaryOp>
+[[nodiscard]] constexpr auto reduce(
+    const_where_expression<M, V> const& x, typename V::value_type identity, BinaryOp op
+) -> typename V::value_type
+{
+    auto lanes = detail::simd_masked_lanes(x, identity);
+    return detail::simd_reduce_lanes(lanes, op);
+}
+
+/// \brief Sum of the selected elements of x, 0 if no element is selected.
+template <typename M, typename V>
+[[nodiscard]] constexpr auto reduce(const_where_expression<M, V> const& x, plus<> op = {}) -> typename V::value_type
+{
+    return etl::reduce(x, typename V::value_type(0), op);
+}
+
+/// \brief Product of the selected elements of x, 1 if no element is selected.
+template <typename M, typename V>
+[[nodiscard]] constexpr auto reduce(const_where_expression<M, V> const& x, multiplies<> op) -> typename V::value_type
+{
+    return etl::reduce(x, typename V::value_type(1), op);
+}
+
+/// \brief Smallest element of v.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto hmin(simd<T, Abi> const& v) -> T
+{
+    return etl::reduce(v, [](T a, T b) { return b < a ? b : a; });
+}
+
+/// \brief Largest element of v.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto hmax(simd<T, Abi> const& v) -> T
+{
+    return etl::reduce(v, [](T a, T b) { return a < b ? b : a; });
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_REDUCE_HPP
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_RESIZE_SIMD_HPP
+#define TETL_SIMD_RESIZE_SIMD_HPP
+
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+
+namespace etl {
+
+/// \brief simd or simd_mask with the same value type as V, but with N
+/// elements.
+template <int N, typename V>
+struct resize_simd;
+
+template <int N, typename T, typename Abi>
+struct resize_simd<N, simd<T, Abi>> {
+    using type = simd<T, simd_abi::deduce_t<T, static_cast<size_t>(N), Abi>>;
+};
+
+template <int N, typename T, typename Abi>
+struct resize_simd<N, simd_mask<T, Abi>> {
+    using type = simd_mask<T, simd_abi::deduce_t<T, static_cast<size_t>(N), Abi>>;
+};
+
+template <int N, typename V>
+using resize_simd_t = typename resize_simd<N, V>::type;
+
+} // namespace etl
+
+#endif // TETL_SIMD_RESIZE_SIMD_HPP
@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_HPP
+#define TETL_SIMD_SIMD_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstring/memcpy.hpp"
+#include "etl/_memory/assume_aligned.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_simd/is_abi_tag.hpp"
+#include "etl/_simd/is_simd_flag_type.hpp"
+#include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/memory_alignment.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/simd_mask.hpp"
+#include "etl/_simd/simd_size.hpp"
+#include "etl/_simd/simd_storage.hpp"
+#include "etl/_type_traits/declval.hpp"
+#include "etl/_type_traits/integral_constant.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_convertible.hpp"
+#include "etl/_type_traits/is_integral.hpp"
+#include "etl/_type_traits/is_same.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
+#include "etl/_utility/index_sequence.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/// \brief Alignment of the pointer passed to a load or store with flag type Flags.
+template <typename Flags, typename V, typename U>
+inline constexpr size_t simd_flag_alignment = alignof(U);
+
+template <typename V, typename U>
+inline constexpr size_t simd_flag_alignment<vector_aligned_tag, V, U> = memory_alignment_v<V, U>;
+
+template <size_t N, typename V, typename U>
+inline constexpr size_t simd_flag_alignment<overaligned_tag<N>, V, U> = N;
+
+} // namespace detail
+
+/// \brief Data-parallel type with the element type T. The number of elements
+/// is determined by the ABI tag.
+///
+/// \details If the elements fit into a vector register of the target, the
+/// storage is a GCC/Clang vector extension type and every operation is a
+/// single vector instruction (SSE, AVX, NEON, ...). Otherwise, operations are
+/// plain loops over an array, which the optimizer may still vectorize.
+///
+/// https://en.cppreference.com/w/cpp/experimental/simd/simd
+template <typename T, typename Abi>
+struct simd {
+    static_assert(detail::is_vectorizable_v<T>, "simd: T must be arithmetic and not bool");
+    static_assert(is_abi_tag_v<Abi>, "simd: Abi must be an ABI tag");
+
+private:
+    static constexpr size_t lanes = simd_size_v<T, Abi>;
+    using storage_t               = typename detail::simd_storage<T, lanes>::type;
+
+public:
+    using value_type = T;
+    using mask_type  = simd_mask<T, Abi>;
+    using abi_type   = Abi;
+
+    [[nodiscard]] static constexpr auto size() noexcept -> size_t { return lanes; }
+
+    simd() noexcept = default;
+
+    /// \brief Broadcasts value to all elements. Only participates in overload
+    /// resolution, if the conversion from U to T is value-preserving.
+    template <typename U>
+        requires(is_convertible_v<U, T> and detail::simd_is_value_preserving<remove_cvref_t<U>, T>)
+    constexpr simd(U&& value) noexcept // NOLINT(hicpp-explicit-conversions)
+        : data_ { detail::simd_generate<storage_t>([v = static_cast<T>(value)](size_t /*i*/) { return v; }) }
+    {
+    }
+
+    /// \brief Element i is initialized to gen(integral_constant<size_t, i>()).
+    template <typename G>
+        requires(requires(G& g) { static_cast<T>(g(integral_constant<size_t, 0> {})); })
+    constexpr explicit simd(G&& gen) noexcept
+        : data_ { generate(gen, make_index_sequence<lanes> {}) }
+    {
+    }
+
+    /// \brief Loads size() elements from mem. The alignment of mem must match
+    /// Flags.
+    template <typename U, typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr simd(U const* mem, Flags flags)
+    {
+        copy_from(mem, flags);
+    }
+
+    /// \brief Loads size() elements from mem. The alignment of mem must match
+    /// Flags.
+    template <typename U, typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_from(U const* mem, Flags /*flags*/) -> void
+    {
+        auto const* src = assume_aligned<detail::simd_flag_alignment<Flags, simd, U>>(mem);
+        if constexpr (is_same_v<U, T>) {
+            if (not is_constant_evaluated()) {
+                etl::memcpy(&data_, src, sizeof(data_));
+                return;
+            }
+        }
+        data_ = detail::simd_generate<storage_t>([src](size_t i) { return static_cast<T>(src[i]); });
+    }
+
+    /// \brief Stores size() elements to mem. The alignment of mem must match
+    /// Flags.
+    template <typename U, typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_to(U* mem, Flags /*flags*/) const -> void
+    {
+        auto* dest = assume_aligned<detail::simd_flag_alignment<Flags, simd, U>>(mem);
+        if constexpr (is_same_v<U, T>) {
+            if (not is_constant_evaluated()) {
+                etl::memcpy(dest, &data_, sizeof(data_));
+                return;
+            }
+        }
+        for (size_t i = 0; i < lanes; ++i) { dest[i] = static_cast<U>(data_[i]); }
+    }
+
+    [[nodiscard]] constexpr auto operator[](size_t i) const noexcept -> value_type { return data_[i]; }
+
+    constexpr auto operator++() noexcept -> simd& { return *this += simd { 1 }; }
+    constexpr auto operator--() noexcept -> simd& { return *this -= simd { 1 }; }
+
+    constexpr auto operator++(int) noexcept -> simd
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    constexpr auto operator--(int) noexcept -> simd
+    {
+        auto tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    [[nodiscard]] constexpr auto operator!() const noexcept -> mask_type { return *this == simd { 0 }; }
+
+    [[nodiscard]] constexpr auto operator+() const noexcept -> simd { return *this; }
+
+    [[nodiscard]] constexpr auto operator-() const noexcept -> simd
+    {
+        return make(detail::simd_apply(data_, [](auto x) { return -x; }));
+    }
+
+    [[nodiscard]] constexpr auto operator~() const noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(data_, [](auto x) { return ~x; }));
+    }
+
+    friend constexpr auto operator+(simd const& lhs, simd const& rhs) noexcept -> simd
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x + y; }));
+    }
+
+    friend constexpr auto operator-(simd const& lhs, simd const& rhs) noexcept -> simd
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x - y; }));
+    }
+
+    friend constexpr auto operator*(simd const& lhs, simd const& rhs) noexcept -> simd
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x * y; }));
+    }
+
+    friend constexpr auto operator/(simd const& lhs, simd const& rhs) noexcept -> simd
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x / y; }));
+    }
+
+    friend constexpr auto operator%(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x % y; }));
+    }
+
+    friend constexpr auto operator&(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x & y; }));
+    }
+
+    friend constexpr auto operator|(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x | y; }));
+    }
+
+    friend constexpr auto operator^(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x ^ y; }));
+    }
+
+    friend constexpr auto operator<<(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x << y; }));
+    }
+
+    friend constexpr auto operator>>(simd const& lhs, simd const& rhs) noexcept -> simd
+        requires(is_integral_v<T>)
+    {
+        return make(detail::simd_apply(lhs.data_, rhs.data_, [](auto x, auto y) { return x >> y; }));
+    }
+
+    friend constexpr auto operator+=(simd& lhs, simd const& rhs) noexcept -> simd& { return lhs = lhs + rhs; }
+    friend constexpr auto operator-=(simd& lhs, simd const& rhs) noexcept -> simd& { return lhs = lhs - rhs; }
+    friend constexpr auto operator*=(simd& lhs, simd const& rhs) noexcept -> simd& { return lhs = lhs * rhs; }
+    friend constexpr auto operator/=(simd& lhs, simd const& rhs) noexcept -> simd& { return lhs = lhs / rhs; }
+
+    friend constexpr auto operator%=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs % rhs;
+    }
+
+    friend constexpr auto operator&=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs & rhs;
+    }
+
+    friend constexpr auto operator|=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs | rhs;
+    }
+
+    friend constexpr auto operator^=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs ^ rhs;
+    }
+
+    friend constexpr auto operator<<=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs << rhs;
+    }
+
+    friend constexpr auto operator>>=(simd& lhs, simd const& rhs) noexcept -> simd&
+        requires(is_integral_v<T>)
+    {
+        return lhs = lhs >> rhs;
+    }
+
+    friend constexpr auto operator==(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x == y; });
+    }
+
+    friend constexpr auto operator!=(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x != y; });
+    }
+
+    friend constexpr auto operator<(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x < y; });
+    }
+
+    friend constexpr auto operator<=(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x <= y; });
+    }
+
+    friend constexpr auto operator>(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x > y; });
+    }
+
+    friend constexpr auto operator>=(simd const& lhs, simd const& rhs) noexcept -> mask_type
+    {
+        return compare(lhs, rhs, [](auto x, auto y) { return x >= y; });
+    }
+
+    /// \internal Raw storage, used by where_expression and the casts.
+    [[nodiscard]] constexpr auto _data() noexcept -> storage_t& { return data_; }
+
+    /// \internal Raw storage, used by where_expression and the casts.
+    [[nodiscard]] constexpr auto _data() const noexcept -> storage_t const& { return data_; }
+
+    /// \internal
+    [[nodiscard]] static constexpr auto make(storage_t const& data) noexcept -> simd
+    {
+        auto v  = simd {};
+        v.data_ = data;
+        return v;
+    }
+
+private:
+    template <typename G, size_t... I>
+    [[nodiscard]] static constexpr auto generate(G& gen, index_sequence<I...> /*indices*/) -> storage_t
+    {
+        return storage_t { static_cast<T>(gen(integral_constant<size_t, I> {}))... };
+    }
+
+    template <typename Op>
+    [[nodiscard]] static constexpr auto compare(simd const& lhs, simd const& rhs, Op op) noexcept -> mask_type
+    {
+        using mask_storage_t = remove_cvref_t<decltype(declval<mask_type&>()._data())>;
+        return mask_type::make(detail::simd_compare<mask_storage_t>(lhs.data_, rhs.data_, op));
+    }
+
+    storage_t data_;
+};
+
+/// \brief Element-wise minimum.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto min(simd<T, Abi> const& a, simd<T, Abi> const& b) noexcept -> simd<T, Abi>
+{
+    return simd<T, Abi>::make(detail::simd_select((b < a)._data(), b._data(), a._data()));
+}
+
+/// \brief Element-wise maximum.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto max(simd<T, Abi> const& a, simd<T, Abi> const& b) noexcept -> simd<T, Abi>
+{
+    return simd<T, Abi>::make(detail::simd_select((a < b)._data(), b._data(), a._data()));
+}
+
+/// \brief Element-wise clamp of v to [lo, hi].
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto clamp(simd<T, Abi> const& v, simd<T, Abi> const& lo, simd<T, Abi> const& hi) noexcept
+    -> simd<T, Abi>
+{
+    return etl::min(etl::max(v, lo), hi);
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_SIMD_HPP
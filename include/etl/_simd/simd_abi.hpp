@@ -5,6 +5,9 @@
 
 #include "etl/_config/all.hpp"
 
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_type_traits/conditional.hpp"
+
 namespace etl::simd_abi {
 
 namespace detail {
@@ -17,30 +20,34 @@ template <typename T>
 struct simd_abi_native_tag { };
 } // namespace detail
 
+/// \brief Stores a single element.
 using scalar = detail::simd_abi_scaler_tag;
 
+/// \brief Stores N elements. Lowered to vector registers, if N elements fit
+/// into the native vector width, otherwise to loops over an array.
 template <int N>
 using fixed_size = detail::simd_abi_fixed_size_tag<N>;
 
 template <typename T>
 inline constexpr int max_fixed_size = 32;
 
+/// \brief 16 byte wide on targets with SSE2, NEON or AltiVec, scalar otherwise.
 template <typename T>
 using compatible = detail::simd_abi_compatible_tag<T>;
 
+/// \brief Widest vector register of the target, e.g. 32 bytes with AVX2.
 template <typename T>
 using native = detail::simd_abi_native_tag<T>;
 
-// TODO(tobi)
-#if 0
+/// \brief ABI tag for N elements of type T. scalar for N == 1, fixed_size<N>
+/// otherwise.
 template <typename T, size_t N, typename... Abis>
 struct deduce {
-    using type = /* see below */;
+    using type = conditional_t<N == 1, scalar, fixed_size<static_cast<int>(N)>>;
 };
 
 template <typename T, size_t N, typename... Abis>
 using deduce_t = typename deduce<T, N, Abis...>::type;
-#endif
 
 } // namespace etl::simd_abi
 
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_CAST_HPP
+#define TETL_SIMD_SIMD_CAST_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_simd/is_simd.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_simd/simd_storage.hpp"
+#include "etl/_type_traits/declval.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
+
+namespace etl {
+
+/// \brief Converts every element of x with static_cast. V must have the same
+/// number of elements. Both sides in vector registers convert with a single
+/// instruction, e.g. cvtdq2ps for int to float.
+template <typename V, typename T, typename Abi>
+    requires(is_simd_v<V> and V::size() == simd<T, Abi>::size())
+[[nodiscard]] constexpr auto static_simd_cast(simd<T, Abi> const& x) noexcept -> V
+{
+    using from_t = remove_cvref_t<decltype(x._data())>;
+    using to_t   = remove_cvref_t<decltype(declval<V&>()._data())>;
+#if defined(TETL_GCC) or defined(TETL_CLANG)
+    if constexpr (not detail::simd_is_array_v<from_t> and not detail::simd_is_array_v<to_t>) {
+        return V::make(__builtin_convertvector(x._data(), to_t));
+    }
+#endif
+    using U = typename V::value_type;
+    return V([&x](auto i) { return static_cast<U>(x[i]); });
+}
+
+/// \brief Like static_simd_cast, but only participates in overload resolution
+/// if every value of T can be represented by the element type of V.
+template <typename V, typename T, typename Abi>
+    requires(is_simd_v<V> and detail::simd_is_value_preserving<T, typename V::value_type>)
+[[nodiscard]] constexpr auto simd_cast(simd<T, Abi> const& x) noexcept -> V
+{
+    return etl::static_simd_cast<V>(x);
+}
+
+/// \brief Copies x into a simd with the fixed_size ABI and the same number of
+/// elements.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto to_fixed_size(simd<T, Abi> const& x) noexcept
+    -> fixed_size_simd<T, static_cast<int>(simd<T, Abi>::size())>
+{
+    return etl::static_simd_cast<fixed_size_simd<T, static_cast<int>(simd<T, Abi>::size())>>(x);
+}
+
+/// \brief Copies x into a native_simd. Only participates in overload
+/// resolution if both have the same number of elements.
+template <typename T, int N>
+    requires(native_simd<T>::size() == static_cast<size_t>(N))
+[[nodiscard]] constexpr auto to_native(fixed_size_simd<T, N> const& x) noexcept -> native_simd<T>
+{
+    return etl::static_simd_cast<native_simd<T>>(x);
+}
+
+/// \brief Copies x into a simd with the compatible ABI. Only participates in
+/// overload resolution if both have the same number of elements.
+template <typename T, int N>
+    requires(simd<T>::size() == static_cast<size_t>(N))
+[[nodiscard]] constexpr auto to_compatible(fixed_size_simd<T, N> const& x) noexcept -> simd<T>
+{
+    return etl::static_simd_cast<simd<T>>(x);
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_SIMD_CAST_HPP
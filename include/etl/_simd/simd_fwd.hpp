@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_FWD_HPP
+#define TETL_SIMD_SIMD_FWD_HPP
+
+#include "etl/_simd/simd_abi.hpp"
+
+namespace etl {
+
+template <typename T, typename Abi = simd_abi::compatible<T>>
+struct simd;
+
+template <typename T>
+using native_simd = simd<T, simd_abi::native<T>>;
+
+template <typename T, int N>
+using fixed_size_simd = simd<T, simd_abi::fixed_size<N>>;
+
+template <typename T, typename Abi = simd_abi::compatible<T>>
+struct simd_mask;
+
+template <typename T>
+using native_simd_mask = simd_mask<T, simd_abi::native<T>>;
+
+template <typename T, int N>
+using fixed_size_simd_mask = simd_mask<T, simd_abi::fixed_size<N>>;
+
+} // namespace etl
+
+#endif // TETL_SIMD_SIMD_FWD_HPP
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_MASK_HPP
+#define TETL_SIMD_SIMD_MASK_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_simd/is_abi_tag.hpp"
+#include "etl/_simd/is_simd_flag_type.hpp"
+#include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/simd_size.hpp"
+#include "etl/_simd/simd_storage.hpp"
+#include "etl/_type_traits/declval.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
+
+namespace etl {
+
+/// \brief Data-parallel boolean type with one element per element of
+/// simd<T, Abi>. Results of comparisons between simd objects.
+///
+/// \details With vector storage, a set lane has all bits set, so masks can be
+/// used directly as blend selectors.
+template <typename T, typename Abi>
+struct simd_mask {
+    static_assert(detail::is_vectorizable_v<T>, "simd_mask: T must be arithmetic and not bool");
+    static_assert(is_abi_tag_v<Abi>, "simd_mask: Abi must be an ABI tag");
+
+private:
+    static constexpr size_t lanes = simd_size_v<T, Abi>;
+    using storage_t               = typename detail::simd_storage<T, lanes>::mask_type;
+    using lane_t                  = remove_cvref_t<decltype(declval<storage_t&>()[0])>;
+
+public:
+    using value_type = bool;
+    using simd_type  = simd<T, Abi>;
+    using abi_type   = Abi;
+
+    [[nodiscard]] static constexpr auto size() noexcept -> size_t { return lanes; }
+
+    simd_mask() noexcept = default;
+
+    /// \brief Broadcasts value to all elements.
+    explicit constexpr simd_mask(value_type value) noexcept
+        : data_ { detail::simd_generate<storage_t>([value](size_t /*i*/) { return to_lane(value); }) }
+    {
+    }
+
+    template <typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr simd_mask(bool const* mem, Flags flags) noexcept
+    {
+        copy_from(mem, flags);
+    }
+
+    template <typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_from(bool const* mem, Flags /*flags*/) noexcept -> void
+    {
+        data_ = detail::simd_generate<storage_t>([mem](size_t i) { return to_lane(mem[i]); });
+    }
+
+    template <typename Flags>
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_to(bool* mem, Flags /*flags*/) const noexcept -> void
+    {
+        for (size_t i = 0; i < lanes; ++i) { mem[i] = (*this)[i]; }
+    }
+
+    [[nodiscard]] constexpr auto operator[](size_t i) const noexcept -> value_type { return data_[i] != lane_t {}; }
+
+    [[nodiscard]] constexpr auto operator!() const noexcept -> simd_mask
+    {
+        return make(detail::simd_apply(data_, [](auto x) { return x == decltype(x) {}; }));
+    }
+
+    constexpr auto operator&=(simd_mask const& other) noexcept -> simd_mask&
+    {
+        data_ = detail::simd_apply(data_, other.data_, [](auto x, auto y) { return x & y; });
+        return *this;
+    }
+
+    constexpr auto operator|=(simd_mask const& other) noexcept -> simd_mask&
+    {
+        data_ = detail::simd_apply(data_, other.data_, [](auto x, auto y) { return x | y; });
+        return *this;
+    }
+
+    constexpr auto operator^=(simd_mask const& other) noexcept -> simd_mask&
+    {
+        data_ = detail::simd_apply(data_, other.data_, [](auto x, auto y) { return x ^ y; });
+        return *this;
+    }
+
+    friend constexpr auto operator&&(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return simd_mask { lhs } &= rhs;
+    }
+
+    friend constexpr auto operator||(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return simd_mask { lhs } |= rhs;
+    }
+
+    friend constexpr auto operator&(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return simd_mask { lhs } &= rhs;
+    }
+
+    friend constexpr auto operator|(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return simd_mask { lhs } |= rhs;
+    }
+
+    friend constexpr auto operator^(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return simd_mask { lhs } ^= rhs;
+    }
+
+    friend constexpr auto operator==(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return !(lhs ^ rhs);
+    }
+
+    friend constexpr auto operator!=(simd_mask const& lhs, simd_mask const& rhs) noexcept -> simd_mask
+    {
+        return lhs ^ rhs;
+    }
+
+    /// \internal Raw storage, used by simd, where_expression and the reductions.
+    [[nodiscard]] constexpr auto _data() noexcept -> storage_t& { return data_; }
+
+    /// \internal Raw storage, used by simd, where_expression and the reductions.
+    [[nodiscard]] constexpr auto _data() const noexcept -> storage_t const& { return data_; }
+
+    /// \internal
+    [[nodiscard]] static constexpr auto make(storage_t const& data) noexcept -> simd_mask
+    {
+        auto mask  = simd_mask {};
+        mask.data_ = data;
+        return mask;
+    }
+
+private:
+    [[nodiscard]] static constexpr auto to_lane(bool value) noexcept -> lane_t
+    {
+        return value ? static_cast<lane_t>(-1) : lane_t {};
+    }
+
+    storage_t data_;
+};
+
+/// \brief Returns true if all elements of mask are true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto all_of(simd_mask<T, Abi> const& mask) noexcept -> bool
+{
+    for (size_t i = 0; i < mask.size(); ++i) {
+        if (not mask[i]) { return false; }
+    }
+    return true;
+}
+
+/// \brief Returns true if at least one element of mask is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto any_of(simd_mask<T, Abi> const& mask) noexcept -> bool
+{
+    for (size_t i = 0; i < mask.size(); ++i) {
+        if (mask[i]) { return true; }
+    }
+    return false;
+}
+
+/// \brief Returns true if all elements of mask are false.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto none_of(simd_mask<T, Abi> const& mask) noexcept -> bool
+{
+    return not any_of(mask);
+}
+
+/// \brief Returns true if at least one element of mask is true and at least
+/// one is false.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto some_of(simd_mask<T, Abi> const& mask) noexcept -> bool
+{
+    return any_of(mask) and not all_of(mask);
+}
+
+/// \brief Returns the number of true elements in mask.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto popcount(simd_mask<T, Abi> const& mask) noexcept -> int
+{
+    auto count = 0;
+    for (size_t i = 0; i < mask.size(); ++i) { count += mask[i] ? 1 : 0; }
+    return count;
+}
+
+/// \brief Returns the lowest index i where mask[i] is true. The behavior is
+/// undefined if none_of(mask) is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto find_first_set(simd_mask<T, Abi> const& mask) -> int
+{
+    TETL_ASSERT(any_of(mask));
+    for (size_t i = 0; i < mask.size(); ++i) {
+        if (mask[i]) { return static_cast<int>(i); }
+    }
+    return -1;
+}
+
+/// \brief Returns the greatest index i where mask[i] is true. The behavior is
+/// undefined if none_of(mask) is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto find_last_set(simd_mask<T, Abi> const& mask) -> int
+{
+    TETL_ASSERT(any_of(mask));
+    for (auto i = mask.size(); i > 0; --i) {
+        if (mask[i - 1]) { return static_cast<int>(i - 1); }
+    }
+    return -1;
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_SIMD_MASK_HPP
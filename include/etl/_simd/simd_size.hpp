@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_SIZE_HPP
+#define TETL_SIMD_SIMD_SIZE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_simd/is_abi_tag.hpp"
+#include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/simd_abi.hpp"
+#include "etl/_type_traits/integral_constant.hpp"
+#include "etl/_type_traits/is_floating_point.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/// \brief Width in bytes of the widest vector register usable for T, 0 if the
+/// target has no vector unit.
+template <typename T>
+inline constexpr size_t simd_native_bytes =
+#if defined(__AVX512F__)
+    64;
+#elif defined(__AVX2__)
+    32;
+#elif defined(__AVX__)
+    is_floating_point_v<T> ? 32 : 16;
+#elif defined(__SSE2__) or defined(__ARM_NEON) or defined(__ALTIVEC__)
+    16;
+#else
+    0;
+#endif
+
+template <typename T>
+inline constexpr size_t simd_compatible_bytes = simd_native_bytes<T> == 0 ? 0 : 16;
+
+template <typename T, size_t Bytes>
+inline constexpr size_t simd_lanes_for_bytes = Bytes / sizeof(T) > 1 ? Bytes / sizeof(T) : 1;
+
+} // namespace detail
+
+/// \brief The number of elements in a simd<T, Abi>.
+template <typename T, typename Abi = simd_abi::compatible<T>>
+struct simd_size;
+
+template <typename T>
+    requires(detail::is_vectorizable_v<T>)
+struct simd_size<T, simd_abi::scalar> : integral_constant<size_t, 1> { };
+
+template <typename T, int N>
+    requires(detail::is_vectorizable_v<T> and is_abi_tag_v<simd_abi::fixed_size<N>>)
+struct simd_size<T, simd_abi::fixed_size<N>> : integral_constant<size_t, static_cast<size_t>(N)> { };
+
+template <typename T>
+    requires(detail::is_vectorizable_v<T>)
+struct simd_size<T, simd_abi::compatible<T>>
+    : integral_constant<size_t, detail::simd_lanes_for_bytes<T, detail::simd_compatible_bytes<T>>> { };
+
+template <typename T>
+    requires(detail::is_vectorizable_v<T>)
+struct simd_size<T, simd_abi::native<T>>
+    : integral_constant<size_t, detail::simd_lanes_for_bytes<T, detail::simd_native_bytes<T>>> { };
+
+template <typename T, typename Abi = simd_abi::compatible<T>>
+inline constexpr size_t simd_size_v = simd_size<T, Abi>::value;
+
+} // namespace etl
+
+#endif // TETL_SIMD_SIMD_SIZE_HPP
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_SIMD_STORAGE_HPP
+#define TETL_SIMD_SIMD_STORAGE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_array/array.hpp"
+#include "etl/_bit/has_single_bit.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/int_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_simd/simd_size.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
+#include "etl/_type_traits/conditional.hpp"
+#include "etl/_type_traits/is_floating_point.hpp"
+#include "etl/_type_traits/is_same.hpp"
+#include "etl/_type_traits/is_signed.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
+#include "etl/_utility/index_sequence.hpp"
+
+namespace etl::detail {
+
+// clang-format off
+template <size_t Bytes>
+using simd_int_for_t = conditional_t<Bytes == 1, int8_t,
+                       conditional_t<Bytes == 2, int16_t,
+                       conditional_t<Bytes == 4, int32_t, int64_t>>>;
+// clang-format on
+
+/// \brief True, if N elements of T are stored in a GCC/Clang vector extension
+/// type. The compiler lowers operations on it to the instructions of the target
+/// (SSE, AVX, NEON, ...). Vectors wider than the native registers would change
+/// the calling convention, those fall back to loops over an array.
+template <typename T, size_t N>
+inline constexpr bool simd_use_vector_ext =
+#if defined(TETL_GCC) or defined(TETL_CLANG)
+    N > 1 and has_single_bit(N) and sizeof(T) <= 8 and not is_same_v<T, long double>
+    and sizeof(T) * N <= simd_native_bytes<T>;
+#else
+    false;
+#endif
+
+template <typename T, size_t N, bool = simd_use_vector_ext<T, N>>
+struct simd_storage {
+    using type      = array<T, N>;
+    using mask_type = array<bool, N>;
+};
+
+#if defined(TETL_GCC) or defined(TETL_CLANG)
+template <typename T, size_t N>
+struct simd_storage<T, N, true> {
+    using type [[gnu::vector_size(sizeof(T) * N)]]      = T;
+    using mask_type [[gnu::vector_size(sizeof(T) * N)]] = simd_int_for_t<sizeof(T)>;
+};
+#endif
+
+template <typename S>
+struct simd_is_array : false_type { };
+
+template <typename T, size_t N>
+struct simd_is_array<array<T, N>> : true_type { };
+
+template <typename S>
+inline constexpr bool simd_is_array_v = simd_is_array<S>::value;
+
+/// \brief Number of lanes in a storage object, works for arrays and vector
+/// extension types.
+template <typename S>
+inline constexpr size_t simd_lanes = sizeof(S) / sizeof(S {}[0]);
+
+template <typename S, typename F, size_t... I>
+[[nodiscard]] constexpr auto simd_generate_impl(F& f, index_sequence<I...> /*indices*/) -> S
+{
+    using lane_t = remove_cvref_t<decltype(S {}[0])>;
+    return S { static_cast<lane_t>(f(I))... };
+}
+
+/// \brief Builds storage S with lane i set to f(i). All lanes are brace-
+/// initialized at once: vector extension types can't be modified element-wise
+/// during constant evaluation, and for arrays the optimizer sees a single
+/// expression instead of a zeroed array and a loop of stores, which would
+/// have to be forwarded to the next operation.
+template <typename S, typename F>
+[[nodiscard]] constexpr auto simd_generate(F f) -> S
+{
+    return simd_generate_impl<S>(f, make_index_sequence<simd_lanes<S>> {});
+}
+
+/// \brief Applies op lane-wise. On vector storage op is called once with the
+/// whole vectors.
+template <typename S, typename Op>
+[[nodiscard]] constexpr auto simd_apply(S const& a, Op op) noexcept -> S
+{
+    if constexpr (simd_is_array_v<S>) {
+        return simd_generate<S>([&](size_t i) { return op(a[i]); });
+    } else {
+        return op(a);
+    }
+}
+
+template <typename S, typename Op>
+[[nodiscard]] constexpr auto simd_apply(S const& a, S const& b, Op op) noexcept -> S
+{
+    if constexpr (simd_is_array_v<S>) {
+        return simd_generate<S>([&](size_t i) { return op(a[i], b[i]); });
+    } else {
+        return op(a, b);
+    }
+}
+
+/// \brief Lane-wise comparison, returns mask storage M.
+template <typename M, typename S, typename Op>
+[[nodiscard]] constexpr auto simd_compare(S const& a, S const& b, Op op) noexcept -> M
+{
+    if constexpr (simd_is_array_v<S>) {
+        return simd_generate<M>([&](size_t i) { return op(a[i], b[i]); });
+    } else {
+        return __builtin_convertvector(op(a, b), M);
+    }
+}
+
+/// \brief Returns a[i] where m[i] is set, b[i] otherwise.
+template <typename M, typename S>
+[[nodiscard]] constexpr auto simd_select(M const& m, S const& a, S const& b) noexcept -> S
+{
+    if constexpr (simd_is_array_v<S>) {
+        return simd_generate<S>([&](size_t i) { return m[i] ? a[i] : b[i]; });
+    } else {
+        return m ? a : b;
+    }
+}
+
+/// \brief Conversion from From to To is value-preserving, i.e. every value of
+/// From can be represented by To. int and unsigned int are always accepted, to
+/// allow literals like `v * 2`.
+template <typename From, typename To>
+inline constexpr bool simd_is_value_preserving
+    = is_same_v<From, To> or is_same_v<From, int> or is_same_v<From, unsigned int>
+   or (numeric_limits<From>::is_specialized and numeric_limits<To>::is_specialized
+       and numeric_limits<From>::digits <= numeric_limits<To>::digits
+       and (is_signed_v<To> or not is_signed_v<From>) and (is_floating_point_v<To> or not is_floating_point_v<From>));
+
+} // namespace etl::detail
+
+#endif // TETL_SIMD_SIMD_STORAGE_HPP
@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_VEXP_HPP
+#define TETL_SIMD_VEXP_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/vmath_accuracy.hpp"
+#include "etl/_simd/vmath_kernel.hpp"
+#include "etl/_span/span.hpp"
+
+namespace etl {
+
+/// \brief Computes e raised to the power of each element of in and stores
+/// the results to out, which must have the same size. in and out may be the
+/// same memory.
+///
+/// \details Each step processes a native_simd, the remaining elements run
+/// through the same kernel as scalars. The error is below 1 ULP with both
+/// accuracies. Results above FLT_MAX are infinite, results below the
+/// smallest subnormal are zero.
+constexpr auto vexp(span<float const> in, span<float> out, vmath_accuracy accuracy = vmath_accuracy::precise) -> void
+{
+    if (accuracy == vmath_accuracy::fast) {
+        detail::vmath_transform<native_simd<float>>(in, out, [](auto x) { return detail::vexp_fast(x); });
+    } else {
+        detail::vmath_transform<native_simd<double>>(in, out, [](auto x) { return detail::vexp_precise(x); });
+    }
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_VEXP_HPP
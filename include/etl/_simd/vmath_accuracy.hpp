@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_VMATH_ACCURACY_HPP
+#define TETL_SIMD_VMATH_ACCURACY_HPP
+
+namespace etl {
+
+/// \brief Selects the kernels of the batched math functions vexp, vlog, vsin
+/// and vcos.
+enum struct vmath_accuracy : unsigned char {
+    /// \brief Error below 1 ULP. The polynomials are evaluated in double
+    /// precision, so each vector holds half as many elements as with fast.
+    precise,
+
+    /// \brief Single precision polynomials with an error of at most 2 ULP,
+    /// see the documentation of each function.
+    fast,
+};
+
+} // namespace etl
+
+#endif // TETL_SIMD_VMATH_ACCURACY_HPP
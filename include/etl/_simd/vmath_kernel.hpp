@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_VMATH_KERNEL_HPP
+#define TETL_SIMD_VMATH_KERNEL_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_bit/bit_cast.hpp"
+#include "etl/_cstddef/nullptr_t.hpp"
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstdint/int_t.hpp"
+#include "etl/_limits/numeric_limits.hpp"
+#include "etl/_simd/alignment_tags.hpp"
+#include "etl/_simd/rebind_simd.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_mask.hpp"
+#include "etl/_simd/simd_storage.hpp"
+#include "etl/_span/span.hpp"
+#include "etl/_type_traits/conditional.hpp"
+#include "etl/_type_traits/is_null_pointer.hpp"
+#include "etl/_type_traits/is_same.hpp"
+
+namespace etl::detail {
+
+/// \brief Element and bit pattern type of a vmath kernel argument, which is
+/// either a simd or a float or double for the scalar tail. The same kernel
+/// code handles both.
+template <typename V>
+struct vmath_traits {
+    using value_type = V;
+    using bits_type  = conditional_t<sizeof(V) == 4, int32_t, int64_t>;
+};
+
+template <typename T, typename Abi>
+struct vmath_traits<simd<T, Abi>> {
+    using value_type = T;
+    using bits_type  = rebind_simd_t<conditional_t<sizeof(T) == 4, int32_t, int64_t>, simd<T, Abi>>;
+};
+
+template <typename V>
+using vmath_bits_t = typename vmath_traits<V>::bits_type;
+
+template <typename V>
+[[nodiscard]] constexpr auto vmath_to_bits(V const& x) noexcept -> vmath_bits_t<V>
+{
+    return etl::bit_cast<vmath_bits_t<V>>(x);
+}
+
+template <typename V>
+[[nodiscard]] constexpr auto vmath_from_bits(vmath_bits_t<V> const& x) noexcept -> V
+{
+    return etl::bit_cast<V>(x);
+}
+
+/// \brief Returns a where mask is set, b otherwise.
+template <typename M, typename V>
+[[nodiscard]] constexpr auto vmath_select(M const& mask, V const& a, V const& b) noexcept -> V
+{
+    if constexpr (is_same_v<M, bool>) {
+        return mask ? a : b;
+    } else {
+        return V::make(detail::simd_select(mask._data(), a._data(), b._data()));
+    }
+}
+
+[[nodiscard]] constexpr auto vmath_any(bool mask) noexcept -> bool { return mask; }
+
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto vmath_any(simd_mask<T, Abi> const& mask) noexcept -> bool
+{
+    return any_of(mask);
+}
+
+/// \brief Replaces the results for NaN, zero, negative and infinite
+/// arguments of a logarithm.
+template <typename V>
+[[nodiscard]] constexpr auto vmath_log_special(V const& x, V result) noexcept -> V
+{
+    using T = typename vmath_traits<V>::value_type;
+
+    constexpr auto inf = numeric_limits<T>::infinity();
+    result             = vmath_select(x == V(T(0)), V(-inf), result);
+    result             = vmath_select(x < V(T(0)), V(numeric_limits<T>::quiet_NaN()), result);
+    result             = vmath_select(x == V(inf), V(inf), result);
+    return vmath_select(x != x, x, result);
+}
+
+/// \brief Picks sin(r) or cos(r) and the sign for the argument r + q pi/2.
+/// Odd quadrants swap sine and cosine, quadrants 2 and 3 negate the result.
+/// cos(x) is sin(x + pi/2), i.e. the same with q + 1.
+template <typename V>
+[[nodiscard]] constexpr auto vmath_quadrant(V const& s, V const& c, vmath_bits_t<V> const& q) noexcept -> V
+{
+    using bits_t = vmath_bits_t<V>;
+    using T      = typename vmath_traits<V>::value_type;
+
+    auto const swap = bits_t(0) - (q & bits_t(1));
+    auto const sign = (q & bits_t(2)) << bits_t(static_cast<int>(sizeof(T) * 8 - 2));
+    auto const sb   = vmath_to_bits(s);
+    auto const cb   = vmath_to_bits(c);
+    return vmath_from_bits<V>(bits_t(((sb & ~swap) | (cb & swap)) ^ sign));
+}
+
+/// \brief e^x over the float range in double precision. The truncated Taylor
+/// series of degree 8 on |r| <= ln2/2 has a relative error below 2^-32, so the
+/// result rounded to float is within 0.51 ULP.
+template <typename V>
+[[nodiscard]] constexpr auto vexp_precise(V x) noexcept -> V
+{
+    using bits_t         = vmath_bits_t<V>;
+    constexpr auto magic = 0x1.8p52;
+
+    // beyond the float range, but 2^k stays a normal double
+    x = vmath_select(x > V(89.0), V(89.0), x);
+    x = vmath_select(x < V(-104.0), V(-104.0), x);
+
+    // adding magic rounds to an integer, which ends up in the low bits
+    auto const t = x * V(0x1.71547652B82FEp0) + V(magic);
+    auto const k = t - V(magic);
+    auto const r = x - k * V(0x1.62E42FEFA39EFp-1);
+
+    auto p = V(1.0 / 40320.0);
+    p      = p * r + V(1.0 / 5040.0);
+    p      = p * r + V(1.0 / 720.0);
+    p      = p * r + V(1.0 / 120.0);
+    p      = p * r + V(1.0 / 24.0);
+    p      = p * r + V(1.0 / 6.0);
+    p      = p * r + V(0.5);
+    p      = p * r + V(1.0);
+    p      = p * r + V(1.0);
+
+    auto const scale = vmath_from_bits<V>(bits_t((vmath_to_bits(t) << bits_t(52)) + bits_t(int64_t(1023) << 52)));
+    return p * scale;
+}
+
+/// \brief e^x in single precision, the error is below 1 ULP.
+///
+/// \details Cody-Waite reduction with ln2 split into two parts and a degree 7
+/// polynomial from Cephes. 2^k is applied in two steps, so results in the
+/// subnormal range are rounded only once.
+///
+/// Stephen L. Moshier, Cephes Math Library, expf.c.
+template <typename V>
+[[nodiscard]] constexpr auto vexp_fast(V x) noexcept -> V
+{
+    using bits_t         = vmath_bits_t<V>;
+    constexpr auto magic = 0x1.8p23F;
+
+    x = vmath_select(x > V(89.0F), V(89.0F), x);
+    x = vmath_select(x < V(-104.0F), V(-104.0F), x);
+
+    auto const t = x * V(0x1.715476p0F) + V(magic);
+    auto const k = t - V(magic);
+    auto const r = (x - k * V(0.693359375F)) - k * V(-2.12194440e-4F);
+    auto const z = r * r;
+
+    auto p = V(1.9875691500E-4F);
+    p      = p * r + V(1.3981999507E-3F);
+    p      = p * r + V(8.3334519073E-3F);
+    p      = p * r + V(4.1665795894E-2F);
+    p      = p * r + V(1.6666665459E-1F);
+    p      = p * r + V(5.0000001201E-1F);
+    p      = p * z + r + V(1.0F);
+
+    auto const ki = vmath_to_bits(t) - vmath_to_bits(V(magic));
+    auto const k1 = bits_t(ki >> bits_t(1));
+    auto const k2 = bits_t(ki - k1);
+    auto const s1 = vmath_from_bits<V>(bits_t((k1 + bits_t(127)) << bits_t(23)));
+    auto const s2 = vmath_from_bits<V>(bits_t((k2 + bits_t(127)) << bits_t(23)));
+    return p * s1 * s2;
+}
+
+/// \brief Natural logarithm over the float range in double precision.
+///
+/// \details x = 2^k (1 + f) with sqrt(2)/2 <= 1 + f < sqrt(2) and
+/// log(1 + f) = 2 atanh(s) with s = f / (2 + f). The series up to s^11 has
+/// a relative error below 2^-34, the result rounded to float is within
+/// 0.51 ULP. Floats are normal as doubles, no subnormal handling is needed.
+template <typename V>
+[[nodiscard]] constexpr auto vlog_precise(V x) noexcept -> V
+{
+    using bits_t = vmath_bits_t<V>;
+
+    auto const u = bits_t(vmath_to_bits(x) + bits_t(int64_t(0x3FF0'0000 - 0x3FE6'A09E) << 32));
+    auto const k = vmath_from_bits<V>(bits_t((u >> bits_t(52)) | bits_t(int64_t(0x4330'0000'0000'0000))))
+                 - V(0x1.0p52 + 1023.0);
+    auto const m = vmath_from_bits<V>(
+        bits_t((u & bits_t(int64_t(0x000F'FFFF'FFFF'FFFF))) + bits_t(int64_t(0x3FE6'A09E) << 32))
+    );
+
+    auto const f = m - V(1.0);
+    auto const s = f / (V(2.0) + f);
+    auto const z = s * s;
+
+    auto p = V(2.0 / 11.0);
+    p      = p * z + V(2.0 / 9.0);
+    p      = p * z + V(2.0 / 7.0);
+    p      = p * z + V(2.0 / 5.0);
+    p      = p * z + V(2.0 / 3.0);
+
+    auto const result = k * V(0x1.62E42FEFA39EFp-1) + (V(2.0) * s + s * z * p);
+    return vmath_log_special(x, result);
+}
+
+/// \brief Natural logarithm in single precision, the error is below 1 ULP.
+///
+/// \details Same reduction as vlog_precise, log(1 + f) is a degree 11
+/// polynomial from Cephes. Subnormal arguments are scaled by 2^23 first.
+///
+/// Stephen L. Moshier, Cephes Math Library, logf.c.
+template <typename V>
+[[nodiscard]] constexpr auto vlog_fast(V x) noexcept -> V
+{
+    using bits_t = vmath_bits_t<V>;
+
+    auto const subnormal = x < V(0x1.0p-126F);
+    auto const y         = vmath_select(subnormal, x * V(0x1.0p23F), x);
+
+    auto const u = bits_t(vmath_to_bits(y) + bits_t(0x3F80'0000 - 0x3F35'04F3));
+    auto k       = vmath_from_bits<V>(bits_t((u >> bits_t(23)) | bits_t(0x4B00'0000))) - V(0x1.0p23F + 127.0F);
+    k            = vmath_select(subnormal, k - V(23.0F), k);
+
+    auto const f = vmath_from_bits<V>(bits_t((u & bits_t(0x007F'FFFF)) + bits_t(0x3F35'04F3))) - V(1.0F);
+    auto const z = f * f;
+
+    auto p = V(7.0376836292E-2F);
+    p      = p * f + V(-1.1514610310E-1F);
+    p      = p * f + V(1.1676998740E-1F);
+    p      = p * f + V(-1.2420140846E-1F);
+    p      = p * f + V(1.4249322787E-1F);
+    p      = p * f + V(-1.6668057665E-1F);
+    p      = p * f + V(2.0000714765E-1F);
+    p      = p * f + V(-2.4999993993E-1F);
+    p      = p * f + V(3.3333331174E-1F);
+
+    auto r = f * z * p + k * V(-2.12194440e-4F) - V(0.5F) * z;
+    r      = (f + r) + k * V(0.693359375F);
+    return vmath_log_special(x, r);
+}
+
+/// \brief |x| up to which vsincos_precise reduces the argument exactly, about
+/// 2^20 pi/2. Larger arguments are computed with the scalar functions.
+inline constexpr auto vsincos_precise_limit = 0x1.921FB4p+20F;
+
+/// \brief sin(x) for quadrant 0 or cos(x) for quadrant 1 in double precision.
+///
+/// \details x is reduced to r + n pi/2 with pi/2 split into a 33 bit head and
+/// a tail, n times the head is exact for |x| < vsincos_precise_limit. The
+/// Taylor series of degree 11 and 10 on |r| <= pi/4 have a relative error
+/// below 2^-32, the results rounded to float are within 0.51 ULP.
+template <typename V>
+[[nodiscard]] constexpr auto vsincos_precise(V x, int quadrant) noexcept -> V
+{
+    using bits_t         = vmath_bits_t<V>;
+    constexpr auto magic = 0x1.8p52;
+
+    auto const t = x * V(0x1.45F306DC9C883p-1) + V(magic);
+    auto const n = t - V(magic);
+    auto const r = (x - n * V(1.57079632673412561417e+00)) - n * V(6.07710050650619224932e-11);
+    auto const z = r * r;
+
+    auto s = V(-1.0 / 39916800.0);
+    s      = s * z + V(1.0 / 362880.0);
+    s      = s * z + V(-1.0 / 5040.0);
+    s      = s * z + V(1.0 / 120.0);
+    s      = s * z + V(-1.0 / 6.0);
+    s      = r + r * z * s;
+
+    auto c = V(-1.0 / 3628800.0);
+    c      = c * z + V(1.0 / 40320.0);
+    c      = c * z + V(-1.0 / 720.0);
+    c      = c * z + V(1.0 / 24.0);
+    c      = c * z + V(-0.5);
+    c      = c * z + V(1.0);
+
+    return vmath_quadrant(s, c, bits_t(vmath_to_bits(t) + bits_t(quadrant)));
+}
+
+/// \brief |x| up to which vsincos_fast stays below 2 ULP. Beyond, the
+/// rounding error of the last part of pi/2 times n dominates close to the
+/// zeros. Larger arguments are computed with the scalar functions.
+inline constexpr auto vsincos_fast_limit = 256.0F;
+
+/// \brief sin(x) for quadrant 0 or cos(x) for quadrant 1 in single
+/// precision, the error is below 2 ULP.
+///
+/// \details pi/2 is split into three parts with 8, 11 and 24 bits, n times
+/// the first two is exact for |x| < 8192. The polynomials of
+/// degree 7 and 8 on |r| <= pi/4 are from Cephes.
+///
+/// Stephen L. Moshier, Cephes Math Library, sinf.c.
+template <typename V>
+[[nodiscard]] constexpr auto vsincos_fast(V x, int quadrant) noexcept -> V
+{
+    using bits_t         = vmath_bits_t<V>;
+    constexpr auto magic = 0x1.8p23F;
+
+    auto const t = x * V(0x1.45F306p-1F) + V(magic);
+    auto const n = t - V(magic);
+    auto const r = ((x - n * V(1.5703125F)) - n * V(4.837512969970703125e-4F)) - n * V(7.54978995489188216e-8F);
+    auto const z = r * r;
+
+    auto s = V(-1.9515295891E-4F);
+    s      = s * z + V(8.3321608736E-3F);
+    s      = s * z + V(-1.6666654611E-1F);
+    s      = r + r * z * s;
+
+    auto c = V(2.443315711809948E-5F);
+    c      = c * z + V(-1.388731625493765E-3F);
+    c      = c * z + V(4.166664568298827E-2F);
+    c      = V(1.0F) - V(0.5F) * z + z * z * c;
+
+    return vmath_quadrant(s, c, bits_t(vmath_to_bits(t) + bits_t(quadrant)));
+}
+
+/// \brief Applies kernel to in and stores the results to out, V::size()
+/// elements per step. The remaining elements are passed to the same kernel
+/// as scalars. With a fallback, elements with a magnitude above limit or
+/// infinite ones are overwritten by fallback(x).
+template <typename V, typename Kernel, typename Fallback = nullptr_t>
+constexpr auto vmath_transform(
+    span<float const> in,
+    span<float> out,
+    Kernel kernel,
+    typename V::value_type limit = 0,
+    Fallback fallback            = {}
+) -> void
+{
+    using T = typename V::value_type;
+    TETL_ASSERT(in.size() == out.size());
+
+    auto const* const src = in.data();
+    auto* const dst       = out.data();
+
+    auto const body = in.size() - in.size() % V::size();
+    for (size_t i = 0; i < body; i += V::size()) {
+        auto const x = V { src + i, element_aligned };
+        kernel(x).copy_to(dst + i, element_aligned);
+
+        if constexpr (not is_null_pointer_v<Fallback>) {
+            if (vmath_any((x > V(limit)) || (x < V(-limit)))) {
+                for (size_t j = 0; j < V::size(); ++j) {
+                    if (x[j] > limit or x[j] < -limit) { dst[i + j] = static_cast<float>(fallback(x[j])); }
+                }
+            }
+        }
+    }
+
+    for (auto i = body; i < in.size(); ++i) {
+        auto const x = static_cast<T>(src[i]);
+        if constexpr (not is_null_pointer_v<Fallback>) {
+            if (x > limit or x < -limit) {
+                dst[i] = static_cast<float>(fallback(x));
+                continue;
+            }
+        }
+        dst[i] = static_cast<float>(kernel(x));
+    }
+}
+
+} // namespace etl::detail
+
+#endif // TETL_SIMD_VMATH_KERNEL_HPP
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_VSIN_HPP
+#define TETL_SIMD_VSIN_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cmath/sin.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_fwd.hpp"
+#include "etl/_simd/vmath_accuracy.hpp"
+#include "etl/_simd/vmath_kernel.hpp"
+#include "etl/_span/span.hpp"
+
+namespace etl {
+
+/// \brief Computes the sine of each element (measured in radians) of in and
+/// stores the results to out, which must have the same size. in and out may
+/// be the same memory.
+///
+/// \details Each step processes a native_simd, the remaining elements run
+/// through the same kernel as scalars. The error is below 1 ULP with precise
+/// and below 2 ULP with fast. Elements beyond the range of the vector
+/// argument reduction, about 10^6 with precise and 256 with fast, are
+/// computed by etl::sin in double precision.
+constexpr auto vsin(span<float const> in, span<float> out, vmath_accuracy accuracy = vmath_accuracy::precise) -> void
+{
+    auto const fallback = [](double x) { return etl::sin(x); };
+    if (accuracy == vmath_accuracy::fast) {
+        detail::vmath_transform<native_simd<float>>(
+            in, out, [](auto x) { return detail::vsincos_fast(x, 0); }, detail::vsincos_fast_limit, fallback
+        );
+    } else {
+        detail::vmath_transform<native_simd<double>>(
+            in, out, [](auto x) { return detail::vsincos_precise(x, 0); }, detail::vsincos_precise_limit, fallback
+        );
+    }
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_VSIN_HPP
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_SIMD_WHERE_HPP
+#define TETL_SIMD_WHERE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_simd/const_where_expression.hpp"
+#include "etl/_simd/simd.hpp"
+#include "etl/_simd/simd_mask.hpp"
+#include "etl/_simd/where_expression.hpp"
+#include "etl/_type_traits/type_identity.hpp"
+
+namespace etl {
+
+/// \brief Selects the elements of v, for which mask is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto where(type_identity_t<simd_mask<T, Abi>> const& mask, simd<T, Abi>& v) noexcept
+    -> where_expression<simd_mask<T, Abi>, simd<T, Abi>>
+{
+    return { mask, v };
+}
+
+/// \brief Selects the elements of v, for which mask is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto where(type_identity_t<simd_mask<T, Abi>> const& mask, simd<T, Abi> const& v) noexcept
+    -> const_where_expression<simd_mask<T, Abi>, simd<T, Abi>>
+{
+    return { mask, v };
+}
+
+/// \brief Selects the elements of v, for which mask is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto where(type_identity_t<simd_mask<T, Abi>> const& mask, simd_mask<T, Abi>& v) noexcept
+    -> where_expression<simd_mask<T, Abi>, simd_mask<T, Abi>>
+{
+    return { mask, v };
+}
+
+/// \brief Selects the elements of v, for which mask is true.
+template <typename T, typename Abi>
+[[nodiscard]] constexpr auto where(type_identity_t<simd_mask<T, Abi>> const& mask, simd_mask<T, Abi> const& v) noexcept
+    -> const_where_expression<simd_mask<T, Abi>, simd_mask<T, Abi>>
+{
+    return { mask, v };
+}
+
+} // namespace etl
+
+#endif // TETL_SIMD_WHERE_HPP
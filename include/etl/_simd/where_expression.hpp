@@ -3,43 +3,113 @@
 #ifndef TETL_SIMD_WHERE_EXPRESSION_HPP
 #define TETL_SIMD_WHERE_EXPRESSION_HPP
 
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
 #include "etl/_simd/const_where_expression.hpp"
+#include "etl/_simd/is_simd_flag_type.hpp"
+#include "etl/_simd/simd_storage.hpp"
 
 namespace etl {
 
+/// \brief Selects the elements of a simd (or simd_mask) object, for which the
+/// mask is true. Assignments only modify the selected elements. Created by
+/// etl::where.
+///
+/// \code
+/// auto v = etl::simd<float>{[](auto i) { return float(i) - 1.0F; }};
+/// etl::where(v < 0.0F, v) = 0.0F;
+/// \endcode
 template <typename M, typename T>
 struct where_expression : const_where_expression<M, T> {
+    using const_where_expression<M, T>::const_where_expression;
+
     template <typename U>
-    auto operator=(U&& x) && noexcept -> void;
+    constexpr auto operator=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator+=(U&& x) && noexcept -> void;
+    constexpr auto operator+=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ + T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator-=(U&& x) && noexcept -> void;
+    constexpr auto operator-=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ - T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator*=(U&& x) && noexcept -> void;
+    constexpr auto operator*=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ * T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator/=(U&& x) && noexcept -> void;
+    constexpr auto operator/=(U&& x) && noexcept -> void
+    {
+        // Unselected lanes may hold a zero divisor, only divide by the selected ones.
+        auto const value   = T(static_cast<U&&>(x));
+        auto const divisor = T::make(detail::simd_select(this->mask_._data(), value._data(), T(1)._data()));
+        this->data_        = this->select(this->data_ / divisor);
+    }
+
     template <typename U>
-    auto operator%=(U&& x) && noexcept -> void;
+    constexpr auto operator%=(U&& x) && noexcept -> void
+    {
+        auto const value   = T(static_cast<U&&>(x));
+        auto const divisor = T::make(detail::simd_select(this->mask_._data(), value._data(), T(1)._data()));
+        this->data_        = this->select(this->data_ % divisor);
+    }
+
     template <typename U>
-    auto operator&=(U&& x) && noexcept -> void;
+    constexpr auto operator&=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ & T(static_cast<U&&>(x)));
+    }
 
     template <typename U>
-    auto operator|=(U&& x) && noexcept -> void;
+    constexpr auto operator|=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ | T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator^=(U&& x) && noexcept -> void;
+    constexpr auto operator^=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ ^ T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator<<=(U&& x) && noexcept -> void;
+    constexpr auto operator<<=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ << T(static_cast<U&&>(x)));
+    }
+
     template <typename U>
-    auto operator>>=(U&& x) && noexcept -> void;
+    constexpr auto operator>>=(U&& x) && noexcept -> void
+    {
+        this->data_ = this->select(this->data_ >> T(static_cast<U&&>(x)));
+    }
 
-    auto operator++() && noexcept -> void;
-    auto operator++(int) && noexcept -> void;
-    auto operator--() && noexcept -> void;
-    auto operator--(int) && noexcept -> void;
+    constexpr auto operator++() && noexcept -> void { this->data_ = this->select(this->data_ + T(1)); }
+    constexpr auto operator++(int) && noexcept -> void { this->data_ = this->select(this->data_ + T(1)); }
+    constexpr auto operator--() && noexcept -> void { this->data_ = this->select(this->data_ - T(1)); }
+    constexpr auto operator--(int) && noexcept -> void { this->data_ = this->select(this->data_ - T(1)); }
 
+    /// \brief Loads the selected elements from mem[i]. The other elements of
+    /// mem are not accessed.
     template <typename U, typename Flags>
-    auto copy_from(U const* mem, Flags) && -> void;
+        requires(is_simd_flag_type_v<Flags>)
+    constexpr auto copy_from(U const* mem, Flags /*flags*/) && -> void
+    {
+        auto const& mask = this->mask_;
+        auto const& old  = this->data_;
+        this->data_      = T([&](auto i) { return mask[i] ? static_cast<typename T::value_type>(mem[i]) : old[i]; });
+    }
 };
 
 } // namespace etl
@@ -6,6 +6,8 @@
 #include "etl/_config/all.hpp"
 
 #include "etl/_array/array.hpp"
+#include "etl/_cstddef/byte.hpp"
+#include "etl/_functional/hash.hpp"
 #include "etl/_iterator/begin.hpp"
 #include "etl/_iterator/data.hpp"
 #include "etl/_iterator/end.hpp"
@@ -17,6 +19,9 @@
 #include "etl/_limits/numeric_limits.hpp"
 #include "etl/_span/dynamic_extent.hpp"
 #include "etl/_type_traits/declval.hpp"
+#include "etl/_type_traits/is_integral.hpp"
+#include "etl/_type_traits/is_same.hpp"
+#include "etl/_type_traits/remove_cv.hpp"
 #include "etl/_type_traits/remove_pointer.hpp"
 
 namespace etl {
@@ -252,6 +257,17 @@ template <typename Container,
     typename Element = etl::remove_pointer_t<decltype(etl::declval<Container const&>().data())>>
 span(Container const&) -> span<Element>;
 
+/// \brief Hashes the object representation of the viewed elements. Only
+/// available for spans over integers and etl::byte, which have no padding bits.
+template <typename ElementType, etl::size_t Extent>
+    requires(is_integral_v<remove_cv_t<ElementType>> or is_same_v<remove_cv_t<ElementType>, byte>)
+struct hash<span<ElementType, Extent>> {
+    [[nodiscard]] constexpr auto operator()(span<ElementType, Extent> s) const noexcept -> etl::size_t
+    {
+        return detail::hash_bytes(s.data(), s.size_bytes());
+    }
+};
+
 } // namespace etl
 
 #endif // TETL_SPAN_SPAN_HPP
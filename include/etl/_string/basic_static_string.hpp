@@ -9,6 +9,7 @@
 #include "etl/_algorithm/rotate.hpp"
 #include "etl/_container/smallest_size_t.hpp"
 #include "etl/_cstring/memset.hpp"
+#include "etl/_functional/hash.hpp"
 #include "etl/_iterator/begin.hpp"
 #include "etl/_iterator/data.hpp"
 #include "etl/_iterator/distance.hpp"
@@ -1606,6 +1607,17 @@ constexpr auto erase_if(basic_static_string<CharT, Capacity, Traits>& c, Predica
     return static_cast<return_type>(r);
 }
 
+/// \brief Hashes the characters of the string, equal to the hash of the
+/// corresponding basic_string_view.
+template <typename CharT, etl::size_t Capacity, typename Traits>
+struct hash<basic_static_string<CharT, Capacity, Traits>> {
+    [[nodiscard]] constexpr auto operator()(basic_static_string<CharT, Capacity, Traits> const& str) const noexcept
+        -> etl::size_t
+    {
+        return hash<basic_string_view<CharT, Traits>> {}(str);
+    }
+};
+
 } // namespace etl
 
 #endif // TETL_STRING_BASIC_STATIC_STRING_HPP
@@ -7,6 +7,7 @@
 #include "etl/_algorithm/min.hpp"
 #include "etl/_algorithm/none_of.hpp"
 #include "etl/_concepts/emulation.hpp"
+#include "etl/_functional/hash.hpp"
 #include "etl/_iterator/begin.hpp"
 #include "etl/_iterator/data.hpp"
 #include "etl/_iterator/end.hpp"
@@ -804,6 +805,16 @@ template <typename CharT, typename Traits, int = 2>
     return (lhs > rhs) || (lhs == rhs);
 }
 
+/// \brief The hash of a view depends only on the viewed characters, so views,
+/// static_strings and null-terminated strings with equal contents hash equal.
+template <typename CharType, typename Traits>
+struct hash<basic_string_view<CharType, Traits>> {
+    [[nodiscard]] constexpr auto operator()(basic_string_view<CharType, Traits> sv) const noexcept -> etl::size_t
+    {
+        return detail::hash_bytes(sv.data(), sv.size() * sizeof(CharType));
+    }
+};
+
 } // namespace etl
 
 #endif // TETL_BASIC_STRING_VIEW_STRING_VIEW_HPP
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_HPP
+#define TETL_TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_cstddef/size_t.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
+#include "etl/_type_traits/is_trivially_destructible.hpp"
+
+namespace etl {
+
+/// \brief If T is trivially relocatable, provides the member constant value
+/// equal to true. For any other type, value is false.
+///
+/// \details Relocating an object means move-constructing a new object from it
+/// and destroying the source. For a trivially relocatable type this operation
+/// is equivalent to copying the object representation with memcpy/memmove.
+/// Every trivially move constructible and trivially destructible type
+/// qualifies. Types that own resources through a pointer, but do not point
+/// into themselves, can opt-in by specializing this template:
+///
+/// \code
+/// template <>
+/// struct etl::is_trivially_relocatable<my_record> : etl::true_type { };
+/// \endcode
+///
+/// https://wg21.link/p1144
+template <typename T>
+struct is_trivially_relocatable
+    : bool_constant<__is_trivially_constructible(T, T&&) && is_trivially_destructible_v<T>> { };
+
+template <typename T>
+struct is_trivially_relocatable<T const> : is_trivially_relocatable<T> { };
+
+template <typename T, size_t N>
+struct is_trivially_relocatable<T[N]> : is_trivially_relocatable<T> { };
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+} // namespace etl
+
+#endif // TETL_TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_HPP
@@ -6,6 +6,7 @@
 #include "etl/_array/array.hpp"
 #include "etl/_container/smallest_size_t.hpp"
 #include "etl/_cstddef/size_t.hpp"
+#include "etl/_cstring/memcpy.hpp"
 #include "etl/_exception/raise.hpp"
 #include "etl/_functional/equal_to.hpp"
 #include "etl/_functional/greater.hpp"
@@ -13,16 +14,26 @@
 #include "etl/_functional/less.hpp"
 #include "etl/_functional/less_equal.hpp"
 #include "etl/_limits/numeric_limits.hpp"
+#include "etl/_memory/relocate_at.hpp"
 #include "etl/_new/operator.hpp"
 #include "etl/_type_traits/add_pointer.hpp"
-#include "etl/_type_traits/aligned_storage.hpp"
+#include "etl/_type_traits/aligned_union.hpp"
+#include "etl/_type_traits/bool_constant.hpp"
 #include "etl/_type_traits/declval.hpp"
 #include "etl/_type_traits/integral_constant.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
+#include "etl/_type_traits/is_copy_assignable.hpp"
+#include "etl/_type_traits/is_copy_constructible.hpp"
 #include "etl/_type_traits/is_default_constructible.hpp"
+#include "etl/_type_traits/is_move_constructible.hpp"
 #include "etl/_type_traits/is_nothrow_default_constructible.hpp"
 #include "etl/_type_traits/is_nothrow_move_constructible.hpp"
 #include "etl/_type_traits/is_nothrow_swappable.hpp"
+#include "etl/_type_traits/remove_cvref.hpp"
 #include "etl/_type_traits/is_same.hpp"
+#include "etl/_type_traits/is_trivially_copyable.hpp"
+#include "etl/_type_traits/is_trivially_destructible.hpp"
+#include "etl/_type_traits/is_trivially_relocatable.hpp"
 #include "etl/_type_traits/type_pack_element.hpp"
 #include "etl/_utility/forward.hpp"
 #include "etl/_utility/in_place_index.hpp"
@@ -80,181 +91,165 @@ constexpr auto make_variant_compare_table(index_sequence<Indices...> /*is*/)
 template <typename Op, typename Variant, typename... Ts>
 inline constexpr auto variant_compare_table = make_variant_compare_table<Op, Variant>(index_sequence_for<Ts...> {});
 
-template <size_t Index, typename...>
-struct variant_storage;
+template <typename T>
+inline constexpr auto is_in_place_tag = false;
 
-template <size_t Index, typename Head>
-struct variant_storage<Index, Head> {
-    using storage_t = aligned_storage_t<sizeof(Head), alignof(Head)>;
-    storage_t data;
+template <typename T>
+inline constexpr auto is_in_place_tag<in_place_type_t<T>> = true;
 
-    template <typename T>
-    constexpr auto construct(T&& head, size_t& index) -> void
-    {
-        new (&data) Head(forward<T>(head));
-        index = 0;
-    }
+template <size_t I>
+inline constexpr auto is_in_place_tag<in_place_index_t<I>> = true;
 
-    template <typename T, typename... Args>
-    constexpr auto construct(in_place_type_t<T> /*tag*/, size_t& index, Args&&... args) -> void
-    {
-        new (&data) Head(forward<Args>(args)...);
-        index = 0;
+/// \brief Index of the first occurrence of T in Ts. Evaluates to sizeof...(Ts)
+/// if T is not an alternative.
+template <typename T, typename... Ts>
+inline constexpr auto variant_index_of = [] {
+    bool const matches[] { is_same_v<T, Ts>... };
+    auto index = size_t { 0 };
+    for (; index != sizeof...(Ts); ++index) {
+        if (matches[index]) { break; }
     }
+    return index;
+}();
 
-    constexpr auto destruct(size_t /*unused*/) -> void { static_cast<Head*>(static_cast<void*>(&data))->~Head(); }
-
-    [[nodiscard]] constexpr auto get_index(Head const& /*head*/) const -> integral_constant<size_t, Index>
-    {
-        return {};
-    }
-
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) & -> Head& { return *to_ptr(); }
+/// \brief Imaginary function FUN(T_i) for each alternative, used to select the
+/// alternative of the converting constructor via overload resolution.
+template <size_t I, typename T>
+struct variant_overload {
+    auto operator()(T /*ignore*/) const -> integral_constant<size_t, I>;
+};
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) const& -> Head const&
-    {
-        return *to_ptr();
-    }
+template <typename Indices, typename... Ts>
+struct variant_overload_set;
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) && -> Head&&
-    {
-        return move(*to_ptr());
-    }
+template <size_t... Is, typename... Ts>
+struct variant_overload_set<index_sequence<Is...>, Ts...> : variant_overload<Is, Ts>... {
+    using variant_overload<Is, Ts>::operator()...;
+};
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) const&& -> Head const&&
-    {
-        return move(*to_ptr());
+/// \brief Alternative selected by the converting constructor. An exact match
+/// is preferred, otherwise overload resolution is used.
+template <typename T, typename... Ts>
+inline constexpr auto variant_converting_index = [] {
+    if constexpr (variant_index_of<remove_cvref_t<T>, Ts...> != sizeof...(Ts)) {
+        return variant_index_of<remove_cvref_t<T>, Ts...>;
+    } else {
+        using overloads = variant_overload_set<index_sequence_for<Ts...>, Ts...>;
+        return decltype(overloads {}(declval<T>()))::value;
     }
+}();
 
-    [[nodiscard]] constexpr auto to_ptr() noexcept -> Head* { return static_cast<Head*>(static_cast<void*>(&data)); }
+template <typename Storage, typename T>
+auto variant_destroy_func(Storage& storage) -> void
+{
+    static_cast<T*>(static_cast<void*>(&storage))->~T();
+}
 
-    [[nodiscard]] constexpr auto to_ptr() const noexcept -> Head const*
-    {
-        return static_cast<Head const*>(static_cast<void const*>(&data));
-    }
-};
+template <typename Storage, typename T>
+auto variant_copy_func(Storage& dest, Storage const& src) -> void
+{
+    ::new (static_cast<void*>(&dest)) T(*static_cast<T const*>(static_cast<void const*>(&src)));
+}
 
-template <size_t Index, typename Head, typename... Tail>
-struct variant_storage<Index, Head, Tail...> {
-    using storage_t = aligned_storage_t<sizeof(Head), alignof(Head)>;
+template <typename Storage, typename T>
+auto variant_move_func(Storage& dest, Storage& src) -> void
+{
+    ::new (static_cast<void*>(&dest)) T(move(*static_cast<T*>(static_cast<void*>(&src))));
+}
 
-    union {
-        storage_t data;
-        variant_storage<Index + 1, Tail...> tail;
-    };
+template <typename Storage, typename T>
+auto variant_copy_assign_func(Storage& dest, Storage const& src) -> void
+{
+    *static_cast<T*>(static_cast<void*>(&dest)) = *static_cast<T const*>(static_cast<void const*>(&src));
+}
 
-    constexpr auto construct(Head const& head, size_t& index) -> void
-    {
-        new (&data) Head(head);
-        index = 0;
-    }
+template <typename Storage, typename... Ts>
+inline constexpr auto variant_destroy_table = array { &variant_destroy_func<Storage, Ts>... };
 
-    constexpr auto construct(Head& head, size_t& index) -> void
-    {
-        auto const& headCref = head;
-        construct(headCref, index);
-    }
+template <typename Storage, typename... Ts>
+inline constexpr auto variant_copy_table = array { &variant_copy_func<Storage, Ts>... };
 
-    constexpr auto construct(Head&& head, size_t& index) -> void
-    {
-        new (&data) Head(move(head));
-        index = 0;
-    }
+template <typename Storage, typename... Ts>
+inline constexpr auto variant_move_table = array { &variant_move_func<Storage, Ts>... };
 
-    template <typename... Args>
-    constexpr auto construct(in_place_type_t<Head> /*tag*/, size_t& index, Args&&... args) -> void
-    {
-        new (&data) Head(forward<Args>(args)...);
-        index = 0;
-    }
+template <typename Storage, typename... Ts>
+inline constexpr auto variant_copy_assign_table = array { &variant_copy_assign_func<Storage, Ts>... };
 
-    template <typename T>
-    constexpr auto construct(T&& t, size_t& index) -> void
-    {
-        tail.construct(forward<T>(t), index);
-        ++index;
-    }
+/// \brief Flat storage for all alternatives. The active alternative is tracked
+/// by the variant itself.
+template <typename... Ts>
+struct variant_storage {
+    template <size_t I>
+    using alternative_t = type_pack_element_t<I, Ts...>;
 
-    template <typename T, typename... Args>
-    constexpr auto construct(in_place_type_t<T> tag, size_t& index, Args&&... args) -> void
+    template <size_t I, typename... Args>
+    auto construct(Args&&... args) -> void
     {
-        tail.construct(tag, index, forward<Args>(args)...);
-        ++index;
+        ::new (static_cast<void*>(&data)) alternative_t<I>(forward<Args>(args)...);
     }
 
-    constexpr auto destruct(size_t index) -> void
+    auto destruct(size_t index) -> void
     {
-        if (index == 0) {
-            static_cast<Head*>(static_cast<void*>(&data))->~Head();
-            return;
+        if constexpr (!(is_trivially_destructible_v<Ts> && ...)) {
+            variant_destroy_table<storage_t, Ts...>[index](data);
         }
-
-        tail.destruct(index - 1);
     }
 
-    [[nodiscard]] constexpr auto get_index(Head const& /*head*/) const -> integral_constant<size_t, Index>
+    auto copy_construct(size_t index, variant_storage const& other) -> void
     {
-        return {};
+        variant_copy_table<storage_t, Ts...>[index](data, other.data);
     }
 
-    template <typename T>
-    [[nodiscard]] constexpr auto get_index(T const& t) const
+    auto move_construct(size_t index, variant_storage& other) -> void
     {
-        return tail.get_index(t);
+        variant_move_table<storage_t, Ts...>[index](data, other.data);
     }
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) & -> Head& { return *to_ptr(); }
-
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) const& -> Head const&
+    auto copy_assign(size_t index, variant_storage const& other) -> void
     {
-        return *to_ptr();
+        variant_copy_assign_table<storage_t, Ts...>[index](data, other.data);
     }
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) && -> Head&&
+    template <size_t I>
+    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, I> /*ic*/) & -> alternative_t<I>&
     {
-        return move(*to_ptr());
+        return *to_ptr<I>();
     }
 
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, Index> /*ic*/) const&& -> Head const&&
+    template <size_t I>
+    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, I> /*ic*/) const& -> alternative_t<I> const&
     {
-        return move(*to_ptr());
+        return *to_ptr<I>();
     }
 
-    template <size_t N>
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, N> ic) & -> auto&
+    template <size_t I>
+    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, I> /*ic*/) && -> alternative_t<I>&&
     {
-        return tail.get_value(ic);
+        return move(*to_ptr<I>());
     }
 
-    template <size_t N>
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, N> ic) const& -> auto const&
+    template <size_t I>
+    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, I> /*ic*/) const&& -> alternative_t<I> const&&
     {
-        return tail.get_value(ic);
+        return move(*to_ptr<I>());
     }
 
-    template <size_t N>
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, N> ic) && -> auto&&
+    template <size_t I>
+    [[nodiscard]] constexpr auto to_ptr() noexcept -> alternative_t<I>*
     {
-        return move(tail).get_value(ic);
+        return static_cast<alternative_t<I>*>(static_cast<void*>(&data));
     }
 
-    template <size_t N>
-    [[nodiscard]] constexpr auto get_value(integral_constant<size_t, N> ic) const&& -> auto const&&
+    template <size_t I>
+    [[nodiscard]] constexpr auto to_ptr() const noexcept -> alternative_t<I> const*
     {
-        return move(tail).get_value(ic);
+        return static_cast<alternative_t<I> const*>(static_cast<void const*>(&data));
     }
 
-    [[nodiscard]] constexpr auto to_ptr() noexcept -> Head* { return static_cast<Head*>(static_cast<void*>(&data)); }
-
-    [[nodiscard]] constexpr auto to_ptr() const noexcept -> Head const*
-    {
-        return static_cast<Head const*>(static_cast<void const*>(&data));
-    }
+    using storage_t = aligned_union_t<0, Ts...>;
+    storage_t data;
 };
 
-template <typename... Ts>
-using variant_storage_for = detail::variant_storage<0, Ts...>;
-
 template <typename... Ts>
 inline constexpr auto enable_variant_swap = ((is_move_constructible_v<Ts> && is_swappable_v<Ts>)&&...);
 
@@ -277,10 +272,8 @@ private:
 public:
     constexpr variant() noexcept(noexcept(is_nothrow_default_constructible_v<first_type>))
         requires(is_default_constructible_v<first_type>)
+        : variant(in_place_index<0>)
     {
-        auto tmpIndex = size_t { index_ };
-        data_.construct(in_place_type<first_type>, tmpIndex);
-        index_ = static_cast<internal_size_t>(tmpIndex);
     }
 
     /// \brief (4) Converting constructor.
@@ -288,11 +281,9 @@ public:
     ///
     /// https://en.cppreference.com/w/cpp/utility/variant/variant
     template <typename T>
-    explicit variant(T&& t)
+        requires(!is_same_v<remove_cvref_t<T>, variant> && !detail::is_in_place_tag<remove_cvref_t<T>>)
+    explicit variant(T&& t) : variant(in_place_index<detail::variant_converting_index<T, Types...>>, forward<T>(t))
     {
-        auto tmpIndex = size_t { index_ };
-        data_.construct(forward<T>(t), tmpIndex);
-        index_ = static_cast<internal_size_t>(tmpIndex);
     }
 
     /// \brief (5) Constructs a variant with the specified alternative T and
@@ -308,11 +299,9 @@ public:
     /// \bug Improve sfinae (single unique type in variant)
     template <typename T, typename... Args>
         requires(is_constructible_v<T, Args...>)
-    constexpr explicit variant(in_place_type_t<T> tag, Args&&... args)
+    constexpr explicit variant(in_place_type_t<T> /*tag*/, Args&&... args)
+        : variant(in_place_index<detail::variant_index_of<T, Types...>>, forward<Args>(args)...)
     {
-        auto tmpIndex = size_t { index_ };
-        data_.construct(tag, tmpIndex, forward<Args>(args)...);
-        index_ = static_cast<internal_size_t>(tmpIndex);
     }
 
     /// \brief (7) Constructs a variant with the alternative T_i specified by
@@ -325,37 +314,76 @@ public:
     /// https://en.cppreference.com/w/cpp/utility/variant/variant
     template <size_t I, typename... Args>
         requires(I < sizeof...(Types)) && (is_constructible_v<variant_alternative_t<I, variant>, Args...>)
-    constexpr explicit variant(in_place_index_t<I> /*tag*/, Args&&... args)
-        : variant(in_place_type<variant_alternative_t<I, variant>>, forward<Args>(args)...)
+    constexpr explicit variant(in_place_index_t<I> /*tag*/, Args&&... args) : index_ { static_cast<internal_size_t>(I) }
     {
+        data_.template construct<I>(forward<Args>(args)...);
+    }
+
+    /// \brief Copy constructor. Trivial if all alternatives are trivially
+    /// copyable.
+    constexpr variant(variant const& other) requires((is_trivially_copyable_v<Types> && ...)) = default;
+
+    /// \brief Copy constructor. Copy constructs the alternative held by other.
+    variant(variant const& other)
+        requires((is_copy_constructible_v<Types> && ...) && !(is_trivially_copyable_v<Types> && ...))
+        : index_ { other.index_ }
+    {
+        data_.copy_construct(index_, other.data_);
+    }
+
+    /// \brief Move constructor. Trivial if all alternatives are trivially
+    /// copyable.
+    constexpr variant(variant&& other) requires((is_trivially_copyable_v<Types> && ...)) = default;
+
+    /// \brief Move constructor. Move constructs the alternative held by other.
+    variant(variant&& other) noexcept((is_nothrow_move_constructible_v<Types> && ...))
+        requires((is_move_constructible_v<Types> && ...) && !(is_trivially_copyable_v<Types> && ...))
+        : index_ { other.index_ }
+    {
+        data_.move_construct(index_, other.data_);
     }
 
     /// \brief If valueless_by_exception is true, does nothing. Otherwise,
-    /// destroys the currently contained value.
-    /// \todo This destructor is trivial if
+    /// destroys the currently contained value. This destructor is trivial if
     /// is_trivially_destructible_v<T_i> is true for all T_i in Types...
+    ~variant() requires((is_trivially_destructible_v<Types> && ...)) = default;
+
+    /// \brief If valueless_by_exception is true, does nothing. Otherwise,
+    /// destroys the currently contained value.
     ~variant()
     {
         if (!valueless_by_exception()) { data_.destruct(index_); }
     }
 
     /// \brief Copy-assignment
-    /// \details  If both *this and rhs are valueless by exception, does
-    /// nothing. Otherwise, if rhs holds the same alternative as *this, assigns
-    /// the value contained in rhs to the value contained in *this. If an
-    /// exception is thrown, *this does not become valueless: the value depends
-    /// on the exception safety guarantee of the alternative's copy assignment.
+    /// \details If both hold the same alternative, copy assigns it. Otherwise
+    /// copies rhs into a temporary, destroys the value contained in *this and
+    /// move constructs the alternative from the temporary. If the copy into
+    /// the temporary throws, *this is unchanged.
+    ///
+    /// This overload participates in overload resolution only if all
+    /// alternatives are copy constructible, copy assignable and nothrow move
+    /// constructible.
     constexpr auto operator=(variant const& rhs) -> variant&
+        requires((is_copy_constructible_v<Types> && ...) && (is_copy_assignable_v<Types> && ...)
+                 && (is_nothrow_move_constructible_v<Types> && ...))
     {
         // Self assignment
         if (this == &rhs) { return *this; }
 
-        // Same type
-        if (index() && rhs.index()) {
-            data_ = rhs.data_;
-            return *this;
+        if constexpr ((is_trivially_copyable_v<Types> && ...)) {
+            // bytewise, GCC doesn't treat an aggregate copy of the storage
+            // as a store to the alternative and miscompiles later loads
+            etl::memcpy(&data_, &rhs.data_, sizeof(data_));
+        } else if (index_ == rhs.index_) {
+            data_.copy_assign(index_, rhs.data_);
+        } else {
+            auto tmp = variant { rhs };
+            data_.destruct(index_);
+            data_.move_construct(tmp.index_, tmp.data_);
         }
 
+        index_ = rhs.index_;
         return *this;
     }
 
@@ -371,22 +399,35 @@ public:
     /// always returns false, since there is no default constructor.
     [[nodiscard]] constexpr auto valueless_by_exception() const noexcept -> bool { return false; }
 
-    /// \brief Swaps two variant objects.
+    /// \brief Swaps two variant objects. If all alternatives are trivially
+    /// relocatable, the variants are swapped bytewise, even if they hold
+    /// different alternatives.
     constexpr auto swap(variant& rhs) noexcept(
         ((is_nothrow_move_constructible_v<Types> && is_nothrow_swappable_v<Types>)&&...)) -> void
     {
+        if constexpr ((is_trivially_relocatable_v<Types> && ...)) {
+            if (!is_constant_evaluated()) {
+                detail::trivially_relocating_swap(*this, rhs);
+                return;
+            }
+        }
+
         if (index() == rhs.index()) { detail::variant_swap_table<variant, Types...>[index()](*this, rhs); }
     }
 
     /// \todo Remove & replace with friendship for get_if.
-    [[nodiscard]] auto _impl() const noexcept { return &data_; } // NOLINT
-    auto _impl() noexcept { return &data_; }                     // NOLINT
+    [[nodiscard]] constexpr auto _impl() const noexcept { return &data_; } // NOLINT
+    [[nodiscard]] constexpr auto _impl() noexcept { return &data_; }       // NOLINT
 
 private:
-    detail::variant_storage_for<Types...> data_;
-    internal_size_t index_ { 0 };
+    detail::variant_storage<Types...> data_;
+    internal_size_t index_;
 };
 
+/// \brief A variant is trivially relocatable, if all its alternatives are.
+template <typename... Ts>
+struct is_trivially_relocatable<variant<Ts...>> : bool_constant<(is_trivially_relocatable_v<Ts> && ...)> { };
+
 /// \brief Overloads the swap algorithm for variant. Effectively calls
 /// lhs.swap(rhs).
 ///
@@ -511,8 +552,9 @@ constexpr auto operator>=(variant<Ts...> const& lhs, variant<Ts...> const& rhs)
 template <typename T, typename... Types>
 constexpr auto holds_alternative(variant<Types...> const& v) noexcept -> bool
 {
-    using index_t = decltype(v._impl()->get_index(declval<T>()));
-    return index_t::value == v.index();
+    constexpr auto index = detail::variant_index_of<T, Types...>;
+    static_assert(index != sizeof...(Types), "T must be an alternative of the variant");
+    return index == v.index();
 }
 
 /// \brief Index-based non-throwing accessor: If pv is not a null pointer and
@@ -543,8 +585,7 @@ constexpr auto get_if(variant<Types...> const* pv) noexcept
 template <typename T, typename... Types>
 constexpr auto get_if(variant<Types...>* v) noexcept -> add_pointer_t<T>
 {
-    using idx  = decltype((*v)._impl()->get_index(declval<T>()));
-    using ic_t = integral_constant<size_t, idx::value>;
+    using ic_t = integral_constant<size_t, detail::variant_index_of<T, Types...>>;
     if (holds_alternative<T>(*v)) { return &(v->_impl()->get_value(ic_t {})); }
     return nullptr;
 }
@@ -554,8 +595,7 @@ constexpr auto get_if(variant<Types...>* v) noexcept -> add_pointer_t<T>
 template <typename T, typename... Types>
 constexpr auto get_if(variant<Types...> const* v) noexcept -> add_pointer_t<T const>
 {
-    using idx  = decltype((*v)._impl()->get_index(declval<T const>()));
-    using ic_t = integral_constant<size_t, idx::value>;
+    using ic_t = integral_constant<size_t, detail::variant_index_of<T, Types...>>;
     if (holds_alternative<T>(*v)) { return &(v->_impl()->get_value(ic_t {})); }
     return nullptr;
 }
@@ -3,19 +3,17 @@
 #ifndef TETL_VARIANT_VISIT_HPP
 #define TETL_VARIANT_VISIT_HPP
 
+#include "etl/_array/array.hpp"
 #include "etl/_cstddef/size_t.hpp"
-#include "etl/_tuple/tuple.hpp"
-#include "etl/_type_traits/add_rvalue_reference.hpp"
 #include "etl/_type_traits/bool_constant.hpp"
-#include "etl/_type_traits/conditional.hpp"
+#include "etl/_type_traits/declval.hpp"
 #include "etl/_type_traits/decay.hpp"
+#include "etl/_type_traits/integral_constant.hpp"
 #include "etl/_type_traits/is_lvalue_reference.hpp"
-#include "etl/_type_traits/is_reference.hpp"
-#include "etl/_type_traits/is_rvalue_reference.hpp"
-#include "etl/_type_traits/remove_reference.hpp"
 #include "etl/_type_traits/void_t.hpp"
 #include "etl/_utility/forward.hpp"
 #include "etl/_utility/index_sequence.hpp"
+#include "etl/_utility/move.hpp"
 #include "etl/_variant/variant.hpp"
 
 namespace etl {
@@ -43,86 +41,22 @@ constexpr bool is_detected_v = is_detected<D, Ts...>::value;
 template <typename T>
 constexpr bool is_variant_v = is_detected_v<variant_access_t, T>;
 
-template <etl::size_t I, etl::size_t... Is>
-[[nodiscard]] constexpr auto prepend(etl::index_sequence<Is...> /*ignore*/) -> etl::index_sequence<I, Is...>
-{
-    return {};
-}
-
-[[nodiscard]] constexpr auto next_seq(etl::index_sequence<> /*ignore*/, etl::index_sequence<> /*ignore*/)
-    -> etl::index_sequence<>
-{
-    return {};
-}
-
-template <typename T, typename V>
-struct copy_referenceness {
-    using type = T;
-};
-
-template <typename T, typename V>
-struct copy_referenceness<T, V&> {
-    using type = T&;
-};
-
-template <typename T, typename V>
-struct copy_referenceness<T, V&&> {
-    using type = etl::remove_reference_t<T>&&;
-};
-
-template <typename T, typename V>
-using copy_referenceness_t = typename copy_referenceness<T, V>::type;
-
-template <typename T, typename TSource>
-using as_if_forwarded = etl::conditional_t<!etl::is_reference<TSource> {},
-    etl::add_rvalue_reference_t<etl::remove_reference_t<T>>, copy_referenceness_t<T, TSource>>;
-
-template <typename TLike, typename T>
-constexpr auto forward_like(T&& x) noexcept -> decltype(auto)
-{
-    static_assert(!(etl::is_rvalue_reference<decltype(x)> {} && etl::is_lvalue_reference<TLike> {}));
-
-    return static_cast<as_if_forwarded<T, TLike>>(x);
-}
-
-template <etl::size_t I, etl::size_t... Is, etl::size_t J, etl::size_t... Js>
-constexpr auto next_seq(etl::index_sequence<I, Is...> /*ignore*/, etl::index_sequence<J, Js...> /*ignore*/)
-{
-    if constexpr (I + 1 == J) {
-        return prepend<0>(next_seq(etl::index_sequence<Is...> {}, etl::index_sequence<Js...> {}));
-    } else {
-        return etl::index_sequence<I + 1, Is...> {};
-    }
-}
-
-template <etl::size_t... I>
-static constexpr auto sum(etl::index_sequence<I...> /*ignore*/) -> etl::size_t
-{
-    return (I + ...);
-}
-
 template <etl::size_t I, typename T>
-constexpr auto get(T&& t) -> decltype(auto)
+constexpr auto get_unchecked(T&& t) -> decltype(auto)
 {
     if constexpr (is_variant_v<T>) {
-        return etl::get<I>(etl::forward<T>(t));
+        using ic_t = etl::integral_constant<etl::size_t, I>;
+        if constexpr (etl::is_lvalue_reference_v<T>) {
+            return t._impl()->get_value(ic_t {});
+        } else {
+            return etl::move(*t._impl()).get_value(ic_t {});
+        }
     } else {
         static_assert(I == 0);
         return etl::forward<T>(t);
     }
 }
 
-template <etl::size_t I, typename T>
-constexpr auto get_if(T* t)
-{
-    if constexpr (is_variant_v<T>) {
-        return etl::get_if<I>(t);
-    } else {
-        static_assert(I == 0);
-        return t;
-    }
-}
-
 template <typename V>
 constexpr auto variant_size() -> etl::size_t
 {
@@ -143,20 +77,51 @@ constexpr auto index(V const& v) -> etl::size_t
     }
 }
 
-template <etl::size_t... Is, etl::size_t... Ms, typename F, typename... Vs>
-constexpr auto visit(etl::index_sequence<Is...> i, etl::index_sequence<Ms...> m, F&& f, Vs&&... vs)
+/// \brief Splits the flat index into one alternative index per variant. The
+/// first variant is the most significant digit.
+template <etl::size_t Flat, typename... Vs>
+constexpr auto unflatten_index() -> etl::array<etl::size_t, sizeof...(Vs)>
 {
-    constexpr auto n = next_seq(i, m);
-    if constexpr (sum(n) == 0) {
-        return f(get<Is>(etl::forward<Vs>(vs))...);
-    } else {
-        if (etl::tuple(detail::index(vs)...) == etl::tuple(Is...)) { return f(forward_like<Vs>(*get_if<Is>(&vs))...); }
-        return visit(n, m, etl::forward<F>(f), etl::forward<Vs>(vs)...);
+    auto const sizes = etl::array<etl::size_t, sizeof...(Vs)> { variant_size<Vs>()... };
+    auto indices     = etl::array<etl::size_t, sizeof...(Vs)> {};
+    auto remainder   = Flat;
+    for (auto i = sizeof...(Vs); i != 0; --i) {
+        indices[i - 1] = remainder % sizes[i - 1];
+        remainder /= sizes[i - 1];
     }
+    return indices;
 }
 
-template <typename>
-inline constexpr etl::size_t zero = 0;
+template <typename F, typename... Vs>
+using visit_result_t = decltype(etl::declval<F>()(get_unchecked<0>(etl::declval<Vs>())...));
+
+template <etl::size_t Flat, typename F, typename... Vs>
+constexpr auto visit_alternative(F&& f, Vs&&... vs) -> visit_result_t<F, Vs...>
+{
+    constexpr auto indices = unflatten_index<Flat, Vs...>();
+    return [&]<etl::size_t... Js>(etl::index_sequence<Js...> /*is*/) -> visit_result_t<F, Vs...> {
+        return etl::forward<F>(f)(get_unchecked<indices[Js]>(etl::forward<Vs>(vs))...);
+    }(etl::index_sequence_for<Vs...> {});
+}
+
+template <typename F, typename... Vs, etl::size_t... Flat>
+constexpr auto make_visit_table(etl::index_sequence<Flat...> /*is*/)
+{
+    return etl::array { &visit_alternative<Flat, F, Vs...>... };
+}
+
+/// \brief One function pointer per combination of alternatives.
+template <typename F, typename... Vs>
+inline constexpr auto visit_table
+    = make_visit_table<F, Vs...>(etl::make_index_sequence<(variant_size<Vs>() * ... * 1)> {});
+
+template <typename... Vs>
+constexpr auto flat_index(Vs const&... vs) -> etl::size_t
+{
+    auto result = etl::size_t { 0 };
+    ((result = result * variant_size<Vs>() + detail::index(vs)), ...);
+    return result;
+}
 
 } // namespace detail
 
@@ -168,17 +133,13 @@ inline constexpr etl::size_t zero = 0;
 /// whether other argument types, e.g. a class derived from a etl::variant, are
 /// supported.
 ///
-/// Copied from https://github.com/rollbear/visit
-/// https://github.com/rollbear/visit/blob/master/LICENSE.txt
+/// Dispatch is a single indirect call through a constexpr table, which holds
+/// one entry for every combination of alternatives.
 template <typename F, typename... Vs>
 constexpr auto visit(F&& f, Vs&&... vs)
 {
-    if constexpr (((detail::variant_size<Vs>() == 1) && ...)) {
-        return f(detail::forward_like<Vs>(*detail::get_if<0>(&vs))...);
-    } else {
-        return detail::visit(etl::index_sequence<detail::zero<Vs>...> {},
-            etl::index_sequence<detail::variant_size<Vs>()...> {}, etl::forward<F>(f), etl::forward<Vs>(vs)...);
-    }
+    auto const index = detail::flat_index(vs...);
+    return detail::visit_table<F&&, Vs&&...>[index](etl::forward<F>(f), etl::forward<Vs>(vs)...);
 }
 
 } // namespace etl
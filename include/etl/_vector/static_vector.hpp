@@ -22,19 +22,27 @@
 #include "etl/_iterator/rbegin.hpp"
 #include "etl/_iterator/rend.hpp"
 #include "etl/_iterator/size.hpp"
+#include "etl/_memory/addressof.hpp"
+#include "etl/_memory/construct_at.hpp"
+#include "etl/_memory/relocate_at.hpp"
+#include "etl/_memory/uninitialized_relocate.hpp"
+#include "etl/_memory/uninitialized_relocate_backward.hpp"
 #include "etl/_new/operator.hpp"
 #include "etl/_type_traits/aligned_storage.hpp"
 #include "etl/_type_traits/conditional.hpp"
 #include "etl/_type_traits/is_assignable.hpp"
 #include "etl/_type_traits/is_const.hpp"
+#include "etl/_type_traits/is_constant_evaluated.hpp"
 #include "etl/_type_traits/is_constructible.hpp"
 #include "etl/_type_traits/is_copy_constructible.hpp"
 #include "etl/_type_traits/is_move_constructible.hpp"
+#include "etl/_type_traits/is_nothrow_constructible.hpp"
 #include "etl/_type_traits/is_nothrow_copy_constructible.hpp"
 #include "etl/_type_traits/is_nothrow_destructible.hpp"
 #include "etl/_type_traits/is_nothrow_move_constructible.hpp"
 #include "etl/_type_traits/is_pointer.hpp"
 #include "etl/_type_traits/is_trivial.hpp"
+#include "etl/_type_traits/is_trivially_relocatable.hpp"
 
 namespace etl {
 namespace detail {
@@ -358,6 +366,23 @@ private:
         while (n != size()) { emplace_back(T {}); }
     }
 
+    /// Elements of trivially relocatable types are shifted with a single
+    /// memmove on insert & erase, instead of being moved one by one. Insert
+    /// additionally requires, that constructing the new element can't throw.
+    template <typename... Args>
+    static constexpr bool relocate_on_insert
+        = is_trivially_relocatable_v<T> && !is_const_v<T> && is_nothrow_constructible_v<T, Args...>;
+
+    /// \brief (unsafe) Relocates [position, end()) n slots towards the end.
+    ///
+    /// \warning [position, position + n) is left uninitialized and the size is
+    /// not changed.
+    constexpr auto unsafe_open_gap(iterator position, size_type n) noexcept -> void
+    {
+        TETL_ASSERT(size() + n <= capacity());
+        uninitialized_relocate_backward(position, end(), end() + n);
+    }
+
 public:
     [[nodiscard]] constexpr auto begin() noexcept -> iterator { return data(); }
     [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return data(); }
@@ -402,6 +427,18 @@ public:
         assert_valid_iterator_pair(first, last);
         if constexpr (detail::RandomAccessIterator<InIt>) {
             TETL_ASSERT(size() + static_cast<size_type>(last - first) <= capacity());
+            if constexpr (relocate_on_insert<decltype(move(*first))>) {
+                if (!is_constant_evaluated()) {
+                    auto const n           = static_cast<size_type>(last - first);
+                    auto* writablePosition = begin() + (position - begin());
+                    unsafe_open_gap(writablePosition, n);
+                    for (auto* it = writablePosition; first != last; ++first, (void)++it) {
+                        (void)construct_at(it, move(*first));
+                    }
+                    unsafe_set_size(size() + n);
+                    return writablePosition;
+                }
+            }
         }
         iterator b = end();
 
@@ -440,6 +477,21 @@ public:
     {
         assert_iterator_in_range(position);
         TETL_ASSERT(size() + n <= capacity());
+        if constexpr (relocate_on_insert<T const&>) {
+            if (!is_constant_evaluated()) {
+                auto* writablePosition = begin() + (position - begin());
+
+                // x may refer to an element which is about to be shifted
+                auto const* value = addressof(x);
+                if (writablePosition <= value && value < end()) { value += n; }
+
+                unsafe_open_gap(writablePosition, n);
+                for (auto* it = writablePosition; it != writablePosition + n; ++it) { (void)construct_at(it, *value); }
+                unsafe_set_size(size() + n);
+                return writablePosition;
+            }
+        }
+
         auto* b = end();
         while (n != 0) {
             push_back(x);
@@ -470,6 +522,18 @@ public:
         assert_valid_iterator_pair(first, last);
         if constexpr (detail::RandomAccessIterator<InputIt>) {
             TETL_ASSERT(size() + static_cast<size_type>(last - first) <= capacity());
+            if constexpr (relocate_on_insert<detail::iterator_reference_t<InputIt>>) {
+                if (!is_constant_evaluated()) {
+                    auto const n           = static_cast<size_type>(last - first);
+                    auto* writablePosition = begin() + (position - begin());
+                    unsafe_open_gap(writablePosition, n);
+                    for (auto* it = writablePosition; first != last; ++first, (void)++it) {
+                        (void)construct_at(it, *first);
+                    }
+                    unsafe_set_size(size() + n);
+                    return writablePosition;
+                }
+            }
         }
         auto* b = end();
 
@@ -634,6 +698,15 @@ public:
         assert_iterator_pair_in_range(first, last);
         iterator p = begin() + (first - begin());
         if (first != last) {
+            if constexpr (is_trivially_relocatable_v<T>) {
+                if (!is_constant_evaluated()) {
+                    auto* tail = p + (last - first);
+                    unsafe_destroy(p, tail);
+                    uninitialized_relocate(tail, end(), p);
+                    unsafe_set_size(size() - static_cast<size_type>(last - first));
+                    return p;
+                }
+            }
             unsafe_destroy(move(p + (last - first), end(), p), end());
             unsafe_set_size(size() - static_cast<size_type>(last - first));
         }
@@ -645,6 +718,13 @@ public:
     constexpr auto swap(static_vector& other) noexcept(is_nothrow_swappable_v<T>) -> void
         requires(is_assignable_v<T&, T &&>)
     {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (!is_constant_evaluated()) {
+                detail::trivially_relocating_swap(*this, other);
+                return;
+            }
+        }
+
         using etl::move;
 
         static_vector tmp = move(other);
@@ -715,6 +795,10 @@ constexpr auto swap(static_vector<T, Capacity>& lhs, static_vector<T, Capacity>&
     lhs.swap(rhs);
 }
 
+/// \brief A static_vector is trivially relocatable, if its elements are.
+template <typename T, size_t Capacity>
+struct is_trivially_relocatable<static_vector<T, Capacity>> : is_trivially_relocatable<T> { };
+
 /// \brief Compares the contents of two vectors.
 ///
 /// \details Checks if the contents of lhs and rhs are equal, that is, they have
@@ -5,9 +5,15 @@
 
 #include "etl/_config/all.hpp"
 
+#include "etl/_coroutine/async_channel.hpp"
+#include "etl/_coroutine/async_event.hpp"
 #include "etl/_coroutine/coroutine_handle.hpp"
 #include "etl/_coroutine/coroutine_traits.hpp"
+#include "etl/_coroutine/frame_arena.hpp"
+#include "etl/_coroutine/generator.hpp"
+#include "etl/_coroutine/run_loop.hpp"
 #include "etl/_coroutine/suspend_always.hpp"
 #include "etl/_coroutine/suspend_never.hpp"
+#include "etl/_coroutine/task.hpp"
 
 #endif // TETL_COROUTINE_HPP
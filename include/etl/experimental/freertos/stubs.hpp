@@ -51,6 +51,42 @@ inline auto vTaskDelayUntil(TickType_t* const pxPreviousWakeTime, const TickType
 {
     etl::ignore_unused(pxPreviousWakeTime, xTimeIncrement);
 }
+
+inline auto xTaskGetCurrentTaskHandle() -> TaskHandle_t { return nullptr; }
+
+inline auto xTaskNotifyGive(TaskHandle_t xTaskToNotify) -> BaseType_t
+{
+    etl::ignore_unused(xTaskToNotify);
+    return pdPASS;
+}
+
+inline auto vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken) -> void
+{
+    etl::ignore_unused(xTaskToNotify, pxHigherPriorityTaskWoken);
+}
+
+struct xTIME_OUT {
+    BaseType_t xOverflowCount;
+    TickType_t xTimeOnEntering;
+};
+
+using TimeOut_t = xTIME_OUT;
+
+inline auto vTaskSetTimeOutState(TimeOut_t* const pxTimeOut) -> void { *pxTimeOut = TimeOut_t {}; }
+
+inline auto xTaskCheckForTimeOut(TimeOut_t* const pxTimeOut, TickType_t* const pxTicksToWait) -> BaseType_t
+{
+    etl::ignore_unused(pxTimeOut);
+    *pxTicksToWait = 0;
+    return pdTRUE;
+}
+
+inline auto ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait) -> etl::uint32_t
+{
+    etl::ignore_unused(xClearCountOnExit, xTicksToWait);
+    return 0;
+}
+
 // QUEUE
 struct QueueDefinition;
 using QueueHandle_t = QueueDefinition*;
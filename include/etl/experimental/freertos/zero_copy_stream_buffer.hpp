@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FREERTOS_ZERO_COPY_STREAM_BUFFER_HPP
+#define TETL_FREERTOS_ZERO_COPY_STREAM_BUFFER_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/cassert.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+
+#include "etl/experimental/net/buffer.hpp"
+
+#if defined(TETL_FREERTOS_USE_STUBS)
+    #include "etl/experimental/freertos/stubs.hpp"
+#endif
+
+namespace etl::experimental::freertos {
+
+/// \brief Single reader single writer byte stream, which is written and read
+/// in place. Unlike stream_buffer, no payload is copied through the kernel.
+///
+/// \details The writer acquires a contiguous block of n bytes, fills it,
+/// e.g. by DMA, and commits the bytes it used. The reader peeks at the
+/// largest contiguous block of committed bytes and consumes the bytes it
+/// processed. A block, that does not fit in front of the end of the storage,
+/// is placed at the start instead (bipartite buffer). The unused tail is
+/// skipped by the reader. An empty buffer restarts at the start of the
+/// storage, so it fits a block of up to Capacity bytes.
+///
+/// The indices are size_t and published with release stores, so the writer
+/// and the reader can run in different tasks or interrupts without a
+/// critical section. Blocking calls register the calling task, the other
+/// side wakes it with a task notification.
+///
+/// \ingroup StreamBuffer
+template <etl::size_t Capacity>
+struct zero_copy_stream_buffer {
+    using size_type = etl::size_t;
+
+    zero_copy_stream_buffer() = default;
+
+    zero_copy_stream_buffer(zero_copy_stream_buffer const& other)                    = delete;
+    auto operator=(zero_copy_stream_buffer const& other) -> zero_copy_stream_buffer& = delete;
+
+    /// \brief Returns n contiguous bytes to write into, or an empty buffer if
+    /// there is not enough space. Waits up to ticks for the reader to make
+    /// space. Acquiring again discards the previous, uncommitted block.
+    [[nodiscard]] auto acquire(size_type n, TickType_t ticks = 0) -> net::mutable_buffer
+    {
+        return wait(writer_, ticks, [this, n] { return try_acquire(n); });
+    }
+
+    /// \brief Publishes the first n bytes of the acquired block and wakes a
+    /// waiting reader.
+    auto commit(size_type n) -> void
+    {
+        publish(n);
+        if (auto* reader = load_acquire(reader_); reader != nullptr) { (void)xTaskNotifyGive(reader); }
+    }
+
+    /// \brief Interrupt safe version of commit.
+    auto commit_from_isr(size_type n, BaseType_t* prio) -> void
+    {
+        publish(n);
+        if (auto* reader = load_acquire(reader_); reader != nullptr) { vTaskNotifyGiveFromISR(reader, prio); }
+    }
+
+    /// \brief Returns the largest contiguous block of committed bytes, or an
+    /// empty buffer. Waits up to ticks for the writer, if empty.
+    [[nodiscard]] auto peek(TickType_t ticks = 0) -> net::const_buffer
+    {
+        return wait(reader_, ticks, [this] { return readable(); });
+    }
+
+    /// \brief Releases the first n bytes of the block returned by peek and
+    /// wakes a waiting writer.
+    auto consume(size_type n) -> void
+    {
+        release(n);
+        if (auto* writer = load_acquire(writer_); writer != nullptr) { (void)xTaskNotifyGive(writer); }
+    }
+
+    /// \brief Interrupt safe version of consume.
+    auto consume_from_isr(size_type n, BaseType_t* prio) -> void
+    {
+        release(n);
+        if (auto* writer = load_acquire(writer_); writer != nullptr) { vTaskNotifyGiveFromISR(writer, prio); }
+    }
+
+    /// \brief Returns the number of committed bytes, that were not consumed.
+    [[nodiscard]] auto bytes_available() const noexcept -> size_type
+    {
+        auto const [write, read] = load_indices();
+        if (write >= read) { return write - read; }
+        return load_acquire(last_) - read + write;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return bytes_available() == 0; }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Capacity; }
+
+private:
+    // Registers the calling task as waiter until func returns a non-empty
+    // block or ticks elapsed. A notification may arrive for an attempt that
+    // already succeeded, so a wake up only means to try again.
+    template <typename Func>
+    auto wait(TaskHandle_t& waiter, TickType_t ticks, Func func)
+    {
+        auto block = func();
+        if (block.size() != 0 or ticks == 0) { return block; }
+
+        auto timeout = TimeOut_t {};
+        vTaskSetTimeOutState(&timeout);
+        store_release(waiter, xTaskGetCurrentTaskHandle());
+        while (true) {
+            block = func();
+            if (block.size() != 0 or xTaskCheckForTimeOut(&timeout, &ticks) != pdFALSE) { break; }
+            (void)ulTaskNotifyTake(pdTRUE, ticks);
+        }
+        store_release(waiter, TaskHandle_t { nullptr });
+        return block;
+    }
+
+    // Writer side. While write_ >= read_ the bytes [read_, write_) are
+    // readable. After the writer wrapped around, write_ < read_ and the
+    // readable bytes are [read_, last_) followed by [0, write_). write_ never
+    // catches up with read_ from below, equal indices mean empty.
+    [[nodiscard]] auto try_acquire(size_type n) noexcept -> net::mutable_buffer
+    {
+        auto const write = write_;
+        auto const read  = load_acquire(read_);
+
+        auto start = write;
+        if (write >= read) {
+            if (Capacity - write < n) {
+                if (write == read and n <= Capacity) {
+                    restart(write);
+                } else if (n >= read) {
+                    return {};
+                }
+                start = 0;
+            }
+        } else if (read - write <= n) {
+            return {};
+        }
+
+        start_   = start;
+        granted_ = n;
+        return net::mutable_buffer { &storage_[start], n };
+    }
+
+    // Moves both indices of the empty buffer to the start. The writer first
+    // publishes an empty wrap, i.e. write_ = 0 and last_ = read_, which the
+    // reader resolves by storing read_ = 0 itself. Storing the same 0 here
+    // does not race with the reader, because it doesn't store anything else
+    // to read_ until there are bytes to consume. See load_indices for the
+    // reader side.
+    auto restart(size_type write) noexcept -> void
+    {
+        store_release(last_, write);
+        store_release(write_, size_type(0));
+        store_release(read_, size_type(0));
+    }
+
+    auto publish(size_type n) noexcept -> void
+    {
+        TETL_ASSERT(n <= granted_);
+        granted_ = 0;
+        if (n == 0) { return; }
+
+        // the reader loads last_ only after it saw the wrapped write_
+        if (start_ != write_) { store_release(last_, write_); }
+        store_release(write_, start_ + n);
+    }
+
+    // Reader side
+    [[nodiscard]] auto readable() noexcept -> net::const_buffer
+    {
+        auto [write, read] = load_indices();
+        if (write < read) {
+            auto const last = load_acquire(last_);
+            if (read != last) { return net::const_buffer { &storage_[read], last - read }; }
+            read = 0;
+            store_release(read_, read);
+        }
+        return net::const_buffer { &storage_[read], write - read };
+    }
+
+    auto release(size_type n) noexcept -> void
+    {
+        auto const block = readable();
+        TETL_ASSERT(n <= block.size());
+        if (n == 0) { return; }
+
+        auto const offset = static_cast<size_type>(static_cast<unsigned char const*>(block.data()) - storage_);
+        store_release(read_, offset + n);
+    }
+
+    struct indices {
+        size_type write;
+        size_type read;
+    };
+
+    // Loads read_ between two equal loads of write_. Without the second load,
+    // a restart in between pairs the old write_ with the reset read_.
+    [[nodiscard]] auto load_indices() const noexcept -> indices
+    {
+        auto write = load_acquire(write_);
+        while (true) {
+            auto const read = load_acquire(read_);
+            auto const next = load_acquire(write_);
+            if (next == write) { return { write, read }; }
+            write = next;
+        }
+    }
+
+    template <typename T>
+    static auto load_acquire(T const& v) noexcept -> T
+    {
+#if defined(TETL_MSVC)
+        return *static_cast<T const volatile*>(&v);
+#else
+        return __atomic_load_n(&v, __ATOMIC_ACQUIRE);
+#endif
+    }
+
+    template <typename T>
+    static auto store_release(T& v, T x) noexcept -> void
+    {
+#if defined(TETL_MSVC)
+        *static_cast<T volatile*>(&v) = x;
+#else
+        __atomic_store_n(&v, x, __ATOMIC_RELEASE);
+#endif
+    }
+
+    unsigned char storage_[Capacity] {};
+    size_type write_ { 0 };
+    size_type read_ { 0 };
+    size_type last_ { 0 };
+
+    // only accessed by the writer
+    size_type start_ { 0 };
+    size_type granted_ { 0 };
+
+    TaskHandle_t reader_ { nullptr };
+    TaskHandle_t writer_ { nullptr };
+};
+
+} // namespace etl::experimental::freertos
+
+#endif // TETL_FREERTOS_ZERO_COPY_STREAM_BUFFER_HPP
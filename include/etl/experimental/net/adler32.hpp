@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_ADLER32_HPP
+#define TETL_NET_ADLER32_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/span.hpp"
+
+#include "etl/experimental/net/buffer_const.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Incremental Adler-32 checksum of zlib (RFC 1950).
+///
+/// \details The modulo is deferred to every 5552 bytes, the largest block
+/// for which the sums can not overflow 32 bits.
+struct adler32 {
+    using value_type = etl::uint32_t;
+
+    constexpr adler32() = default;
+
+    /// \brief Adds data to the checksum.
+    constexpr auto update(etl::span<etl::uint8_t const> data) noexcept -> adler32&
+    {
+        auto const* p = data.data();
+        auto n        = data.size();
+        while (n != 0) {
+            auto const block = etl::min(n, max_block);
+            n -= block;
+            for (auto const* last = p + block; p != last; ++p) {
+                a_ += *p;
+                b_ += a_;
+            }
+            a_ %= modulus;
+            b_ %= modulus;
+        }
+        return *this;
+    }
+
+    /// \brief Adds the bytes of the buffer to the checksum.
+    auto update(const_buffer data) noexcept -> adler32&
+    {
+        return update(etl::span<etl::uint8_t const> { static_cast<etl::uint8_t const*>(data.data()), data.size() });
+    }
+
+    /// \brief Returns the checksum of all bytes added since the last reset.
+    [[nodiscard]] constexpr auto value() const noexcept -> value_type { return (b_ << 16U) | a_; }
+
+    constexpr auto reset() noexcept -> void
+    {
+        a_ = 1;
+        b_ = 0;
+    }
+
+private:
+    static constexpr auto modulus   = etl::uint32_t(65521);
+    static constexpr auto max_block = etl::size_t(5552);
+
+    etl::uint32_t a_ { 1 };
+    etl::uint32_t b_ { 0 };
+};
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_ADLER32_HPP
@@ -10,6 +10,9 @@
 
 #include "etl/experimental/net/buffer_const.hpp"
 #include "etl/experimental/net/buffer_mutable.hpp"
+#include "etl/experimental/net/buffer_sequence.hpp"
+#include "etl/experimental/net/consuming_buffers.hpp"
+#include "etl/experimental/net/static_buffer_sequence.hpp"
 
 namespace etl::experimental::net {
 inline auto make_buffer(void* data, size_t size) noexcept -> mutable_buffer { return mutable_buffer { data, size }; }
@@ -8,6 +8,8 @@
 #include "etl/array.hpp"
 #include "etl/cstddef.hpp"
 
+#include "etl/experimental/net/buffer_mutable.hpp"
+
 namespace etl::experimental::net {
 struct const_buffer {
     /// \brief Construct an empty buffer.
@@ -16,6 +18,9 @@ struct const_buffer {
     /// \brief Construct a buffer to represent a given memory range.
     const_buffer(void const* data, etl::size_t size) : data_ { data }, size_ { size } { }
 
+    /// \brief Construct a non-modifiable view of a modifiable buffer.
+    const_buffer(mutable_buffer const& b) noexcept : data_ { b.data() }, size_ { b.size() } { }
+
     /// \brief Get a pointer to the beginning of the memory range.
     [[nodiscard]] auto data() const noexcept -> void const* { return data_; }
 
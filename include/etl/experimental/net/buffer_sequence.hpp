@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_BUFFER_SEQUENCE_HPP
+#define TETL_NET_BUFFER_SEQUENCE_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/concepts.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstring.hpp"
+#include "etl/limits.hpp"
+#include "etl/memory.hpp"
+#include "etl/type_traits.hpp"
+
+#include "etl/experimental/net/buffer_const.hpp"
+#include "etl/experimental/net/buffer_mutable.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Returns an iterator to the first buffer of the sequence. A single
+/// buffer is a sequence of one element.
+template <typename Buffer>
+    requires(is_convertible_v<Buffer const&, const_buffer>)
+[[nodiscard]] auto buffer_sequence_begin(Buffer const& b) noexcept -> Buffer const*
+{
+    return etl::addressof(b);
+}
+
+template <typename Sequence>
+    requires(not is_convertible_v<Sequence const&, const_buffer>)
+[[nodiscard]] auto buffer_sequence_begin(Sequence const& s) noexcept -> decltype(s.begin())
+{
+    return s.begin();
+}
+
+/// \brief Returns an iterator one past the last buffer of the sequence.
+template <typename Buffer>
+    requires(is_convertible_v<Buffer const&, const_buffer>)
+[[nodiscard]] auto buffer_sequence_end(Buffer const& b) noexcept -> Buffer const*
+{
+    return etl::addressof(b) + 1;
+}
+
+template <typename Sequence>
+    requires(not is_convertible_v<Sequence const&, const_buffer>)
+[[nodiscard]] auto buffer_sequence_end(Sequence const& s) noexcept -> decltype(s.end())
+{
+    return s.end();
+}
+
+/// \brief True, if T is a mutable_buffer or a range of buffers convertible
+/// to mutable_buffer.
+template <typename T>
+inline constexpr bool is_mutable_buffer_sequence_v = requires(T const& s) {
+    { *buffer_sequence_begin(s) } -> convertible_to<mutable_buffer>;
+    { buffer_sequence_end(s) };
+};
+
+/// \brief True, if T is a buffer or a range of buffers convertible to
+/// const_buffer.
+template <typename T>
+inline constexpr bool is_const_buffer_sequence_v = requires(T const& s) {
+    { *buffer_sequence_begin(s) } -> convertible_to<const_buffer>;
+    { buffer_sequence_end(s) };
+};
+
+/// \brief Returns the total number of bytes in all buffers of the sequence.
+template <typename ConstBufferSequence>
+    requires(is_const_buffer_sequence_v<ConstBufferSequence>)
+[[nodiscard]] auto buffer_size(ConstBufferSequence const& buffers) noexcept -> etl::size_t
+{
+    auto total = etl::size_t(0);
+    auto last  = buffer_sequence_end(buffers);
+    for (auto it = buffer_sequence_begin(buffers); it != last; ++it) { total += const_buffer(*it).size(); }
+    return total;
+}
+
+/// \brief Copies min(max_size, buffer_size(dest), buffer_size(source))
+/// bytes from source to dest, where the buffer boundaries of both sequences
+/// do not need to match. Returns the number of copied bytes.
+template <typename MutableBufferSequence, typename ConstBufferSequence>
+    requires(is_mutable_buffer_sequence_v<MutableBufferSequence> and is_const_buffer_sequence_v<ConstBufferSequence>)
+auto buffer_copy(MutableBufferSequence const& dest, ConstBufferSequence const& source, etl::size_t maxSize) noexcept
+    -> etl::size_t
+{
+    auto destIt    = buffer_sequence_begin(dest);
+    auto destLast  = buffer_sequence_end(dest);
+    auto srcIt     = buffer_sequence_begin(source);
+    auto srcLast   = buffer_sequence_end(source);
+    auto destBuf   = mutable_buffer {};
+    auto srcBuf    = const_buffer {};
+    auto remaining = maxSize;
+
+    while (remaining != 0) {
+        if (destBuf.size() == 0) {
+            if (destIt == destLast) { break; }
+            destBuf = mutable_buffer(*destIt++);
+            continue;
+        }
+        if (srcBuf.size() == 0) {
+            if (srcIt == srcLast) { break; }
+            srcBuf = const_buffer(*srcIt++);
+            continue;
+        }
+
+        auto const n = etl::min(remaining, etl::min(destBuf.size(), srcBuf.size()));
+        etl::memcpy(destBuf.data(), srcBuf.data(), n);
+        destBuf += n;
+        srcBuf += n;
+        remaining -= n;
+    }
+    return maxSize - remaining;
+}
+
+/// \brief Copies min(buffer_size(dest), buffer_size(source)) bytes from
+/// source to dest. Returns the number of copied bytes.
+template <typename MutableBufferSequence, typename ConstBufferSequence>
+    requires(is_mutable_buffer_sequence_v<MutableBufferSequence> and is_const_buffer_sequence_v<ConstBufferSequence>)
+auto buffer_copy(MutableBufferSequence const& dest, ConstBufferSequence const& source) noexcept -> etl::size_t
+{
+    return buffer_copy(dest, source, etl::numeric_limits<etl::size_t>::max());
+}
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_BUFFER_SEQUENCE_HPP
@@ -5,34 +5,105 @@
 
 #include "etl/version.hpp"
 
+#include "etl/bit.hpp"
+#include "etl/concepts.hpp"
+#include "etl/cstddef.hpp"
 #include "etl/cstdint.hpp"
+#include "etl/cstring.hpp"
+#include "etl/limits.hpp"
+#include "etl/span.hpp"
+#include "etl/type_traits.hpp"
 
 namespace etl::experimental::net {
+
+namespace detail {
+
+template <typename T>
+concept byte_order_float
+    = floating_point<T> and etl::numeric_limits<T>::is_iec559 and (sizeof(T) == 4 or sizeof(T) == 8);
+
+template <typename T>
+concept byte_order_convertible = integral<T> or byte_order_float<T>;
+
 template <typename T>
-constexpr auto ntoh(T) -> T
-    = delete;
-constexpr auto ntoh(char v) noexcept -> char { return v; }
-constexpr auto ntoh(uint8_t v) noexcept -> uint8_t { return v; }
-constexpr auto ntoh(int8_t v) noexcept -> int8_t { return v; }
-constexpr auto ntoh(uint16_t v) noexcept -> uint16_t { return uint16_t(v << uint16_t(8)) | uint16_t(v >> uint16_t(8)); }
-constexpr auto ntoh(uint32_t v) noexcept -> uint32_t
+using float_bits_t = etl::conditional_t<sizeof(T) == 4, etl::uint32_t, etl::uint64_t>;
+
+// The swapped bits of a float are often a signalling NaN, which an FPU may
+// quiet when the value passes through a register. So they only ever live
+// in an integer or, at runtime, are copied bytewise into the float.
+template <typename T>
+constexpr auto swap_in_place(T& v) noexcept -> void
 {
-    auto const a = v << 24;
-    auto const b = (v & 0x0000FF00) << 8;
-    auto const c = (v & 0x00FF0000) >> 8;
-    auto const d = v >> 24;
+    if constexpr (integral<T>) {
+        v = etl::byteswap(v);
+    } else if (etl::is_constant_evaluated()) {
+        v = etl::bit_cast<T>(etl::byteswap(etl::bit_cast<float_bits_t<T>>(v)));
+    } else {
+        auto bits = float_bits_t<T> {};
+        etl::memcpy(&bits, &v, sizeof(T));
+        bits = etl::byteswap(bits);
+        etl::memcpy(&v, &bits, sizeof(T));
+    }
+}
 
-    return a | b | c | d;
+} // namespace detail
+
+/// \brief Converts v from network (big-endian) to host byte order. A no-op on
+/// big-endian targets.
+template <integral T>
+[[nodiscard]] constexpr auto ntoh(T v) noexcept -> T
+{
+    if constexpr (endian::native == endian::big or sizeof(T) == 1) {
+        return v;
+    } else {
+        return etl::byteswap(v);
+    }
 }
 
-template <typename T>
-constexpr auto hton(T) -> T
-    = delete;
-constexpr auto hton(char v) noexcept -> char { return v; }
-constexpr auto hton(int8_t v) noexcept -> int8_t { return v; }
-constexpr auto hton(uint8_t v) noexcept -> uint8_t { return v; }
-constexpr auto hton(uint16_t v) noexcept -> uint16_t { return ntoh(v); }
-constexpr auto hton(uint32_t v) noexcept -> uint32_t { return ntoh(v); }
+/// \brief Converts v from host to network (big-endian) byte order.
+template <integral T>
+[[nodiscard]] constexpr auto hton(T v) noexcept -> T
+{
+    return ntoh(v);
+}
+
+/// \brief Returns the IEEE float or double, whose bits in network byte order
+/// are v, e.g. ntoh<float>(wire).
+template <detail::byte_order_float T>
+[[nodiscard]] constexpr auto ntoh(detail::float_bits_t<T> v) noexcept -> T
+{
+    return etl::bit_cast<T>(ntoh(v));
+}
+
+/// \brief Returns the bits of the IEEE float or double v in network byte
+/// order. They are returned as an integer, because the swapped bits may be a
+/// signalling NaN, which doesn't survive all FPUs.
+template <detail::byte_order_float T>
+[[nodiscard]] constexpr auto hton(T v) noexcept -> detail::float_bits_t<T>
+{
+    return hton(etl::bit_cast<detail::float_bits_t<T>>(v));
+}
+
+/// \brief Converts all values in data between network and host byte order in
+/// place. Swapping is its own inverse, so this works in both directions.
+///
+/// \details The values are converted in blocks of 16 bytes with a constant
+/// trip count, which the compiler turns into vector shuffles already at -O2.
+template <detail::byte_order_convertible T, etl::size_t Extent>
+constexpr auto convert_endian(etl::span<T, Extent> data) noexcept -> void
+{
+    if constexpr (endian::native != endian::big and sizeof(T) != 1) {
+        constexpr auto block = etl::size_t(16) / sizeof(T);
+
+        auto* ptr   = data.data();
+        auto* first = data.data();
+        auto* last  = first + data.size();
+        for (; last - ptr >= static_cast<etl::ptrdiff_t>(block); ptr += block) {
+            for (auto i = etl::size_t(0); i < block; ++i) { detail::swap_in_place(ptr[i]); }
+        }
+        for (; ptr != last; ++ptr) { detail::swap_in_place(*ptr); }
+    }
+}
 
 } // namespace etl::experimental::net
 
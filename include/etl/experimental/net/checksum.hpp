@@ -0,0 +1,12 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_CHECKSUM_HPP
+#define TETL_NET_CHECKSUM_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/experimental/net/adler32.hpp"
+#include "etl/experimental/net/crc.hpp"
+#include "etl/experimental/net/fletcher.hpp"
+
+#endif // TETL_NET_CHECKSUM_HPP
@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_CODEC_HPP
+#define TETL_NET_CODEC_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/bit.hpp"
+#include "etl/concepts.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/cstring.hpp"
+#include "etl/span.hpp"
+#include "etl/tuple.hpp"
+#include "etl/type_traits.hpp"
+#include "etl/utility.hpp"
+
+#include "etl/experimental/mpl/algorithm/for_each.hpp"
+#include "etl/experimental/net/buffer_const.hpp"
+#include "etl/experimental/net/buffer_mutable.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Describes the wire format of T. Specializations list the encoded
+/// members in wire order, e.g.
+///
+/// \code
+/// template <>
+/// struct net::describe<header> {
+///     using fields = net::fields<
+///         net::field<&header::version, 4>,
+///         net::field<&header::length, 16>,
+///         net::field<&header::samples, 12, etl::endian::big>,
+///         net::field<&header::position>>;
+/// };
+/// \endcode
+template <typename T>
+struct describe;
+
+/// \brief True, if describe<T> has been specialized.
+template <typename T>
+concept described = requires { typename describe<T>::fields; };
+
+/// \brief Type list of field descriptions.
+template <typename... Fields>
+struct fields { };
+
+namespace detail {
+
+template <typename T>
+struct codec_element {
+    using type                         = T;
+    static constexpr etl::size_t count = 1;
+    static constexpr bool is_array     = false;
+};
+
+template <typename T, etl::size_t N>
+struct codec_element<T[N]> {
+    using type                         = T;
+    static constexpr etl::size_t count = N;
+    static constexpr bool is_array     = true;
+};
+
+template <typename T, etl::size_t N>
+struct codec_element<etl::array<T, N>> {
+    using type                         = T;
+    static constexpr etl::size_t count = N;
+    static constexpr bool is_array     = true;
+};
+
+template <typename T>
+struct codec_member;
+
+template <typename C, typename M>
+struct codec_member<M C::*> {
+    using class_type  = C;
+    using member_type = M;
+};
+
+template <auto Member>
+using codec_element_t = typename codec_element<typename codec_member<decltype(Member)>::member_type>::type;
+
+template <typename List>
+struct codec_bits;
+
+template <typename T>
+inline constexpr etl::size_t codec_bits_v = codec_bits<typename describe<T>::fields>::value;
+
+template <typename... Fields>
+struct codec_bits<fields<Fields...>> : etl::integral_constant<etl::size_t, (Fields::bits + ... + 0)> { };
+
+template <typename T, etl::size_t Bits = sizeof(T) * 8>
+[[nodiscard]] consteval auto codec_element_bits() -> etl::size_t
+{
+    if constexpr (described<T>) {
+        return codec_bits_v<T>;
+    } else {
+        return Bits;
+    }
+}
+
+} // namespace detail
+
+/// \brief Encodes the member Member with Bits bits per element in byte order
+/// Order. Arrays are encoded element by element, described members are
+/// encoded inline with their own fields. Bits defaults to the size of the
+/// member type and is ignored for described members.
+///
+/// \details Fields are packed without padding, most significant bit first,
+/// like the headers of IP or CAN. Fields with a width that is not a multiple
+/// of 8 or that do not start on a byte boundary must be big-endian.
+template <auto Member, etl::size_t Bits = detail::codec_element_bits<detail::codec_element_t<Member>>(),
+    etl::endian Order = etl::endian::big>
+struct field {
+    using element_type = detail::codec_element<typename detail::codec_member<decltype(Member)>::member_type>;
+    using value_type   = typename element_type::type;
+
+    static constexpr auto member       = Member;
+    static constexpr auto order        = Order;
+    static constexpr auto count        = element_type::count;
+    static constexpr auto is_array     = element_type::is_array;
+    static constexpr auto element_bits = detail::codec_element_bits<value_type, Bits>();
+    static constexpr auto bits         = element_bits * count;
+
+    static_assert(described<value_type> or integral<value_type> or is_enum_v<value_type>
+                      or floating_point<value_type>,
+        "fields must be integers, enums, floats, arrays of those or described structs");
+    static_assert(described<value_type> or (Bits > 0 and Bits <= sizeof(value_type) * 8 and Bits <= 64),
+        "Bits must fit into the member type");
+    static_assert(not floating_point<value_type> or Bits == sizeof(value_type) * 8, "floats are always encoded whole");
+};
+
+/// \brief Number of bytes of the encoding of T.
+template <described T>
+inline constexpr etl::size_t encoded_size_v = (detail::codec_bits_v<T> + 7) / 8;
+
+namespace detail {
+
+[[nodiscard]] constexpr auto codec_mask(etl::size_t bits) noexcept -> etl::uint64_t
+{
+    return bits >= 64 ? ~etl::uint64_t(0) : (etl::uint64_t(1) << bits) - 1U;
+}
+
+template <etl::size_t Bytes>
+using codec_uint_t = etl::conditional_t<Bytes == 2, etl::uint16_t,
+    etl::conditional_t<Bytes == 4, etl::uint32_t, etl::conditional_t<Bytes == 8, etl::uint64_t, void>>>;
+
+/// Writes the low Bits of v at bit Offset, most significant bit first.
+template <etl::size_t Offset, etl::size_t Bits, etl::endian Order>
+constexpr auto put_bits(etl::uint8_t* out, etl::uint64_t v) noexcept -> void
+{
+    constexpr auto first = Offset / 8;
+
+    if constexpr (Offset % 8 == 0 and Bits % 8 == 0) {
+        constexpr auto n = Bits / 8;
+        if constexpr (not is_void_v<codec_uint_t<n>>) {
+            if (not is_constant_evaluated()) {
+                auto x = static_cast<codec_uint_t<n>>(v);
+                if constexpr (Order != etl::endian::native) { x = etl::byteswap(x); }
+                etl::memcpy(out + first, &x, n);
+                return;
+            }
+        }
+        for (auto k = etl::size_t(0); k < n; ++k) {
+            auto const shift = Order == etl::endian::big ? 8 * (n - 1 - k) : 8 * k;
+            out[first + k]   = static_cast<etl::uint8_t>(v >> shift);
+        }
+    } else {
+        static_assert(Order == etl::endian::big, "little-endian fields must be whole bytes on a byte boundary");
+
+        // the field ends at bit end, byte i holds the bits up to 8 * (i + 1)
+        constexpr auto end  = Offset + Bits;
+        constexpr auto last = (end - 1) / 8;
+        constexpr auto mask = codec_mask(Bits);
+        for (auto i = first; i <= last; ++i) {
+            auto const right = static_cast<int>(end) - static_cast<int>(8 * (i + 1));
+            auto const bits  = right >= 0 ? v >> right : v << -right;
+            auto const keep  = right >= 0 ? mask >> right : mask << -right;
+            out[i] = static_cast<etl::uint8_t>((out[i] & ~keep) | (bits & keep));
+        }
+    }
+}
+
+/// Reads Bits bits at bit Offset, most significant bit first.
+template <etl::size_t Offset, etl::size_t Bits, etl::endian Order>
+[[nodiscard]] constexpr auto get_bits(etl::uint8_t const* in) noexcept -> etl::uint64_t
+{
+    constexpr auto first = Offset / 8;
+
+    if constexpr (Offset % 8 == 0 and Bits % 8 == 0) {
+        constexpr auto n = Bits / 8;
+        if constexpr (not is_void_v<codec_uint_t<n>>) {
+            if (not is_constant_evaluated()) {
+                auto x = codec_uint_t<n> {};
+                etl::memcpy(&x, in + first, n);
+                if constexpr (Order != etl::endian::native) { x = etl::byteswap(x); }
+                return x;
+            }
+        }
+        auto v = etl::uint64_t(0);
+        for (auto k = etl::size_t(0); k < n; ++k) {
+            auto const shift = Order == etl::endian::big ? 8 * (n - 1 - k) : 8 * k;
+            v |= etl::uint64_t(in[first + k]) << shift;
+        }
+        return v;
+    } else {
+        static_assert(Order == etl::endian::big, "little-endian fields must be whole bytes on a byte boundary");
+
+        constexpr auto end  = Offset + Bits;
+        constexpr auto last = (end - 1) / 8;
+        auto v              = etl::uint64_t(0);
+        for (auto i = first; i <= last; ++i) {
+            auto const right = static_cast<int>(end) - static_cast<int>(8 * (i + 1));
+            v |= right >= 0 ? etl::uint64_t(in[i]) << right : etl::uint64_t(in[i]) >> -right;
+        }
+        return v & codec_mask(Bits);
+    }
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto to_wire(T v) noexcept -> etl::uint64_t
+{
+    if constexpr (floating_point<T>) {
+        return etl::bit_cast<codec_uint_t<sizeof(T)>>(v);
+    } else if constexpr (is_enum_v<T>) {
+        return static_cast<etl::uint64_t>(static_cast<make_unsigned_t<underlying_type_t<T>>>(v));
+    } else if constexpr (is_same_v<T, bool>) {
+        return v ? 1U : 0U;
+    } else {
+        return static_cast<etl::uint64_t>(static_cast<make_unsigned_t<T>>(v));
+    }
+}
+
+template <typename T, etl::size_t Bits>
+[[nodiscard]] constexpr auto from_wire(etl::uint64_t v) noexcept -> T
+{
+    if constexpr (floating_point<T>) {
+        return etl::bit_cast<T>(static_cast<codec_uint_t<sizeof(T)>>(v));
+    } else if constexpr (is_same_v<T, bool>) {
+        return v != 0;
+    } else {
+        using int_t = typename conditional_t<is_enum_v<T>, underlying_type<T>, type_identity<T>>::type;
+        if constexpr (is_signed_v<int_t> and Bits < 64) {
+            // sign extension of narrow fields
+            if (((v >> (Bits - 1)) & 1U) != 0) { v |= ~codec_mask(Bits); }
+        }
+        return static_cast<T>(static_cast<int_t>(v));
+    }
+}
+
+template <etl::size_t Offset, typename T>
+constexpr auto encode_fields(T const& value, etl::uint8_t* out) noexcept -> void;
+
+template <etl::size_t Offset, typename T>
+constexpr auto decode_fields(etl::uint8_t const* in, T& value) noexcept -> void;
+
+template <etl::size_t Offset, typename Field, typename T>
+constexpr auto encode_element(T const& v, etl::uint8_t* out) noexcept -> void
+{
+    if constexpr (described<T>) {
+        encode_fields<Offset>(v, out);
+    } else {
+        put_bits<Offset, Field::element_bits, Field::order>(out, to_wire(v));
+    }
+}
+
+template <etl::size_t Offset, typename Field, typename T>
+constexpr auto decode_element(etl::uint8_t const* in, T& v) noexcept -> void
+{
+    if constexpr (described<T>) {
+        decode_fields<Offset>(in, v);
+    } else {
+        v = from_wire<T, Field::element_bits>(get_bits<Offset, Field::element_bits, Field::order>(in));
+    }
+}
+
+/// A field together with its bit offset in the encoding.
+template <etl::size_t Offset, typename Field>
+struct placed_field {
+    static constexpr auto offset = Offset;
+    using field_type             = Field;
+};
+
+template <typename... Fields, etl::size_t... I>
+[[nodiscard]] constexpr auto place_fields(fields<Fields...> /*list*/, etl::index_sequence<I...> /*is*/)
+{
+    constexpr auto bits    = etl::array<etl::size_t, sizeof...(Fields)> { Fields::bits... };
+    constexpr auto offsets = [&] {
+        auto result = etl::array<etl::size_t, sizeof...(Fields)> {};
+        for (auto i = etl::size_t(1); i < result.size(); ++i) { result[i] = result[i - 1] + bits[i - 1]; }
+        return result;
+    }();
+    return etl::tuple<placed_field<offsets[I], Fields>...> {};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto placed_fields_of()
+{
+    using list_t = typename describe<T>::fields;
+    return []<typename... Fields>(fields<Fields...> list) {
+        return place_fields(list, etl::make_index_sequence<sizeof...(Fields)> {});
+    }(list_t {});
+}
+
+template <etl::size_t Offset, typename T>
+constexpr auto encode_fields(T const& value, etl::uint8_t* out) noexcept -> void
+{
+    auto placed = placed_fields_of<T>();
+    mpl::for_each(placed, [&]<typename Placed>(Placed /*p*/) {
+        using field_t     = typename Placed::field_type;
+        auto const& m     = value.*field_t::member;
+        constexpr auto at = Offset + Placed::offset;
+        if constexpr (field_t::is_array) {
+            [&]<etl::size_t... I>(etl::index_sequence<I...> /*is*/) {
+                (encode_element<at + I * field_t::element_bits, field_t>(m[I], out), ...);
+            }(etl::make_index_sequence<field_t::count> {});
+        } else {
+            encode_element<at, field_t>(m, out);
+        }
+    });
+}
+
+template <etl::size_t Offset, typename T>
+constexpr auto decode_fields(etl::uint8_t const* in, T& value) noexcept -> void
+{
+    auto placed = placed_fields_of<T>();
+    mpl::for_each(placed, [&]<typename Placed>(Placed /*p*/) {
+        using field_t     = typename Placed::field_type;
+        auto& m           = value.*field_t::member;
+        constexpr auto at = Offset + Placed::offset;
+        if constexpr (field_t::is_array) {
+            [&]<etl::size_t... I>(etl::index_sequence<I...> /*is*/) {
+                (decode_element<at + I * field_t::element_bits, field_t>(in, m[I]), ...);
+            }(etl::make_index_sequence<field_t::count> {});
+        } else {
+            decode_element<at, field_t>(in, m);
+        }
+    });
+}
+
+} // namespace detail
+
+/// \brief Writes the encoding of value to the first encoded_size_v<T> bytes
+/// of out. Returns the number of written bytes, or 0 if out is too small.
+/// The size is checked once, the fields are written without any checks.
+template <described T>
+constexpr auto encode(T const& value, etl::span<etl::uint8_t> out) noexcept -> etl::size_t
+{
+    constexpr auto size = encoded_size_v<T>;
+    if (out.size() < size) { return 0; }
+
+    // unused bits in the last byte are zero
+    if constexpr (detail::codec_bits_v<T> % 8 != 0) { out[size - 1] = 0; }
+    detail::encode_fields<0>(value, out.data());
+    return size;
+}
+
+/// \brief Reads value from the first encoded_size_v<T> bytes of in. Returns
+/// the number of read bytes, or 0 if in is too small.
+template <described T>
+constexpr auto decode(etl::span<etl::uint8_t const> in, T& value) noexcept -> etl::size_t
+{
+    constexpr auto size = encoded_size_v<T>;
+    if (in.size() < size) { return 0; }
+    detail::decode_fields<0>(in.data(), value);
+    return size;
+}
+
+/// \brief Writes the encoding of value to the buffer.
+template <described T>
+auto encode(T const& value, mutable_buffer out) noexcept -> etl::size_t
+{
+    return encode(value, etl::span<etl::uint8_t> { static_cast<etl::uint8_t*>(out.data()), out.size() });
+}
+
+/// \brief Reads value from the buffer.
+template <described T>
+auto decode(const_buffer in, T& value) noexcept -> etl::size_t
+{
+    return decode(etl::span<etl::uint8_t const> { static_cast<etl::uint8_t const*>(in.data()), in.size() }, value);
+}
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_CODEC_HPP
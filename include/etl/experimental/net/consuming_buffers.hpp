@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_CONSUMING_BUFFERS_HPP
+#define TETL_NET_CONSUMING_BUFFERS_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/limits.hpp"
+#include "etl/type_traits.hpp"
+
+#include "etl/experimental/net/buffer_sequence.hpp"
+#include "etl/experimental/net/static_buffer_sequence.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Tracks the progress of a gathered write or scattered read, which
+/// transfers fewer bytes than requested, e.g. one DMA transfer per call.
+///
+/// \details prepare() returns up to MaxBuffers of the remaining buffers and
+/// consume(n) marks n bytes as transferred. The sequence is copied, so it
+/// must only refer to the memory, not own it.
+template <typename BufferSequence, etl::size_t MaxBuffers = 8>
+struct consuming_buffers {
+    using buffer_type = etl::conditional_t<is_mutable_buffer_sequence_v<BufferSequence>, mutable_buffer, const_buffer>;
+    using prepared_buffers_type = static_buffer_sequence<buffer_type, MaxBuffers>;
+
+    explicit consuming_buffers(BufferSequence const& buffers) : buffers_ { buffers } { }
+
+    /// \brief Returns the remaining buffers, limited to maxSize bytes.
+    [[nodiscard]] auto prepare(etl::size_t maxSize = etl::numeric_limits<etl::size_t>::max()) const
+        -> prepared_buffers_type
+    {
+        auto result = prepared_buffers_type {};
+        auto it     = first();
+        auto last   = buffer_sequence_end(buffers_);
+        auto offset = offset_;
+        while (it != last and maxSize != 0 and not result.full()) {
+            auto b = buffer_type(*it++);
+            b += offset;
+            offset = 0;
+            if (b.size() == 0) { continue; }
+
+            auto const n = etl::min(b.size(), maxSize);
+            result.push_back(buffer_type(b.data(), n));
+            maxSize -= n;
+        }
+        return result;
+    }
+
+    /// \brief Marks the first n remaining bytes as transferred.
+    auto consume(etl::size_t n) -> void
+    {
+        consumed_ += n;
+        auto last = buffer_sequence_end(buffers_);
+        for (auto it = first(); it != last and n != 0; ++it) {
+            auto const left = const_buffer(*it).size() - offset_;
+            if (n < left) {
+                offset_ += n;
+                return;
+            }
+            n -= left;
+            offset_ = 0;
+            ++next_;
+        }
+    }
+
+    /// \brief Returns true, if all bytes were transferred.
+    [[nodiscard]] auto empty() const -> bool { return prepare(1).empty(); }
+
+    /// \brief Returns the number of transferred bytes.
+    [[nodiscard]] auto total_consumed() const noexcept -> etl::size_t { return consumed_; }
+
+private:
+    [[nodiscard]] auto first() const
+    {
+        auto it = buffer_sequence_begin(buffers_);
+        for (auto i = etl::size_t(0); i < next_; ++i) { ++it; }
+        return it;
+    }
+
+    BufferSequence buffers_;
+    etl::size_t next_ { 0 };
+    etl::size_t offset_ { 0 };
+    etl::size_t consumed_ { 0 };
+};
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_CONSUMING_BUFFERS_HPP
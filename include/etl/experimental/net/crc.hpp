@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_CRC_HPP
+#define TETL_NET_CRC_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/cstring.hpp"
+#include "etl/limits.hpp"
+#include "etl/span.hpp"
+#include "etl/type_traits.hpp"
+
+#include "etl/experimental/net/buffer_const.hpp"
+
+namespace etl::experimental::net {
+
+namespace detail {
+
+template <typename T>
+[[nodiscard]] constexpr auto crc_reflect(T v) noexcept -> T
+{
+    auto result = T(0);
+    for (auto i = 0; i < etl::numeric_limits<T>::digits; ++i) {
+        result = static_cast<T>((result << 1U) | (v & 1U));
+        v      = static_cast<T>(v >> 1U);
+    }
+    return result;
+}
+
+/// Table driven CRC register. Reflected registers shift right and consume
+/// the low byte first, all others shift left and consume the high byte.
+template <typename T, T Poly, bool Reflect, etl::size_t Slices>
+struct crc_register {
+    static constexpr auto width = etl::numeric_limits<T>::digits;
+
+    /// Shifts the register by one byte.
+    [[nodiscard]] static constexpr auto shift(T c) noexcept -> T
+    {
+        if constexpr (width == 8) {
+            return T(0);
+        } else if constexpr (Reflect) {
+            return static_cast<T>(c >> 8U);
+        } else {
+            return static_cast<T>(c << 8U);
+        }
+    }
+
+    /// Byte i of the register in the order it meets the input.
+    [[nodiscard]] static constexpr auto byte(T c, etl::size_t i) noexcept -> etl::uint8_t
+    {
+        if constexpr (Reflect) {
+            return static_cast<etl::uint8_t>(c >> (8 * i));
+        } else {
+            return static_cast<etl::uint8_t>(c >> (width - 8 - 8 * i));
+        }
+    }
+
+    // table[k][b] is the register after the byte b followed by k zero bytes
+    static constexpr auto table = [] {
+        auto result = etl::array<etl::array<T, 256>, Slices> {};
+        for (auto b = 0U; b < 256U; ++b) {
+            auto c = T(0);
+            if constexpr (Reflect) {
+                constexpr auto poly = crc_reflect(Poly);
+                c                   = static_cast<T>(b);
+                for (auto k = 0; k < 8; ++k) { c = static_cast<T>((c & 1U) != 0 ? (c >> 1U) ^ poly : c >> 1U); }
+            } else {
+                constexpr auto top = T(1) << (width - 1);
+                c                  = static_cast<T>(T(b) << (width - 8));
+                for (auto k = 0; k < 8; ++k) { c = static_cast<T>((c & top) != 0 ? (c << 1U) ^ Poly : c << 1U); }
+            }
+            result[0][b] = c;
+        }
+        for (auto k = etl::size_t(1); k < Slices; ++k) {
+            for (auto b = etl::size_t(0); b < 256U; ++b) {
+                auto const prev = result[k - 1][b];
+                result[k][b]    = static_cast<T>(shift(prev) ^ result[0][byte(prev, 0)]);
+            }
+        }
+        return result;
+    }();
+
+    [[nodiscard]] static constexpr auto update(T c, etl::uint8_t const* p, etl::size_t n) noexcept -> T
+    {
+        // slicing-by-N: the register is xor-ed into the next N bytes, each of
+        // which is then looked up independently in its own table.
+        if constexpr (Slices > 1) {
+            for (; n >= Slices; n -= Slices, p += Slices) {
+                auto next = T(0);
+                for (auto i = etl::size_t(0); i < Slices; ++i) {
+                    auto x = p[i];
+                    if (i < sizeof(T)) { x = static_cast<etl::uint8_t>(x ^ byte(c, i)); }
+                    next = static_cast<T>(next ^ table[Slices - 1 - i][x]);
+                }
+                c = next;
+            }
+        }
+        for (; n != 0; --n, ++p) { c = static_cast<T>(shift(c) ^ table[0][byte(c, 0) ^ *p]); }
+        return c;
+    }
+};
+
+inline constexpr auto crc32c_poly = etl::uint32_t(0x1EDC6F41);
+
+#if defined(__x86_64__) and defined(__SSE4_2__)
+    #define TETL_NET_HAS_HARDWARE_CRC32C 1
+#elif defined(__aarch64__) and defined(__ARM_FEATURE_CRC32)                                                            \
+    and (__has_builtin(__builtin_arm_crc32cd) or __has_builtin(__builtin_aarch64_crc32cx))
+    #define TETL_NET_HAS_HARDWARE_CRC32C 1
+#else
+    #define TETL_NET_HAS_HARDWARE_CRC32C 0
+#endif
+
+#if TETL_NET_HAS_HARDWARE_CRC32C
+/// Reflected CRC-32C register update with the SSE4.2 or ARMv8 CRC instructions.
+inline auto hardware_crc32c(etl::uint32_t c, etl::uint8_t const* p, etl::size_t n) noexcept -> etl::uint32_t
+{
+    for (; n >= 8; n -= 8, p += 8) {
+        auto word = etl::uint64_t(0);
+        etl::memcpy(&word, p, 8);
+    #if defined(__x86_64__)
+        c = static_cast<etl::uint32_t>(__builtin_ia32_crc32di(c, word));
+    #elif __has_builtin(__builtin_arm_crc32cd)
+        c = __builtin_arm_crc32cd(c, word);
+    #else
+        c = __builtin_aarch64_crc32cx(c, word);
+    #endif
+    }
+    for (; n != 0; --n, ++p) {
+    #if defined(__x86_64__)
+        c = __builtin_ia32_crc32qi(c, *p);
+    #elif __has_builtin(__builtin_arm_crc32cb)
+        c = __builtin_arm_crc32cb(c, *p);
+    #else
+        c = __builtin_aarch64_crc32cb(c, *p);
+    #endif
+    }
+    return c;
+}
+#endif
+
+} // namespace detail
+
+/// \brief Incremental CRC with the parameters of the Rocksoft model, e.g.
+/// CRC-32 is basic_crc<uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF>.
+/// The width of the CRC is the width of T. Reflect applies to the input and
+/// the output.
+///
+/// \details The lookup tables are generated at compile time. Slices is the
+/// number of tables, 8 tables (8 KiB for a 32-bit CRC) process 8 bytes per
+/// step, 1 table (1 KiB) processes a single byte. At runtime, CRC-32C uses
+/// the CRC instructions of SSE4.2 or ARMv8, if the target has them.
+template <typename T, T Poly, T Init, bool Reflect, T XorOut, etl::size_t Slices = 8>
+struct basic_crc {
+    static_assert(etl::is_unsigned_v<T> and sizeof(T) <= 8, "T must be an unsigned integer");
+    static_assert(Slices == 1 or Slices == 4 or Slices == 8, "Slices must be 1, 4 or 8");
+    static_assert(Slices == 1 or Slices >= sizeof(T), "Slices must cover the width of the CRC");
+
+    using value_type = T;
+
+    constexpr basic_crc() = default;
+
+    /// \brief Adds data to the checksum.
+    constexpr auto update(etl::span<etl::uint8_t const> data) noexcept -> basic_crc&
+    {
+#if TETL_NET_HAS_HARDWARE_CRC32C
+        if constexpr (is_crc32c) {
+            if (not etl::is_constant_evaluated()) {
+                state_ = detail::hardware_crc32c(state_, data.data(), data.size());
+                return *this;
+            }
+        }
+#endif
+        state_ = register_t::update(state_, data.data(), data.size());
+        return *this;
+    }
+
+    /// \brief Adds the bytes of the buffer to the checksum.
+    auto update(const_buffer data) noexcept -> basic_crc&
+    {
+        return update(etl::span<etl::uint8_t const> { static_cast<etl::uint8_t const*>(data.data()), data.size() });
+    }
+
+    /// \brief Returns the checksum of all bytes added since the last reset.
+    [[nodiscard]] constexpr auto value() const noexcept -> T { return static_cast<T>(state_ ^ XorOut); }
+
+    constexpr auto reset() noexcept -> void { state_ = initial; }
+
+private:
+    using register_t = detail::crc_register<T, Poly, Reflect, Slices>;
+
+    static constexpr auto initial   = Reflect ? detail::crc_reflect(Init) : Init;
+    static constexpr auto is_crc32c = etl::is_same_v<T, etl::uint32_t> and Poly == detail::crc32c_poly and Reflect;
+
+    T state_ { initial };
+};
+
+/// \brief CRC-8/SMBUS
+using crc8 = basic_crc<etl::uint8_t, 0x07, 0x00, false, 0x00>;
+
+/// \brief CRC-16/CCITT-FALSE
+using crc16 = basic_crc<etl::uint16_t, 0x1021, 0xFFFF, false, 0x0000>;
+
+/// \brief CRC-32 of Ethernet, zlib and PNG
+using crc32 = basic_crc<etl::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF>;
+
+/// \brief CRC-32C (Castagnoli) of iSCSI, SCTP and ext4
+using crc32c = basic_crc<etl::uint32_t, detail::crc32c_poly, 0xFFFFFFFF, true, 0xFFFFFFFF>;
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_CRC_HPP
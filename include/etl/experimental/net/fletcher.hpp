@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_FLETCHER_HPP
+#define TETL_NET_FLETCHER_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/span.hpp"
+
+#include "etl/experimental/net/buffer_const.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Incremental Fletcher-16 checksum over bytes.
+///
+/// \details The modulo is deferred to every 5802 bytes, the largest block
+/// for which the sums can not overflow 32 bits.
+struct fletcher16 {
+    using value_type = etl::uint16_t;
+
+    constexpr fletcher16() = default;
+
+    /// \brief Adds data to the checksum.
+    constexpr auto update(etl::span<etl::uint8_t const> data) noexcept -> fletcher16&
+    {
+        auto const* p = data.data();
+        auto n        = data.size();
+        while (n != 0) {
+            auto const block = etl::min(n, max_block);
+            n -= block;
+            for (auto const* last = p + block; p != last; ++p) {
+                a_ += *p;
+                b_ += a_;
+            }
+            a_ %= 255U;
+            b_ %= 255U;
+        }
+        return *this;
+    }
+
+    /// \brief Adds the bytes of the buffer to the checksum.
+    auto update(const_buffer data) noexcept -> fletcher16&
+    {
+        return update(etl::span<etl::uint8_t const> { static_cast<etl::uint8_t const*>(data.data()), data.size() });
+    }
+
+    /// \brief Returns the checksum of all bytes added since the last reset.
+    [[nodiscard]] constexpr auto value() const noexcept -> value_type
+    {
+        return static_cast<value_type>((b_ << 8U) | a_);
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        a_ = 0;
+        b_ = 0;
+    }
+
+private:
+    static constexpr auto max_block = etl::size_t(5802);
+
+    etl::uint32_t a_ { 0 };
+    etl::uint32_t b_ { 0 };
+};
+
+/// \brief Incremental Fletcher-32 checksum over little-endian 16-bit words.
+/// An odd number of bytes is padded with a zero byte.
+///
+/// \details The modulo is deferred to every 359 words, the largest block for
+/// which the sums can not overflow 32 bits. Updates may split a word, the
+/// first byte is kept until the next update.
+struct fletcher32 {
+    using value_type = etl::uint32_t;
+
+    constexpr fletcher32() = default;
+
+    /// \brief Adds data to the checksum.
+    constexpr auto update(etl::span<etl::uint8_t const> data) noexcept -> fletcher32&
+    {
+        auto const* p = data.data();
+        auto n        = data.size();
+        if (n == 0) { return *this; }
+
+        if (has_pending_) {
+            add_word(pending_ | static_cast<etl::uint32_t>(*p++) << 8U);
+            --n;
+            has_pending_ = false;
+        }
+
+        while (n >= 2) {
+            auto const words = etl::min(n / 2, max_block);
+            n -= 2 * words;
+            for (auto const* last = p + 2 * words; p != last; p += 2) {
+                a_ += p[0] | static_cast<etl::uint32_t>(p[1]) << 8U;
+                b_ += a_;
+            }
+            a_ %= 65535U;
+            b_ %= 65535U;
+        }
+
+        if (n != 0) {
+            pending_     = *p;
+            has_pending_ = true;
+        }
+        return *this;
+    }
+
+    /// \brief Adds the bytes of the buffer to the checksum.
+    auto update(const_buffer data) noexcept -> fletcher32&
+    {
+        return update(etl::span<etl::uint8_t const> { static_cast<etl::uint8_t const*>(data.data()), data.size() });
+    }
+
+    /// \brief Returns the checksum of all bytes added since the last reset.
+    [[nodiscard]] constexpr auto value() const noexcept -> value_type
+    {
+        auto copy = *this;
+        if (copy.has_pending_) { copy.add_word(copy.pending_); }
+        return (copy.b_ << 16U) | copy.a_;
+    }
+
+    constexpr auto reset() noexcept -> void { *this = fletcher32 {}; }
+
+private:
+    static constexpr auto max_block = etl::size_t(359);
+
+    constexpr auto add_word(etl::uint32_t word) noexcept -> void
+    {
+        a_ = (a_ + word) % 65535U;
+        b_ = (b_ + a_) % 65535U;
+    }
+
+    etl::uint32_t a_ { 0 };
+    etl::uint32_t b_ { 0 };
+    etl::uint32_t pending_ { 0 };
+    bool has_pending_ { false };
+};
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_FLETCHER_HPP
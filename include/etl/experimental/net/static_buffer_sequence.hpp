@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_NET_STATIC_BUFFER_SEQUENCE_HPP
+#define TETL_NET_STATIC_BUFFER_SEQUENCE_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cassert.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/type_traits.hpp"
+
+#include "etl/experimental/net/buffer_const.hpp"
+#include "etl/experimental/net/buffer_mutable.hpp"
+
+namespace etl::experimental::net {
+
+/// \brief Buffer sequence with storage for up to Capacity buffers, e.g. to
+/// gather a header, a payload and a checksum into one write without copying
+/// the bytes. Buffer is const_buffer or mutable_buffer.
+template <typename Buffer, etl::size_t Capacity>
+struct static_buffer_sequence {
+    using value_type     = Buffer;
+    using size_type      = etl::size_t;
+    using iterator       = Buffer const*;
+    using const_iterator = Buffer const*;
+
+    static_buffer_sequence() = default;
+
+    template <typename... Buffers>
+        requires(sizeof...(Buffers) > 0 and sizeof...(Buffers) <= Capacity
+                 and (etl::is_convertible_v<Buffers const&, Buffer> and ...))
+    explicit static_buffer_sequence(Buffers const&... buffers) noexcept
+        : buffers_ { Buffer(buffers)... }
+        , size_ { sizeof...(Buffers) }
+    {
+    }
+
+    /// \brief Appends b. The sequence must not be full.
+    auto push_back(Buffer const& b) noexcept -> void
+    {
+        TETL_ASSERT(not full());
+        buffers_[size_++] = b;
+    }
+
+    auto clear() noexcept -> void { size_ = 0; }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator { return buffers_.data(); }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator { return buffers_.data() + size_; }
+
+    [[nodiscard]] auto operator[](size_type i) const noexcept -> Buffer const& { return buffers_[i]; }
+
+    [[nodiscard]] auto size() const noexcept -> size_type { return size_; }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto full() const noexcept -> bool { return size_ == Capacity; }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Capacity; }
+
+private:
+    etl::array<Buffer, Capacity> buffers_ {};
+    size_type size_ { 0 };
+};
+
+/// \brief A sequence of only mutable buffers is mutable, all others are const.
+template <typename... Buffers>
+static_buffer_sequence(Buffers const&...) -> static_buffer_sequence<
+    etl::conditional_t<(etl::is_same_v<Buffers, mutable_buffer> and ...), mutable_buffer, const_buffer>,
+    sizeof...(Buffers)>;
+
+} // namespace etl::experimental::net
+
+#endif // TETL_NET_STATIC_BUFFER_SEQUENCE_HPP
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_POSIX_MONOTONIC_CLOCK_HPP
+#define TETL_POSIX_MONOTONIC_CLOCK_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/chrono.hpp"
+#include "etl/cstdint.hpp"
+
+#if defined(__unix__) and __has_include(<time.h>)
+    #include <errno.h>
+    #include <time.h>
+
+namespace etl::experimental::posix {
+
+/// \brief Steady clock of the host, based on CLOCK_MONOTONIC. Backend for
+/// running an etl::run_loop on Linux, e.g. in tests and benchmarks.
+struct monotonic_clock {
+    using rep                       = etl::int64_t;
+    using period                    = etl::nano;
+    using duration                  = etl::chrono::duration<rep, period>;
+    using time_point                = etl::chrono::time_point<monotonic_clock>;
+    static constexpr bool is_steady = true;
+
+    [[nodiscard]] static auto now() noexcept -> time_point
+    {
+        auto ts = timespec {};
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+        return time_point { duration { static_cast<rep>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec } };
+    }
+
+    /// \brief Sleeps until deadline, retrying after interruptions by signals.
+    static auto wait_until(time_point deadline) noexcept -> void
+    {
+        auto const ns = deadline.time_since_epoch().count();
+        auto ts       = timespec {};
+        ts.tv_sec     = static_cast<time_t>(ns / 1'000'000'000);
+        ts.tv_nsec    = static_cast<long>(ns % 1'000'000'000);
+        while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) { }
+    }
+};
+
+} // namespace etl::experimental::posix
+
+#endif
+
+#endif // TETL_POSIX_MONOTONIC_CLOCK_HPP
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef ETL_EXPERIMENTAL_TESTING_BENCHMARK_HPP
+#define ETL_EXPERIMENTAL_TESTING_BENCHMARK_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/array.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/warning.hpp"
+
+namespace etl::test {
+
+#if defined(__x86_64__) or defined(__i386__) or defined(__aarch64__)
+    #define TETL_TEST_HAS_CYCLE_COUNTER 1
+#else
+    #define TETL_TEST_HAS_CYCLE_COUNTER 0
+#endif
+
+#if TETL_TEST_HAS_CYCLE_COUNTER
+/// \brief Returns the time stamp counter on x86 and the virtual counter on
+/// AArch64. On microcontrollers, e.g. the DWT cycle counter or a hardware
+/// timer can be passed as a user callback to benchmark_clock.
+[[nodiscard]] inline auto cycle_counter() noexcept -> etl::uint64_t
+{
+    #if defined(__aarch64__)
+    auto ticks = etl::uint64_t(0);
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+    #else
+    return __builtin_ia32_rdtsc();
+    #endif
+}
+#endif
+
+/// \brief Returns Clock::now() in nanoseconds. Works with any clock that has
+/// a period and a time_point with time_since_epoch(), e.g.
+/// chrono_nanoseconds<std::chrono::steady_clock>.
+template <typename Clock>
+[[nodiscard]] auto chrono_nanoseconds() -> etl::uint64_t
+{
+    using period     = typename Clock::period;
+    auto const ticks = static_cast<etl::uint64_t>(Clock::now().time_since_epoch().count());
+    if constexpr (period::den >= 1'000'000'000) {
+        return ticks * static_cast<etl::uint64_t>(period::num) / (period::den / 1'000'000'000);
+    } else {
+        return ticks * static_cast<etl::uint64_t>(period::num * (1'000'000'000 / period::den));
+    }
+}
+
+/// \brief A monotonic clock, which is read before and after each sample.
+/// unit is only used for reporting. Defaults to cycle_counter, if the target
+/// has one. Benchmarks are skipped without a clock.
+struct benchmark_clock {
+    using now_func_t = etl::uint64_t (*)();
+
+#if TETL_TEST_HAS_CYCLE_COUNTER
+    now_func_t now { cycle_counter };
+#else
+    now_func_t now { nullptr };
+#endif
+    char const* unit { "cycles" };
+};
+
+/// \brief The number of samples is limited, they are stored on the stack.
+inline constexpr auto max_benchmark_samples = etl::uint16_t(31);
+
+struct benchmark_options {
+    /// The clock used for all measurements.
+    benchmark_clock clock {};
+
+    /// The number of iterations is doubled, until a sample takes at least
+    /// min_ticks of clock.
+    etl::uint64_t min_ticks { 100'000 };
+
+    /// Number of samples after calibration, at most max_benchmark_samples.
+    etl::uint16_t samples { 9 };
+};
+
+/// \brief The minimum, median and maximum duration of a sample of iterations
+/// calls in ticks of the clock.
+struct benchmark_stats {
+    etl::uint64_t iterations { 0 };
+    etl::uint64_t min { 0 };
+    etl::uint64_t median { 0 };
+    etl::uint64_t max { 0 };
+};
+
+/// \brief Prevents the compiler from optimizing away the computation of
+/// value inside of a benchmark.
+template <typename T>
+auto do_not_optimize(T const& value) -> void
+{
+#if defined(TETL_MSVC)
+    auto const volatile* sink = &value;
+    etl::ignore_unused(sink);
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/// \brief Calls func repeatedly and measures the duration of samples of
+/// calls. Allocates nothing, the samples are stored on the stack. Returns
+/// zero iterations, if there is no clock.
+template <typename Func>
+[[nodiscard]] auto run_benchmark(Func func, benchmark_options const& options) -> benchmark_stats
+{
+    if (options.clock.now == nullptr) { return {}; }
+
+    auto const sample = [&](etl::uint64_t iterations) {
+        auto const start = options.clock.now();
+        for (auto i = etl::uint64_t(0); i < iterations; ++i) { func(); }
+        return options.clock.now() - start;
+    };
+
+    // warmup and calibration
+    auto stats = benchmark_stats { 1, 0, 0, 0 };
+    while (sample(stats.iterations) < options.min_ticks and stats.iterations < (etl::uint64_t(1) << 32U)) {
+        stats.iterations *= 2U;
+    }
+
+    auto samples     = etl::array<etl::uint64_t, max_benchmark_samples> {};
+    auto const count = etl::clamp<etl::size_t>(options.samples, 1, max_benchmark_samples);
+    for (auto i = etl::size_t(0); i < count; ++i) { samples[i] = sample(stats.iterations); }
+    etl::sort(samples.begin(), etl::next(samples.begin(), static_cast<etl::ptrdiff_t>(count)));
+
+    stats.min    = samples[0];
+    stats.median = samples[count / 2];
+    stats.max    = samples[count - 1];
+    return stats;
+}
+
+} // namespace etl::test
+
+#endif // ETL_EXPERIMENTAL_TESTING_BENCHMARK_HPP
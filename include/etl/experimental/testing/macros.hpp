@@ -6,6 +6,7 @@
 #include "etl/version.hpp"
 
 #include "etl/experimental/testing/assertion_handler.hpp"
+#include "etl/experimental/testing/benchmark.hpp"
 #include "etl/experimental/testing/name_and_tags.hpp"
 #include "etl/experimental/testing/section.hpp"
 #include "etl/experimental/testing/session.hpp"
@@ -58,6 +59,18 @@ namespace mpl = etl::experimental::mpl;
 
 #define TEST_DETAIL_TEST_CASE(...) TEST_DETAIL_TEST_CASE2(TETL_PP_UNIQUE_NAME(tc), __VA_ARGS__)
 
+#define TEST_DETAIL_BENCHMARK2(bm, ...)                                                                                \
+    static auto bm()->void;                                                                                            \
+    namespace {                                                                                                        \
+    auto TETL_PP_UNIQUE_NAME(bm) = etl::test::auto_benchmark_reg {                                                     \
+        etl::test::name_and_tags { __VA_ARGS__ },                                                                      \
+        bm,                                                                                                            \
+    };                                                                                                                 \
+    }                                                                                                                  \
+    static auto bm()->void
+
+#define TEST_DETAIL_BENCHMARK(...) TEST_DETAIL_BENCHMARK2(TETL_PP_UNIQUE_NAME(bm), __VA_ARGS__)
+
 #define TEST_DETAIL_SECTION2(tcs, ...)                                                                                 \
     if (etl::test::section tcs {                                                                                       \
             etl::test::section_info {                                                                                  \
@@ -87,6 +100,8 @@ namespace mpl = etl::experimental::mpl;
 
 #define SECTION(...)  TEST_DETAIL_SECTION(__VA_ARGS__)
 
+#define BENCHMARK(...)  TEST_DETAIL_BENCHMARK(__VA_ARGS__)
+
 #define CHECK(...)      TEST_DETAIL_CHECK(etl::test::result_disposition::continue_on_failure, __VA_ARGS__)
 #define REQUIRE(...)    TEST_DETAIL_CHECK(etl::test::result_disposition::normal, __VA_ARGS__)
 
@@ -3,6 +3,7 @@
 #ifndef ETL_EXPERIMENTAL_TESTING_SESSION_HPP
 #define ETL_EXPERIMENTAL_TESTING_SESSION_HPP
 
+#include "etl/experimental/testing/benchmark.hpp"
 #include "etl/experimental/testing/name_and_tags.hpp"
 #include "etl/experimental/testing/source_line_info.hpp"
 #include "etl/experimental/testing/test_case.hpp"
@@ -23,6 +24,8 @@ struct session_stats {
 
     etl::uint16_t num_assertions { 0 };
     etl::uint16_t num_assertions_failed { 0 };
+
+    etl::uint16_t num_benchmarks { 0 };
 };
 
 template <etl::size_t Capacity>
@@ -40,6 +43,10 @@ struct session {
     [[nodiscard]] auto run_all() -> int;
 
     constexpr auto add_test(name_and_tags const& spec, test_func_t func, etl::string_view typeName = {}) -> void;
+    constexpr auto add_benchmark(name_and_tags const& spec, test_func_t func) -> void;
+
+    [[nodiscard]] constexpr auto benchmark_options() const noexcept -> etl::test::benchmark_options const&;
+    constexpr auto benchmark_options(etl::test::benchmark_options const& options) noexcept -> void;
 
     auto current_test(test_case* tc) -> void;
 
@@ -63,6 +70,7 @@ private:
     // section_stack_t sections_ {};
     bool shouldTerminate_ { false };
     session_stats stats_ {};
+    etl::test::benchmark_options benchmarkOptions_ {};
 };
 
 inline auto current_session() -> session&;
@@ -89,6 +97,24 @@ inline constexpr auto session::add_test(name_and_tags const& spec, test_func_t f
     }
 }
 
+inline constexpr auto session::add_benchmark(name_and_tags const& spec, test_func_t func) -> void
+{
+    if (first_ + count_ != last_) {
+        first_[count_].is_benchmark = true;
+        add_test(spec, func);
+    }
+}
+
+inline constexpr auto session::benchmark_options() const noexcept -> etl::test::benchmark_options const&
+{
+    return benchmarkOptions_;
+}
+
+inline constexpr auto session::benchmark_options(etl::test::benchmark_options const& options) noexcept -> void
+{
+    benchmarkOptions_ = options;
+}
+
 inline auto session::run_all() -> int
 {
     ::printf("%-10s %-10s\n", "Run:", name_.data());
@@ -100,6 +126,37 @@ inline auto session::run_all() -> int
             continue;
         }
 
+        if (tc.is_benchmark) {
+            ++stats_.num_benchmarks;
+            tc.benchmark = run_benchmark(tc.func, benchmarkOptions_);
+            if (tc.benchmark.iterations == 0) {
+                ::printf("%-10s %-10s\n", "Skip:", tc.info.name.data());
+                continue;
+            }
+
+            // per iteration with two decimal places, printf may lack floating point support
+            auto const perIteration = [&tc](etl::uint64_t ticks) {
+                return static_cast<unsigned long long>(ticks * 100U / tc.benchmark.iterations);
+            };
+            auto const min    = perIteration(tc.benchmark.min);
+            auto const median = perIteration(tc.benchmark.median);
+            auto const max    = perIteration(tc.benchmark.max);
+            ::printf(
+                "%-10s %-10s %llu.%02llu / %llu.%02llu / %llu.%02llu %s (min / median / max, %llu iterations)\n",
+                "Bench:",
+                tc.info.name.data(),
+                min / 100U,
+                min % 100U,
+                median / 100U,
+                median % 100U,
+                max / 100U,
+                max % 100U,
+                benchmarkOptions_.clock.unit,
+                static_cast<unsigned long long>(tc.benchmark.iterations)
+            );
+            continue;
+        }
+
         current_test(&tc);
         ::printf("%-10s %-10s %-10s\n", "Run:", tc.info.name.data(), tc.type_name.empty() ? "" : tc.type_name.data());
         tc.func();
@@ -114,6 +171,7 @@ inline auto session::run_all() -> int
 
     auto const& s = stats();
     ::printf("\nAll tests passed (%d assertions in %d test cases)\n", s.num_assertions, s.num_test_cases);
+    if (s.num_benchmarks > 0) { ::printf("%d benchmarks\n", s.num_benchmarks); }
     return 0;
 }
 
@@ -150,6 +208,13 @@ struct auto_reg {
     explicit auto_reg(name_and_tags const& sp, test_func_t func) { current_session().add_test(sp, func); }
 };
 
+struct auto_benchmark_reg {
+    explicit auto_benchmark_reg(name_and_tags const& sp, test_func_t func)
+    {
+        current_session().add_benchmark(sp, func);
+    }
+};
+
 } // namespace etl::test
 
 #endif // ETL_EXPERIMENTAL_TESTING_SESSION_HPP
@@ -3,6 +3,7 @@
 #ifndef ETL_EXPERIMENTAL_TESTING_TEST_CASE_HPP
 #define ETL_EXPERIMENTAL_TESTING_TEST_CASE_HPP
 
+#include "etl/experimental/testing/benchmark.hpp"
 #include "etl/experimental/testing/name_and_tags.hpp"
 
 namespace etl::test {
@@ -13,6 +14,8 @@ struct test_case {
     name_and_tags info;
     test_func_t func;
     etl::string_view type_name {};
+    bool is_benchmark { false };
+    benchmark_stats benchmark {};
 };
 
 } // namespace etl::test
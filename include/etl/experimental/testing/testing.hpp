@@ -6,6 +6,7 @@
 #include "etl/version.hpp"
 
 #include "etl/experimental/testing/assertion_handler.hpp"
+#include "etl/experimental/testing/benchmark.hpp"
 #include "etl/experimental/testing/macros.hpp"
 #include "etl/experimental/testing/name_and_tags.hpp"
 #include "etl/experimental/testing/result_disposition.hpp"
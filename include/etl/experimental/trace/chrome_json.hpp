@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_TRACE_CHROME_JSON_HPP
+#define TETL_TRACE_CHROME_JSON_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/charconv.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/cstring.hpp"
+
+#include "etl/experimental/trace/event.hpp"
+#include "etl/experimental/trace/trace.hpp"
+
+#if __has_include(<stdio.h>)
+    #include <stdio.h>
+#endif
+
+namespace etl::experimental::trace {
+
+namespace detail {
+
+template <typename Writer>
+auto write_string(Writer& write, char const* str) -> void
+{
+    write(str, etl::strlen(str));
+}
+
+template <typename Writer>
+auto write_unsigned(Writer& write, etl::uint64_t value, int minDigits = 1) -> void
+{
+    auto digits    = etl::array<char, 24> {};
+    auto const res = etl::to_chars(digits.begin(), digits.end(), value);
+    for (auto n = res.ptr - digits.begin(); n < minDigits; ++n) { write("0", 1); }
+    write(digits.data(), static_cast<etl::size_t>(res.ptr - digits.begin()));
+}
+
+template <typename Writer>
+auto write_event(Writer& write, etl::size_t thread, event const& e) -> void
+{
+    static constexpr char const* phases[] = { "B", "E", "C", "i" };
+
+    write_string(write, "{\"name\":\"");
+    for (auto const* c = e.name != nullptr ? e.name : ""; *c != '\0'; ++c) {
+        if (*c == '"' or *c == '\\') { write("\\", 1); }
+        write(c, 1);
+    }
+    write_string(write, "\",\"ph\":\"");
+    write_string(write, phases[static_cast<etl::uint8_t>(e.type)]);
+
+    // microseconds with three decimals
+    auto const tpu = trace::ticks_per_microsecond() != 0 ? trace::ticks_per_microsecond() : 1;
+    write_string(write, "\",\"ts\":");
+    write_unsigned(write, e.timestamp / tpu);
+    write_string(write, ".");
+    write_unsigned(write, e.timestamp % tpu * 1000U / tpu, 3);
+
+    write_string(write, ",\"pid\":1,\"tid\":");
+    write_unsigned(write, thread);
+    if (e.type == event_type::counter) {
+        write_string(write, ",\"args\":{\"value\":");
+        if (e.value < 0) { write("-", 1); }
+        write_unsigned(write, e.value < 0 ? etl::uint64_t(0) - static_cast<etl::uint64_t>(e.value) : e.value);
+        write_string(write, "}");
+    }
+    if (e.type == event_type::instant) { write_string(write, ",\"s\":\"t\""); }
+    write_string(write, "}");
+}
+
+} // namespace detail
+
+/// \brief Exports the events of all threads in the Chrome trace event format,
+/// which can be loaded into chrome://tracing or Perfetto. write is called
+/// with (char const* data, size_t size) for every piece of the document.
+///
+/// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+template <typename Writer>
+auto write_chrome_json(Writer write) -> void
+{
+    auto first = true;
+    detail::write_string(write, "{\"traceEvents\":[");
+    for_each_buffer([&](etl::size_t thread, buffer const& events) {
+        events.for_each([&](event const& e) {
+            detail::write_string(write, first ? "\n" : ",\n");
+            detail::write_event(write, thread, e);
+            first = false;
+        });
+    });
+    detail::write_string(write, "\n]}\n");
+}
+
+#if __has_include(<stdio.h>)
+/// \brief Exports the events of all threads in the Chrome trace event format
+/// to file. Returns false if a write failed.
+inline auto write_chrome_json(FILE* file) -> bool
+{
+    auto ok = true;
+    write_chrome_json([file, &ok](char const* data, etl::size_t size) {
+        ok = ok and ::fwrite(data, 1, size, file) == size;
+    });
+    return ok;
+}
+#endif
+
+} // namespace etl::experimental::trace
+
+#endif // TETL_TRACE_CHROME_JSON_HPP
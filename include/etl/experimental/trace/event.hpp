@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_TRACE_EVENT_HPP
+#define TETL_TRACE_EVENT_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/cstdint.hpp"
+
+namespace etl::experimental::trace {
+
+/// \brief Kind of a trace event. Maps to the phases "B", "E", "C" and "i" of
+/// the Chrome trace event format.
+enum struct event_type : etl::uint8_t {
+    begin,
+    end,
+    counter,
+    instant,
+};
+
+/// \brief A single trace event. name must point to a string with static
+/// storage duration, usually a string literal. value is only used by
+/// counters.
+struct event {
+    char const* name { nullptr };
+    etl::uint64_t timestamp { 0 };
+    etl::int64_t value { 0 };
+    event_type type { event_type::instant };
+};
+
+} // namespace etl::experimental::trace
+
+#endif // TETL_TRACE_EVENT_HPP
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_TRACE_RING_BUFFER_HPP
+#define TETL_TRACE_RING_BUFFER_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/bit.hpp"
+#include "etl/cstdint.hpp"
+
+#include "etl/experimental/trace/event.hpp"
+
+namespace etl::experimental::trace {
+
+/// \brief Fixed size event buffer with a single writer. When full, the
+/// oldest events are overwritten.
+///
+/// \details push never blocks or allocates. The number of written events is
+/// a size_t, so it is lock-free on all targets. It is published with a
+/// release store, readers on other threads load it with acquire. Events,
+/// that are overwritten while being read, may be torn, so buffers should be
+/// exported after the writers are done.
+template <etl::size_t Capacity>
+struct ring_buffer {
+    static_assert(etl::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    using size_type = etl::size_t;
+
+    /// \brief Appends e, overwriting the oldest event if full.
+    auto push(event const& e) noexcept -> void
+    {
+        auto const head                = written_;
+        events_[head & (Capacity - 1)] = e;
+        store_release(written_, head + 1U);
+    }
+
+    /// \brief Returns the number of events, that can be read.
+    [[nodiscard]] auto size() const noexcept -> size_type
+    {
+        auto const written = load_acquire(written_);
+        return written < Capacity ? written : Capacity;
+    }
+
+    /// \brief Returns the number of overwritten events.
+    [[nodiscard]] auto dropped() const noexcept -> size_type
+    {
+        auto const written = load_acquire(written_);
+        return written < Capacity ? 0 : written - Capacity;
+    }
+
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Capacity; }
+
+    /// \brief Calls f with every event, from the oldest to the newest.
+    template <typename Func>
+    auto for_each(Func f) const -> void
+    {
+        auto const written = load_acquire(written_);
+        auto const first   = written < Capacity ? size_type(0) : written - Capacity;
+        for (auto i = first; i != written; ++i) { f(events_[i & (Capacity - 1)]); }
+    }
+
+    /// \brief Removes all events. Must not be called concurrently with push.
+    auto clear() noexcept -> void { store_release(written_, size_type(0)); }
+
+private:
+    static auto load_acquire(size_type const& v) noexcept -> size_type
+    {
+#if defined(TETL_MSVC)
+        return *static_cast<size_type const volatile*>(&v);
+#else
+        return __atomic_load_n(&v, __ATOMIC_ACQUIRE);
+#endif
+    }
+
+    static auto store_release(size_type& v, size_type x) noexcept -> void
+    {
+#if defined(TETL_MSVC)
+        *static_cast<size_type volatile*>(&v) = x;
+#else
+        __atomic_store_n(&v, x, __ATOMIC_RELEASE);
+#endif
+    }
+
+    etl::array<event, Capacity> events_ {};
+    size_type written_ { 0 };
+};
+
+} // namespace etl::experimental::trace
+
+#endif // TETL_TRACE_RING_BUFFER_HPP
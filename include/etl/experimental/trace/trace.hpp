@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_TRACE_TRACE_HPP
+#define TETL_TRACE_TRACE_HPP
+
+#include "etl/version.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/scope.hpp"
+
+#include "etl/experimental/trace/event.hpp"
+#include "etl/experimental/trace/ring_buffer.hpp"
+
+#if defined(__linux__) and __has_include(<time.h>)
+    #include <time.h>
+#endif
+
+/// Number of events per thread, must be a power of two.
+#if not defined(TETL_TRACE_BUFFER_SIZE)
+    #define TETL_TRACE_BUFFER_SIZE 256
+#endif
+
+/// Number of statically allocated buffers, i.e. threads that can record at
+/// the same time.
+#if not defined(TETL_TRACE_MAX_THREADS)
+    #define TETL_TRACE_MAX_THREADS 16
+#endif
+
+/// Storage class of the per-thread buffers. Single threaded targets without
+/// TLS support should define it as empty.
+#if not defined(TETL_TRACE_THREAD_LOCAL)
+    #if defined(__STDC_HOSTED__) and (__STDC_HOSTED__ == 1)
+        #define TETL_TRACE_THREAD_LOCAL thread_local
+    #else
+        #define TETL_TRACE_THREAD_LOCAL
+    #endif
+#endif
+
+namespace etl::experimental::trace {
+
+using buffer = ring_buffer<TETL_TRACE_BUFFER_SIZE>;
+
+/// \brief Returns the current time in ticks of the timestamp source.
+using timestamp_func_t = etl::uint64_t (*)();
+
+namespace detail {
+
+#if defined(__linux__) and __has_include(<time.h>)
+inline auto monotonic_nanoseconds() -> etl::uint64_t
+{
+    auto ts = timespec {};
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<etl::uint64_t>(ts.tv_sec) * 1'000'000'000U + static_cast<etl::uint64_t>(ts.tv_nsec);
+}
+
+inline constinit timestamp_func_t timestamp_source = monotonic_nanoseconds;
+#else
+inline constinit timestamp_func_t timestamp_source = nullptr;
+#endif
+
+inline constinit etl::uint64_t ticks_per_microsecond = 1'000;
+
+inline constexpr auto slot_free    = etl::uint8_t(0);
+inline constexpr auto slot_claimed = etl::uint8_t(1);
+inline constexpr auto slot_retired = etl::uint8_t(2);
+
+struct buffer_slot {
+    buffer events {};
+    etl::uint8_t state { slot_free };
+};
+
+inline constinit etl::array<buffer_slot, TETL_TRACE_MAX_THREADS> slots {};
+
+[[nodiscard]] inline auto load_state(buffer_slot const& slot) noexcept -> etl::uint8_t
+{
+#if defined(TETL_MSVC)
+    return *static_cast<etl::uint8_t const volatile*>(&slot.state);
+#else
+    return __atomic_load_n(&slot.state, __ATOMIC_ACQUIRE);
+#endif
+}
+
+inline auto try_transition(buffer_slot& slot, etl::uint8_t from, etl::uint8_t to) noexcept -> bool
+{
+#if defined(TETL_MSVC)
+    if (slot.state != from) { return false; }
+    slot.state = to;
+    return true;
+#else
+    return __atomic_compare_exchange_n(&slot.state, &from, to, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+#endif
+}
+
+/// Claims an unused slot or, if there is none, the slot of a thread that
+/// exited, whose events are discarded. Returns nullptr if all are in use.
+[[nodiscard]] inline auto claim_slot() noexcept -> buffer_slot*
+{
+    for (auto& slot : slots) {
+        if (try_transition(slot, slot_free, slot_claimed)) { return &slot; }
+    }
+    for (auto& slot : slots) {
+        if (try_transition(slot, slot_retired, slot_claimed)) {
+            slot.events.clear();
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+/// Owns the slot of a thread and retires it on thread exit. The events stay
+/// in the slot, so they can be exported after the thread was joined.
+struct thread_slot {
+    thread_slot() = default;
+
+    thread_slot(thread_slot const&)                    = delete;
+    auto operator=(thread_slot const&) -> thread_slot& = delete;
+
+    ~thread_slot()
+    {
+        if (slot != nullptr) { (void)try_transition(*slot, slot_claimed, slot_retired); }
+    }
+
+    buffer_slot* slot { claim_slot() };
+};
+
+} // namespace detail
+
+/// \brief Sets the timestamp source, e.g. a cycle counter or a hardware
+/// timer. ticksPerMicrosecond is used to convert the timestamps on export.
+/// Defaults to CLOCK_MONOTONIC in nanoseconds on Linux, without a source all
+/// timestamps are zero.
+inline auto set_timestamp_source(timestamp_func_t now, etl::uint64_t ticksPerMicrosecond) noexcept -> void
+{
+    detail::timestamp_source      = now;
+    detail::ticks_per_microsecond = ticksPerMicrosecond;
+}
+
+[[nodiscard]] inline auto ticks_per_microsecond() noexcept -> etl::uint64_t { return detail::ticks_per_microsecond; }
+
+[[nodiscard]] inline auto now() noexcept -> etl::uint64_t
+{
+    auto const source = detail::timestamp_source;
+    return source != nullptr ? source() : 0;
+}
+
+/// \brief Returns the buffer of the calling thread, or nullptr if the buffers
+/// of all TETL_TRACE_MAX_THREADS slots are in use.
+///
+/// \details The buffers are static. A thread claims one on first use and
+/// returns it on exit. Its events can be exported, until another thread
+/// claims the buffer.
+[[nodiscard]] inline auto this_thread_buffer() noexcept -> buffer*
+{
+    static TETL_TRACE_THREAD_LOCAL detail::thread_slot owner {};
+    return owner.slot != nullptr ? &owner.slot->events : nullptr;
+}
+
+/// \brief Calls f(thread_index, buffer) for the buffer of every thread, that
+/// recorded events, including threads that exited.
+template <typename Func>
+auto for_each_buffer(Func f) -> void
+{
+    for (auto i = etl::size_t(0); i < detail::slots.size(); ++i) {
+        auto const& slot = detail::slots[i];
+        if (detail::load_state(slot) != detail::slot_free) { f(i, slot.events); }
+    }
+}
+
+namespace detail {
+
+inline auto record(char const* name, etl::int64_t value, event_type type) noexcept -> void
+{
+    if (auto* events = this_thread_buffer(); events != nullptr) { events->push(event { name, now(), value, type }); }
+}
+
+} // namespace detail
+
+/// \brief Records the start of a zone.
+inline auto begin(char const* name) noexcept -> void
+{
+    detail::record(name, 0, event_type::begin);
+}
+
+/// \brief Records the end of the innermost zone.
+inline auto end(char const* name) noexcept -> void
+{
+    detail::record(name, 0, event_type::end);
+}
+
+/// \brief Records the value of a counter.
+inline auto counter(char const* name, etl::int64_t value) noexcept -> void
+{
+    detail::record(name, value, event_type::counter);
+}
+
+/// \brief Records an instant event.
+inline auto instant(char const* name) noexcept -> void
+{
+    detail::record(name, 0, event_type::instant);
+}
+
+/// \brief Records the start of a zone and returns a scope_exit, which records
+/// its end.
+[[nodiscard]] inline auto scope(char const* name) noexcept
+{
+    begin(name);
+    return etl::scope_exit { [name] { end(name); } };
+}
+
+} // namespace etl::experimental::trace
+
+/// \brief Records the lifetime of the enclosing scope as a zone. Compiles to
+/// nothing, unless TETL_ENABLE_TRACE is defined, like all TETL_TRACE_ macros.
+#if defined(TETL_ENABLE_TRACE)
+    #define TETL_TRACE_SCOPE(name)                                                                                     \
+        auto const TETL_PP_UNIQUE_NAME(tetl_trace_scope_) = ::etl::experimental::trace::scope(name)
+    #define TETL_TRACE_COUNTER(name, value) ::etl::experimental::trace::counter(name, value)
+    #define TETL_TRACE_INSTANT(name) ::etl::experimental::trace::instant(name)
+#else
+    #define TETL_TRACE_SCOPE(name) static_cast<void>(0)
+    #define TETL_TRACE_COUNTER(name, value) static_cast<void>(0)
+    #define TETL_TRACE_INSTANT(name) static_cast<void>(0)
+#endif
+
+#endif // TETL_TRACE_TRACE_HPP
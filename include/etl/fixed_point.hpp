@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_FIXED_POINT_HPP
+#define TETL_FIXED_POINT_HPP
+
+#include "etl/_config/all.hpp"
+
+#include "etl/_fixed_point/cos.hpp"
+#include "etl/_fixed_point/fixed_point.hpp"
+#include "etl/_fixed_point/fixed_point_overflow.hpp"
+#include "etl/_fixed_point/from_chars.hpp"
+#include "etl/_fixed_point/rescale.hpp"
+#include "etl/_fixed_point/sin.hpp"
+#include "etl/_fixed_point/sqrt.hpp"
+#include "etl/_fixed_point/to_chars.hpp"
+
+#endif // TETL_FIXED_POINT_HPP
@@ -29,6 +29,7 @@
 #include "etl/_functional/logical_or.hpp"
 #include "etl/_functional/minus.hpp"
 #include "etl/_functional/modulus.hpp"
+#include "etl/_functional/move_only_inplace_function.hpp"
 #include "etl/_functional/multiplies.hpp"
 #include "etl/_functional/negate.hpp"
 #include "etl/_functional/not_equal_to.hpp"
@@ -9,6 +9,7 @@
 #include "etl/_iterator/back_insert_iterator.hpp"
 #include "etl/_iterator/begin.hpp"
 #include "etl/_iterator/data.hpp"
+#include "etl/_iterator/default_sentinel.hpp"
 #include "etl/_iterator/distance.hpp"
 #include "etl/_iterator/empty.hpp"
 #include "etl/_iterator/end.hpp"
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#ifndef TETL_LINALG_HPP
+#define TETL_LINALG_HPP
+
+#include <etl/_config/all.hpp>
+
+#include <etl/mdspan.hpp>
+
+#include <etl/_linalg/add.hpp>
+#include <etl/_linalg/dot.hpp>
+#include <etl/_linalg/matrix_product.hpp>
+#include <etl/_linalg/matrix_vector_product.hpp>
+#include <etl/_linalg/scaled.hpp>
+#include <etl/_linalg/transposed.hpp>
+#include <etl/_linalg/vector_two_norm.hpp>
+
+#endif // TETL_LINALG_HPP
@@ -7,4 +7,6 @@
 
 #include "etl/_config/all.hpp"
 
+#include "etl/_map/static_perfect_map.hpp"
+
 #endif // TETL_MAP_HPP
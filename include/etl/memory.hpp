@@ -20,8 +20,11 @@
 #include "etl/_memory/pointer_int_pair_info.hpp"
 #include "etl/_memory/pointer_like_traits.hpp"
 #include "etl/_memory/pointer_traits.hpp"
+#include "etl/_memory/relocate_at.hpp"
 #include "etl/_memory/small_ptr.hpp"
 #include "etl/_memory/to_address.hpp"
+#include "etl/_memory/uninitialized_relocate.hpp"
+#include "etl/_memory/uninitialized_relocate_backward.hpp"
 #include "etl/_memory/uses_allocator.hpp"
 
 #endif // TETL_MEMORY_HPP
@@ -6,12 +6,22 @@
 #include <etl/_config/all.hpp>
 
 #include <etl/_random/bernoulli_distribution.hpp>
+#include <etl/_random/discrete_distribution.hpp>
+#include <etl/_random/exponential_distribution.hpp>
 #include <etl/_random/generate_canonical.hpp>
+#include <etl/_random/normal_distribution.hpp>
+#include <etl/_random/pcg32.hpp>
+#include <etl/_random/pcg64.hpp>
+#include <etl/_random/poisson_distribution.hpp>
+#include <etl/_random/splitmix64.hpp>
 #include <etl/_random/uniform_int_distribution.hpp>
 #include <etl/_random/uniform_real_distribution.hpp>
 #include <etl/_random/xorshift.hpp>
 #include <etl/_random/xoshiro128plus.hpp>
 #include <etl/_random/xoshiro128plusplus.hpp>
 #include <etl/_random/xoshiro128starstar.hpp>
+#include <etl/_random/xoshiro256plusplus.hpp>
+#include <etl/_random/xoshiro256plusplus_lanes.hpp>
+#include <etl/_random/xoshiro256starstar.hpp>
 
 #endif // TETL_RANDOM_HPP
@@ -7,8 +7,26 @@
 
 #include "etl/_simd/alignment_tags.hpp"
 #include "etl/_simd/const_where_expression.hpp"
+#include "etl/_simd/is_abi_tag.hpp"
+#include "etl/_simd/is_simd.hpp"
+#include "etl/_simd/is_simd_flag_type.hpp"
+#include "etl/_simd/is_simd_mask.hpp"
 #include "etl/_simd/is_vectorizable.hpp"
+#include "etl/_simd/memory_alignment.hpp"
+#include "etl/_simd/rebind_simd.hpp"
+#include "etl/_simd/reduce.hpp"
+#include "etl/_simd/resize_simd.hpp"
+#include "etl/_simd/simd.hpp"
 #include "etl/_simd/simd_abi.hpp"
+#include "etl/_simd/simd_cast.hpp"
+#include "etl/_simd/simd_mask.hpp"
+#include "etl/_simd/simd_size.hpp"
+#include "etl/_simd/vcos.hpp"
+#include "etl/_simd/vexp.hpp"
+#include "etl/_simd/vlog.hpp"
+#include "etl/_simd/vmath_accuracy.hpp"
+#include "etl/_simd/vsin.hpp"
+#include "etl/_simd/where.hpp"
 #include "etl/_simd/where_expression.hpp"
 
 #endif // TETL_SIMD_HPP
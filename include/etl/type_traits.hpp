@@ -130,6 +130,7 @@
 #include "etl/_type_traits/always_false.hpp"
 #include "etl/_type_traits/is_any_of.hpp"
 #include "etl/_type_traits/is_specialized.hpp"
+#include "etl/_type_traits/is_trivially_relocatable.hpp"
 #include "etl/_type_traits/type_pack_element.hpp"
 
 #endif // TETL_TYPETRAITS_HPP
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/cmath.hpp"
+
+#include "etl/bit.hpp"
+#include "etl/cassert.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/limits.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+
+constexpr auto ulp_distance(double a, double b) -> etl::int64_t
+{
+    auto const key = [](double x) {
+        auto const bits = etl::bit_cast<etl::int64_t>(x);
+        return bits < 0 ? -(bits & etl::numeric_limits<etl::int64_t>::max()) : bits;
+    };
+    auto const d = key(a) - key(b);
+    return d < 0 ? -d : d;
+}
+
+constexpr auto within_1ulp(double actual, double expected) -> bool { return ulp_distance(actual, expected) <= 1; }
+
+constexpr auto test_exp() -> bool
+{
+    using etl::detail::exp_kernel;
+
+    assert(exp_kernel(0.0) == 1.0);
+    assert(within_1ulp(exp_kernel(1.0), 0x1.5bf0a8b145769p+1));
+    assert(within_1ulp(exp_kernel(-1.0), 0x1.78b56362cef38p-2));
+    assert(within_1ulp(exp_kernel(0.5), 0x1.a61298e1e069cp+0));
+    assert(within_1ulp(exp_kernel(10.0), 0x1.5829dcf95056p+14));
+    assert(within_1ulp(exp_kernel(-20.5), 0x1.57a3afeed00abp-30));
+    assert(within_1ulp(exp_kernel(700.0), 0x1.d945df4f8ec8ep+1009));
+    assert(within_1ulp(exp_kernel(-740.0), 0x0.0000000000055p-1022));
+    assert(within_1ulp(exp_kernel(0x1.b7cdfd9d7bdbbp-34), 0x1.000000006df38p+0));
+
+    assert(exp_kernel(1000.0) == etl::numeric_limits<double>::infinity());
+    assert(exp_kernel(-1000.0) == 0.0);
+    assert(etl::isnan(exp_kernel(etl::numeric_limits<double>::quiet_NaN())));
+    return true;
+}
+
+constexpr auto test_log() -> bool
+{
+    using etl::detail::log_kernel;
+
+    assert(log_kernel(1.0) == 0.0);
+    assert(within_1ulp(log_kernel(2.0), 0x1.62e42fefa39efp-1));
+    assert(within_1ulp(log_kernel(0.5), -0x1.62e42fefa39efp-1));
+    assert(within_1ulp(log_kernel(10.0), 0x1.26bb1bbb55516p+1));
+    assert(within_1ulp(log_kernel(1.41), 0x1.5fd5fabe64084p-2));
+    assert(within_1ulp(log_kernel(0.71), -0x1.5eb5c7907e4cap-2));
+    assert(within_1ulp(log_kernel(1e-300), -0x1.5963447f87fb5p+9));
+    assert(within_1ulp(log_kernel(1e300), 0x1.5963447f87fb5p+9));
+    assert(within_1ulp(log_kernel(5e-320), -0x1.6f9be0f7cee66p+9));
+
+    assert(log_kernel(0.0) == -etl::numeric_limits<double>::infinity());
+    assert(log_kernel(etl::numeric_limits<double>::infinity()) == etl::numeric_limits<double>::infinity());
+    assert(etl::isnan(log_kernel(-1.0)));
+    return true;
+}
+
+constexpr auto test_trig() -> bool
+{
+    using etl::detail::cos_kernel;
+    using etl::detail::sin_kernel;
+    using etl::detail::tan_kernel;
+
+    struct reference {
+        double x;
+        double sin;
+        double cos;
+        double tan;
+    };
+
+    constexpr reference references[] = {
+        { 0.5,  0x1.eaee8744b05fp-2,   0x1.c1528065b7d5p-1,   0x1.17b4f5bf3474ap-1},
+        {-0.5, -0x1.eaee8744b05fp-2,   0x1.c1528065b7d5p-1,  -0x1.17b4f5bf3474ap-1},
+        { 1.0,  0x1.aed548f090ceep-1,  0x1.14a280fb5068cp-1,  0x1.8eb245cbee3a6p+0},
+        { 2.0,  0x1.d18f6ead1b446p-1, -0x1.aa22657537205p-2, -0x1.17af62e0950f8p+1},
+        { 3.0,  0x1.210386db6d55bp-3, -0x1.fae04be85e5d2p-1, -0x1.23ef71254b86fp-3},
+        {-4.0,  0x1.837b9dddc1eaep-1, -0x1.4eaa606db24c1p-1, -0x1.2866f9be4de13p+0},
+        {10.0, -0x1.1689ef5f34f52p-1, -0x1.ad9ac890c6b1fp-1,  0x1.4bf5f34be3782p-1},
+        {100.0, -0x1.03425b78c4db8p-1, 0x1.b981dbf665fdfp-1, -0x1.2ca74d62b5d38p-1},
+        {1e5,   0x1.24daa9c527e96p-5, -0x1.ffac3841b3da7p-1, -0x1.250a9d503313dp-5},
+        {1e-9,  0x1.12e0be826d695p-30, 0x1p+0,                0x1.12e0be826d695p-30},
+    };
+
+    for (auto const& ref : references) {
+        assert(within_1ulp(sin_kernel(ref.x), ref.sin));
+        assert(within_1ulp(cos_kernel(ref.x), ref.cos));
+        assert(within_1ulp(tan_kernel(ref.x), ref.tan));
+    }
+
+    assert(etl::isnan(sin_kernel(etl::numeric_limits<double>::quiet_NaN())));
+    assert(etl::isnan(cos_kernel(etl::numeric_limits<double>::quiet_NaN())));
+    assert(etl::isnan(tan_kernel(etl::numeric_limits<double>::quiet_NaN())));
+    return true;
+}
+
+constexpr auto test_sqrt() -> bool
+{
+    using etl::detail::sqrt_kernel;
+
+    assert(sqrt_kernel(4.0) == 2.0);
+    assert(sqrt_kernel(0.25) == 0.5);
+    assert(within_1ulp(sqrt_kernel(2.0), 0x1.6a09e667f3bcdp+0));
+    assert(within_1ulp(sqrt_kernel(3.0), 0x1.bb67ae8584caap+0));
+    assert(within_1ulp(sqrt_kernel(123456.789), 0x1.5f5d3b16948f6p+8));
+    assert(within_1ulp(sqrt_kernel(1e300), 0x1.38d352e5096afp+498));
+    assert(within_1ulp(sqrt_kernel(1e-310), 0x1.1297872d9cbaep-515));
+
+    assert(sqrt_kernel(0.0) == 0.0);
+    assert(etl::signbit(sqrt_kernel(-0.0)));
+    assert(sqrt_kernel(etl::numeric_limits<double>::infinity()) == etl::numeric_limits<double>::infinity());
+    assert(etl::isnan(sqrt_kernel(-1.0)));
+    return true;
+}
+
+} // namespace
+
+auto main() -> int
+{
+    assert(test_exp());
+    assert(test_log());
+    assert(test_trig());
+    assert(test_sqrt());
+
+    static_assert(test_exp());
+    static_assert(test_log());
+    static_assert(test_trig());
+    static_assert(test_sqrt());
+    return 0;
+}
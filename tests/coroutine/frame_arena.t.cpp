@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/coroutine.hpp"
+
+#include "etl/cstdint.hpp"
+#include "etl/stdexcept.hpp"
+#include "etl/string_view.hpp"
+
+#include "testing/testing.hpp"
+
+static auto test_all() -> bool
+{
+    constexpr auto align = alignof(etl::max_align_t);
+
+    auto arena = etl::frame_arena<256> {};
+    assert(arena.capacity() == 256);
+    assert(arena.used() == 0);
+
+    // sizes are rounded up to max_align_t
+    auto* a = arena.allocate(10);
+    assert(a != nullptr);
+    assert(arena.used() == align);
+
+    auto* b = arena.allocate(align + 1);
+    assert(reinterpret_cast<etl::uintptr_t>(b) % align == 0);
+    assert(static_cast<char*>(b) == static_cast<char*>(a) + align);
+    assert(arena.used() == 3 * align);
+
+    // only the most recent allocation is reclaimed
+    arena.deallocate(a, 10);
+    assert(arena.used() == 3 * align);
+    arena.deallocate(b, align + 1);
+    assert(arena.used() == align);
+    arena.deallocate(a, 10);
+    assert(arena.used() == 0);
+
+    (void)arena.allocate(1);
+    arena.reset();
+    assert(arena.used() == 0);
+    assert(arena.allocate(256) == a);
+    assert(arena.used() == 256);
+
+#if defined(__cpp_exceptions)
+    // the rounded size of the last frame doesn't fit into an uneven capacity
+    auto uneven = etl::frame_arena<align * 6 + 4> {};
+    (void)uneven.allocate(align * 5 + 2);
+    assert(uneven.used() == align * 6);
+    try {
+        (void)uneven.allocate(4);
+        assert(false);
+    } catch (etl::length_error const& e) {
+        assert(e.what() == etl::string_view { "frame_arena: out of memory" });
+    }
+    assert(uneven.used() == align * 6);
+#endif
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/coroutine.hpp"
+
+#include "etl/memory.hpp"
+
+#include "testing/testing.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace {
+
+using arena_t = etl::frame_arena<512>;
+
+auto iota(etl::allocator_arg_t /*tag*/, arena_t& /*arena*/, int first, int last) -> etl::generator<int>
+{
+    for (auto i = first; i < last; ++i) { co_yield i; }
+}
+
+auto fibonacci(etl::allocator_arg_t /*tag*/, arena_t& /*arena*/) -> etl::generator<long>
+{
+    auto a = 0L;
+    auto b = 1L;
+    while (true) {
+        co_yield a;
+        a = etl::exchange(b, a + b);
+    }
+}
+
+auto squares(int n) -> etl::generator<int>
+{
+    for (auto i = 1; i <= n; ++i) { co_yield i * i; }
+}
+
+struct counter {
+    auto count(etl::allocator_arg_t /*tag*/, arena_t& /*arena*/) -> etl::generator<int>
+    {
+        for (auto i = 0; i < n; ++i) { co_yield i; }
+    }
+
+    int n;
+};
+
+} // namespace
+
+static auto test_all() -> bool
+{
+    auto arena = arena_t {};
+
+    {
+        auto sum = 0;
+        for (auto i : iota(etl::allocator_arg, arena, 1, 11)) {
+            assert(arena.used() > 0);
+            sum += i;
+        }
+        assert(sum == 55);
+        assert(arena.used() == 0);
+    }
+
+    {
+        // empty sequence
+        auto gen = iota(etl::allocator_arg, arena, 5, 5);
+        assert(gen.begin() == gen.end());
+    }
+    assert(arena.used() == 0);
+
+    {
+        // infinite sequence, leaving early destroys the frame
+        auto last = 0L;
+        for (auto f : fibonacci(etl::allocator_arg, arena)) {
+            if (f > 1000) { break; }
+            last = f;
+        }
+        assert(last == 987);
+        assert(arena.used() == 0);
+    }
+
+    {
+        // yielded temporaries, frame from the global operator new
+        auto sum = 0;
+        for (auto s : squares(4)) { sum += s; }
+        assert(sum == 30);
+    }
+
+    {
+        // member function coroutine, the object parameter comes first
+        auto c   = counter { 3 };
+        auto gen = c.count(etl::allocator_arg, arena);
+        assert(arena.used() > 0);
+
+        auto it = gen.begin();
+        assert(*it == 0);
+        ++it;
+        assert(*it == 1);
+        it++;
+        assert(*it == 2);
+        ++it;
+        assert(it == gen.end());
+    }
+    assert(arena.used() == 0);
+
+    {
+        // move transfers ownership of the frame
+        auto a = iota(etl::allocator_arg, arena, 0, 3);
+        auto b = etl::move(a);
+        auto n = 0;
+        for (auto i : b) { n += i; }
+        assert(n == 3);
+    }
+    assert(arena.used() == 0);
+    return true;
+}
+
+#else
+static auto test_all() -> bool { return true; }
+#endif
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
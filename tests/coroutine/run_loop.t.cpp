@@ -0,0 +1,255 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/coroutine.hpp"
+
+#include "etl/array.hpp"
+#include "etl/chrono.hpp"
+#include "etl/experimental/posix/monotonic_clock.hpp"
+
+#include "testing/testing.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace {
+
+/// Advances only while the loop waits, so timers are deterministic.
+struct fake_clock {
+    using rep                       = etl::int64_t;
+    using period                    = etl::milli;
+    using duration                  = etl::chrono::duration<rep, period>;
+    using time_point                = etl::chrono::time_point<fake_clock>;
+    static constexpr bool is_steady = true;
+
+    static auto now() -> time_point { return current; }
+    static auto wait_until(time_point deadline) -> void { current = deadline; }
+
+    static inline time_point current {};
+};
+
+using loop_t = etl::run_loop<fake_clock, 8>;
+
+struct log_t {
+    auto push(int value) -> void { values[size++] = value; }
+
+    etl::array<int, 32> values {};
+    etl::size_t size { 0 };
+};
+
+auto ping(loop_t& loop, log_t& log, int id, int n) -> etl::task<>
+{
+    for (auto i = 0; i < n; ++i) {
+        log.push(id);
+        co_await loop.yield();
+    }
+}
+
+auto sleeper(loop_t& loop, log_t& log, int ms) -> etl::task<>
+{
+    co_await loop.sleep_for(etl::chrono::milliseconds(ms));
+    log.push(ms);
+}
+
+auto waiter(etl::async_event<loop_t>& event, log_t& log, int id) -> etl::task<>
+{
+    co_await event;
+    log.push(id);
+}
+
+auto setter(loop_t& loop, etl::async_event<loop_t>& event) -> etl::task<>
+{
+    co_await loop.sleep_for(etl::chrono::seconds(1));
+    event.set();
+}
+
+using channel_t = etl::async_channel<int, 2, loop_t>;
+
+auto producer(channel_t& channel, int n) -> etl::task<>
+{
+    for (auto i = 1; i <= n; ++i) { co_await channel.send(i); }
+    co_await channel.send(0);
+}
+
+auto consumer(channel_t& channel, log_t& log) -> etl::task<>
+{
+    while (true) {
+        auto const value = co_await channel.receive();
+        if (value == 0) { break; }
+        log.push(value);
+    }
+}
+
+} // namespace
+
+static auto test_yield() -> bool
+{
+    auto loop = loop_t {};
+    auto log  = log_t {};
+    auto a    = ping(loop, log, 1, 3);
+    auto b    = ping(loop, log, 2, 3);
+    a.start();
+    b.start();
+    assert(loop.num_ready() == 2);
+
+    loop.run();
+    assert(a.done() and b.done());
+    assert(log.size == 6);
+    for (auto i = etl::size_t(0); i < log.size; ++i) { assert(log.values[i] == (i % 2 == 0 ? 1 : 2)); }
+    return true;
+}
+
+static auto test_timers() -> bool
+{
+    fake_clock::current = {};
+
+    auto loop = loop_t {};
+    auto log  = log_t {};
+    auto a    = sleeper(loop, log, 30);
+    auto b    = sleeper(loop, log, 10);
+    auto c    = sleeper(loop, log, 20);
+    auto d    = sleeper(loop, log, 10);
+    auto e    = sleeper(loop, log, 0);
+    a.start();
+    b.start();
+    c.start();
+    d.start();
+    e.start();
+    assert(e.done());
+    assert(loop.num_timers() == 4);
+
+    loop.run();
+    assert(fake_clock::current.time_since_epoch().count() == 30);
+    assert(log.size == 5);
+    assert(log.values[0] == 0);
+    assert(log.values[1] == 10);
+    assert(log.values[2] == 10);
+    assert(log.values[3] == 20);
+    assert(log.values[4] == 30);
+    return true;
+}
+
+static auto test_event() -> bool
+{
+    fake_clock::current = {};
+
+    auto loop  = loop_t {};
+    auto log   = log_t {};
+    auto event = etl::async_event { loop };
+    assert(not event.is_set());
+
+    auto a = waiter(event, log, 1);
+    auto b = waiter(event, log, 2);
+    auto s = setter(loop, event);
+    a.start();
+    b.start();
+    s.start();
+    assert(not a.done() and not b.done());
+
+    loop.run();
+    assert(event.is_set());
+    assert(a.done() and b.done() and s.done());
+    assert(log.size == 2);
+    assert(log.values[0] == 1);
+    assert(log.values[1] == 2);
+
+    // already set, does not suspend
+    auto c = waiter(event, log, 3);
+    c.start();
+    assert(c.done());
+
+    event.reset();
+    auto d = waiter(event, log, 4);
+    d.start();
+    assert(not d.done());
+    event.set();
+    (void)loop.poll();
+    assert(d.done());
+    return true;
+}
+
+static auto test_channel() -> bool
+{
+    auto loop    = loop_t {};
+    auto channel = channel_t { loop };
+    assert(channel.capacity() == 2);
+
+    {
+        // producer runs ahead until the channel is full
+        auto log = log_t {};
+        auto p   = producer(channel, 10);
+        auto c   = consumer(channel, log);
+        p.start();
+        assert(channel.full());
+        c.start();
+
+        loop.run();
+        assert(p.done() and c.done());
+        assert(channel.empty());
+        assert(log.size == 10);
+        for (auto i = etl::size_t(0); i < log.size; ++i) { assert(log.values[i] == static_cast<int>(i) + 1); }
+    }
+
+    {
+        // consumer waits first, values are handed over directly
+        auto log = log_t {};
+        auto c   = consumer(channel, log);
+        auto p   = producer(channel, 5);
+        c.start();
+        p.start();
+
+        loop.run();
+        assert(p.done() and c.done());
+        assert(log.size == 5);
+        assert(log.values[4] == 5);
+    }
+
+    {
+        auto value = 42;
+        assert(channel.try_send(value));
+        assert(channel.size() == 1);
+        assert(channel.try_receive() == 42);
+        assert(not channel.try_receive().has_value());
+    }
+    return true;
+}
+
+    #if defined(__unix__)
+static auto test_monotonic_clock() -> bool
+{
+    using host_clock = etl::experimental::posix::monotonic_clock;
+
+    auto loop  = etl::run_loop<host_clock, 4> {};
+    auto sleep = [](etl::run_loop<host_clock, 4>& l) -> etl::task<> {
+        co_await l.sleep_for(etl::chrono::milliseconds(2));
+    };
+
+    auto const start = host_clock::now();
+    auto t           = sleep(loop);
+    t.start();
+    loop.run();
+    assert(t.done());
+    assert((host_clock::now().time_since_epoch() - start.time_since_epoch()) >= etl::chrono::milliseconds(2));
+    return true;
+}
+    #else
+static auto test_monotonic_clock() -> bool { return true; }
+    #endif
+
+static auto test_all() -> bool
+{
+    assert(test_yield());
+    assert(test_timers());
+    assert(test_event());
+    assert(test_channel());
+    assert(test_monotonic_clock());
+    return true;
+}
+
+#else
+static auto test_all() -> bool { return true; }
+#endif
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
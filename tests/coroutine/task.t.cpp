@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/coroutine.hpp"
+
+#include "etl/memory.hpp"
+
+#include "testing/testing.hpp"
+
+#if defined(__cpp_impl_coroutine)
+
+namespace {
+
+using arena_t = etl::frame_arena<1024>;
+
+/// Resumed by hand, like an interrupt completing an I/O request.
+struct event {
+    [[nodiscard]] auto await_ready() const noexcept -> bool { return false; }
+    auto await_suspend(etl::coroutine_handle<> handle) noexcept -> void { waiting = handle; }
+    [[nodiscard]] auto await_resume() const noexcept -> int { return value; }
+
+    auto set(int v) -> void
+    {
+        value = v;
+        etl::exchange(waiting, nullptr).resume();
+    }
+
+    etl::coroutine_handle<> waiting { nullptr };
+    int value { 0 };
+};
+
+auto value(etl::allocator_arg_t /*tag*/, arena_t& /*arena*/, int x) -> etl::task<int> { co_return x; }
+
+auto add(etl::allocator_arg_t tag, arena_t& arena, int x, int y) -> etl::task<int>
+{
+    auto const a = co_await value(tag, arena, x);
+    auto const b = co_await value(tag, arena, y);
+    co_return a + b;
+}
+
+auto count(etl::allocator_arg_t tag, arena_t& arena, int n, int& result) -> etl::task<>
+{
+    // every child completes synchronously and resumes this loop by symmetric
+    // transfer. GCC only turns the transfer into a tail call with optimization
+    // enabled, so n is kept small enough for unoptimized builds.
+    for (auto i = 0; i < n; ++i) { result += co_await value(tag, arena, 1); }
+}
+
+auto read(etl::allocator_arg_t /*tag*/, arena_t& /*arena*/, event& ev) -> etl::task<int>
+{
+    auto const v = co_await ev;
+    co_return v * 2;
+}
+
+auto request(etl::allocator_arg_t tag, arena_t& arena, event& ev) -> etl::task<int>
+{
+    auto const a = co_await read(tag, arena, ev);
+    auto const b = co_await read(tag, arena, ev);
+    co_return a + b;
+}
+
+auto heap() -> etl::task<int> { co_return 42; }
+
+} // namespace
+
+static auto test_all() -> bool
+{
+    auto arena = arena_t {};
+
+    {
+        auto t = add(etl::allocator_arg, arena, 2, 3);
+        assert(not t.done());
+        t.start();
+        assert(t.done());
+        assert(t.result() == 5);
+    }
+    assert(arena.used() == 0);
+
+    {
+        auto result = 0;
+        auto t      = count(etl::allocator_arg, arena, 10'000, result);
+        t.start();
+        assert(t.done());
+        assert(result == 10'000);
+    }
+    assert(arena.used() == 0);
+
+    {
+        auto ev = event {};
+        auto t  = request(etl::allocator_arg, arena, ev);
+        t.start();
+        assert(not t.done());
+        assert(static_cast<bool>(ev.waiting));
+
+        ev.set(10);
+        assert(not t.done());
+        ev.set(11);
+        assert(t.done());
+        assert(t.result() == 42);
+    }
+    assert(arena.used() == 0);
+
+    {
+        auto t = heap();
+        t.start();
+        assert(t.result() == 42);
+    }
+
+    {
+        // a task that was never started is destroyed
+        auto t = add(etl::allocator_arg, arena, 1, 1);
+        assert(arena.used() > 0);
+    }
+    assert(arena.used() == 0);
+    return true;
+}
+
+#else
+static auto test_all() -> bool { return true; }
+#endif
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: BSL-1.0
+#define TETL_FREERTOS_USE_STUBS
+#include "etl/experimental/freertos/zero_copy_stream_buffer.hpp"
+
+#include "etl/algorithm.hpp"
+
+#include "testing/testing.hpp"
+
+namespace rtos = etl::experimental::freertos;
+namespace net  = etl::experimental::net;
+
+namespace {
+
+auto fill(net::mutable_buffer block, unsigned char first) -> void
+{
+    auto* data = static_cast<unsigned char*>(block.data());
+    for (auto i = etl::size_t(0); i < block.size(); ++i) { data[i] = static_cast<unsigned char>(first + i); }
+}
+
+auto at(net::const_buffer block, etl::size_t i) -> unsigned char
+{
+    return static_cast<unsigned char const*>(block.data())[i];
+}
+
+} // namespace
+
+static auto test_acquire_commit() -> bool
+{
+    auto sb = rtos::zero_copy_stream_buffer<16> {};
+    assert(sb.capacity() == 16);
+    assert(sb.empty());
+    assert(sb.peek().size() == 0);
+
+    auto block = sb.acquire(10);
+    assert(block.size() == 10);
+    fill(block, 0);
+
+    // nothing is visible before commit
+    assert(sb.empty());
+    sb.commit(6);
+    assert(sb.bytes_available() == 6);
+
+    auto data = sb.peek();
+    assert(data.size() == 6);
+    assert(at(data, 0) == 0);
+    assert(at(data, 5) == 5);
+
+    sb.consume(4);
+    assert(sb.bytes_available() == 2);
+    assert(at(sb.peek(), 0) == 4);
+
+    // 6 bytes left in front of the end, 4 bytes free at the start
+    assert(sb.acquire(11).size() == 0);
+    assert(sb.acquire(10).size() == 10);
+    sb.commit(10);
+    assert(sb.bytes_available() == 12);
+
+    // one byte in front of read stays free, equal indices mean empty
+    assert(sb.acquire(4).size() == 0);
+    assert(sb.acquire(3).size() == 3);
+    sb.commit(3);
+    assert(sb.bytes_available() == 15);
+    return true;
+}
+
+static auto test_wrap_around() -> bool
+{
+    auto sb = rtos::zero_copy_stream_buffer<16> {};
+
+    fill(sb.acquire(12), 0);
+    sb.commit(12);
+    sb.consume(10);
+
+    // does not fit in front of the end, placed at the start
+    auto block = sb.acquire(8);
+    assert(block.size() == 8);
+    assert(block.data() < sb.peek().data());
+    fill(block, 12);
+    sb.commit(8);
+    assert(sb.bytes_available() == 10);
+
+    // write may not catch up with read from below
+    assert(sb.acquire(2).size() == 0);
+    assert(sb.acquire(1).size() == 1);
+    sb.commit(0);
+
+    // the tail before the wrap is read first
+    auto data = sb.peek();
+    assert(data.size() == 2);
+    assert(at(data, 0) == 10);
+    sb.consume(2);
+
+    data = sb.peek();
+    assert(data.size() == 8);
+    assert(at(data, 0) == 12);
+    assert(at(data, 7) == 19);
+
+    // the reader wrapped around, the whole tail is free again
+    assert(sb.acquire(9).size() == 0);
+    assert(sb.acquire(8).size() == 8);
+    sb.commit(0);
+
+    sb.consume(8);
+    assert(sb.empty());
+    return true;
+}
+
+static auto test_restart() -> bool
+{
+    auto sb = rtos::zero_copy_stream_buffer<16> {};
+
+    fill(sb.acquire(8), 0);
+    sb.commit(8);
+    sb.consume(8);
+    assert(sb.empty());
+
+    // the drained buffer starts over at the front
+    auto block = sb.acquire(12);
+    assert(block.size() == 12);
+    fill(block, 8);
+    sb.commit(12);
+    assert(sb.bytes_available() == 12);
+
+    auto data = sb.peek();
+    assert(data.size() == 12);
+    assert(at(data, 0) == 8);
+    assert(at(data, 11) == 19);
+    sb.consume(12);
+    assert(sb.empty());
+
+    // the whole capacity fits into a drained buffer
+    block = sb.acquire(16);
+    assert(block.size() == 16);
+    fill(block, 20);
+    sb.commit(16);
+    assert(sb.bytes_available() == 16);
+    assert(sb.acquire(1).size() == 0);
+
+    data = sb.peek();
+    assert(data.size() == 16);
+    assert(at(data, 0) == 20);
+    assert(at(data, 15) == 35);
+    sb.consume(16);
+    assert(sb.empty());
+    assert(sb.acquire(17).size() == 0);
+    assert(sb.acquire(16).size() == 16);
+    return true;
+}
+
+static auto test_stream() -> bool
+{
+    auto sb       = rtos::zero_copy_stream_buffer<32> {};
+    auto written  = 0;
+    auto received = 0;
+    auto step     = etl::size_t(0);
+
+    while (received < 1000) {
+        auto const n = 1 + (step++ * 7U) % 13U;
+        if (auto block = sb.acquire(n); block.size() != 0 and written < 1000) {
+            fill(block, static_cast<unsigned char>(written));
+            sb.commit(n);
+            written += static_cast<int>(n);
+        }
+
+        auto data = sb.peek();
+        auto const m = etl::min(data.size(), etl::size_t(1) + (step * 5U) % 11U);
+        for (auto i = etl::size_t(0); i < m; ++i) {
+            assert(at(data, i) == static_cast<unsigned char>(received));
+            ++received;
+        }
+        sb.consume(m);
+    }
+    return true;
+}
+
+static auto test_blocking() -> bool
+{
+    auto sb = rtos::zero_copy_stream_buffer<8> {};
+
+    // the stubs never notify, so waiting times out
+    assert(sb.peek(10).size() == 0);
+
+    auto prio = BaseType_t {};
+    fill(sb.acquire(8, 10), 1);
+    sb.commit_from_isr(8, &prio);
+    assert(sb.acquire(1, 10).size() == 0);
+
+    assert(sb.peek(10).size() == 8);
+    sb.consume_from_isr(8, &prio);
+    assert(sb.empty());
+    return true;
+}
+
+static auto test_all() -> bool
+{
+    assert(test_acquire_commit());
+    assert(test_wrap_around());
+    assert(test_restart());
+    assert(test_stream());
+    assert(test_blocking());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
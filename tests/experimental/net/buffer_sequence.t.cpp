@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/experimental/net/buffer.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cstring.hpp"
+#include "etl/string_view.hpp"
+
+#include "testing/testing.hpp"
+
+namespace net = etl::experimental::net;
+
+static auto test_traits() -> bool
+{
+    using sequence_t = net::static_buffer_sequence<net::const_buffer, 2>;
+    static_assert(net::is_mutable_buffer_sequence_v<net::mutable_buffer>);
+    static_assert(net::is_const_buffer_sequence_v<net::mutable_buffer>);
+    static_assert(not net::is_mutable_buffer_sequence_v<net::const_buffer>);
+    static_assert(net::is_const_buffer_sequence_v<net::const_buffer>);
+    static_assert(net::is_const_buffer_sequence_v<sequence_t>);
+    static_assert(not net::is_mutable_buffer_sequence_v<sequence_t>);
+    static_assert(net::is_mutable_buffer_sequence_v<etl::array<net::mutable_buffer, 3>>);
+    static_assert(not net::is_const_buffer_sequence_v<int>);
+
+    auto mem = etl::array<char, 4> {};
+    auto buf = net::make_buffer(mem);
+    assert(net::buffer_sequence_begin(buf) == &buf);
+    assert(net::buffer_sequence_end(buf) == &buf + 1);
+    assert(net::buffer_size(buf) == 4);
+
+    auto const c = net::const_buffer { buf };
+    assert(c.data() == mem.data());
+    assert(c.size() == 4);
+    return true;
+}
+
+static auto test_static_buffer_sequence() -> bool
+{
+    auto header  = etl::array<char, 4> { 'h', 'e', 'a', 'd' };
+    auto payload = etl::array<char, 6> { 'p', 'a', 'y', 'l', 'o', 'd' };
+    auto crc     = etl::array<char, 2> { 'c', 'c' };
+
+    // only mutable buffers deduce a mutable sequence
+    auto gather = net::static_buffer_sequence { net::make_buffer(header), net::make_buffer(payload) };
+    static_assert(etl::is_same_v<decltype(gather), net::static_buffer_sequence<net::mutable_buffer, 2>>);
+    assert(gather.size() == 2);
+    assert(gather.full());
+    assert(net::buffer_size(gather) == 10);
+
+    auto const& ccrc = crc;
+    auto mixed       = net::static_buffer_sequence { net::make_buffer(header), net::make_buffer(ccrc) };
+    static_assert(etl::is_same_v<decltype(mixed), net::static_buffer_sequence<net::const_buffer, 2>>);
+
+    auto seq = net::static_buffer_sequence<net::const_buffer, 4> {};
+    assert(seq.empty());
+    assert(seq.capacity() == 4);
+    seq.push_back(net::make_buffer(header));
+    seq.push_back(net::make_buffer(payload));
+    seq.push_back(net::make_buffer(crc));
+    assert(seq.size() == 3);
+    assert(seq[2].data() == crc.data());
+    assert(net::buffer_size(seq) == 12);
+
+    seq.clear();
+    assert(seq.empty());
+    assert(net::buffer_size(seq) == 0);
+    return true;
+}
+
+static auto test_buffer_copy() -> bool
+{
+    auto header  = etl::array<char, 4> { 'h', 'e', 'a', 'd' };
+    auto payload = etl::array<char, 6> { 'p', 'a', 'y', 'l', 'o', 'd' };
+    auto crc     = etl::array<char, 2> { 'c', 'c' };
+    auto source  = net::static_buffer_sequence {
+        net::make_buffer(header),
+        net::make_buffer(payload),
+        net::make_buffer(crc),
+    };
+
+    {
+        // gather into one contiguous buffer
+        auto packet = etl::array<char, 16> {};
+        assert(net::buffer_copy(net::make_buffer(packet), source) == 12);
+        assert(etl::string_view(packet.data()) == "headpaylodcc");
+    }
+
+    {
+        // scatter with different buffer boundaries
+        auto a    = etl::array<char, 5> {};
+        auto b    = etl::array<char, 3> {};
+        auto c    = etl::array<char, 8> {};
+        auto dest = net::static_buffer_sequence { net::make_buffer(a), net::make_buffer(b), net::make_buffer(c) };
+        assert(net::buffer_copy(dest, source) == 12);
+        assert(etl::string_view(a.data(), a.size()) == "headp");
+        assert(etl::string_view(b.data(), b.size()) == "ayl");
+        assert(etl::string_view(c.data(), 4) == "odcc");
+    }
+
+    {
+        // limited by max size and by a short destination
+        auto packet = etl::array<char, 8> {};
+        assert(net::buffer_copy(net::make_buffer(packet), source, 6) == 6);
+        assert(etl::string_view(packet.data(), 6) == "headpa");
+        assert(net::buffer_copy(net::make_buffer(packet), source) == 8);
+        assert(net::buffer_copy(net::make_buffer(packet), net::const_buffer {}) == 0);
+    }
+    return true;
+}
+
+static auto test_consuming_buffers() -> bool
+{
+    auto header  = etl::array<char, 4> { 'h', 'e', 'a', 'd' };
+    auto payload = etl::array<char, 6> { 'p', 'a', 'y', 'l', 'o', 'd' };
+    auto crc     = etl::array<char, 2> { 'c', 'c' };
+    auto source  = net::static_buffer_sequence<net::const_buffer, 4> {
+        net::make_buffer(header),
+        net::const_buffer {},
+        net::make_buffer(payload),
+        net::make_buffer(crc),
+    };
+
+    auto cb = net::consuming_buffers { source };
+    assert(not cb.empty());
+    assert(cb.total_consumed() == 0);
+
+    // every prepared buffer is one DMA descriptor, at most 5 bytes per transfer
+    auto out = etl::array<char, 12> {};
+    auto pos = etl::size_t(0);
+    while (not cb.empty()) {
+        auto const descriptors = cb.prepare(5);
+        assert(net::buffer_size(descriptors) <= 5);
+        for (auto const& d : descriptors) {
+            assert(d.size() != 0);
+            etl::memcpy(&out[pos], d.data(), d.size());
+            pos += d.size();
+        }
+        cb.consume(net::buffer_size(descriptors));
+    }
+    assert(pos == 12);
+    assert(cb.total_consumed() == 12);
+    assert(etl::string_view(out.data(), out.size()) == "headpaylodcc");
+
+    {
+        auto partial  = net::consuming_buffers { source };
+        partial.consume(6);
+        auto prepared = partial.prepare();
+        assert(prepared.size() == 2);
+        assert(prepared[0].data() == &payload[2]);
+        assert(prepared[0].size() == 4);
+        assert(prepared[1].size() == 2);
+
+        // consuming more than is left ends the sequence
+        partial.consume(100);
+        assert(partial.empty());
+        assert(partial.prepare().empty());
+    }
+
+    {
+        // limited number of buffers per prepare
+        auto few      = net::consuming_buffers<decltype(source), 2> { source };
+        auto prepared = few.prepare();
+        assert(prepared.size() == 2);
+        assert(net::buffer_size(prepared) == 10);
+    }
+
+    {
+        auto mem       = etl::array<char, 8> {};
+        auto scatter   = net::consuming_buffers { net::make_buffer(mem) };
+        using prepared = decltype(scatter.prepare());
+        static_assert(etl::is_same_v<typename prepared::value_type, net::mutable_buffer>);
+        scatter.consume(3);
+        assert(scatter.prepare()[0].data() == &mem[3]);
+    }
+    return true;
+}
+
+static auto test_all() -> bool
+{
+    assert(test_traits());
+    assert(test_static_buffer_sequence());
+    assert(test_buffer_copy());
+    assert(test_consuming_buffers());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
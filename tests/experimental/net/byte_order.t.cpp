@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: BSL-1.0
 #include "etl/experimental/net/byte_order.hpp" // for hton, ntoh, net
 
+#include "etl/array.hpp"   // for array
+#include "etl/bit.hpp"     // for endian
 #include "etl/cstdint.hpp" // for int8_t, uint16_t, uin...
+#include "etl/span.hpp"    // for span
 
 #include "testing/testing.hpp"
 
@@ -25,6 +28,70 @@ constexpr auto test_all() -> bool
     assert(ntoh(hton(etl::uint32_t { 1 })) == 1);
     assert(ntoh(hton(etl::uint32_t { 42 })) == 42);
 
+    assert(ntoh(hton(etl::uint64_t { 42 })) == 42);
+    assert(ntoh(hton(etl::int16_t { -2 })) == -2);
+    assert(ntoh(hton(etl::int32_t { -3 })) == -3);
+    assert(ntoh(hton(etl::int64_t { -4 })) == -4);
+    assert(ntoh<float>(hton(1.5F)) == 1.5F);
+    assert(ntoh<double>(hton(-0.25)) == -0.25);
+
+    if constexpr (etl::endian::native == etl::endian::little) {
+        assert(hton(etl::uint16_t { 0x1122 }) == 0x2211);
+        assert(hton(etl::uint32_t { 0x11223344 }) == 0x44332211);
+        assert(hton(etl::uint64_t { 0x1122334455667788 }) == 0x8877665544332211);
+        assert(hton(etl::int16_t { 1 }) == 256);
+        assert(hton(1.0F) == 0x0000803F);
+        assert(hton(1.0) == 0x000000000000F03F);
+
+        // the network order bits of this denormal are a signalling NaN
+        auto const denormal = etl::bit_cast<float>(etl::uint32_t { 0x0000A07F });
+        assert(hton(denormal) == 0x7FA00000);
+        assert(etl::bit_cast<etl::uint32_t>(ntoh<float>(0x7FA00000)) == 0x0000A07F);
+    } else {
+        assert(hton(etl::uint32_t { 0x11223344 }) == 0x11223344);
+        assert(hton(1.0F) == etl::bit_cast<etl::uint32_t>(1.0F));
+    }
+
+    return true;
+}
+
+template <typename T>
+constexpr auto test_convert_endian() -> bool
+{
+    using namespace etl::experimental::net;
+
+    // more than one block plus a remainder, floats arrive as their bits
+    using wire_t = decltype(hton(T {}));
+    auto wire    = etl::array<wire_t, 37> {};
+    for (auto i = etl::size_t(0); i < wire.size(); ++i) { wire[i] = hton(static_cast<T>(i + 1)); }
+
+    auto data = etl::bit_cast<etl::array<T, 37>>(wire);
+    convert_endian(etl::span<T> { data });
+    for (auto i = etl::size_t(0); i < data.size(); ++i) { assert(data[i] == static_cast<T>(i + 1)); }
+
+    convert_endian(etl::span<T, 37> { data });
+    assert(etl::bit_cast<etl::array<wire_t, 37>>(data) == wire);
+
+    convert_endian(etl::span<T> {});
+    return true;
+}
+
+constexpr auto test_convert_endian_all() -> bool
+{
+    assert(test_convert_endian<etl::uint8_t>());
+    assert(test_convert_endian<etl::int16_t>());
+    assert(test_convert_endian<etl::uint32_t>());
+    assert(test_convert_endian<etl::int64_t>());
+    assert(test_convert_endian<float>());
+    assert(test_convert_endian<double>());
+
+    if constexpr (etl::endian::native == etl::endian::little) {
+        // a signalling NaN on the wire keeps its bits
+        auto data = etl::bit_cast<etl::array<float, 5>>(etl::array<etl::uint32_t, 5> {
+            0x7FA00000, 0x7FA00000, 0x7FA00000, 0x7FA00000, 0x7FA00000 });
+        etl::experimental::net::convert_endian(etl::span<float> { data });
+        for (auto x : etl::bit_cast<etl::array<etl::uint32_t, 5>>(data)) { assert(x == 0x0000A07F); }
+    }
     return true;
 }
 
@@ -32,5 +99,7 @@ auto main() -> int
 {
     assert(test_all());
     static_assert(test_all());
+    assert(test_convert_endian_all());
+    static_assert(test_convert_endian_all());
     return 0;
 }
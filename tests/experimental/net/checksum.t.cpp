@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/experimental/net/checksum.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/span.hpp"
+
+#include "testing/testing.hpp"
+
+namespace net = etl::experimental::net;
+
+namespace {
+
+template <etl::size_t N>
+constexpr auto to_bytes(char const (&str)[N]) -> etl::array<etl::uint8_t, N - 1>
+{
+    auto result = etl::array<etl::uint8_t, N - 1> {};
+    for (auto i = etl::size_t(0); i < N - 1; ++i) { result[i] = static_cast<etl::uint8_t>(str[i]); }
+    return result;
+}
+
+constexpr auto check = to_bytes("123456789");
+
+template <typename Checksum>
+constexpr auto compute(etl::span<etl::uint8_t const> data) -> typename Checksum::value_type
+{
+    return Checksum {}.update(data).value();
+}
+
+// The result must not depend on how the data is split into updates.
+template <typename Checksum>
+constexpr auto test_incremental() -> bool
+{
+    auto data = etl::array<etl::uint8_t, 67> {};
+    for (auto i = etl::size_t(0); i < data.size(); ++i) { data[i] = static_cast<etl::uint8_t>(i * 37U + 11U); }
+
+    auto const expected = compute<Checksum>(data);
+    for (auto split = etl::size_t(0); split <= data.size(); ++split) {
+        auto c = Checksum {};
+        c.update(etl::span<etl::uint8_t const> { data }.first(split));
+        c.update(etl::span<etl::uint8_t const> { data }.subspan(split));
+        assert(c.value() == expected);
+    }
+
+    auto c = Checksum {};
+    for (auto byte : data) { c.update(etl::span<etl::uint8_t const> { &byte, 1 }); }
+    assert(c.value() == expected);
+
+    c.reset();
+    assert(c.value() == Checksum {}.value());
+    return true;
+}
+
+constexpr auto test_crc() -> bool
+{
+    // catalogue check values of "123456789"
+    assert(compute<net::crc8>(check) == 0xF4);
+    assert(compute<net::crc16>(check) == 0x29B1);
+    assert(compute<net::crc32>(check) == 0xCBF43926);
+    assert(compute<net::crc32c>(check) == 0xE3069283);
+
+    using crc16_arc    = net::basic_crc<etl::uint16_t, 0x8005, 0x0000, true, 0x0000>;
+    using crc16_modbus = net::basic_crc<etl::uint16_t, 0x8005, 0xFFFF, true, 0x0000>;
+    using crc32_bzip2  = net::basic_crc<etl::uint32_t, 0x04C11DB7, 0xFFFFFFFF, false, 0xFFFFFFFF>;
+    using crc64_xz     = net::basic_crc<etl::uint64_t, 0x42F0E1EBA9EA3693, ~0ULL, true, ~0ULL>;
+    assert(compute<crc16_arc>(check) == 0xBB3D);
+    assert(compute<crc16_modbus>(check) == 0x4B37);
+    assert(compute<crc32_bzip2>(check) == 0xFC891918);
+    assert(compute<crc64_xz>(check) == 0x995DC9BBDF1939FA);
+
+    // the number of tables does not change the result
+    using crc32_by1  = net::basic_crc<etl::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF, 1>;
+    using crc32_by4  = net::basic_crc<etl::uint32_t, 0x04C11DB7, 0xFFFFFFFF, true, 0xFFFFFFFF, 4>;
+    using crc16_by4  = net::basic_crc<etl::uint16_t, 0x1021, 0xFFFF, false, 0x0000, 4>;
+    using crc32c_by1 = net::basic_crc<etl::uint32_t, 0x1EDC6F41, 0xFFFFFFFF, true, 0xFFFFFFFF, 1>;
+    assert(compute<crc32_by1>(check) == 0xCBF43926);
+    assert(compute<crc32_by4>(check) == 0xCBF43926);
+    assert(compute<crc16_by4>(check) == 0x29B1);
+    assert(compute<crc32c_by1>(check) == 0xE3069283);
+
+    assert(compute<net::crc32>({}) == 0);
+    assert(compute<net::crc16>({}) == 0xFFFF);
+
+    assert(test_incremental<net::crc8>());
+    assert(test_incremental<net::crc16>());
+    assert(test_incremental<net::crc32>());
+    assert(test_incremental<net::crc32c>());
+    assert(test_incremental<crc16_by4>());
+    assert(test_incremental<crc64_xz>());
+    return true;
+}
+
+constexpr auto test_adler_fletcher() -> bool
+{
+    assert(compute<net::adler32>(check) == 0x091E01DE);
+    assert(compute<net::adler32>(to_bytes("Wikipedia")) == 0x11E60398);
+    assert(compute<net::adler32>({}) == 1);
+
+    assert(compute<net::fletcher16>(to_bytes("abcde")) == 0xC8F0);
+    assert(compute<net::fletcher16>(to_bytes("abcdef")) == 0x2057);
+    assert(compute<net::fletcher16>(to_bytes("abcdefgh")) == 0x0627);
+
+    assert(compute<net::fletcher32>(to_bytes("abcde")) == 0xF04FC729);
+    assert(compute<net::fletcher32>(to_bytes("abcdef")) == 0x56502D2A);
+    assert(compute<net::fletcher32>(to_bytes("abcdefgh")) == 0xEBE19591);
+
+    assert(test_incremental<net::adler32>());
+    assert(test_incremental<net::fletcher16>());
+    assert(test_incremental<net::fletcher32>());
+    return true;
+}
+
+// Long inputs cross the blocks of deferred modulo reductions.
+auto test_long() -> bool
+{
+    static auto data = etl::array<etl::uint8_t, 20000> {};
+    data.fill(0xFF);
+
+    auto a = net::adler32 {};
+    auto f = net::fletcher16 {};
+    auto g = net::fletcher32 {};
+    for (auto byte : data) {
+        a.update(etl::span<etl::uint8_t const> { &byte, 1 });
+        f.update(etl::span<etl::uint8_t const> { &byte, 1 });
+        g.update(etl::span<etl::uint8_t const> { &byte, 1 });
+    }
+    assert(compute<net::adler32>(data) == a.value());
+    assert(compute<net::fletcher16>(data) == f.value());
+    assert(compute<net::fletcher32>(data) == g.value());
+
+    // the hardware CRC-32C matches the tables
+    for (auto i = etl::size_t(0); i < data.size(); ++i) { data[i] = static_cast<etl::uint8_t>(i * 7U); }
+    using crc32c_by1 = net::basic_crc<etl::uint32_t, 0x1EDC6F41, 0xFFFFFFFF, true, 0xFFFFFFFF, 1>;
+    assert(compute<net::crc32c>(data) == compute<crc32c_by1>(data));
+    return true;
+}
+
+auto test_buffers() -> bool
+{
+    auto const bytes = check;
+    auto const buf   = net::const_buffer { bytes.data(), bytes.size() };
+    assert(net::crc32 {}.update(buf).value() == 0xCBF43926);
+    assert(net::crc32c {}.update(buf).value() == 0xE3069283);
+    assert(net::adler32 {}.update(buf).value() == 0x091E01DE);
+    assert(net::fletcher32 {}.update(buf).value() == compute<net::fletcher32>(check));
+    return true;
+}
+
+} // namespace
+
+auto main() -> int
+{
+    assert(test_crc());
+    static_assert(test_crc());
+    assert(test_adler_fletcher());
+    static_assert(test_adler_fletcher());
+    assert(test_long());
+    assert(test_buffers());
+    return 0;
+}
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/experimental/net/codec.hpp"
+
+#include "etl/array.hpp"
+#include "etl/bit.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/span.hpp"
+
+#include "testing/testing.hpp"
+
+namespace net = etl::experimental::net;
+
+namespace {
+
+enum struct kind : etl::uint8_t {
+    data    = 1,
+    control = 2,
+};
+
+struct vec3 {
+    etl::int16_t x;
+    etl::int16_t y;
+    etl::int16_t z;
+};
+
+/// Bitfields, a little-endian field, an array, a float and a nested struct.
+struct packet {
+    etl::uint8_t version;
+    kind type;
+    bool urgent;
+    etl::int8_t delta;
+    etl::uint16_t length;
+    etl::uint32_t sequence;
+    etl::array<etl::uint16_t, 3> samples;
+    float gain;
+    vec3 position;
+    etl::uint8_t flags[2];
+};
+
+} // namespace
+
+template <>
+struct net::describe<vec3> {
+    using fields = net::fields<net::field<&vec3::x>, net::field<&vec3::y>, net::field<&vec3::z>>;
+};
+
+template <>
+struct net::describe<packet> {
+    using fields = net::fields<
+        net::field<&packet::version, 4>,
+        net::field<&packet::type, 3>,
+        net::field<&packet::urgent, 1>,
+        net::field<&packet::delta, 4>,
+        net::field<&packet::length, 12>,
+        net::field<&packet::sequence, 32, etl::endian::little>,
+        net::field<&packet::samples, 12>,
+        net::field<&packet::gain>,
+        net::field<&packet::position>,
+        net::field<&packet::flags, 1>>;
+};
+
+static_assert(net::described<packet>);
+static_assert(not net::described<int>);
+static_assert(net::encoded_size_v<vec3> == 6);
+// 4 + 3 + 1 + 4 + 12 + 32 + 3 * 12 + 32 + 48 + 2 = 174 bits
+static_assert(net::encoded_size_v<packet> == 22);
+
+static constexpr auto make_packet() -> packet
+{
+    auto p     = packet {};
+    p.version  = 4;
+    p.type     = kind::control;
+    p.urgent   = true;
+    p.delta    = -3;
+    p.length   = 0xABC;
+    p.sequence = 0x11223344;
+    p.samples  = { 0x123, 0x456, 0xFFF };
+    p.gain     = 1.5F;
+    p.position = { -1, 2, -300 };
+    p.flags[0] = 1;
+    p.flags[1] = 0;
+    return p;
+}
+
+static constexpr auto test_wire_format() -> bool
+{
+    auto out = etl::array<etl::uint8_t, 24> {};
+    out.fill(0xEE);
+    assert(net::encode(make_packet(), etl::span<etl::uint8_t> { out }) == 22);
+
+    // version 4 | type 2 | urgent 1, delta -3 | length 0xABC
+    assert(out[0] == 0x45);
+    assert(out[1] == 0xDA);
+    assert(out[2] == 0xBC);
+
+    // little-endian sequence
+    assert(out[3] == 0x44);
+    assert(out[4] == 0x33);
+    assert(out[5] == 0x22);
+    assert(out[6] == 0x11);
+
+    // 12 bit samples 0x123, 0x456, 0xFFF
+    assert(out[7] == 0x12);
+    assert(out[8] == 0x34);
+    assert(out[9] == 0x56);
+    assert(out[10] == 0xFF);
+    assert(out[11] == 0xF3);
+
+    // 1.5F is 0x3FC00000 and starts in the middle of byte 11
+    assert(out[12] == 0xFC);
+    assert(out[13] == 0x00);
+    assert(out[14] == 0x00);
+    assert(out[15] == 0x0F);
+
+    // vec3 { -1, 2, -300 }: 0xFFFF 0x0002 0xFED4, shifted by 4 bits
+    assert(out[16] == 0xFF);
+    assert(out[17] == 0xF0);
+    assert(out[18] == 0x00);
+    assert(out[19] == 0x2F);
+    assert(out[20] == 0xED);
+
+    // -300 low nibble 4, flags 1 and 0, two unused zero bits
+    assert(out[21] == 0x48);
+
+    // bytes after the encoding are untouched
+    assert(out[22] == 0xEE);
+    return true;
+}
+
+static constexpr auto test_round_trip() -> bool
+{
+    auto out = etl::array<etl::uint8_t, 22> {};
+    assert(net::encode(make_packet(), etl::span<etl::uint8_t> { out }) == 22);
+
+    auto p = packet {};
+    assert(net::decode(etl::span<etl::uint8_t const> { out }, p) == 22);
+    assert(p.version == 4);
+    assert(p.type == kind::control);
+    assert(p.urgent);
+    assert(p.delta == -3);
+    assert(p.length == 0xABC);
+    assert(p.sequence == 0x11223344);
+    assert(p.samples[0] == 0x123);
+    assert(p.samples[1] == 0x456);
+    assert(p.samples[2] == 0xFFF);
+    assert(p.gain == 1.5F);
+    assert(p.position.x == -1);
+    assert(p.position.y == 2);
+    assert(p.position.z == -300);
+    assert(p.flags[0] == 1);
+    assert(p.flags[1] == 0);
+
+    // values are truncated to the field width
+    auto q    = make_packet();
+    q.version = 0x1F;
+    assert(net::encode(q, etl::span<etl::uint8_t> { out }) == 22);
+    assert(net::decode(etl::span<etl::uint8_t const> { out }, p) == 22);
+    assert(p.version == 0xF);
+    assert(p.type == kind::control);
+    return true;
+}
+
+static constexpr auto test_size_check() -> bool
+{
+    auto small = etl::array<etl::uint8_t, 21> {};
+    assert(net::encode(make_packet(), etl::span<etl::uint8_t> { small }) == 0);
+
+    auto p = packet {};
+    assert(net::decode(etl::span<etl::uint8_t const> { small }, p) == 0);
+    assert(p.version == 0);
+
+    auto v = vec3 {};
+    assert(net::decode(etl::span<etl::uint8_t const> { small }.first(6), v) == 6);
+    return true;
+}
+
+static auto test_buffers() -> bool
+{
+    auto mem = etl::array<etl::uint8_t, 32> {};
+    assert(net::encode(make_packet(), net::mutable_buffer { mem.data(), mem.size() }) == 22);
+
+    auto p = packet {};
+    assert(net::decode(net::const_buffer { mem.data(), 22 }, p) == 22);
+    assert(p.sequence == 0x11223344);
+    assert(p.position.z == -300);
+    assert(net::decode(net::const_buffer { mem.data(), 21 }, p) == 0);
+    return true;
+}
+
+static constexpr auto test_all() -> bool
+{
+    assert(test_wire_format());
+    assert(test_round_trip());
+    assert(test_size_check());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    assert(test_buffers());
+    return 0;
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/experimental/testing/testing.hpp"
+
+namespace {
+
+etl::uint64_t fake_ticks = 0;
+
+auto fake_clock() -> etl::uint64_t { return fake_ticks; }
+
+auto fake_work() -> void { fake_ticks += 10; }
+
+} // namespace
+
+TEST_CASE("benchmark: iteration scaling", "[benchmark]")
+{
+    auto options      = etl::test::benchmark_options {};
+    options.clock     = etl::test::benchmark_clock { fake_clock, "ticks" };
+    options.min_ticks = 1000;
+    options.samples   = 5;
+
+    auto const stats = etl::test::run_benchmark(fake_work, options);
+    CHECK_EQUAL(stats.iterations, 128U);
+    CHECK_EQUAL(stats.min, 1280U);
+    CHECK_EQUAL(stats.median, 1280U);
+    CHECK_EQUAL(stats.max, 1280U);
+}
+
+TEST_CASE("benchmark: min/median/max", "[benchmark]")
+{
+    auto calls    = 0;
+    auto const fn = [&calls] { fake_ticks += static_cast<etl::uint64_t>(++calls); };
+
+    auto options      = etl::test::benchmark_options {};
+    options.clock     = etl::test::benchmark_clock { fake_clock, "ticks" };
+    options.min_ticks = 1;
+    options.samples   = 3;
+
+    // calibration takes the first call, the samples the next three
+    auto const stats = etl::test::run_benchmark(fn, options);
+    CHECK_EQUAL(stats.iterations, 1U);
+    CHECK_EQUAL(stats.min, 2U);
+    CHECK_EQUAL(stats.median, 3U);
+    CHECK_EQUAL(stats.max, 4U);
+}
+
+TEST_CASE("benchmark: no clock", "[benchmark]")
+{
+    auto options      = etl::test::benchmark_options {};
+    options.clock.now = nullptr;
+
+    auto const stats = etl::test::run_benchmark(fake_work, options);
+    CHECK_EQUAL(stats.iterations, 0U);
+}
+
+BENCHMARK("accumulate 64")
+{
+    auto sum = 0U;
+    for (auto i = 0U; i < 64U; ++i) { sum += i * i; }
+    etl::test::do_not_optimize(sum);
+}
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/experimental/trace/ring_buffer.hpp"
+
+#include "testing/testing.hpp"
+
+namespace trace = etl::experimental::trace;
+
+static auto test_all() -> bool
+{
+    auto buffer = trace::ring_buffer<4> {};
+    assert(buffer.capacity() == 4);
+    assert(buffer.size() == 0);
+    assert(buffer.dropped() == 0);
+
+    for (auto i = 0; i < 3; ++i) { buffer.push(trace::event { "a", static_cast<etl::uint64_t>(i), i }); }
+    assert(buffer.size() == 3);
+    assert(buffer.dropped() == 0);
+
+    // oldest events are overwritten
+    for (auto i = 3; i < 7; ++i) { buffer.push(trace::event { "b", static_cast<etl::uint64_t>(i), i }); }
+    assert(buffer.size() == 4);
+    assert(buffer.dropped() == 3);
+
+    auto expected = etl::int64_t(3);
+    buffer.for_each([&expected](trace::event const& e) { assert(e.value == expected++); });
+    assert(expected == 7);
+
+    buffer.clear();
+    assert(buffer.size() == 0);
+    buffer.for_each([](trace::event const& /*e*/) { assert(false); });
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
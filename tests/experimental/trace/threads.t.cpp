@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#define TETL_ENABLE_TRACE
+#define TETL_TRACE_MAX_THREADS 2
+
+#include "etl/experimental/trace/trace.hpp"
+
+#include "etl/string_view.hpp"
+
+#include "testing/testing.hpp"
+
+#include <thread>
+
+namespace trace = etl::experimental::trace;
+
+namespace {
+
+auto first() -> void { TETL_TRACE_SCOPE("first"); }
+
+auto third() -> void { TETL_TRACE_SCOPE("third"); }
+
+auto counters() -> void
+{
+    for (auto i = 0; i < 300; ++i) { TETL_TRACE_COUNTER("i", i); }
+}
+
+auto name(trace::buffer const& events) -> etl::string_view
+{
+    auto result = etl::string_view {};
+    events.for_each([&result](trace::event const& e) { result = e.name; });
+    return result;
+}
+
+} // namespace
+
+static auto test_all() -> bool
+{
+    std::thread { first }.join();
+    std::thread { counters }.join();
+
+    // the buffers of joined threads can still be exported
+    auto threads = etl::size_t(0);
+    trace::for_each_buffer([&](etl::size_t thread, trace::buffer const& events) {
+        if (thread == 0) {
+            assert(events.size() == 2);
+            assert(name(events) == "first");
+        } else {
+            assert(events.size() == trace::buffer::capacity());
+            assert(events.dropped() == 300 - trace::buffer::capacity());
+            auto i = static_cast<etl::int64_t>(events.dropped());
+            events.for_each([&i](trace::event const& e) {
+                assert(e.type == trace::event_type::counter);
+                assert(e.value == i++);
+            });
+        }
+        ++threads;
+    });
+    assert(threads == 2);
+
+    // all slots were taken, the slot of the first thread is reused
+    std::thread { third }.join();
+    threads = 0;
+    trace::for_each_buffer([&](etl::size_t thread, trace::buffer const& events) {
+        if (thread == 0) {
+            assert(events.size() == 2);
+            assert(name(events) == "third");
+        } else {
+            assert(events.size() == trace::buffer::capacity());
+        }
+        ++threads;
+    });
+    assert(threads == 2);
+
+    // while this thread and the outer thread hold both slots, the inner
+    // thread doesn't record
+    TETL_TRACE_INSTANT("main");
+    std::thread { [] {
+        TETL_TRACE_INSTANT("outer");
+        auto inner = std::thread { [] { assert(trace::this_thread_buffer() == nullptr); } };
+        inner.join();
+    } }.join();
+
+    threads = 0;
+    trace::for_each_buffer([&](etl::size_t thread, trace::buffer const& events) {
+        assert(events.size() == 1);
+        assert(name(events) == (thread == 0 ? "main" : "outer"));
+        ++threads;
+    });
+    assert(threads == 2);
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
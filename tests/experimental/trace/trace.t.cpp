@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#define TETL_ENABLE_TRACE
+
+#include "etl/experimental/trace/chrome_json.hpp"
+#include "etl/experimental/trace/trace.hpp"
+
+#include "etl/string.hpp"
+#include "etl/string_view.hpp"
+
+#include "testing/testing.hpp"
+
+namespace trace = etl::experimental::trace;
+
+namespace {
+
+etl::uint64_t ticks = 0;
+
+auto fake_clock() -> etl::uint64_t
+{
+    ticks += 1500;
+    return ticks;
+}
+
+auto work(int n) -> int
+{
+    TETL_TRACE_SCOPE("work");
+    TETL_TRACE_COUNTER("n", n);
+    return n * 2;
+}
+
+} // namespace
+
+static auto test_all() -> bool
+{
+    trace::set_timestamp_source(fake_clock, 1000);
+
+    {
+        TETL_TRACE_SCOPE("outer");
+        assert(work(-3) == -6);
+        TETL_TRACE_INSTANT("done");
+    }
+
+    auto const& events = *trace::this_thread_buffer();
+    assert(events.size() == 6);
+
+    auto const expected = etl::array {
+        trace::event_type::begin,
+        trace::event_type::begin,
+        trace::event_type::counter,
+        trace::event_type::end,
+        trace::event_type::instant,
+        trace::event_type::end,
+    };
+    auto i = etl::size_t(0);
+    events.for_each([&](trace::event const& e) {
+        assert(e.type == expected[i]);
+        assert(e.timestamp == 1500U * (i + 1));
+        ++i;
+    });
+
+    auto json = etl::static_string<1024> {};
+    trace::write_chrome_json([&json](char const* data, etl::size_t size) { json.append(data, size); });
+
+    auto const sv = etl::string_view { json.data(), json.size() };
+    assert(sv.starts_with("{\"traceEvents\":["));
+    assert(sv.find(R"({"name":"outer","ph":"B","ts":1.500,"pid":1,"tid":0})") != etl::string_view::npos);
+    assert(sv.find(R"({"name":"work","ph":"E","ts":6.000,"pid":1,"tid":0})") != etl::string_view::npos);
+    auto const counter = etl::string_view { R"({"name":"n","ph":"C","ts":4.500,"pid":1,"tid":0,"args":{"value":-3}})" };
+    assert(sv.find(counter) != etl::string_view::npos);
+    assert(sv.find(R"({"name":"done","ph":"i","ts":7.500,"pid":1,"tid":0,"s":"t"})") != etl::string_view::npos);
+    assert(sv.ends_with("\n]}\n"));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
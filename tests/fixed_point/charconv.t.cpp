@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/fixed_point.hpp"
+
+#include "etl/cstdint.hpp"
+#include "etl/string_view.hpp"
+#include "etl/system_error.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+
+template <typename Fixed>
+constexpr auto to_string(Fixed value, char (&buffer)[32]) -> etl::string_view
+{
+    auto const [ptr, ec] = etl::to_chars(etl::begin(buffer), etl::end(buffer), value);
+    assert(ec == etl::errc {});
+    return { etl::begin(buffer), static_cast<etl::size_t>(ptr - etl::begin(buffer)) };
+}
+
+template <typename Fixed>
+constexpr auto parse(etl::string_view str) -> Fixed
+{
+    auto value           = Fixed {};
+    auto const [ptr, ec] = etl::from_chars(str.data(), str.data() + str.size(), value);
+    assert(ec == etl::errc {});
+    assert(ptr == str.data() + str.size());
+    return value;
+}
+
+template <typename Fixed>
+constexpr auto round_trip(Fixed value) -> bool
+{
+    char buffer[32] {};
+    return parse<Fixed>(to_string(value, buffer)) == value;
+}
+
+constexpr auto test_to_chars() -> bool
+{
+    using q15 = etl::fixed_point<0, 15, etl::int16_t>;
+    using q16 = etl::fixed_point<15, 16, etl::int32_t>;
+    using u8  = etl::fixed_point<4, 4, etl::uint8_t>;
+
+    char buffer[32] {};
+    assert(to_string(q16(0), buffer) == "0");
+    assert(to_string(q16(42), buffer) == "42");
+    assert(to_string(q16(-42), buffer) == "-42");
+    assert(to_string(q16(1.5), buffer) == "1.5");
+    assert(to_string(q16(-0.25), buffer) == "-0.25");
+    assert(to_string(q16(0.1), buffer) == "0.1");
+    assert(to_string(q16(-3.14159), buffer) == "-3.14159");
+    assert(to_string(q16::max(), buffer) == "32767.99998");
+    assert(to_string(q16::lowest(), buffer) == "-32768");
+    assert(to_string(q16::epsilon(), buffer) == "0.00002");
+    assert(to_string(q15(0.1), buffer) == "0.1");
+    assert(to_string(q15::lowest(), buffer) == "-1");
+    assert(to_string(q15::max(), buffer) == "0.99997");
+    assert(to_string(u8(15.9375), buffer) == "15.94");
+    assert(to_string(u8(0.0625), buffer) == "0.06");
+
+    // the shortest string is rounded up or down
+    assert(to_string(q16::from_raw(13107), buffer) == "0.2");
+    assert(to_string(q16::from_raw(6553), buffer) == "0.09999");
+    assert(to_string(q16::from_raw(65535), buffer) == "0.99998");
+
+    char small[3] {};
+    auto const res = etl::to_chars(etl::begin(small), etl::end(small), q16(-1.5));
+    assert(res.ec == etl::errc::value_too_large);
+    assert(res.ptr == etl::end(small));
+    return true;
+}
+
+constexpr auto test_from_chars() -> bool
+{
+    using q15 = etl::fixed_point<0, 15, etl::int16_t>;
+    using q16 = etl::fixed_point<15, 16, etl::int32_t>;
+    using u8  = etl::fixed_point<4, 4, etl::uint8_t>;
+
+    assert(parse<q16>("0") == q16(0));
+    assert(parse<q16>("-0") == q16(0));
+    assert(parse<q16>("42") == q16(42));
+    assert(parse<q16>("-42.") == q16(-42));
+    assert(parse<q16>("1.5") == q16(1.5));
+    assert(parse<q16>(".5") == q16(0.5));
+    assert(parse<q16>("-0.25") == q16(-0.25));
+    assert(parse<q16>("0.1") == q16(0.1));
+    assert(parse<q16>("-32768") == q16::lowest());
+    assert(parse<q16>("32767.99998") == q16::max());
+    assert(parse<q16>("32767.99999") == q16::max());
+    assert(parse<q16>("0.000000000000000000000000000001") == q16(0));
+    assert(parse<q15>("-1") == q15::lowest());
+    assert(parse<q15>("0.333333333333333333333333333333") == q15(1.0 / 3.0));
+    assert(parse<u8>("15.9375") == u8::max());
+
+    // halfway cases round away from zero
+    assert(parse<u8>("0.03125") == u8::epsilon());
+    assert(parse<u8>("0.03124") == u8(0));
+    assert(parse<q16>("-0.00000762939453125") == -q16::epsilon());
+
+    // errors
+    auto value = q16(7);
+    auto check = [&value](etl::string_view str, etl::errc ec, etl::size_t consumed) {
+        auto const res = etl::from_chars(str.data(), str.data() + str.size(), value);
+        return res.ec == ec and res.ptr == str.data() + consumed and value == q16(7);
+    };
+    assert(check("", etl::errc::invalid_argument, 0));
+    assert(check("-", etl::errc::invalid_argument, 0));
+    assert(check(".", etl::errc::invalid_argument, 0));
+    assert(check("+1", etl::errc::invalid_argument, 0));
+    assert(check("abc", etl::errc::invalid_argument, 0));
+    assert(check("32768", etl::errc::result_out_of_range, 5));
+    assert(check("-32768.00001", etl::errc::result_out_of_range, 12));
+    assert(check("99999999999999999999999x", etl::errc::result_out_of_range, 23));
+
+    auto unsigned_value  = u8(1);
+    constexpr auto minus = etl::string_view("-1");
+    auto const res       = etl::from_chars(minus.data(), minus.data() + minus.size(), unsigned_value);
+    assert(res.ec == etl::errc::invalid_argument);
+    assert(unsigned_value == u8(1));
+
+    // stops at the first character that does not match
+    auto const str = etl::string_view("2.5e3");
+    assert(etl::from_chars(str.data(), str.data() + str.size(), value).ptr == str.data() + 3);
+    assert(value == q16(2.5));
+    return true;
+}
+
+template <typename Fixed>
+constexpr auto test_round_trip() -> bool
+{
+    using storage_t = typename Fixed::storage_type;
+
+    auto const step = static_cast<storage_t>(Fixed::max().raw() / 97);
+    for (auto i = 0; i < 97; ++i) {
+        auto const x = Fixed::from_raw(static_cast<storage_t>(step * static_cast<storage_t>(i)));
+        assert(round_trip(x));
+        assert(round_trip(-x));
+        assert(round_trip(Fixed::from_raw(static_cast<storage_t>(i))));
+    }
+    assert(round_trip(Fixed::max()));
+    assert(round_trip(Fixed::lowest()));
+    return true;
+}
+
+} // namespace
+
+auto main() -> int
+{
+    assert(test_to_chars());
+    assert(test_from_chars());
+    assert((test_round_trip<etl::fixed_point<0, 15, etl::int16_t>>()));
+    assert((test_round_trip<etl::fixed_point<15, 16, etl::int32_t>>()));
+    assert((test_round_trip<etl::fixed_point<4, 4, etl::uint8_t>>()));
+
+    static_assert(test_to_chars());
+    static_assert(test_from_chars());
+    static_assert(test_round_trip<etl::fixed_point<0, 15, etl::int16_t>>());
+    static_assert(test_round_trip<etl::fixed_point<15, 16, etl::int32_t>>());
+    static_assert(test_round_trip<etl::fixed_point<4, 4, etl::uint8_t>>());
+
+#if defined(__SIZEOF_INT128__)
+    assert((test_round_trip<etl::fixed_point<31, 32, etl::int64_t>>()));
+    assert((test_round_trip<etl::fixed_point<0, 64, etl::uint64_t>>()));
+    static_assert(test_round_trip<etl::fixed_point<31, 32, etl::int64_t>>());
+    static_assert(test_round_trip<etl::fixed_point<0, 64, etl::uint64_t>>());
+#endif
+    return 0;
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/fixed_point.hpp"
+
+#include "etl/cstdint.hpp"
+#include "etl/ratio.hpp"
+#include "etl/type_traits.hpp"
+
+#include "testing/testing.hpp"
+
+template <typename Storage>
+constexpr auto test_signed() -> bool
+{
+    constexpr auto frac = etl::numeric_limits<Storage>::digits / 2;
+    constexpr auto ints = etl::numeric_limits<Storage>::digits - frac;
+    using fixed_t       = etl::fixed_point<ints, frac, Storage>;
+
+    assert((etl::is_same_v<typename fixed_t::storage_type, Storage>));
+    assert(fixed_t::integer_bits == ints);
+    assert(fixed_t::fractional_bits == frac);
+    assert(fixed_t::max().raw() == etl::numeric_limits<Storage>::max());
+    assert(fixed_t::lowest().raw() == etl::numeric_limits<Storage>::min());
+    assert(fixed_t::epsilon().raw() == 1);
+    assert(fixed_t().raw() == 0);
+
+    // conversions
+    assert(fixed_t(1).raw() == Storage(1) << frac);
+    assert(fixed_t(-3).raw() == -(Storage(3) << frac));
+    assert(fixed_t(0.5).raw() == Storage(1) << (frac - 1));
+    assert(fixed_t(-0.25F).raw() == -(Storage(1) << (frac - 2)));
+    assert(fixed_t(1000000000000.0) == fixed_t::max());
+    assert(fixed_t(-1000000000000.0) == fixed_t::lowest());
+    assert(fixed_t(etl::numeric_limits<double>::quiet_NaN()) == fixed_t());
+    assert(static_cast<double>(fixed_t(2.5)) == 2.5);
+    assert(static_cast<float>(fixed_t(-0.75)) == -0.75F);
+    assert(static_cast<int>(fixed_t(2.75)) == 2);
+    assert(static_cast<int>(fixed_t(-2.75)) == -2);
+    assert(fixed_t::from_raw(Storage(3)).raw() == 3);
+
+    // arithmetic
+    assert(fixed_t(1.5) + fixed_t(2.25) == fixed_t(3.75));
+    assert(fixed_t(1.5) - fixed_t(2.25) == fixed_t(-0.75));
+    assert(fixed_t(1.5) * fixed_t(-2.25) == fixed_t(-3.375));
+    assert(fixed_t(-6) / fixed_t(-4) == fixed_t(1.5));
+    assert(-fixed_t(1.5) == fixed_t(-1.5));
+    assert(+fixed_t(1.5) == fixed_t(1.5));
+
+    // rounded to nearest
+    assert((fixed_t(1) / fixed_t(3)).raw() == ((Storage(1) << frac) + 1) / 3);
+    assert((fixed_t(-1) / fixed_t(3)).raw() == -((Storage(1) << frac) + 1) / 3);
+    assert((fixed_t::epsilon() * fixed_t(0.5)).raw() == 1);
+    assert((fixed_t::epsilon() * fixed_t(0.25)).raw() == 0);
+
+    auto x = fixed_t(1);
+    x += fixed_t(2);
+    assert(x == fixed_t(3));
+    x -= fixed_t(0.5);
+    assert(x == fixed_t(2.5));
+    x *= fixed_t(2);
+    assert(x == fixed_t(5));
+    x /= fixed_t(4);
+    assert(x == fixed_t(1.25));
+
+    // saturation
+    assert(fixed_t::max() + fixed_t::epsilon() == fixed_t::max());
+    assert(fixed_t::lowest() - fixed_t::epsilon() == fixed_t::lowest());
+    assert(fixed_t::max() * fixed_t(2) == fixed_t::max());
+    assert(fixed_t::max() * fixed_t(-2) == fixed_t::lowest());
+    assert(-fixed_t::lowest() == fixed_t::max());
+    assert(fixed_t(etl::numeric_limits<etl::int64_t>::max()) == fixed_t::max());
+    assert(fixed_t(etl::numeric_limits<etl::int64_t>::min()) == fixed_t::lowest());
+
+    // comparison
+    assert(fixed_t(1) < fixed_t(2));
+    assert(fixed_t(-1) <= fixed_t(-1));
+    assert(fixed_t(2) > fixed_t(-2));
+    assert(fixed_t(2) >= fixed_t(2));
+    assert(fixed_t(2) != fixed_t(-2));
+    return true;
+}
+
+template <typename Storage>
+constexpr auto test_wrap() -> bool
+{
+    using fixed_t = etl::fixed_point<3, 4, Storage, etl::fixed_point_overflow::wrap>;
+
+    assert(fixed_t::max() == fixed_t(7.9375));
+    assert(fixed_t::lowest() == fixed_t(-8));
+    assert(fixed_t::max() + fixed_t::epsilon() == fixed_t::lowest());
+    assert(fixed_t::lowest() - fixed_t::epsilon() == fixed_t::max());
+    assert(fixed_t(4) * fixed_t(2) == fixed_t(-8));
+    assert(fixed_t(9) == fixed_t(-7));
+    assert(-fixed_t::lowest() == fixed_t::lowest());
+
+    // floating point arguments saturate with both policies
+    assert(fixed_t(100.0) == fixed_t::max());
+    return true;
+}
+
+template <typename Storage>
+constexpr auto test_unsigned() -> bool
+{
+    using fixed_t = etl::fixed_point<4, 4, Storage>;
+
+    assert(fixed_t::lowest() == fixed_t(0));
+    assert(fixed_t::max() == fixed_t(15.9375));
+    assert(fixed_t(3.5).raw() == 56);
+    assert(fixed_t(-1) == fixed_t::lowest());
+    assert(fixed_t(100) == fixed_t::max());
+    assert(fixed_t(1) - fixed_t(2) == fixed_t::lowest());
+    assert(fixed_t(2.5) * fixed_t(1.5) == fixed_t(3.75));
+    assert(fixed_t(7) / fixed_t(2) == fixed_t(3.5));
+    return true;
+}
+
+constexpr auto test_convert() -> bool
+{
+    using q15   = etl::fixed_point<0, 15, etl::int16_t>;
+    using q16   = etl::fixed_point<15, 16, etl::int32_t>;
+    using q4    = etl::fixed_point<3, 4, etl::uint8_t>;
+    using q4_4w = etl::fixed_point<3, 4, etl::int8_t, etl::fixed_point_overflow::wrap>;
+
+    assert(q15(q16(0.25)) == q15(0.25));
+    assert(q15(q16(-0.5)) == q15(-0.5));
+    assert(q15(q16(3)) == q15::max());
+    assert(q15(q16(-3)) == q15::lowest());
+    assert(q16(q15(-0.25)) == q16(-0.25));
+    assert(q16(q15::lowest()) == q16(-1));
+    assert(q4(q16(-1)) == q4::lowest());
+    assert(q4(q16(2.53125)) == q4(2.5625));
+    assert(q4_4w(q16(9)) == q4_4w(-7));
+    return true;
+}
+
+constexpr auto test_rescale() -> bool
+{
+    using q16 = etl::fixed_point<15, 16, etl::int32_t>;
+    using q8  = etl::fixed_point<7, 8, etl::int16_t, etl::fixed_point_overflow::wrap>;
+
+    assert(etl::rescale<etl::ratio<3, 4>>(q16(2)) == q16(1.5));
+    assert(etl::rescale<etl::ratio<-1, 2>>(q16(3)) == q16(-1.5));
+    assert(etl::rescale<etl::milli>(q16(1500)) == q16(1.5));
+    assert(etl::rescale<etl::ratio<1, 3>>(q16(1)) == q16(1) / q16(3));
+    assert(etl::rescale<etl::ratio<1000>>(q16(1000)) == q16::max());
+    assert(etl::rescale<etl::ratio<2>>(q8(100)) == q8(-56));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_signed<etl::int16_t>());
+    assert(test_signed<etl::int32_t>());
+    assert(test_wrap<etl::int8_t>());
+    assert(test_wrap<etl::int32_t>());
+    assert(test_unsigned<etl::uint8_t>());
+    assert(test_unsigned<etl::uint16_t>());
+    assert(test_convert());
+    assert(test_rescale());
+
+    static_assert(test_signed<etl::int16_t>());
+    static_assert(test_signed<etl::int32_t>());
+    static_assert(test_wrap<etl::int8_t>());
+    static_assert(test_wrap<etl::int32_t>());
+    static_assert(test_unsigned<etl::uint8_t>());
+    static_assert(test_unsigned<etl::uint16_t>());
+    static_assert(test_convert());
+    static_assert(test_rescale());
+
+#if defined(__SIZEOF_INT128__)
+    assert(test_signed<etl::int64_t>());
+    assert(test_wrap<etl::int64_t>());
+    assert(test_unsigned<etl::uint64_t>());
+    static_assert(test_signed<etl::int64_t>());
+    static_assert(test_wrap<etl::int64_t>());
+    static_assert(test_unsigned<etl::uint64_t>());
+#endif
+    return 0;
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/fixed_point.hpp"
+
+#include "etl/cstdint.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+
+template <typename Fixed>
+constexpr auto near(Fixed x, double expected, double lsb = 1.0) -> bool
+{
+    auto const diff = static_cast<double>(x) - expected;
+    auto const tol  = lsb * static_cast<double>(Fixed::epsilon());
+    return diff <= tol and diff >= -tol;
+}
+
+} // namespace
+
+template <typename Fixed>
+constexpr auto test_sqrt() -> bool
+{
+    // exact squares
+    assert(etl::sqrt(Fixed(0)) == Fixed(0));
+    assert(etl::sqrt(Fixed(1)) == Fixed(1));
+    assert(etl::sqrt(Fixed(4)) == Fixed(2));
+    assert(etl::sqrt(Fixed(0.25)) == Fixed(0.5));
+    assert(etl::sqrt(Fixed(6.25)) == Fixed(2.5));
+    assert(etl::sqrt(Fixed(100)) == Fixed(10));
+
+    // rounded to nearest
+    assert(near(etl::sqrt(Fixed(2)), 1.4142135623730951, 0.5));
+    assert(near(etl::sqrt(Fixed(3)), 1.7320508075688772, 0.5));
+    assert(near(etl::sqrt(Fixed(0.1)), 0.31622776601683794, 1.0));
+    assert(etl::sqrt(Fixed::epsilon()).raw() > 0);
+
+    // negative arguments
+    assert(etl::sqrt(Fixed(-1)) == Fixed(0));
+    assert(etl::sqrt(Fixed::lowest()) == Fixed(0));
+    return true;
+}
+
+template <typename Fixed>
+constexpr auto test_trig() -> bool
+{
+    // the Q31 kernel is accurate to a few 2^-31
+    constexpr auto frac = Fixed::fractional_bits;
+    constexpr auto lsb  = frac > 29 ? static_cast<double>(1LL << (frac - 29)) : 1.0;
+
+    assert(etl::sin(Fixed(0)) == Fixed(0));
+    assert(etl::cos(Fixed(0)) == Fixed(1));
+
+    assert(near(etl::sin(Fixed(0.5)), 0.479425538604203, lsb));
+    assert(near(etl::sin(Fixed(1)), 0.8414709848078965, lsb));
+    assert(near(etl::sin(Fixed(2)), 0.9092974268256817, lsb));
+    assert(near(etl::sin(Fixed(3)), 0.1411200080598672, lsb));
+    assert(near(etl::sin(Fixed(-1)), -0.8414709848078965, lsb));
+    assert(near(etl::sin(Fixed(-4)), 0.7568024953079282, lsb));
+    assert(near(etl::sin(Fixed(100)), -0.5063656411097588, lsb));
+    assert(near(etl::sin(Fixed(-1000)), -0.8268795405320025, lsb));
+
+    assert(near(etl::cos(Fixed(0.5)), 0.8775825618903728, lsb));
+    assert(near(etl::cos(Fixed(1)), 0.5403023058681398, lsb));
+    assert(near(etl::cos(Fixed(2)), -0.4161468365471424, lsb));
+    assert(near(etl::cos(Fixed(3)), -0.9899924966004454, lsb));
+    assert(near(etl::cos(Fixed(-1)), 0.5403023058681398, lsb));
+    assert(near(etl::cos(Fixed(-4)), -0.6536436208636119, lsb));
+    assert(near(etl::cos(Fixed(100)), 0.8623188722876839, lsb));
+    assert(near(etl::cos(Fixed(-1000)), 0.5623790762907029, lsb));
+
+    // values of x are multiples of epsilon, pi/2 is not
+    auto const half_pi = Fixed(1.5707963267948966);
+    assert(near(etl::sin(half_pi), 1.0, lsb));
+    assert(near(etl::cos(half_pi), 0.0, lsb + 0.5));
+
+    // sin^2 + cos^2 == 1
+    for (auto i = -50; i <= 50; ++i) {
+        auto const x  = Fixed(i) / Fixed(7);
+        auto const s  = static_cast<double>(etl::sin(x));
+        auto const c  = static_cast<double>(etl::cos(x));
+        auto const e  = static_cast<double>(Fixed::epsilon());
+        auto const d  = s * s + c * c - 1.0;
+        assert(d <= 4.0 * lsb * e and d >= -4.0 * lsb * e);
+    }
+    return true;
+}
+
+constexpr auto test_saturate() -> bool
+{
+    // no integer bits, 1.0 is not representable
+    using q15 = etl::fixed_point<0, 15, etl::int16_t>;
+    assert(etl::sqrt(q15::max()) == q15::max());
+    assert(near(etl::sqrt(q15(0.25)), 0.5));
+    assert(etl::cos(q15(0)) == q15::max());
+    assert(near(etl::sin(q15(0.5)), 0.479425538604203));
+    assert(near(etl::sin(q15(-0.5)), -0.479425538604203));
+
+    // unsigned storage clamps negative results to zero
+    using uq8_8 = etl::fixed_point<8, 8, etl::uint16_t>;
+    assert(etl::sqrt(uq8_8(144)) == uq8_8(12));
+    assert(etl::sin(uq8_8(4)) == uq8_8(0));
+    assert(near(etl::sin(uq8_8(1)), 0.8414709848078965));
+    return true;
+}
+
+auto main() -> int
+{
+    using q16 = etl::fixed_point<15, 16, etl::int32_t>;
+    using q10 = etl::fixed_point<21, 10, etl::int32_t>;
+
+    assert(test_sqrt<q16>());
+    assert(test_sqrt<q10>());
+    assert(test_trig<q16>());
+    assert(test_trig<q10>());
+    assert(test_saturate());
+
+    static_assert(test_sqrt<q16>());
+    static_assert(test_sqrt<q10>());
+    static_assert(test_trig<q16>());
+    static_assert(test_trig<q10>());
+    static_assert(test_saturate());
+
+#if defined(__SIZEOF_INT128__)
+    using q32 = etl::fixed_point<31, 32, etl::int64_t>;
+    assert(test_sqrt<q32>());
+    assert(test_trig<q32>());
+    static_assert(test_sqrt<q32>());
+    static_assert(test_trig<q32>());
+#endif
+    return 0;
+}
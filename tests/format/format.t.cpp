@@ -45,6 +45,16 @@ auto test_ints() -> bool
 
 static auto test_all() -> bool
 {
+    {
+        auto str = etl::static_string<32> {};
+        etl::format_to(etl::back_inserter(str), "{} {}-{}", "abc", 'x', 42);
+        assert(str == "abc x-42"_sv);
+    }
+    {
+        char buf[16] {};
+        auto* const end = etl::format_to(buf, "[{}]", -7);
+        assert(etl::string_view(buf, end) == "[-7]"_sv);
+    }
 
     //     assert(test_ints<short>());
     //     assert(test_ints<int>());
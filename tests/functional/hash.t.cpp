@@ -4,7 +4,11 @@
 
 #include "etl/algorithm.hpp"
 #include "etl/array.hpp"
+#include "etl/cstddef.hpp"
 #include "etl/cstdint.hpp"
+#include "etl/span.hpp"
+#include "etl/string.hpp"
+#include "etl/string_view.hpp"
 #include "etl/type_traits.hpp"
 
 #include "testing/testing.hpp"
@@ -36,6 +40,84 @@ constexpr auto test() -> bool
     return true;
 }
 
+template <typename T>
+constexpr auto test_distribution() -> bool
+{
+    // Keys that only differ in their high bits must still spread over a
+    // power-of-two table.
+    auto buckets = etl::array<bool, 256> {};
+    for (auto i = 0; i < 256; ++i) {
+        auto const key = static_cast<T>(static_cast<etl::uint64_t>(i) << 8U);
+        buckets[etl::hash<T> {}(key) & 255U] = true;
+    }
+    assert(etl::count(buckets.begin(), buckets.end(), true) > 128);
+    return true;
+}
+
+constexpr auto test_floats() -> bool
+{
+    assert(etl::hash<float> {}(0.0F) == etl::hash<float> {}(-0.0F));
+    assert(etl::hash<double> {}(0.0) == etl::hash<double> {}(-0.0));
+    assert(etl::hash<double> {}(1.5) != etl::hash<double> {}(1.25));
+    assert(etl::hash<float> {}(1.5F) != etl::hash<float> {}(1.25F));
+    return true;
+}
+
+constexpr auto test_strings() -> bool
+{
+    using namespace etl::string_view_literals;
+    using sv_hash = etl::hash<etl::string_view>;
+
+    assert(sv_hash {}(""_sv) == sv_hash {}(etl::string_view {}));
+    assert(sv_hash {}("abc"_sv) == sv_hash {}("abc"_sv));
+    assert(sv_hash {}("abc"_sv) != sv_hash {}("abd"_sv));
+    assert(sv_hash {}("abc"_sv) != sv_hash {}("ab"_sv));
+    assert(sv_hash {}("a"_sv) != sv_hash {}("b"_sv));
+
+    // Exercise all input length classes
+    auto const text = "The quick brown fox jumps over the lazy dog, again and again and again."_sv;
+    auto const lengths = etl::array<etl::size_t, 12> { 1, 3, 4, 8, 15, 16, 17, 32, 48, 49, 64, 70 };
+    for (auto len : lengths) {
+        auto const a    = text.substr(0, len);
+        auto const b    = text.substr(1, len);
+        auto const copy = etl::static_string<80> { a };
+        assert(sv_hash {}(a) == etl::hash<etl::static_string<80>> {}(copy));
+        assert(sv_hash {}(a) != sv_hash {}(b));
+    }
+
+    auto const str = etl::static_string<32> { "command" };
+    assert(etl::hash<etl::static_string<32>> {}(str) == sv_hash {}("command"_sv));
+
+    using wide_hash = etl::hash<etl::basic_string_view<wchar_t>>;
+    assert(wide_hash {}(L"command") != 0);
+    assert(wide_hash {}(L"command") != wide_hash {}(L"comman"));
+    assert(wide_hash {}(L"command") != sv_hash {}("command"_sv));
+    return true;
+}
+
+constexpr auto test_spans() -> bool
+{
+    auto const bytes = etl::array { etl::byte { 'a' }, etl::byte { 'b' }, etl::byte { 'c' } };
+    auto const chars = etl::array<char, 3> { 'a', 'b', 'c' };
+    auto const hb    = etl::hash<etl::span<etl::byte const>> {}(etl::span<etl::byte const> { bytes });
+    auto const hc    = etl::hash<etl::span<char const>> {}(etl::span<char const> { chars });
+    assert(hb == hc);
+
+    auto const words = etl::array<etl::uint16_t, 2> { 0x6261, 0x0063 };
+    assert(etl::hash<etl::span<etl::uint16_t const, 2>> {}(etl::span { words }) != hb);
+    return true;
+}
+
+constexpr auto test_combine() -> bool
+{
+    auto const a = etl::hash_combine(etl::hash_combine(0, 1), 2);
+    auto const b = etl::hash_combine(etl::hash_combine(0, 2), 1);
+    assert(a != b);
+    assert(a == etl::hash_combine(etl::hash_combine(0, 1), 2));
+    assert(etl::hash_combine(0, 0) != 0);
+    return true;
+}
+
 constexpr auto test_all() -> bool
 {
     assert(test<char>());
@@ -51,6 +133,14 @@ constexpr auto test_all() -> bool
     assert(test<double>());
     assert(test<long double>());
 
+    assert(test_distribution<etl::uint32_t>());
+    assert(test_distribution<etl::uint64_t>());
+    assert(test_distribution<etl::int64_t>());
+    assert(test_floats());
+    assert(test_strings());
+    assert(test_spans());
+    assert(test_combine());
+
     return true;
 }
 
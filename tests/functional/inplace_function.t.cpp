@@ -74,7 +74,7 @@ auto test() -> bool
         empty(T {});
         assert(false);
     } catch (etl::bad_function_call const& e) {
-        assert(e.what() == "empty inplace_func_vtable"_sv);
+        assert(e.what() == "empty inplace_function"_sv);
     } catch (...) { // NOLINT
         assert(false);
     }
@@ -82,6 +82,69 @@ auto test() -> bool
     return true;
 }
 
+namespace {
+struct counted {
+    static inline int alive  = 0;
+    static inline int copies = 0;
+
+    counted() { ++alive; }
+    counted(counted const& /*other*/) { ++alive, ++copies; }
+    counted(counted&& /*other*/) noexcept { ++alive; }
+    auto operator=(counted const&) -> counted& = default;
+    auto operator=(counted&&) -> counted&      = default;
+    ~counted() { --alive; }
+
+    auto operator()(int x) const -> int { return x * 2; }
+};
+} // namespace
+
+static auto test_non_trivial() -> bool
+{
+    using func_t = etl::inplace_function<int(int), 16>;
+    {
+        auto func = func_t { counted {} };
+        assert(counted::alive == 1);
+        assert(func(21) == 42);
+
+        auto copy = func;
+        assert(counted::alive == 2);
+        assert(counted::copies == 1);
+        assert(copy(1) == 2);
+
+        auto moved = etl::move(copy);
+        assert(counted::alive == 2);
+        assert(!static_cast<bool>(copy));
+        assert(moved(2) == 4);
+
+        auto other = func_t { [](int x) { return x + 1; } };
+        other.swap(moved);
+        assert(counted::alive == 2);
+        assert(other(2) == 4);
+        assert(moved(2) == 3);
+
+        other = nullptr;
+        assert(counted::alive == 1);
+    }
+    assert(counted::alive == 0);
+    return true;
+}
+
+static auto test_layout() -> bool
+{
+    // table pointer + storage
+    static_assert(sizeof(etl::inplace_function<void(), 8>) == sizeof(void*) * 2);
+    static_assert(alignof(etl::inplace_function<void(), 8, 4>) == alignof(void*));
+    static_assert(etl::inplace_function<void(), 8, 4>::alignment::value == 4);
+    static_assert(etl::inplace_function<void(), 32, 16>::capacity::value == 32);
+
+    auto x    = 0;
+    auto func = etl::inplace_function<void(int), sizeof(void*), alignof(void*)> { [&x](int v) { x += v; } };
+    func(2);
+    func(3);
+    assert(x == 5);
+    return true;
+}
+
 static auto test_all() -> bool
 {
     assert(test<etl::int8_t>());
@@ -95,6 +158,8 @@ static auto test_all() -> bool
     assert(test<float>());
     assert(test<double>());
 
+    assert(test_non_trivial());
+    assert(test_layout());
     return true;
 }
 
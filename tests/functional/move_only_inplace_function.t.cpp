@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/functional.hpp"
+
+#include "etl/cstdint.hpp"
+#include "etl/utility.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+struct unique_handle {
+    static inline int alive = 0;
+
+    explicit unique_handle(int v) : value { v } { ++alive; }
+    unique_handle(unique_handle const&) = delete;
+    unique_handle(unique_handle&& other) noexcept : value { etl::exchange(other.value, 0) } { ++alive; }
+    auto operator=(unique_handle const&) -> unique_handle& = delete;
+    auto operator=(unique_handle&&) -> unique_handle&      = delete;
+    ~unique_handle() { --alive; }
+
+    int value;
+};
+} // namespace
+
+template <typename T>
+static auto test() -> bool
+{
+    using func_t = etl::move_only_inplace_function<T(T), sizeof(void*) * 2U>;
+
+    assert(!static_cast<bool>(func_t {}));
+    assert(!static_cast<bool>(func_t { nullptr }));
+
+    auto func = func_t { [](T x) { return x + T(1); } };
+    assert(static_cast<bool>(func));
+    assert(func != nullptr);
+    assert(func(T(41)) == T(42));
+
+    auto other = func_t {};
+    assert(other == nullptr);
+    swap(func, other);
+    assert(!static_cast<bool>(func));
+    assert(other(T(41)) == T(42));
+
+    func = etl::move(other);
+    assert(static_cast<bool>(func));
+    assert(!static_cast<bool>(other));
+    assert(func(T(1)) == T(2));
+
+    auto copyable = etl::inplace_function<T(T)> { [](T x) { return x + T(2); } };
+    auto bigger   = func_t { etl::move(copyable) };
+    assert(!static_cast<bool>(copyable));
+    assert(bigger(T(1)) == T(3));
+
+    func = nullptr;
+    assert(func == nullptr);
+    return true;
+}
+
+static auto test_move_only() -> bool
+{
+    using func_t = etl::move_only_inplace_function<int(), 16>;
+    static_assert(!etl::is_copy_constructible_v<func_t>);
+    static_assert(etl::is_nothrow_move_constructible_v<func_t>);
+    {
+        auto func = func_t { [h = unique_handle { 42 }] { return h.value; } };
+        assert(unique_handle::alive == 1);
+        assert(func() == 42);
+
+        auto moved = etl::move(func);
+        assert(unique_handle::alive == 1);
+        assert(!static_cast<bool>(func));
+        assert(moved() == 42);
+
+        auto other = func_t { [] { return 1; } };
+        moved.swap(other);
+        assert(unique_handle::alive == 1);
+        assert(moved() == 1);
+        assert(other() == 42);
+
+        auto bigger = etl::move_only_inplace_function<int(), 32> { etl::move(other) };
+        assert(bigger() == 42);
+
+        bigger = nullptr;
+        assert(unique_handle::alive == 0);
+    }
+    assert(unique_handle::alive == 0);
+    return true;
+}
+
+static auto test_all() -> bool
+{
+    assert(test<etl::int8_t>());
+    assert(test<etl::int16_t>());
+    assert(test<etl::int32_t>());
+    assert(test<etl::int64_t>());
+    assert(test<etl::uint8_t>());
+    assert(test<etl::uint16_t>());
+    assert(test<etl::uint32_t>());
+    assert(test<etl::uint64_t>());
+    assert(test<float>());
+    assert(test<double>());
+
+    assert(test_move_only());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
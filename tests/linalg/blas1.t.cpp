@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/linalg.hpp>
+
+#include <etl/cstdint.hpp>
+#include <etl/type_traits.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename T>
+constexpr auto test_blas1() -> bool
+{
+    T xs[4] { T(1), T(2), T(3), T(4) };
+    T ys[4] { T(4), T(3), T(2), T(1) };
+    T zs[4] {};
+
+    auto const x = etl::mdspan<T, etl::extents<int, 4>> { xs };
+    auto const y = etl::mdspan<T, etl::extents<int, 4>> { ys };
+    auto const z = etl::mdspan<T, etl::extents<int, 4>> { zs };
+    auto const d = etl::mdspan { &xs[0], 4 };
+
+    // add
+    etl::linalg::add(x, y, z);
+    assert(zs[0] == T(5));
+    assert(zs[3] == T(5));
+    etl::linalg::add(x, d, z);
+    assert(zs[1] == T(4));
+    assert(zs[2] == T(6));
+
+    // dot
+    assert(etl::linalg::dot(x, y) == T(20));
+    assert(etl::linalg::dot(x, d) == T(30));
+    assert(etl::linalg::dot(x, y, T(2)) == T(22));
+    assert(etl::linalg::dot(etl::mdspan { &xs[0], 0 }, etl::mdspan { &ys[0], 0 }) == T(0));
+
+    // scaled
+    auto const sx = etl::linalg::scaled(T(2), x);
+    static_assert(etl::is_const_v<typename decltype(sx)::element_type>);
+    assert(sx(0) == T(2));
+    assert(sx(3) == T(8));
+    assert(etl::linalg::dot(sx, y) == T(40));
+    etl::linalg::add(sx, x, z);
+    assert(zs[1] == T(6));
+
+    // vector_two_norm
+    T vs[2] { T(3), T(4) };
+    auto const v = etl::mdspan<T, etl::extents<int, 2>> { vs };
+    assert(etl::linalg::vector_two_norm(v) == T(5));
+    assert(etl::linalg::vector_two_norm(etl::linalg::scaled(T(2), v)) == T(10));
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_blas1<etl::int16_t>());
+    assert(test_blas1<etl::int32_t>());
+    assert(test_blas1<etl::int64_t>());
+    assert(test_blas1<float>());
+    assert(test_blas1<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
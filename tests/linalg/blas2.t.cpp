@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/linalg.hpp>
+
+#include <etl/cstdint.hpp>
+#include <etl/type_traits.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename T>
+constexpr auto test_blas2() -> bool
+{
+    // | 1 2 3 |
+    // | 4 5 6 |
+    T as[6] { T(1), T(2), T(3), T(4), T(5), T(6) };
+    T xs[3] { T(1), T(0), T(2) };
+    T ys[2] {};
+    T zs[2] { T(10), T(20) };
+
+    auto const a = etl::mdspan<T, etl::extents<int, 2, 3>> { as };
+    auto const x = etl::mdspan<T, etl::extents<int, 3>> { xs };
+    auto const y = etl::mdspan<T, etl::extents<int, 2>> { ys };
+    auto const z = etl::mdspan<T, etl::extents<int, 2>> { zs };
+
+    etl::linalg::matrix_vector_product(a, x, y);
+    assert(ys[0] == T(7));
+    assert(ys[1] == T(16));
+
+    etl::linalg::matrix_vector_product(a, x, z, y);
+    assert(ys[0] == T(17));
+    assert(ys[1] == T(36));
+
+    // y may alias z
+    etl::linalg::matrix_vector_product(a, x, y, y);
+    assert(ys[0] == T(24));
+    assert(ys[1] == T(52));
+
+    // dynamic extents
+    etl::linalg::matrix_vector_product(etl::mdspan { &as[0], 2, 3 }, etl::mdspan { &xs[0], 3 }, y);
+    assert(ys[0] == T(7));
+    assert(ys[1] == T(16));
+
+    // transposed
+    auto const at = etl::linalg::transposed(a);
+    static_assert(etl::is_same_v<typename decltype(at)::extents_type, etl::extents<int, 3, 2>>);
+    static_assert(etl::is_same_v<typename decltype(at)::layout_type, etl::layout_left>);
+    assert(at(2, 1) == T(6));
+    assert(at(1, 0) == T(2));
+    assert(etl::linalg::transposed(at)(1, 2) == T(6));
+
+    T us[3] {};
+    auto const u = etl::mdspan<T, etl::extents<int, 3>> { us };
+    etl::linalg::matrix_vector_product(at, z, u);
+    assert(us[0] == T(90));
+    assert(us[1] == T(120));
+    assert(us[2] == T(150));
+
+    // transposed and scaled
+    etl::linalg::matrix_vector_product(etl::linalg::scaled(T(2), at), z, u);
+    assert(us[0] == T(180));
+    assert(us[2] == T(300));
+
+    // transposed layout_stride
+    auto const col = etl::submdspan(a, etl::full_extent, etl::strided_slice { 0, 3, 2 });
+    auto const ct  = etl::linalg::transposed(col);
+    static_assert(etl::is_same_v<typename decltype(ct)::layout_type, etl::layout_stride>);
+    assert(ct(0, 1) == T(4));
+    assert(ct(1, 0) == T(3));
+    assert(ct(1, 1) == T(6));
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_blas2<etl::int16_t>());
+    assert(test_blas2<etl::int32_t>());
+    assert(test_blas2<etl::int64_t>());
+    assert(test_blas2<float>());
+    assert(test_blas2<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
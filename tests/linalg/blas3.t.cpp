@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/linalg.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename T, typename A, typename B>
+constexpr auto check_product(A a, B b, T const* c) -> bool
+{
+    for (auto i = 0; i < static_cast<int>(a.extent(0)); ++i) {
+        for (auto j = 0; j < static_cast<int>(b.extent(1)); ++j) {
+            auto expected = T(0);
+            for (auto k = 0; k < static_cast<int>(a.extent(1)); ++k) { expected += a(i, k) * b(k, j); }
+            if (c[i * static_cast<int>(b.extent(1)) + j] != expected) { return false; }
+        }
+    }
+    return true;
+}
+
+template <typename T, int M, int K, int N>
+constexpr auto test_static() -> bool
+{
+    auto as = etl::array<T, M * K> {};
+    auto bs = etl::array<T, K * N> {};
+    auto cs = etl::array<T, M * N> {};
+    for (auto i = 0; i < M * K; ++i) { as[static_cast<etl::size_t>(i)] = static_cast<T>(i % 7 - 3); }
+    for (auto i = 0; i < K * N; ++i) { bs[static_cast<etl::size_t>(i)] = static_cast<T>(i % 5 - 2); }
+
+    auto const a = etl::mdspan<T, etl::extents<int, M, K>> { as.data() };
+    auto const b = etl::mdspan<T, etl::extents<int, K, N>> { bs.data() };
+    auto const c = etl::mdspan<T, etl::extents<int, M, N>> { cs.data() };
+    etl::linalg::matrix_product(a, b, c);
+    assert(check_product(a, b, cs.data()));
+
+    // dynamic extents take the panel path
+    auto const ad = etl::mdspan { as.data(), M, K };
+    auto const bd = etl::mdspan { bs.data(), K, N };
+    auto const cd = etl::mdspan { cs.data(), M, N };
+    cs            = {};
+    etl::linalg::matrix_product(ad, bd, cd);
+    assert(check_product(ad, bd, cs.data()));
+
+    return true;
+}
+
+template <typename T>
+constexpr auto test_matrix_product() -> bool
+{
+    assert((test_static<T, 1, 1, 1>()));
+    assert((test_static<T, 2, 3, 4>()));
+    assert((test_static<T, 4, 4, 4>()));
+    assert((test_static<T, 8, 8, 8>()));
+    assert((test_static<T, 16, 16, 16>()));
+    assert((test_static<T, 3, 5, 19>()));
+
+    // A^T * B with scaled B
+    T as[6] { T(1), T(2), T(3), T(4), T(5), T(6) };
+    T bs[4] { T(1), T(0), T(0), T(1) };
+    T cs[9] {};
+    auto const a = etl::mdspan<T, etl::extents<int, 2, 3>> { as };
+    auto const b = etl::mdspan<T, etl::extents<int, 2, 2>> { bs };
+    auto const c = etl::mdspan<T, etl::extents<int, 3, 3>> { cs };
+    etl::linalg::matrix_product(etl::linalg::transposed(a), etl::linalg::scaled(T(2), a), c);
+    assert(cs[0] == T(34));
+    assert(cs[1] == T(44));
+    assert(cs[4] == T(58));
+    assert(cs[8] == T(90));
+
+    T ds[6] {};
+    auto const d = etl::mdspan<T, etl::extents<int, 2, 3>, etl::layout_left> { ds };
+    etl::linalg::matrix_product(b, a, d);
+    assert(ds[0] == T(1));
+    assert(ds[1] == T(4));
+    assert(ds[5] == T(6));
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_matrix_product<etl::int32_t>());
+    assert(test_matrix_product<etl::int64_t>());
+    assert(test_matrix_product<float>());
+    assert(test_matrix_product<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+
+    // split to stay below the constexpr operation limit
+    static_assert(test_matrix_product<etl::int32_t>());
+    static_assert(test_matrix_product<etl::int64_t>());
+    static_assert(test_matrix_product<float>());
+    static_assert(test_matrix_product<double>());
+    return 0;
+}
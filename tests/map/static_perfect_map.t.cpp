@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/map.hpp"
+
+#include "etl/algorithm.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/string_view.hpp"
+
+#include "testing/testing.hpp"
+
+using namespace etl::string_view_literals;
+
+constexpr auto test_string_keys() -> bool
+{
+    constexpr auto map = etl::make_static_perfect_map<etl::string_view, int>({
+        {   "start"_sv, 1},
+        {    "stop"_sv, 2},
+        {   "reset"_sv, 3},
+        {  "status"_sv, 4},
+        { "version"_sv, 5},
+        {    "help"_sv, 6},
+        {"shutdown"_sv, 7},
+    });
+
+    assert(map.size() == 7);
+    assert(map.max_size() == 7);
+    assert(!map.empty());
+
+    assert(map.find("start"_sv)->second == 1);
+    assert(map.find("stop"_sv)->second == 2);
+    assert(map.find("reset"_sv)->second == 3);
+    assert(map.find("status"_sv)->second == 4);
+    assert(map.find("version"_sv)->second == 5);
+    assert(map.find("help"_sv)->second == 6);
+    assert(map.find("shutdown"_sv)->second == 7);
+
+    assert(map.find("sta"_sv) == map.end());
+    assert(map.find(""_sv) == map.end());
+    assert(map.find("shutdown!"_sv) == map.end());
+    assert(!map.contains("HELP"_sv));
+    assert(map.contains("help"_sv));
+    assert(map.count("help"_sv) == 1);
+    assert(map.count("exit"_sv) == 0);
+
+    // iteration keeps the order of construction
+    assert(map.begin()->first == "start"_sv);
+    assert((map.end() - 1)->first == "shutdown"_sv);
+    assert(etl::distance(map.cbegin(), map.cend()) == 7);
+    return true;
+}
+
+constexpr auto test_integer_keys() -> bool
+{
+    using map_t    = etl::static_perfect_map<etl::uint16_t, char, 4>;
+    auto const map = map_t { {
+        {0x0100, 'a'},
+        {0x0200, 'b'},
+        {0x0400, 'c'},
+        {0x0800, 'd'},
+    } };
+
+    assert(map.find(0x0100)->second == 'a');
+    assert(map.find(0x0800)->second == 'd');
+    assert(!map.contains(0x0000));
+    assert(!map.contains(0x0101));
+    return true;
+}
+
+constexpr auto test_single() -> bool
+{
+    constexpr auto map = etl::make_static_perfect_map<etl::string_view, int>({
+        {"only"_sv, 42},
+    });
+    assert(map.find("only"_sv)->second == 42);
+    assert(!map.contains("other"_sv));
+    return true;
+}
+
+template <etl::size_t N>
+constexpr auto test_many() -> bool
+{
+    constexpr auto map = [] {
+        auto entries = etl::array<etl::pair<etl::uint32_t, etl::uint32_t>, N> {};
+        for (auto i = etl::uint32_t { 0 }; i < N; ++i) { entries[i] = { i * 4099U + 7U, i }; }
+
+        etl::pair<etl::uint32_t, etl::uint32_t> raw[N] {};
+        etl::copy(entries.begin(), entries.end(), etl::begin(raw));
+        return etl::static_perfect_map<etl::uint32_t, etl::uint32_t, N> { raw };
+    }();
+
+    for (auto i = etl::uint32_t { 0 }; i < N; ++i) {
+        assert(map.find(i * 4099U + 7U)->second == i);
+        assert(!map.contains(i * 4099U + 8U));
+    }
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_string_keys());
+    assert(test_integer_keys());
+    assert(test_single());
+    assert(test_many<3>());
+    assert(test_many<64>());
+    assert(test_many<200>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
@@ -37,6 +37,27 @@ constexpr auto test_extents() -> bool
     assert(eds2.rank() == 2);
     assert(eds2.rank_dynamic() == 1);
 
+    auto eds3 = etl::extents<SizeType, 2, etl::dynamic_extent, 4> { SizeType(3) };
+    assert(eds3.extent(0) == 2);
+    assert(eds3.extent(1) == 3);
+    assert(eds3.extent(2) == 4);
+    assert(eds3 == (etl::extents<SizeType, 2, 3, 4> {}));
+    assert(eds3 != (etl::extents<SizeType, 2, 2, 4> {}));
+    assert(eds3 == (etl::extents<SizeType, 2, etl::dynamic_extent, 4> { SizeType(2), SizeType(3), SizeType(4) }));
+    assert(eds3 == (etl::extents<SizeType, 2, etl::dynamic_extent, 4> { etl::array { SizeType(3) } }));
+
+    auto const dyn = etl::dextents<SizeType, 2> { SizeType(5), SizeType(6) };
+    assert(dyn.rank_dynamic() == 2);
+    assert(dyn.extent(0) == 5);
+    assert(dyn.extent(1) == 6);
+
+    auto const converted = etl::extents<SizeType, 5, etl::dynamic_extent> { dyn };
+    assert(converted.extent(0) == 5);
+    assert(converted.extent(1) == 6);
+
+    static_assert(sizeof(etl::extents<SizeType, 2, 4>) == 1);
+    static_assert(sizeof(etl::extents<SizeType, 2, etl::dynamic_extent>) == sizeof(SizeType));
+
     return true;
 }
 
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/mdspan.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename IndexType>
+constexpr auto test_layout_right() -> bool
+{
+    using extents_t = etl::extents<IndexType, 2, etl::dynamic_extent, 4>;
+    using mapping_t = etl::layout_right::mapping<extents_t>;
+
+    auto const m = mapping_t { extents_t { IndexType(3) } };
+    assert(m.required_span_size() == 24);
+    assert(m.stride(0) == 12);
+    assert(m.stride(1) == 4);
+    assert(m.stride(2) == 1);
+    assert(m(0, 0, 0) == 0);
+    assert(m(0, 0, 3) == 3);
+    assert(m(0, 1, 0) == 4);
+    assert(m(1, 2, 3) == 23);
+    assert(m.is_exhaustive());
+    assert(mapping_t::is_always_strided());
+
+    auto const s = etl::layout_right::mapping<etl::extents<IndexType, 2, 3, 4>> { m };
+    assert(s == m);
+    assert(s(1, 1, 1) == 17);
+
+    auto const scalar = etl::layout_right::mapping<etl::extents<IndexType>> {};
+    assert(scalar.required_span_size() == 1);
+    assert(scalar() == 0);
+
+    return true;
+}
+
+template <typename IndexType>
+constexpr auto test_layout_left() -> bool
+{
+    using extents_t = etl::extents<IndexType, 2, etl::dynamic_extent, 4>;
+    using mapping_t = etl::layout_left::mapping<extents_t>;
+
+    auto const m = mapping_t { extents_t { IndexType(3) } };
+    assert(m.required_span_size() == 24);
+    assert(m.stride(0) == 1);
+    assert(m.stride(1) == 2);
+    assert(m.stride(2) == 6);
+    assert(m(0, 0, 0) == 0);
+    assert(m(1, 0, 0) == 1);
+    assert(m(0, 1, 0) == 2);
+    assert(m(1, 2, 3) == 23);
+
+    // rank 1 layouts are interchangeable
+    auto const left  = etl::layout_left::mapping<etl::extents<IndexType, 5>> {};
+    auto const right = etl::layout_right::mapping<etl::extents<IndexType, 5>> { left };
+    assert(right(4) == left(4));
+
+    return true;
+}
+
+template <typename IndexType>
+constexpr auto test_layout_stride() -> bool
+{
+    using extents_t = etl::extents<IndexType, 2, 3>;
+    using mapping_t = etl::layout_stride::mapping<extents_t>;
+
+    auto const def = mapping_t {};
+    assert(def.stride(0) == 3);
+    assert(def.stride(1) == 1);
+    assert(def.is_exhaustive());
+
+    // every second column of a 2x6 row-major matrix
+    auto const m = mapping_t { extents_t {}, etl::array<IndexType, 2> { IndexType(6), IndexType(2) } };
+    assert(m(0, 0) == 0);
+    assert(m(0, 2) == 4);
+    assert(m(1, 1) == 8);
+    assert(m.required_span_size() == 11);
+    assert(not m.is_exhaustive());
+    assert(m.strides()[0] == 6);
+    assert(m.strides()[1] == 2);
+
+    auto const from_left = mapping_t { etl::layout_left::mapping<extents_t> {} };
+    assert(from_left.stride(0) == 1);
+    assert(from_left.stride(1) == 2);
+    assert(from_left == etl::layout_left::mapping<extents_t> {});
+    assert(from_left != m);
+
+    auto const back = etl::layout_right::mapping<extents_t> { def };
+    assert(back == def);
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_layout_right<etl::int16_t>());
+    assert(test_layout_right<etl::int32_t>());
+    assert(test_layout_right<etl::uint32_t>());
+    assert(test_layout_right<etl::size_t>());
+
+    assert(test_layout_left<etl::int16_t>());
+    assert(test_layout_left<etl::int32_t>());
+    assert(test_layout_left<etl::uint32_t>());
+    assert(test_layout_left<etl::size_t>());
+
+    assert(test_layout_stride<etl::int16_t>());
+    assert(test_layout_stride<etl::int32_t>());
+    assert(test_layout_stride<etl::uint32_t>());
+    assert(test_layout_stride<etl::size_t>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/mdspan.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/type_traits.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename T>
+constexpr auto test_mdspan() -> bool
+{
+    // static extents
+    {
+        T data[6] {};
+        auto m = etl::mdspan<T, etl::extents<int, 2, 3>> { data };
+        static_assert(sizeof(m) == sizeof(T*));
+        static_assert(decltype(m)::rank() == 2);
+        static_assert(decltype(m)::rank_dynamic() == 0);
+        assert(m.size() == 6);
+        assert(not m.empty());
+        assert(m.extent(0) == 2);
+        assert(m.extent(1) == 3);
+        assert(m.stride(0) == 3);
+        assert(m.stride(1) == 1);
+        assert(m.data_handle() == &data[0]);
+        assert(m.is_exhaustive());
+
+        for (auto i = 0; i < m.extent(0); ++i) {
+            for (auto j = 0; j < m.extent(1); ++j) { m(i, j) = static_cast<T>(i * 10 + j); }
+        }
+        assert(data[0] == T(0));
+        assert(data[2] == T(2));
+        assert(data[4] == T(11));
+        assert(m[etl::array { 1, 2 }] == T(12));
+    }
+
+    // dynamic extents
+    {
+        T data[12] {};
+        auto m = etl::mdspan { data, 3, 4 };
+        static_assert(etl::is_same_v<decltype(m), etl::mdspan<T, etl::dextents<etl::size_t, 2>>>);
+        assert(m.size() == 12);
+        assert(m.extent(0) == 3);
+        assert(m.extent(1) == 4);
+        m(2, 3) = T(42);
+        assert(data[11] == T(42));
+
+        auto const c = etl::mdspan<T const, etl::dextents<etl::size_t, 2>> { m };
+        assert(c(2, 3) == T(42));
+    }
+
+    // layout_left
+    {
+        T data[6] {};
+        auto m = etl::mdspan<T, etl::extents<int, 2, 3>, etl::layout_left> { data };
+        m(1, 0) = T(1);
+        m(0, 2) = T(2);
+        assert(data[1] == T(1));
+        assert(data[4] == T(2));
+    }
+
+    // layout_stride
+    {
+        T data[12] {};
+        using extents_t = etl::extents<int, 2, 3>;
+        auto const map  = etl::layout_stride::mapping<extents_t> { extents_t {}, etl::array { 6, 2 } };
+        auto m          = etl::mdspan { &data[0], map };
+        static_assert(etl::is_same_v<typename decltype(m)::layout_type, etl::layout_stride>);
+        m(1, 2) = T(3);
+        assert(data[10] == T(3));
+        assert(not m.is_exhaustive());
+    }
+
+    // rank 1 and 0
+    {
+        T data[4] { T(1), T(2), T(3), T(4) };
+        auto vec = etl::mdspan { data };
+        static_assert(decltype(vec)::rank() == 1);
+        assert(vec.size() == 4);
+        assert(vec[2] == T(3));
+        assert(vec(3) == T(4));
+
+        auto scalar = etl::mdspan<T, etl::extents<int>> { &data[1] };
+        assert(scalar.size() == 1);
+        assert(scalar() == T(2));
+    }
+
+    // swap
+    {
+        T a[2] { T(1), T(2) };
+        T b[3] { T(3), T(4), T(5) };
+        auto x = etl::mdspan { &a[0], 2 };
+        auto y = etl::mdspan { &b[0], 3 };
+        swap(x, y);
+        assert(x.extent(0) == 3);
+        assert(x(0) == T(3));
+        assert(y.extent(0) == 2);
+        assert(y(1) == T(2));
+    }
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_mdspan<char>());
+    assert(test_mdspan<etl::uint8_t>());
+    assert(test_mdspan<etl::int16_t>());
+    assert(test_mdspan<etl::int32_t>());
+    assert(test_mdspan<etl::uint64_t>());
+    assert(test_mdspan<float>());
+    assert(test_mdspan<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
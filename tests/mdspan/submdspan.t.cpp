@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/mdspan.hpp>
+
+#include <etl/cstdint.hpp>
+#include <etl/type_traits.hpp>
+#include <etl/utility.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename T>
+constexpr auto test_submdspan() -> bool
+{
+    T data[24] {};
+    for (auto i = 0; i < 24; ++i) { data[i] = static_cast<T>(i); }
+
+    auto const m = etl::mdspan<T, etl::extents<int, 2, 3, 4>> { data };
+
+    // all indices
+    {
+        auto const s = etl::submdspan(m, 1, 2, 3);
+        static_assert(decltype(s)::rank() == 0);
+        assert(s() == T(23));
+    }
+
+    // contiguous rows keep layout_right and the static extents
+    {
+        auto const s = etl::submdspan(m, 1, etl::full_extent, etl::full_extent);
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_right>);
+        static_assert(etl::is_same_v<typename decltype(s)::extents_type, etl::extents<int, 3, 4>>);
+        assert(s(0, 0) == T(12));
+        assert(s(2, 3) == T(23));
+    }
+
+    // a range in the leftmost kept rank keeps layout_right
+    {
+        auto const s = etl::submdspan(m, 0, etl::pair { 1, 3 }, etl::full_extent);
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_right>);
+        assert(s.extent(0) == 2);
+        assert(s.extent(1) == 4);
+        assert(s(0, 0) == T(4));
+        assert(s(1, 3) == T(11));
+    }
+
+    // a column is strided
+    {
+        auto const s = etl::submdspan(m, 1, etl::full_extent, 2);
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_stride>);
+        static_assert(etl::is_same_v<typename decltype(s)::extents_type, etl::extents<int, 3>>);
+        assert(s.stride(0) == 4);
+        assert(s(0) == T(14));
+        assert(s(2) == T(22));
+    }
+
+    // strided slices
+    {
+        auto const slice = etl::strided_slice { 1, 3, 2 };
+        auto const s     = etl::submdspan(m, etl::full_extent, 0, slice);
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_stride>);
+        assert(s.extent(0) == 2);
+        assert(s.extent(1) == 2);
+        assert(s.stride(0) == 12);
+        assert(s.stride(1) == 2);
+        assert(s(0, 0) == T(1));
+        assert(s(0, 1) == T(3));
+        assert(s(1, 1) == T(15));
+    }
+
+    // integral_constant extent and stride give a static extent
+    {
+        using two   = etl::integral_constant<int, 2>;
+        using three = etl::integral_constant<int, 3>;
+        auto const s = etl::submdspan(m, 1, 1, etl::strided_slice { 0, three {}, two {} });
+        static_assert(etl::is_same_v<typename decltype(s)::extents_type, etl::extents<int, 2>>);
+        assert(s(0) == T(16));
+        assert(s(1) == T(18));
+    }
+
+    // nested slices of a layout_stride mdspan
+    {
+        auto const col = etl::submdspan(m, etl::full_extent, etl::full_extent, 1);
+        auto const s   = etl::submdspan(col, 1, etl::pair { 1, 3 });
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_stride>);
+        assert(s.extent(0) == 2);
+        assert(s(0) == T(17));
+        assert(s(1) == T(21));
+    }
+
+    // layout_left keeps its layout for leading full slices
+    {
+        auto const left = etl::mdspan<T, etl::extents<int, 2, 3, 4>, etl::layout_left> { data };
+        auto const s    = etl::submdspan(left, etl::full_extent, etl::pair { 1, 3 }, 2);
+        static_assert(etl::is_same_v<typename decltype(s)::layout_type, etl::layout_left>);
+        assert(s(0, 0) == T(14));
+        assert(s(1, 1) == T(17));
+    }
+
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test_submdspan<etl::uint8_t>());
+    assert(test_submdspan<etl::int16_t>());
+    assert(test_submdspan<etl::int32_t>());
+    assert(test_submdspan<etl::uint64_t>());
+    assert(test_submdspan<float>());
+    assert(test_submdspan<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/memory.hpp"
+
+#include "etl/array.hpp"
+#include "etl/cstddef.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/type_traits.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+
+struct Counted {
+    constexpr explicit Counted(int v, int* destroyed) noexcept : value { v }, counter { destroyed } { }
+    constexpr Counted(Counted&& other) noexcept : value { other.value }, counter { other.counter } { }
+    constexpr ~Counted() noexcept { ++*counter; }
+
+    int value;
+    int* counter;
+};
+
+struct OptIn {
+    OptIn() = default;
+    OptIn(OptIn&& /*other*/) noexcept { } // NOLINT
+    ~OptIn() noexcept { }                 // NOLINT
+};
+
+} // namespace
+
+template <>
+struct etl::is_trivially_relocatable<OptIn> : etl::true_type { };
+
+template <typename T>
+constexpr auto test_trait() -> bool
+{
+    assert(etl::is_trivially_relocatable_v<T>);
+    assert(etl::is_trivially_relocatable_v<T const>);
+    assert(etl::is_trivially_relocatable_v<T[4]>);
+    assert(etl::is_trivially_relocatable_v<T*>);
+    assert(etl::is_trivially_relocatable_v<etl::array<T, 4>>);
+    return true;
+}
+
+template <typename T>
+auto test() -> bool
+{
+    assert(test_trait<T>());
+
+    {
+        T src { 42 };
+        T dest { 0 };
+        auto* result = etl::relocate_at(&src, &dest);
+        assert(result == &dest);
+        assert(dest == T(42));
+    }
+
+    {
+        auto src  = etl::array<T, 4> { T(1), T(2), T(3), T(4) };
+        auto dest = etl::array<T, 4> {};
+        auto* end = etl::uninitialized_relocate(src.begin(), src.end(), dest.begin());
+        assert(end == dest.end());
+        assert(dest == src);
+    }
+
+    {
+        // overlapping, shift towards the end
+        auto buf   = etl::array<T, 6> { T(1), T(2), T(3), T(4), T(0), T(0) };
+        auto* head = etl::uninitialized_relocate_backward(buf.begin(), buf.begin() + 4, buf.end());
+        assert(head == buf.begin() + 2);
+        assert(buf[2] == T(1));
+        assert(buf[3] == T(2));
+        assert(buf[4] == T(3));
+        assert(buf[5] == T(4));
+    }
+
+    {
+        // overlapping, shift towards the front
+        auto buf  = etl::array<T, 6> { T(0), T(0), T(1), T(2), T(3), T(4) };
+        auto* end = etl::uninitialized_relocate(buf.begin() + 2, buf.end(), buf.begin());
+        assert(end == buf.begin() + 4);
+        assert(buf[0] == T(1));
+        assert(buf[1] == T(2));
+        assert(buf[2] == T(3));
+        assert(buf[3] == T(4));
+    }
+
+    return true;
+}
+
+static auto test_non_trivial() -> bool
+{
+    assert(!(etl::is_trivially_relocatable_v<Counted>));
+    assert(etl::is_trivially_relocatable_v<OptIn>);
+    assert(etl::is_trivially_relocatable_v<OptIn const>);
+
+    auto destroyed = 0;
+
+    alignas(Counted) etl::byte src[sizeof(Counted) * 3];
+    alignas(Counted) etl::byte dest[sizeof(Counted) * 3];
+    auto* first = reinterpret_cast<Counted*>(&src[0]);
+    auto* out   = reinterpret_cast<Counted*>(&dest[0]);
+    for (auto i = 0; i < 3; ++i) { (void)etl::construct_at(first + i, i, &destroyed); }
+
+    auto* last = etl::uninitialized_relocate(first, first + 3, out);
+    assert(last == out + 3);
+    assert(destroyed == 3);
+    assert(out[0].value == 0);
+    assert(out[1].value == 1);
+    assert(out[2].value == 2);
+
+    auto* head = etl::uninitialized_relocate_backward(out, out + 3, first + 3);
+    assert(head == first);
+    assert(destroyed == 6);
+    assert(first[0].value == 0);
+    assert(first[2].value == 2);
+
+    etl::destroy(first, first + 3);
+    assert(destroyed == 9);
+    return true;
+}
+
+static auto test_all() -> bool
+{
+    assert(test<etl::int8_t>());
+    assert(test<etl::int16_t>());
+    assert(test<etl::int32_t>());
+    assert(test<etl::int64_t>());
+    assert(test<etl::uint8_t>());
+    assert(test<etl::uint16_t>());
+    assert(test<etl::uint32_t>());
+    assert(test<etl::uint64_t>());
+    assert(test<float>());
+    assert(test<double>());
+    assert(test_non_trivial());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    return 0;
+}
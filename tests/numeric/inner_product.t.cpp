@@ -23,8 +23,23 @@ constexpr auto test() -> bool
     return true;
 }
 
+// Each product is converted to the type of init on its own, like in
+// std::inner_product. Only pure integer ranges may be reordered.
+constexpr auto test_mixed() -> bool
+{
+    auto const a = etl::array { 1.5F, -0.5F, 1.5F, -0.5F, 1.5F, -0.5F, 1.5F, -0.5F };
+    auto const b = etl::array { 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F };
+    assert(etl::inner_product(a.data(), a.data() + a.size(), b.data(), 0) == 0);
+    assert(etl::inner_product(a.data(), a.data() + a.size(), b.data(), 0.0) == 4.0);
+
+    auto const c = etl::array<etl::int16_t, 9> { 300, 300, 300, 300, 300, 300, 300, 300, 300 };
+    assert(etl::inner_product(c.data(), c.data() + c.size(), c.data(), 0) == 810000);
+    return true;
+}
+
 constexpr auto test_all() -> bool
 {
+    assert(test_mixed());
     assert(test<etl::int8_t>());
     assert(test<etl::int16_t>());
     assert(test<etl::int32_t>());
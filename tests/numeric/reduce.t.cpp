@@ -15,11 +15,42 @@ constexpr auto test() -> bool
 
     auto func = [](T a, T b) { return static_cast<T>(a + (b * T { 2 })); };
     assert(etl::reduce(vec.begin(), vec.end(), T { 0 }, func) == T(20));
+
+    // Long enough for the unrolled and simd paths, odd size for the tail
+    auto data = etl::array<T, 103> {};
+    for (auto i = etl::size_t { 0 }; i < data.size(); ++i) { data[i] = static_cast<T>(i % 3); }
+    auto const sum = etl::accumulate(data.begin(), data.end(), T { 1 });
+    assert(etl::reduce(data.begin(), data.end(), T { 1 }) == sum);
+    assert(etl::reduce(data.begin(), data.end(), T { 1 }, etl::plus<T> {}) == sum);
+    assert(etl::reduce(data.begin(), data.end(), 1LL) == static_cast<long long>(sum));
+    assert(etl::reduce(data.data(), data.data() + 5) == T(4));
+    assert(etl::reduce(data.data(), data.data()) == T(0));
+
+    for (auto& x : data) { x = T(1); }
+    data[5]   = T(2);
+    data[63]  = T(3);
+    data[102] = T(2);
+    assert(etl::reduce(data.begin(), data.end(), T { 1 }, etl::multiplies<> {}) == T(12));
+    assert(etl::reduce(data.begin(), data.end(), T { 2 }, etl::multiplies<T> {}) == T(24));
+    return true;
+}
+
+// Mixed element and init types must give the same result at runtime and
+// during constant evaluation.
+constexpr auto test_mixed() -> bool
+{
+    auto const data = etl::array { 1.5F, -0.5F, 1.5F, -0.5F, 1.5F, -0.5F, 1.5F, -0.5F };
+    assert(etl::reduce(data.data(), data.data() + data.size(), 0) == 0);
+    assert(etl::reduce(data.data(), data.data() + data.size(), 0.0) == 4.0);
+
+    auto const bytes = etl::array<etl::uint8_t, 9> { 200, 200, 200, 200, 200, 200, 200, 200, 200 };
+    assert(etl::reduce(bytes.data(), bytes.data() + bytes.size(), 0) == 1800);
     return true;
 }
 
 constexpr auto test_all() -> bool
 {
+    assert(test_mixed());
     assert(test<etl::int8_t>());
     assert(test<etl::int16_t>());
     assert(test<etl::int32_t>());
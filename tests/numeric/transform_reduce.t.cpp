@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/numeric.hpp"
+
+#include "etl/array.hpp"
+#include "etl/functional.hpp"
+
+#include "testing/testing.hpp"
+
+template <typename T>
+constexpr auto test() -> bool
+{
+    etl::array a { T(0), T(1), T(2), T(3), T(4) };
+    etl::array b { T(5), T(4), T(2), T(3), T(1) };
+
+    assert(etl::transform_reduce(a.begin(), a.end(), b.begin(), T { 0 }) == T(21));
+    assert(etl::transform_reduce(a.begin(), a.end(), b.begin(), T { 1 }) == T(22));
+    assert(etl::transform_reduce(a.begin(), a.begin(), b.begin(), T { 7 }) == T(7));
+
+    auto const equal = etl::transform_reduce(a.begin(), a.end(), b.begin(), 0, etl::plus<> {}, etl::equal_to<T> {});
+    assert(equal == 2);
+
+    auto const twice = [](T x) { return static_cast<T>(x * T(2)); };
+    assert(etl::transform_reduce(a.begin(), a.end(), T { 0 }, etl::plus<> {}, twice) == T(20));
+    assert(etl::transform_reduce(a.begin() + 1, a.end(), T { 1 }, etl::multiplies<T> {}, twice) == T(48 * 8));
+
+    // Long enough for the unrolled and simd paths, odd size for the tail
+    auto x = etl::array<T, 77> {};
+    auto y = etl::array<T, 77> {};
+    for (auto i = etl::size_t { 0 }; i < x.size(); ++i) {
+        x[i] = static_cast<T>(i % 4);
+        y[i] = static_cast<T>(i % 3);
+    }
+
+    auto const dot = etl::inner_product(x.begin(), x.end(), y.begin(), T { 3 });
+    assert(etl::transform_reduce(x.begin(), x.end(), y.begin(), T { 3 }) == dot);
+    assert(etl::transform_reduce(x.data(), x.data() + x.size(), y.data(), T { 3 }) == dot);
+
+    auto const sum = etl::accumulate(x.begin(), x.end(), T { 0 });
+    auto const id  = [](T v) { return v; };
+    assert(etl::transform_reduce(x.begin(), x.end(), T { 0 }, etl::plus<> {}, id) == sum);
+    assert(etl::transform_reduce(x.begin(), x.end(), 0.0, etl::plus<> {}, id) == static_cast<double>(sum));
+    return true;
+}
+
+constexpr auto test_all() -> bool
+{
+    assert(test<etl::int8_t>());
+    assert(test<etl::int16_t>());
+    assert(test<etl::int32_t>());
+    assert(test<etl::int64_t>());
+    assert(test<etl::uint8_t>());
+    assert(test<etl::uint16_t>());
+    assert(test<etl::uint32_t>());
+    assert(test<etl::uint64_t>());
+    assert(test<float>());
+    assert(test<double>());
+
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_all());
+    return 0;
+}
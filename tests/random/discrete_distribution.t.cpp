@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/random.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename URNG, typename IntType>
+constexpr auto test_discrete_distribution(int samples) -> bool
+{
+    using dist_t = etl::discrete_distribution<IntType, 8>;
+
+    // default is a single outcome
+    {
+        auto urng = URNG { 42 };
+        auto dist = dist_t {};
+        assert(dist.min() == IntType(0));
+        assert(dist.max() == IntType(0));
+        assert(dist.probabilities().size() == 1);
+        assert(dist.probabilities()[0] == 1.0);
+        for (auto i = 0; i < 10; ++i) { assert(dist(urng) == IntType(0)); }
+    }
+
+    // weights are normalized
+    {
+        auto const weights = etl::array { 1.0, 2.0, 0.0, 5.0 };
+        auto dist          = dist_t { weights.begin(), weights.end() };
+        assert(dist.max() == IntType(3));
+
+        auto const p = dist.probabilities();
+        assert(p.size() == 4);
+        assert(p[0] == 0.125);
+        assert(p[1] == 0.25);
+        assert(p[2] == 0.0);
+        assert(p[3] == 0.625);
+
+        auto urng   = URNG { 42 };
+        int hits[4] = {};
+        for (auto i = 0; i < samples; ++i) {
+            auto const x = dist(urng);
+            assert(x >= IntType(0));
+            assert(x <= IntType(3));
+            ++hits[static_cast<int>(x)];
+        }
+
+        assert(hits[2] == 0);
+        auto const n   = static_cast<double>(samples);
+        auto const tol = 5.0 / etl::sqrt(n);
+        for (auto i = 0; i < 4; ++i) { assert(etl::abs(static_cast<double>(hits[i]) / n - p[i]) < tol); }
+    }
+
+    // weights from a function
+    {
+        auto dist = dist_t { 4, 0.0, 4.0, [](double x) { return x; } };
+        auto p    = dist.probabilities();
+        assert(p.size() == 4);
+        assert(etl::abs(p[0] - 0.0625) < 1e-12);
+        assert(etl::abs(p[3] - 0.4375) < 1e-12);
+    }
+
+    // all zero weights behave like a single weight
+    {
+        auto const weights = etl::array { 0.0, 0.0 };
+        auto dist          = dist_t { weights.begin(), weights.end() };
+        assert(dist == dist_t {});
+    }
+
+    return true;
+}
+
+template <typename URNG>
+constexpr auto test_urng(int samples) -> bool
+{
+    assert(test_discrete_distribution<URNG, int>(samples));
+    assert(test_discrete_distribution<URNG, unsigned char>(samples));
+    assert(test_discrete_distribution<URNG, long long>(samples));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_urng<etl::xorshift32>(100'000));
+    assert(test_urng<etl::xoshiro128plusplus>(100'000));
+    assert(test_urng<etl::xoshiro256plusplus>(100'000));
+
+    static_assert(test_urng<etl::xoshiro256plusplus>(1000));
+    static_assert(test_urng<etl::pcg32>(1000));
+    return 0;
+}
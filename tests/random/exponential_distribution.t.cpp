@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/random.hpp>
+
+#include <etl/cmath.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename URNG, typename RealType>
+constexpr auto test_exponential_distribution(int samples) -> bool
+{
+    using dist_t = etl::exponential_distribution<RealType>;
+
+    // parameters
+    {
+        auto dist = dist_t {};
+        assert(dist.lambda() == RealType(1));
+        assert(dist.min() == RealType(0));
+        assert(dist == dist_t(RealType(1)));
+        assert(not(dist == dist_t(RealType(2))));
+
+        dist.param(typename dist_t::param_type { RealType(4) });
+        assert(dist.lambda() == RealType(4));
+    }
+
+    // mean and variance are 1/lambda and 1/lambda^2
+    {
+        auto urng = URNG { 42 };
+        auto dist = dist_t { RealType(2) };
+
+        auto sum     = 0.0;
+        auto squares = 0.0;
+        for (auto i = 0; i < samples; ++i) {
+            auto const x = static_cast<double>(dist(urng));
+            assert(x >= 0.0);
+            assert(etl::isfinite(x));
+            sum += x;
+            squares += x * x;
+        }
+
+        auto const n        = static_cast<double>(samples);
+        auto const mean     = sum / n;
+        auto const variance = squares / n - mean * mean;
+        auto const tol      = 10.0 / etl::sqrt(n);
+        assert(etl::abs(mean - 0.5) < tol);
+        assert(etl::abs(variance - 0.25) < tol);
+    }
+
+    return true;
+}
+
+template <typename URNG>
+constexpr auto test_urng(int samples) -> bool
+{
+    assert(test_exponential_distribution<URNG, float>(samples));
+    assert(test_exponential_distribution<URNG, double>(samples));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_urng<etl::xorshift32>(100'000));
+    assert(test_urng<etl::xoshiro128plusplus>(100'000));
+    assert(test_urng<etl::xoshiro256plusplus>(100'000));
+    assert(test_urng<etl::pcg32>(100'000));
+
+    // tail beyond the base strip
+    {
+        auto urng   = etl::xoshiro256plusplus { 1 };
+        auto dist   = etl::exponential_distribution<double> {};
+        auto counts = 0;
+        for (auto i = 0; i < 1'000'000; ++i) { counts += static_cast<int>(dist(urng) > 5.0); }
+        // P(x > 5) = 0.0067379
+        assert(counts > 6400);
+        assert(counts < 7100);
+    }
+
+    static_assert(test_urng<etl::xoshiro256plusplus>(500));
+    static_assert(test_urng<etl::pcg32>(500));
+    return 0;
+}
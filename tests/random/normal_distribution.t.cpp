@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/random.hpp>
+
+#include <etl/cmath.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename URNG, typename RealType>
+constexpr auto test_normal_distribution(int samples) -> bool
+{
+    using dist_t = etl::normal_distribution<RealType>;
+
+    // parameters
+    {
+        auto dist = dist_t {};
+        assert(dist.mean() == RealType(0));
+        assert(dist.stddev() == RealType(1));
+        assert(dist == dist_t(RealType(0), RealType(1)));
+        assert(not(dist == dist_t(RealType(1), RealType(1))));
+
+        dist.param(typename dist_t::param_type { RealType(2), RealType(3) });
+        assert(dist.mean() == RealType(2));
+        assert(dist.stddev() == RealType(3));
+    }
+
+    // mean and variance
+    {
+        auto urng = URNG { 42 };
+        auto dist = dist_t { RealType(5), RealType(2) };
+
+        auto sum     = 0.0;
+        auto squares = 0.0;
+        for (auto i = 0; i < samples; ++i) {
+            auto const x = static_cast<double>(dist(urng));
+            assert(etl::isfinite(x));
+            sum += x;
+            squares += x * x;
+        }
+
+        auto const n        = static_cast<double>(samples);
+        auto const mean     = sum / n;
+        auto const variance = squares / n - mean * mean;
+        auto const tol      = 10.0 / etl::sqrt(n);
+        assert(etl::abs(mean - 5.0) < 2.0 * tol);
+        assert(etl::abs(variance - 4.0) < 8.0 * tol);
+    }
+
+    return true;
+}
+
+template <typename URNG>
+constexpr auto test_urng(int samples) -> bool
+{
+    assert(test_normal_distribution<URNG, float>(samples));
+    assert(test_normal_distribution<URNG, double>(samples));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_urng<etl::xorshift32>(100'000));
+    assert(test_urng<etl::xoshiro128plusplus>(100'000));
+    assert(test_urng<etl::xoshiro256plusplus>(100'000));
+    assert(test_urng<etl::pcg32>(100'000));
+
+    // tails on both sides
+    {
+        auto urng   = etl::xoshiro256plusplus { 1 };
+        auto dist   = etl::normal_distribution<double> {};
+        auto counts = 0;
+        auto lower  = false;
+        auto upper  = false;
+        for (auto i = 0; i < 1'000'000; ++i) {
+            auto const x = dist(urng);
+            counts += static_cast<int>(x > 3.0);
+            lower = lower or x < -3.7;
+            upper = upper or x > 3.7;
+        }
+        // P(x > 3) = 0.0013499
+        assert(counts > 1200);
+        assert(counts < 1500);
+        assert(lower);
+        assert(upper);
+    }
+
+    static_assert(test_urng<etl::xoshiro256plusplus>(500));
+    static_assert(test_urng<etl::pcg32>(500));
+    return 0;
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/random.hpp"
+
+#include "testing/testing.hpp"
+
+template <typename Engine>
+constexpr auto test_engine() -> bool
+{
+    using result_type = typename Engine::result_type;
+
+    assert(Engine::min() == 0);
+    assert(Engine::max() == result_type(-1));
+    assert(Engine() == Engine());
+    assert(Engine() != Engine(1));
+    assert(Engine(1, 1) != Engine(1, 2));
+
+    // seed
+    {
+        auto a = Engine { 42, 54 };
+        auto b = Engine {};
+        assert(a != b);
+        b.seed(42, 54);
+        assert(a == b);
+    }
+
+    // discard skips ahead
+    {
+        auto a = Engine { 42, 54 };
+        auto b = Engine { 42, 54 };
+        for (auto i = 0; i < 1000; ++i) { (void)a(); }
+        b.discard(1000);
+        assert(a == b);
+        assert(a() == b());
+    }
+
+    // different streams with the same seed differ
+    {
+        auto a = Engine { 42, 1 };
+        auto b = Engine { 42, 2 };
+        assert(a() != b());
+    }
+
+    return true;
+}
+
+constexpr auto test() -> bool
+{
+    assert(test_engine<etl::pcg32>());
+    assert(test_engine<etl::pcg64>());
+
+    // reference values of pcg32_srandom(42, 54)
+    {
+        auto rng = etl::pcg32 { 42, 54 };
+        assert(rng() == 0xA15C02B7U);
+        assert(rng() == 0x7B47F409U);
+        assert(rng() == 0xBA1D3330U);
+        assert(rng() == 0x83D2F293U);
+        assert(rng() == 0xBFA4784BU);
+        assert(rng() == 0xCBED606EU);
+    }
+
+    // reference values of pcg64_srandom(42, 54)
+    {
+        auto rng = etl::pcg64 { 42, 54 };
+        assert(rng() == 0x86B1DA1D72062B68ULL);
+        assert(rng() == 0x1304AA46C9853D39ULL);
+        assert(rng() == 0xA3670E9E0DD50358ULL);
+        assert(rng() == 0xF9090E529A7DAE00ULL);
+        assert(rng() == 0xC85B9FD837996F2CULL);
+        assert(rng() == 0x606121F8E3919196ULL);
+    }
+
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test());
+    static_assert(test());
+    return 0;
+}
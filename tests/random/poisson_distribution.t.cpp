@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include <etl/random.hpp>
+
+#include <etl/cmath.hpp>
+
+#include "testing/testing.hpp"
+
+template <typename URNG, typename IntType>
+constexpr auto test_poisson_distribution(double mean, int samples) -> bool
+{
+    using dist_t = etl::poisson_distribution<IntType>;
+
+    auto urng = URNG { 42 };
+    auto dist = dist_t { mean };
+    assert(dist.mean() == mean);
+    assert(dist.min() == IntType(0));
+
+    auto sum     = 0.0;
+    auto squares = 0.0;
+    for (auto i = 0; i < samples; ++i) {
+        auto const k = dist(urng);
+        assert(k >= IntType(0));
+        auto const x = static_cast<double>(k);
+        sum += x;
+        squares += x * x;
+    }
+
+    // mean and variance are both equal to the mean parameter
+    auto const n        = static_cast<double>(samples);
+    auto const m        = sum / n;
+    auto const variance = squares / n - m * m;
+    auto const tol      = 10.0 * etl::sqrt(mean / n) + 1e-9;
+    assert(etl::abs(m - mean) < tol);
+    assert(etl::abs(variance - mean) < 4.0 * tol * etl::sqrt(mean + 1.0));
+
+    return true;
+}
+
+constexpr auto test_param() -> bool
+{
+    using dist_t = etl::poisson_distribution<int>;
+
+    auto dist = dist_t {};
+    assert(dist.mean() == 1.0);
+    assert(dist == dist_t(1.0));
+    assert(not(dist == dist_t(2.0)));
+
+    dist.param(dist_t::param_type { 3.5 });
+    assert(dist.mean() == 3.5);
+
+    return true;
+}
+
+template <typename URNG>
+constexpr auto test_urng(int samples) -> bool
+{
+    // multiplication method
+    assert(test_poisson_distribution<URNG, int>(0.5, samples));
+    assert(test_poisson_distribution<URNG, long>(4.0, samples));
+    assert(test_poisson_distribution<URNG, unsigned>(11.9, samples));
+
+    // transformed rejection
+    assert(test_poisson_distribution<URNG, int>(12.0, samples));
+    assert(test_poisson_distribution<URNG, long long>(100.0, samples));
+    assert(test_poisson_distribution<URNG, int>(12345.0, samples));
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_param());
+    assert(test_urng<etl::xorshift32>(100'000));
+    assert(test_urng<etl::xoshiro128plusplus>(100'000));
+    assert(test_urng<etl::xoshiro256plusplus>(100'000));
+
+    static_assert(test_param());
+    static_assert(test_urng<etl::xoshiro256plusplus>(100));
+    return 0;
+}
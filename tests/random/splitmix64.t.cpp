@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/random.hpp"
+
+#include "testing/testing.hpp"
+
+constexpr auto test() -> bool
+{
+    using etl::splitmix64;
+
+    assert(splitmix64::min() == 0);
+    assert(splitmix64::max() == etl::uint64_t(-1));
+    assert(splitmix64::default_seed == 5489U);
+    assert(splitmix64() == splitmix64());
+    assert(splitmix64() != splitmix64(1));
+
+    // reference values
+    {
+        auto rng = splitmix64 { 0 };
+        assert(rng() == 0xE220A8397B1DCDAFULL);
+
+        rng.seed(42);
+        assert(rng() == 0xBDD732262FEB6E95ULL);
+        assert(rng() == 0x28EFE333B266F103ULL);
+        assert(rng() == 0x47526757130F9F52ULL);
+    }
+
+    // discard
+    {
+        auto a = splitmix64 { 42 };
+        auto b = splitmix64 { 42 };
+        for (auto i = 0; i < 100; ++i) { (void)a(); }
+        b.discard(100);
+        assert(a == b);
+        assert(a() == b());
+    }
+
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test());
+    static_assert(test());
+    return 0;
+}
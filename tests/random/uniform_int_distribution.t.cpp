@@ -2,6 +2,10 @@
 
 #include <etl/random.hpp>
 
+#include <etl/iterator.hpp>
+#include <etl/limits.hpp>
+#include <etl/type_traits.hpp>
+
 #include "testing/testing.hpp"
 
 template <typename URNG, typename IntType>
@@ -22,6 +26,111 @@ constexpr auto test_uniform_int_distribution() -> bool
     return true;
 }
 
+template <typename URNG, typename IntType>
+constexpr auto test_uniform_int_distribution_bounds() -> bool
+{
+    auto urng = URNG { 42 };
+
+    // a == b
+    {
+        auto dist = etl::uniform_int_distribution<IntType> { IntType(7), IntType(7) };
+        for (auto i { 0 }; i < 10; ++i) { assert(dist(urng) == IntType(7)); }
+    }
+
+    // closed interval, both bounds are reached
+    {
+        auto dist     = etl::uniform_int_distribution<IntType> { IntType(1), IntType(4) };
+        int counts[4] = {};
+        for (auto i { 0 }; i < 4000; ++i) {
+            auto const x = dist(urng);
+            assert(x >= IntType(1));
+            assert(x <= IntType(4));
+            ++counts[static_cast<int>(x) - 1];
+        }
+        for (auto const count : counts) {
+            assert(count > 800);
+            assert(count < 1200);
+        }
+    }
+
+    // negative bounds
+    if constexpr (etl::is_signed_v<IntType>) {
+        auto dist = etl::uniform_int_distribution<IntType> { IntType(-10), IntType(-3) };
+        for (auto i { 0 }; i < 100; ++i) {
+            auto const x = dist(urng);
+            assert(x >= IntType(-10));
+            assert(x <= IntType(-3));
+        }
+    }
+
+    // full range
+    {
+        using limits = etl::numeric_limits<IntType>;
+        auto dist    = etl::uniform_int_distribution<IntType> { limits::min(), limits::max() };
+        auto neg     = false;
+        auto pos     = false;
+        for (auto i { 0 }; i < 100; ++i) {
+            auto const x = dist(urng);
+            neg          = neg or x < IntType(0);
+            pos          = pos or x > IntType(0);
+        }
+        assert(pos);
+        assert(neg == etl::is_signed_v<IntType>);
+    }
+
+    // upper half of the range, needs all bits
+    {
+        constexpr auto maximum = etl::numeric_limits<IntType>::max();
+        constexpr auto minimum = static_cast<IntType>(maximum / 2);
+        auto dist              = etl::uniform_int_distribution<IntType> { minimum, maximum };
+        for (auto i { 0 }; i < 100; ++i) { assert(dist(urng) >= minimum); }
+    }
+
+    return true;
+}
+
+template <typename URNG, typename IntType>
+constexpr auto test_uniform_int_distribution_generate() -> bool
+{
+    auto urng = URNG { 42 };
+
+    {
+        auto dist       = etl::uniform_int_distribution<IntType> { IntType(0), IntType(9) };
+        IntType buf[64] = {};
+        bool seen[10]   = {};
+        dist.generate(etl::begin(buf), etl::end(buf), urng);
+        for (auto const x : buf) {
+            assert(x >= IntType(0));
+            assert(x <= IntType(9));
+            seen[static_cast<int>(x)] = true;
+        }
+        for (auto const s : seen) { assert(s); }
+    }
+
+    {
+        auto dist       = etl::uniform_int_distribution<IntType> {};
+        auto const parm = typename etl::uniform_int_distribution<IntType>::param_type { IntType(3), IntType(5) };
+        IntType buf[16] = {};
+        dist.generate(etl::begin(buf), etl::end(buf), urng, parm);
+        for (auto const x : buf) {
+            assert(x >= IntType(3));
+            assert(x <= IntType(5));
+        }
+    }
+
+    {
+        using limits    = etl::numeric_limits<IntType>;
+        auto dist       = etl::uniform_int_distribution<IntType> { limits::min(), limits::max() };
+        IntType buf[16] = {};
+        dist.generate(etl::begin(buf), etl::end(buf), urng);
+        auto all_zero = true;
+        for (auto const x : buf) { all_zero = all_zero and x == IntType(0); }
+        assert(not all_zero);
+    }
+
+    return true;
+}
+
 constexpr auto test() -> bool
 {
     assert(test_uniform_int_distribution<etl::xorshift32, short>());
@@ -54,9 +163,41 @@ constexpr auto test() -> bool
     return true;
 }
 
+template <typename URNG>
+constexpr auto test_urng() -> bool
+{
+    assert(test_uniform_int_distribution_bounds<URNG, signed char>());
+    assert(test_uniform_int_distribution_bounds<URNG, short>());
+    assert(test_uniform_int_distribution_bounds<URNG, int>());
+    assert(test_uniform_int_distribution_bounds<URNG, long long>());
+    assert(test_uniform_int_distribution_bounds<URNG, unsigned char>());
+    assert(test_uniform_int_distribution_bounds<URNG, unsigned short>());
+    assert(test_uniform_int_distribution_bounds<URNG, unsigned int>());
+    assert(test_uniform_int_distribution_bounds<URNG, unsigned long long>());
+
+    assert(test_uniform_int_distribution_generate<URNG, short>());
+    assert(test_uniform_int_distribution_generate<URNG, int>());
+    assert(test_uniform_int_distribution_generate<URNG, long long>());
+    assert(test_uniform_int_distribution_generate<URNG, unsigned int>());
+    assert(test_uniform_int_distribution_generate<URNG, unsigned long long>());
+    return true;
+}
+
 auto main() -> int
 {
     assert(test());
     static_assert(test());
+
+    // split to stay below the constexpr operation limit
+    assert(test_urng<etl::xorshift32>());
+    assert(test_urng<etl::xorshift64>());
+    assert(test_urng<etl::xoshiro128plusplus>());
+    assert(test_urng<etl::xoshiro256plusplus>());
+    assert(test_urng<etl::pcg32>());
+    static_assert(test_urng<etl::xorshift32>());
+    static_assert(test_urng<etl::xorshift64>());
+    static_assert(test_urng<etl::xoshiro128plusplus>());
+    static_assert(test_urng<etl::xoshiro256plusplus>());
+    static_assert(test_urng<etl::pcg32>());
     return 0;
 }
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/random.hpp"
+
+#include "etl/cstddef.hpp"
+#include "etl/iterator.hpp"
+
+#include "testing/testing.hpp"
+
+template <typename Engine>
+constexpr auto test_engine() -> bool
+{
+    assert(Engine::min() == 0);
+    assert(Engine::max() == etl::uint64_t(-1));
+    assert(Engine::default_seed == 5489U);
+    assert(Engine() == Engine());
+    assert(Engine() != Engine(1));
+
+    // seed
+    {
+        auto a = Engine { 42 };
+        auto b = Engine {};
+        assert(a != b);
+        b.seed(42);
+        assert(a == b);
+    }
+
+    // discard
+    {
+        auto a = Engine { 42 };
+        auto b = Engine { 42 };
+        for (auto i = 0; i < 100; ++i) { (void)a(); }
+        b.discard(100);
+        assert(a == b);
+        assert(a() == b());
+    }
+
+    // jump and long_jump create distinct streams
+    {
+        auto a = Engine { 42 };
+        auto b = a;
+        auto c = a;
+        b.jump();
+        c.long_jump();
+        assert(a != b);
+        assert(a != c);
+        assert(b != c);
+    }
+
+    return true;
+}
+
+constexpr auto test_xoshiro256plusplus() -> bool
+{
+    assert(test_engine<etl::xoshiro256plusplus>());
+
+    auto rng = etl::xoshiro256plusplus { 42 };
+    assert(rng() == 0xD0764D4F4476689FULL);
+    assert(rng() == 0x519E4174576F3791ULL);
+    assert(rng() == 0xFBE07CFB0C24ED8CULL);
+
+    rng.jump();
+    assert(rng() == 0xDD4B9019A605434DULL);
+    rng.long_jump();
+    assert(rng() == 0xC1054E7284F7A902ULL);
+
+    return true;
+}
+
+constexpr auto test_xoshiro256starstar() -> bool
+{
+    assert(test_engine<etl::xoshiro256starstar>());
+
+    auto rng = etl::xoshiro256starstar { 42 };
+    assert(rng() == 0x15780B2E0C2EC716ULL);
+    assert(rng() == 0x6104D9866D113A7EULL);
+    assert(rng() == 0xAE17533239E499A1ULL);
+
+    return true;
+}
+
+template <etl::size_t Lanes>
+constexpr auto test_lanes() -> bool
+{
+    using engine_t = etl::xoshiro256plusplus_lanes<Lanes>;
+
+    assert(engine_t::lanes == Lanes);
+    assert(engine_t() == engine_t());
+    assert(engine_t() != engine_t(1));
+
+    // lane i equals the scalar generator after i jumps
+    {
+        auto rng = engine_t { 42 };
+        auto a   = rng();
+        auto b   = rng();
+
+        auto scalar = etl::xoshiro256plusplus { 42 };
+        for (etl::size_t i = 0; i < Lanes; ++i) {
+            auto lane = scalar;
+            assert(a[i] == lane());
+            assert(b[i] == lane());
+            scalar.jump();
+        }
+    }
+
+    // generate
+    {
+        auto rng = engine_t { 42 };
+        auto ref = engine_t { 42 };
+
+        etl::uint64_t buf[Lanes * 2 + 1] {};
+        rng.generate(etl::begin(buf), etl::end(buf));
+
+        auto const first  = ref();
+        auto const second = ref();
+        auto const third  = ref();
+        for (etl::size_t i = 0; i < Lanes; ++i) {
+            assert(buf[i] == first[i]);
+            assert(buf[Lanes + i] == second[i]);
+        }
+        assert(buf[Lanes * 2] == third[0]);
+        assert(rng == ref);
+    }
+
+    // jump
+    {
+        auto a = engine_t { 42 };
+        auto b = a;
+        b.jump();
+        assert(a != b);
+        b.long_jump();
+        assert(a != b);
+    }
+
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_xoshiro256plusplus());
+    assert(test_xoshiro256starstar());
+    assert(test_lanes<1>());
+    assert(test_lanes<4>());
+    assert(test_lanes<8>());
+
+    // split to stay below the constexpr operation limit
+    static_assert(test_xoshiro256plusplus());
+    static_assert(test_xoshiro256starstar());
+    static_assert(test_lanes<1>());
+    static_assert(test_lanes<4>());
+    static_assert(test_lanes<8>());
+    return 0;
+}
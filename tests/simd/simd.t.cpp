@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/simd.hpp"
+
+#include "etl/cstdint.hpp"
+#include "etl/functional.hpp"
+#include "etl/type_traits.hpp"
+
+#include "testing/testing.hpp"
+
+template <typename T, typename Abi>
+constexpr auto test_simd() -> bool
+{
+    using simd_t = etl::simd<T, Abi>;
+    using mask_t = typename simd_t::mask_type;
+
+    assert((etl::is_same_v<typename simd_t::value_type, T>));
+    assert((etl::is_same_v<typename mask_t::value_type, bool>));
+    assert((etl::is_same_v<typename mask_t::simd_type, simd_t>));
+    assert(etl::is_simd_v<simd_t>);
+    assert(etl::is_simd_mask_v<mask_t>);
+    assert(not etl::is_simd_v<mask_t>);
+    assert(simd_t::size() == mask_t::size());
+    assert(simd_t::size() == etl::simd_size_v<T, Abi>);
+
+    constexpr auto n = simd_t::size();
+
+    // broadcast & generator
+    auto const twos = simd_t { T(2) };
+    auto const iota = simd_t { [](auto i) { return static_cast<T>(i); } };
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(twos[i] == T(2));
+        assert(iota[i] == static_cast<T>(i));
+    }
+
+    // arithmetic
+    auto const sum     = iota + twos;
+    auto const diff    = sum - iota;
+    auto const doubled = iota * twos;
+    auto const ratio   = doubled / twos;
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(sum[i] == static_cast<T>(i + 2));
+        assert(diff[i] == T(2));
+        assert(doubled[i] == static_cast<T>(i * 2));
+        assert(ratio[i] == static_cast<T>(i));
+    }
+
+    auto inc = iota;
+    inc += 1;
+    inc *= 3;
+    auto const old = inc++;
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(old[i] == static_cast<T>((i + 1) * 3));
+        assert(inc[i] == static_cast<T>((i + 1) * 3 + 1));
+    }
+    if constexpr (etl::is_signed_v<T>) {
+        auto const neg = -iota;
+        for (etl::size_t i = 0; i < n; ++i) { assert(neg[i] == static_cast<T>(-static_cast<T>(i))); }
+    }
+    if constexpr (etl::is_integral_v<T>) {
+        auto const bits = (iota | simd_t { T(1) }) & simd_t { T(3) };
+        auto const mod  = iota % twos;
+        auto const shl  = iota << simd_t { T(1) };
+        for (etl::size_t i = 0; i < n; ++i) {
+            assert(bits[i] == static_cast<T>((i | 1U) & 3U));
+            assert(mod[i] == static_cast<T>(i % 2));
+            assert(shl[i] == static_cast<T>(i * 2));
+        }
+    }
+
+    // comparisons & masks
+    auto const small = iota < twos;
+    for (etl::size_t i = 0; i < n; ++i) { assert(small[i] == (i < 2)); }
+    assert(etl::all_of(iota == iota));
+    assert(etl::none_of(iota != iota));
+    assert(etl::any_of(iota == simd_t { T(0) }));
+    assert(etl::popcount(iota >= simd_t { T(0) }) == static_cast<int>(n));
+    assert(etl::find_first_set(iota == simd_t { T(0) }) == 0);
+    assert(etl::find_last_set(iota >= simd_t { T(0) }) == static_cast<int>(n - 1));
+    assert(etl::popcount(small) == static_cast<int>(n < 2 ? n : 2));
+    assert(etl::some_of(small) == (n > 2));
+    assert(etl::all_of(mask_t { true }));
+    assert(etl::none_of(mask_t { false }));
+    assert(etl::none_of(!mask_t { true }));
+    assert(etl::all_of((small || !small) && mask_t { true }));
+    assert(etl::none_of(small ^ small));
+    assert(etl::all_of(small == small));
+
+    // min, max, clamp
+    auto const lo = etl::min(iota, twos);
+    auto const hi = etl::max(iota, twos);
+    auto const cl = etl::clamp(iota, simd_t { T(1) }, twos);
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(lo[i] == static_cast<T>(i < 2 ? i : 2));
+        assert(hi[i] == static_cast<T>(i > 2 ? i : 2));
+        assert(cl[i] == static_cast<T>(i < 1 ? 1 : (i > 2 ? 2 : i)));
+    }
+
+    // where
+    auto masked = iota;
+    etl::where(masked < twos, masked) = T(9);
+    for (etl::size_t i = 0; i < n; ++i) { assert(masked[i] == static_cast<T>(i < 2 ? 9 : i)); }
+    etl::where(iota < twos, masked) += T(1);
+    for (etl::size_t i = 0; i < n; ++i) { assert(masked[i] == static_cast<T>(i < 2 ? 10 : i)); }
+    // Lane 0 of the divisor is zero, but not selected.
+    etl::where(iota > twos, masked) /= iota;
+    ++etl::where(iota == simd_t { T(0) }, masked);
+    for (etl::size_t i = 0; i < n; ++i) {
+        auto const expected = i == 0 ? 11 : (i < 2 ? 10 : (i > 2 ? 1 : i));
+        assert(masked[i] == static_cast<T>(expected));
+    }
+
+    // reductions
+    auto expected = T(0);
+    for (etl::size_t i = 0; i < n; ++i) { expected = static_cast<T>(expected + static_cast<T>(i)); }
+    assert(etl::reduce(iota) == expected);
+    auto const factors = simd_t { [](auto i) { return T(i == 0 ? 2 : (i == 1 ? 3 : 1)); } };
+    assert(etl::reduce(factors, etl::multiplies()) == T(n > 1 ? 6 : 2));
+    assert(etl::reduce(etl::where(iota < twos, iota)) == static_cast<T>(n > 1 ? 1 : 0));
+    assert(etl::reduce(etl::where(mask_t { false }, iota), etl::multiplies()) == T(1));
+    auto const minOp = [](T a, T b) { return a < b ? a : b; };
+    assert(etl::reduce(etl::where(iota > twos, iota), T(100), minOp) == T(n > 3 ? 3 : 100));
+    assert(etl::hmin(iota) == T(0));
+    assert(etl::hmax(iota) == static_cast<T>(n - 1));
+    assert(etl::hmax(-twos) == T(-2) or not etl::is_signed_v<T>);
+
+    // loads & stores
+    T src[n] {};
+    for (etl::size_t i = 0; i < n; ++i) { src[i] = static_cast<T>(i * 3); }
+    auto loaded = simd_t { src, etl::element_aligned };
+    for (etl::size_t i = 0; i < n; ++i) { assert(loaded[i] == static_cast<T>(i * 3)); }
+
+    alignas(etl::memory_alignment_v<simd_t>) T dest[n] {};
+    loaded.copy_to(dest, etl::vector_aligned);
+    for (etl::size_t i = 0; i < n; ++i) { assert(dest[i] == src[i]); }
+
+    double wide[n] {};
+    iota.copy_to(wide, etl::element_aligned);
+    loaded.copy_from(wide, etl::element_aligned);
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(wide[i] == static_cast<double>(i));
+        assert(loaded[i] == static_cast<T>(i));
+    }
+
+    T out[n] {};
+    etl::where(iota >= twos, twos).copy_to(out, etl::element_aligned);
+    for (etl::size_t i = 0; i < n; ++i) { assert(out[i] == static_cast<T>(i >= 2 ? 2 : 0)); }
+    etl::where(iota < twos, loaded).copy_from(src, etl::element_aligned);
+    for (etl::size_t i = 0; i < n; ++i) { assert(loaded[i] == static_cast<T>(i < 2 ? i * 3 : i)); }
+
+    bool flags[n] {};
+    small.copy_to(flags, etl::element_aligned);
+    auto const reloaded = mask_t { flags, etl::element_aligned };
+    assert(etl::all_of(reloaded == small));
+
+    // casts
+    auto const fixed = etl::to_fixed_size(iota);
+    assert(fixed.size() == n);
+    auto const asDouble = etl::static_simd_cast<etl::fixed_size_simd<double, static_cast<int>(n)>>(iota);
+    auto const back     = etl::static_simd_cast<simd_t>(asDouble);
+    for (etl::size_t i = 0; i < n; ++i) {
+        assert(fixed[i] == iota[i]);
+        assert(asDouble[i] == static_cast<double>(i));
+        assert(back[i] == iota[i]);
+    }
+
+    return true;
+}
+
+template <typename T>
+constexpr auto test_abis() -> bool
+{
+    assert((test_simd<T, etl::simd_abi::scalar>()));
+    assert((test_simd<T, etl::simd_abi::compatible<T>>()));
+    assert((test_simd<T, etl::simd_abi::native<T>>()));
+    assert((test_simd<T, etl::simd_abi::fixed_size<3>>()));
+    assert((test_simd<T, etl::simd_abi::fixed_size<4>>()));
+    assert((test_simd<T, etl::simd_abi::fixed_size<16>>()));
+    // Not a power of two and wider than the vector registers, uses the array fallback.
+    assert((test_simd<T, etl::simd_abi::fixed_size<36>>()));
+    return true;
+}
+
+constexpr auto test_traits() -> bool
+{
+    assert(etl::simd_size_v<float, etl::simd_abi::scalar> == 1);
+    assert((etl::simd_size_v<float, etl::simd_abi::fixed_size<7>> == 7));
+    assert(etl::is_abi_tag_v<etl::simd_abi::scalar>);
+    assert(not etl::is_abi_tag_v<int>);
+    assert(etl::is_simd_flag_type_v<etl::vector_aligned_tag>);
+    assert(not etl::is_simd_flag_type_v<int>);
+    assert((etl::is_same_v<etl::simd_abi::deduce_t<float, 1>, etl::simd_abi::scalar>));
+    assert((etl::is_same_v<etl::simd_abi::deduce_t<float, 5>, etl::simd_abi::fixed_size<5>>));
+    assert((etl::is_same_v<etl::rebind_simd_t<int, etl::fixed_size_simd<float, 4>>, etl::fixed_size_simd<int, 4>>));
+    assert((etl::is_same_v<etl::resize_simd_t<8, etl::fixed_size_simd<float, 4>>, etl::fixed_size_simd<float, 8>>));
+    assert(etl::memory_alignment_v<etl::simd<float, etl::simd_abi::scalar>> == alignof(float));
+
+    // value-preserving broadcasts only
+    assert((etl::is_convertible_v<int, etl::simd<float>>));
+    assert((etl::is_convertible_v<float, etl::simd<double>>));
+    assert((not etl::is_convertible_v<double, etl::simd<float>>));
+    assert((not etl::is_convertible_v<long long, etl::simd<etl::int16_t>>));
+    return true;
+}
+
+static auto test_all() -> bool
+{
+    assert(test_traits());
+    assert(test_abis<etl::int8_t>());
+    assert(test_abis<etl::int16_t>());
+    assert(test_abis<etl::int32_t>());
+    assert(test_abis<etl::int64_t>());
+    assert(test_abis<etl::uint8_t>());
+    assert(test_abis<etl::uint16_t>());
+    assert(test_abis<etl::uint32_t>());
+    assert(test_abis<etl::uint64_t>());
+    assert(test_abis<float>());
+    assert(test_abis<double>());
+    return true;
+}
+
+auto main() -> int
+{
+    assert(test_all());
+    static_assert(test_traits());
+    static_assert(test_abis<etl::int32_t>());
+    static_assert(test_abis<float>());
+    return 0;
+}
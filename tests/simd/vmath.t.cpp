@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: BSL-1.0
+
+#include "etl/simd.hpp"
+
+#include "etl/array.hpp"
+#include "etl/bit.hpp"
+#include "etl/cmath.hpp"
+#include "etl/cstdint.hpp"
+#include "etl/limits.hpp"
+
+#include "testing/testing.hpp"
+
+namespace {
+
+constexpr auto count = 37;
+
+constexpr etl::vmath_accuracy accuracies[] = {etl::vmath_accuracy::precise, etl::vmath_accuracy::fast};
+
+constexpr auto ulp_distance(float a, float b) -> etl::int32_t
+{
+    auto const key = [](float x) {
+        auto const bits = etl::bit_cast<etl::int32_t>(x);
+        return bits < 0 ? -(bits & etl::numeric_limits<etl::int32_t>::max()) : bits;
+    };
+    auto const d = key(a) - key(b);
+    return d < 0 ? -d : d;
+}
+
+template <typename Func, typename Reference>
+constexpr auto check(float lo, float hi, Func func, Reference reference) -> bool
+{
+    auto in  = etl::array<float, count> {};
+    auto out = etl::array<float, count> {};
+    for (auto i = 0; i < count; ++i) { in[i] = lo + (hi - lo) * static_cast<float>(i) / (count - 1); }
+
+    for (auto accuracy : accuracies) {
+        func(in, out, accuracy);
+        for (auto i = 0; i < count; ++i) {
+            auto const expected = static_cast<float>(reference(static_cast<double>(in[i])));
+            assert(ulp_distance(out[i], expected) <= 2);
+        }
+    }
+    return true;
+}
+
+constexpr auto test_exp() -> bool
+{
+    auto const vexp = [](auto& in, auto& out, auto accuracy) { etl::vexp(in, out, accuracy); };
+    assert(check(-10.0F, 10.0F, vexp, [](double x) { return etl::exp(x); }));
+    assert(check(-87.0F, 88.0F, vexp, [](double x) { return etl::exp(x); }));
+    return true;
+}
+
+constexpr auto test_log() -> bool
+{
+    auto const vlog = [](auto& in, auto& out, auto accuracy) { etl::vlog(in, out, accuracy); };
+    assert(check(0.5F, 2.0F, vlog, [](double x) { return etl::log(x); }));
+    assert(check(1e-3F, 1e6F, vlog, [](double x) { return etl::log(x); }));
+    return true;
+}
+
+constexpr auto test_trig() -> bool
+{
+    auto const vsin = [](auto& in, auto& out, auto accuracy) { etl::vsin(in, out, accuracy); };
+    auto const vcos = [](auto& in, auto& out, auto accuracy) { etl::vcos(in, out, accuracy); };
+    assert(check(-3.0F, 3.0F, vsin, [](double x) { return etl::sin(x); }));
+    assert(check(-3.0F, 3.0F, vcos, [](double x) { return etl::cos(x); }));
+    assert(check(-100.0F, 90.0F, vsin, [](double x) { return etl::sin(x); }));
+    assert(check(-100.0F, 90.0F, vcos, [](double x) { return etl::cos(x); }));
+    return true;
+}
+
+constexpr auto test_in_place() -> bool
+{
+    auto data = etl::array<float, count> {};
+    for (auto i = 0; i < count; ++i) { data[i] = static_cast<float>(i + 1); }
+    etl::vlog(data, data);
+    etl::vexp(data, data);
+    for (auto i = 0; i < count; ++i) { assert(ulp_distance(data[i], static_cast<float>(i + 1)) <= 2); }
+    return true;
+}
+
+// overflow, infinities and NaN are not constant expressions
+auto test_special() -> bool
+{
+    constexpr auto inf = etl::numeric_limits<float>::infinity();
+    constexpr auto nan = etl::numeric_limits<float>::quiet_NaN();
+
+    for (auto accuracy : accuracies) {
+        auto in  = etl::array<float, 7> {0.0F, 100.0F, -200.0F, inf, -inf, nan, 0x1.0p-149F};
+        auto out = etl::array<float, 7> {};
+
+        etl::vexp(in, out, accuracy);
+        assert(out[0] == 1.0F);
+        assert(out[1] == inf);
+        assert(out[2] == 0.0F);
+        assert(out[3] == inf);
+        assert(out[4] == 0.0F);
+        assert(etl::isnan(out[5]));
+        assert(out[6] == 1.0F);
+
+        etl::vlog(in, out, accuracy);
+        assert(out[0] == -inf);
+        assert(ulp_distance(out[1], 0x1.26bb1cp+2F) <= 1);
+        assert(etl::isnan(out[2]));
+        assert(out[3] == inf);
+        assert(etl::isnan(out[4]));
+        assert(etl::isnan(out[5]));
+        assert(ulp_distance(out[6], -0x1.9d1da0p+6F) <= 1);
+
+        etl::vsin(in, out, accuracy);
+        assert(out[0] == 0.0F);
+        assert(etl::isnan(out[3]));
+        assert(etl::isnan(out[4]));
+        assert(etl::isnan(out[5]));
+        assert(out[6] == 0x1.0p-149F);
+
+        etl::vcos(in, out, accuracy);
+        assert(out[0] == 1.0F);
+        assert(etl::isnan(out[3]));
+        assert(etl::isnan(out[4]));
+        assert(etl::isnan(out[5]));
+        assert(out[6] == 1.0F);
+    }
+    return true;
+}
+
+} // namespace
+
+auto main() -> int
+{
+    assert(test_exp());
+    assert(test_log());
+    assert(test_trig());
+    assert(test_in_place());
+    assert(test_special());
+
+    static_assert(test_exp());
+    static_assert(test_log());
+    static_assert(test_trig());
+    static_assert(test_in_place());
+    return 0;
+}
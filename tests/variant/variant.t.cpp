@@ -178,9 +178,9 @@ static auto test() -> bool
         auto var2 = variant<monostate, int, float> { 143 };
         assert((etl::holds_alternative<int>(var2)));
         assert((*etl::get_if<int>(&var2) == 143));
-        // var2 = var;
-        // assert((etl::holds_alternative<int>(var2)));
-        // assert((*etl::get_if<int>(&var2) == 42));
+        var2 = var;
+        assert((etl::holds_alternative<int>(var2)));
+        assert((*etl::get_if<int>(&var2) == 42));
 
         // var = 42.0F;
         // assert((etl::holds_alternative<float>(var)));
@@ -200,8 +200,21 @@ static auto test() -> bool
 
         auto other = variant<int, float> { 999.0F };
         etl::swap(l, other);
-        assert((etl::holds_alternative<int>(l)));
-        assert((etl::holds_alternative<float>(other)));
+        assert((etl::holds_alternative<float>(l)));
+        assert((etl::holds_alternative<int>(other)));
+        assert((*etl::get_if<float>(&l) == 999.0F));
+        assert((*etl::get_if<int>(&other) == 143));
+    }
+
+    {
+        assert((etl::is_trivially_relocatable_v<variant<int, float>>));
+        assert((etl::is_trivially_relocatable_v<variant<monostate, uint8_t, uint64_t>>));
+
+        struct NonRelocatable {
+            NonRelocatable() = default;
+            NonRelocatable(NonRelocatable&& /*other*/) { } // NOLINT
+        };
+        assert(!(etl::is_trivially_relocatable_v<variant<int, NonRelocatable>>));
     }
 
     {
@@ -345,6 +358,166 @@ static auto test() -> bool
             assert(calledT);
             assert(!calledFloat);
         }
+
+        {
+            // multiple variants
+            auto const a = variant<int, float> { 2.0F };
+            auto const b = variant<monostate, int, double> { 3 };
+            auto const c = variant<int, float> { 4 };
+
+            auto sum = [](auto const&... vals) -> double {
+                auto value = [](auto const& v) -> double {
+                    if constexpr (etl::is_same_v<decltype(v), monostate const&>) {
+                        return 0.0;
+                    } else {
+                        return static_cast<double>(v);
+                    }
+                };
+                return (value(vals) + ...);
+            };
+            assert((etl::visit(sum, a, b) == 5.0));
+            assert((etl::visit(sum, a, b, c) == 9.0));
+            assert((etl::visit(sum, b, variant<monostate, int, double> {}) == 3.0));
+
+            auto which = [](auto const& x, auto const& y) -> int {
+                return etl::is_same_v<decltype(x), float const&> && etl::is_same_v<decltype(y), int const&>;
+            };
+            assert((etl::visit(which, a, c) == 1));
+            assert((etl::visit(which, c, a) == 0));
+        }
+
+        {
+            // value category is forwarded
+            auto v        = variant<int, float> { 42 };
+            auto category = [](auto&& val) -> int { return etl::is_rvalue_reference_v<decltype(val)> ? 1 : 0; };
+            assert((etl::visit(category, v) == 0));
+            assert((etl::visit(category, etl::move(v)) == 1));
+
+            etl::visit([](auto& val) { val += 1; }, v);
+            assert((*etl::get_if<int>(&v) == 43));
+        }
+
+        {
+            // large variant
+            using large_t = variant<char, signed char, unsigned char, short, unsigned short, int, unsigned, long,
+                unsigned long, long long, unsigned long long, float, double, long double, monostate, char const*,
+                void const*, bool, char16_t, char32_t>;
+            assert((etl::variant_size_v<large_t> == 20));
+            assert((sizeof(large_t) == sizeof(long double) + alignof(long double)));
+
+            auto v = large_t { 143.0 };
+            assert((v.index() == 12));
+            assert((etl::visit([](auto const& val) { return sizeof(val); }, v) == sizeof(double)));
+
+            auto ul = large_t { 42UL };
+            assert((ul.index() == 8));
+            assert((etl::visit([](auto const& val) { return sizeof(val); }, ul) == sizeof(unsigned long)));
+        }
+    }
+
+    {
+        // copy & move dispatch to the held alternative
+        struct Counter {
+            explicit Counter(int* c) : copies { c } { }
+            Counter(Counter const& other) : copies { other.copies } { ++*copies; }
+            Counter(Counter&& other) noexcept : copies { other.copies } { }
+            auto operator=(Counter const& other) -> Counter& = default;
+            ~Counter() { } // NOLINT
+            int* copies;
+        };
+
+        auto copies = 0;
+        auto a      = variant<int, Counter> { Counter { &copies } };
+        auto b      = a;
+        assert((copies == 1));
+        assert((etl::holds_alternative<Counter>(b)));
+
+        auto c = etl::move(b);
+        assert((copies == 1));
+        assert((etl::holds_alternative<Counter>(c)));
+
+        auto d = variant<int, Counter> { 42 };
+        d      = a;
+        assert((copies == 2));
+        assert((etl::holds_alternative<Counter>(d)));
+
+        d = variant<int, Counter> { 143 };
+        assert((*etl::get_if<int>(&d) == 143));
+    }
+
+    {
+        // copy assignment keeps the held value if the copy throws
+        struct Tracked {
+            explicit Tracked(int* a, bool t = false) : alive { a }, throws { t } { ++*alive; }
+            Tracked(Tracked const& other) : alive { other.alive }, throws { other.throws }
+            {
+#if defined(__cpp_exceptions)
+                if (throws) { throw 42; }
+#endif
+                ++*alive;
+            }
+            Tracked(Tracked&& other) noexcept : alive { other.alive }, throws { other.throws } { ++*alive; }
+            auto operator=(Tracked const& other) -> Tracked& = default;
+            ~Tracked() { --*alive; }
+            int* alive;
+            bool throws;
+        };
+
+        auto alive = 0;
+        {
+            auto a = variant<int, Tracked> { 42 };
+            auto b = variant<int, Tracked> { Tracked { &alive } };
+            assert((alive == 1));
+
+            a = b;
+            assert((alive == 2));
+            assert((etl::holds_alternative<Tracked>(a)));
+
+            // the same alternative is copy assigned
+            a = b;
+            assert((alive == 2));
+
+            a = variant<int, Tracked> { 143 };
+            assert((alive == 1));
+
+#if defined(__cpp_exceptions)
+            auto c = variant<int, Tracked> { Tracked { &alive, true } };
+            assert((alive == 2));
+            try {
+                a = c;
+                assert(false);
+            } catch (int) {
+                assert((*etl::get_if<int>(&a) == 143));
+            }
+            assert((alive == 2));
+#endif
+        }
+        assert((alive == 0));
+
+        struct ThrowingMove {
+            ThrowingMove() = default;
+            ThrowingMove(ThrowingMove const& /*other*/) { }
+            ThrowingMove(ThrowingMove&& /*other*/) noexcept(false) { }
+            auto operator=(ThrowingMove const& /*other*/) -> ThrowingMove& = default;
+        };
+        assert((etl::is_copy_assignable_v<variant<int, Tracked>>));
+        assert(!(etl::is_copy_assignable_v<variant<int, ThrowingMove>>));
+    }
+
+    {
+        // converting constructor selects via overload resolution for non-exact types
+        struct Explicit {
+            explicit Explicit(int /*ignore*/) { }
+        };
+        auto v = variant<monostate, Explicit, long> { 42 };
+        assert((v.index() == 2));
+
+        assert((etl::is_trivially_destructible_v<variant<monostate, int, float>>));
+
+        struct NonTrivial {
+            ~NonTrivial() { } // NOLINT
+        };
+        assert(!(etl::is_trivially_destructible_v<variant<monostate, NonTrivial>>));
     }
 
     return true;
@@ -30,6 +30,24 @@ template <typename T>
     return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z);
 }
 
+struct Relocatable {
+    static inline int moves = 0;
+
+    explicit Relocatable(int v) noexcept : value { v } { }
+    Relocatable(Relocatable const& other) noexcept : value { other.value } { }
+    Relocatable(Relocatable&& other) noexcept : value { other.value } { ++moves; }
+    auto operator=(Relocatable const& other) noexcept -> Relocatable& = default;
+    auto operator=(Relocatable&& other) noexcept -> Relocatable&
+    {
+        value = other.value;
+        ++moves;
+        return *this;
+    }
+    ~Relocatable() noexcept { } // NOLINT
+
+    int value;
+};
+
 // template <typename T>
 // [[nodiscard]] constexpr auto operator!=(
 //     Vertex<T> const& lhs, Vertex<T> const& rhs) -> bool
@@ -39,6 +57,9 @@ template <typename T>
 
 } // namespace
 
+template <>
+struct etl::is_trivially_relocatable<Relocatable> : etl::true_type { };
+
 template <typename T>
 constexpr auto test_cx() -> bool
 {
@@ -516,8 +537,66 @@ constexpr auto test_all_cx() -> bool
     return true;
 }
 
+static auto test_relocatable() -> bool
+{
+    using vec_t = static_vector<Relocatable, 8>;
+    assert(etl::is_trivially_relocatable_v<vec_t>);
+    assert((etl::is_trivially_relocatable_v<static_vector<static_vector<int, 2>, 2>>));
+
+    auto values = [](vec_t const& v) {
+        auto result = 0;
+        for (auto const& r : v) { result = result * 10 + r.value; }
+        return result;
+    };
+
+    auto vec = vec_t {};
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+    vec.emplace_back(3);
+    Relocatable::moves = 0;
+
+    // insert single copy
+    vec.insert(vec.begin(), Relocatable { 4 });
+    assert(values(vec) == 4123);
+
+    // insert n copies of an element already in the vector
+    vec.insert(vec.begin() + 1, 2, vec[2]);
+    assert(values(vec) == 422123);
+
+    // insert range
+    auto const src = etl::array { Relocatable { 8 }, Relocatable { 9 } };
+    vec.insert(vec.end() - 1, src.begin(), src.end());
+    assert(values(vec) == 42212893);
+    assert(vec.full());
+
+    // erase relocates the tail, even without a default constructor
+    static_assert(not etl::is_default_constructible_v<Relocatable>);
+    Relocatable::moves = 0;
+    vec.erase(vec.begin() + 1, vec.begin() + 4);
+    assert(values(vec) == 42893);
+    vec.erase(vec.begin());
+    assert(values(vec) == 2893);
+    assert(Relocatable::moves == 0);
+
+    // swap
+    auto other = vec_t {};
+    other.emplace_back(7);
+    vec.swap(other);
+    assert(values(vec) == 7);
+    assert(values(other) == 2893);
+
+    // move_insert only moves the inserted element, shifting relocates
+    Relocatable::moves = 0;
+    vec.insert(vec.begin(), Relocatable { 5 });
+    assert(values(vec) == 57);
+    assert(Relocatable::moves == 1);
+
+    return true;
+}
+
 static auto test_all_runtime() -> bool
 {
+    assert(test_relocatable());
     assert(test_runtime<etl::int8_t>());
     assert(test_runtime<etl::int16_t>());
     assert(test_runtime<etl::int32_t>());